@@ -18,9 +18,7 @@ public:
     void onHealthChanged(const BattleEvents::HealthChangeEvent& event) override {
         std::cout << "[LOG] " << event.pokemon->name << " health changed from " 
                   << event.oldHealth << " to " << event.newHealth;
-        if (!event.source.empty()) {
-            std::cout << " (source: " << event.source << ")";
-        }
+        std::cout << " (source: " << BattleEvents::getSourceName(event.source) << ")";
         std::cout << std::endl;
     }
 
@@ -87,10 +85,10 @@ void demonstrateBattleEvents() {
     eventManager->notifyBattleStart(battleStart);
     
     // Simulate some health changes
-    auto healthEvent1 = eventManager->createHealthChangeEvent(&pikachu, 100, 85, "move");
+    auto healthEvent1 = eventManager->createHealthChangeEvent(&pikachu, 100, 85, BattleEvents::EventSource::MOVE);
     eventManager->notifyHealthChanged(healthEvent1);
     
-    auto healthEvent2 = eventManager->createHealthChangeEvent(&charizard, 120, 95, "move");
+    auto healthEvent2 = eventManager->createHealthChangeEvent(&charizard, 120, 95, BattleEvents::EventSource::MOVE);
     eventManager->notifyHealthChanged(healthEvent2);
     
     // Simulate move usage
@@ -114,7 +112,7 @@ void showBattleIntegration() {
     
     std::cout << "\n2. Add event notifications in battle methods:" << std::endl;
     std::cout << "   // In damage calculation method:" << std::endl;
-    std::cout << "   auto event = eventManager_->createHealthChangeEvent(pokemon, oldHp, newHp, \"move\");" << std::endl;
+    std::cout << "   auto event = eventManager_->createHealthChangeEvent(pokemon, oldHp, newHp, BattleEvents::EventSource::MOVE);" << std::endl;
     std::cout << "   eventManager_->notifyHealthChanged(event);" << std::endl;
     
     std::cout << "\n3. Allow external listeners:" << std::endl;
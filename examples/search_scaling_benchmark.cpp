@@ -0,0 +1,115 @@
+/**
+ * @file search_scaling_benchmark.cpp
+ * @brief Measures ExpertAI parallel search throughput at increasing thread counts
+ *
+ * Runs a budgeted iterative deepening search from a fixed six-on-six position
+ * with 1, 2, 4, 8 and 16 workers, in both Lazy SMP and reproducible
+ * (root-split) modes, and reports nodes/sec, completed depth and speedup over
+ * the single-threaded run.
+ *
+ * Usage: search_benchmark [budget_ms]   (default 1000)
+ */
+
+#include "expert_ai.h"
+#include "pokemon.h"
+#include "team.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+Move makeMove(const std::string& name, int power, const std::string& type,
+              const std::string& damage_class) {
+    MoveDef def;
+    def.name = name;
+    def.power = power;
+    def.accuracy = 100;
+    def.pp = 16;
+    def.type = type;
+    parseDamageClass(damage_class, def.damage_class);
+    def.ailment_name = "none";
+    return Move(def);
+}
+
+Pokemon makePokemon(const std::string& name, int hp, int attack, int defense,
+                    int special_attack, int special_defense, int speed,
+                    const std::string& type) {
+    Pokemon pokemon;
+    pokemon.name = name;
+    pokemon.hp = hp;
+    pokemon.current_hp = hp;
+    pokemon.attack = attack;
+    pokemon.defense = defense;
+    pokemon.special_attack = special_attack;
+    pokemon.special_defense = special_defense;
+    pokemon.speed = speed;
+    pokemon.types = {type};
+    pokemon.moves = {makeMove(name + "-strike", 80, type, "physical"),
+                     makeMove(name + "-beam", 90, type, "special"),
+                     makeMove("tackle", 40, "normal", "physical"),
+                     makeMove("swift", 60, "normal", "special")};
+    return pokemon;
+}
+
+Team makeTeam(const std::vector<std::string>& types, int offset) {
+    Team team;
+    for (size_t i = 0; i < types.size(); ++i) {
+        int base = 70 + static_cast<int>((i * 7 + offset) % 30);
+        team.addPokemon(makePokemon(types[i] + std::to_string(offset), base + 30, base,
+                                    base - 5, base + 5, base, base + 10, types[i]));
+    }
+    return team;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int budget_ms = argc > 1 ? std::max(1, std::atoi(argv[1])) : 1000;
+
+    Team ai_team = makeTeam({"fire", "water", "grass", "electric", "rock", "ice"}, 0);
+    Team opponent_team = makeTeam({"water", "grass", "fire", "ground", "flying", "steel"}, 3);
+    BattleState state{ai_team.getPokemon(0), opponent_team.getPokemon(0), &ai_team,
+                      &opponent_team,        WeatherCondition::NONE,       0,
+                      1};
+
+    std::cout << "ExpertAI search scaling, " << budget_ms << " ms per search, "
+              << std::thread::hardware_concurrency() << " hardware threads\n\n";
+
+    for (bool reproducible : {false, true}) {
+        std::cout << (reproducible ? "Reproducible (root split)" : "Lazy SMP") << "\n";
+        std::cout << std::setw(8) << "threads" << std::setw(14) << "nodes" << std::setw(14)
+                  << "nodes/sec" << std::setw(8) << "depth" << std::setw(10) << "speedup"
+                  << "\n";
+
+        double baseline_rate = 0.0;
+        for (int threads : {1, 2, 4, 8, 16}) {
+            ExpertAI ai;
+            ai.setParallelSearch({threads, reproducible});
+
+            std::vector<int> line;
+            auto start = std::chrono::steady_clock::now();
+            ai.iterativeDeepeningSearch(state, std::chrono::milliseconds(budget_ms), line);
+            double seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+
+            auto stats = ai.getSearchStatistics();
+            double rate = stats.nodes_evaluated / std::max(seconds, 1e-9);
+            if (threads == 1) baseline_rate = rate;
+
+            std::cout << std::setw(8) << threads << std::setw(14) << stats.nodes_evaluated
+                      << std::setw(14) << std::fixed << std::setprecision(0) << rate
+                      << std::setw(8) << stats.completed_depth << std::setw(9)
+                      << std::setprecision(2) << rate / baseline_rate << "x\n";
+        }
+        std::cout << "\n";
+    }
+    return 0;
+}
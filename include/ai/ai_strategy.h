@@ -12,7 +12,8 @@ enum class AIDifficulty {
   EASY,    // Basic type awareness, prefers higher power moves
   MEDIUM,  // Adds status consideration, weather awareness
   HARD,    // Strategic switching, stat modifications
-  EXPERT   // Predictive analysis, multi-turn planning
+  EXPERT,  // Predictive analysis, multi-turn planning
+  MCTS     // Monte Carlo tree search over simulated battles
 };
 
 // Move evaluation result
@@ -67,6 +68,9 @@ class AIStrategy {
   double calculateTypeEffectiveness(
       const std::string& moveType,
       const std::vector<std::string>& defenderTypes) const;
+  // Enum lookup for moves and Pokemon; what the hot paths should call
+  double calculateTypeEffectiveness(PokemonType moveType,
+                                    const PokemonTypes& defenderTypes) const;
 
   double estimateDamage(const Pokemon& attacker, const Pokemon& defender,
                         const Move& move, WeatherCondition weather) const;
@@ -1,11 +1,16 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
 #include <vector>
 
 #include "ai_strategy.h"
+#include "matrix_game.h"
+#include "position_evaluator.h"
+#include "search_state.h"
+#include "transposition_table.h"
 
 // Forward declarations for advanced AI components
 struct GameState;
@@ -78,9 +83,84 @@ class ExpertAI : public AIStrategy {
   std::string classifyOpponentPlayStyle(const BattleState& battle_state) const;
   
   // MiniMax search methods
+  // Searches a compact copy of root_state; the live teams are never modified.
+  // best_line receives the principal variation as SearchAction::encode() codes.
   double miniMaxSearch(const BattleState& root_state, int depth, double alpha, double beta, 
                       bool maximizing_player, std::vector<int>& best_line) const;
+  // Iterative deepening under a wall-clock budget. Searches depth 1, 2, ...
+  // until the budget runs out or max_depth is reached, seeding each iteration
+  // with the previous principal variation. Returns the result of the deepest
+  // completed iteration; depth 1 always completes.
+  double iterativeDeepeningSearch(const BattleState& root_state,
+                                  std::chrono::milliseconds time_budget,
+                                  std::vector<int>& best_line,
+                                  int max_depth = MiniMaxSearchEngine::SearchLine::kMaxLength) const;
+  // Parallel search settings, used by both search entry points. With several
+  // workers the default is Lazy SMP: helper threads search the same root
+  // (odd helpers one ply deeper) and share the transposition table, and the
+  // main thread's result is returned. Reproducible mode instead splits the
+  // root moves across workers, each with a private table, and merges them in
+  // move order, so the result doesn't depend on thread count (one included)
+  // or scheduling.
+  struct ParallelSearchSettings {
+    int worker_threads = 1;  // 0 = one per hardware thread
+    bool reproducible = false;
+  };
+  void setParallelSearch(const ParallelSearchSettings& settings) { parallel_settings_ = settings; }
+  const ParallelSearchSettings& getParallelSearch() const { return parallel_settings_; }
+  // Chance handling in the tree search. With chance nodes on, a move's value
+  // is the probability-weighted value of its outcomes (full paralysis, miss,
+  // critical hit, damage roll bucket, secondary ailment), searched with Star1
+  // window pruning and optional Star2 probing. With them off, the default,
+  // every move hits for its average damage as before.
+  struct ChanceSearchSettings {
+    bool chance_nodes = false;
+    bool star2_probing = true;
+  };
+  void setChanceSearch(const ChanceSearchSettings& settings) { chance_settings_ = settings; }
+  const ChanceSearchSettings& getChanceSearch() const { return chance_settings_; }
+  // Simultaneous-move search. Both sides pick their action for a turn
+  // without seeing the other's, as in the battle engine, so every node is a
+  // matrix game: AI actions x opponent actions, each cell resolved in
+  // priority/speed order (speed ties averaged) and valued by the subtree
+  // below it, solved for a mixed-strategy equilibrium by MatrixGameSolver.
+  // Replacing a fainted Pokemon doesn't use up depth. Moves deal their
+  // average damage, as with chance nodes off.
+  struct SimultaneousSearchResult {
+    double value;
+    std::vector<int> ai_actions;  // SearchAction::encode() codes; kNoMove for a pass
+    std::vector<double> ai_strategy;
+    std::vector<int> opponent_actions;
+    std::vector<double> opponent_strategy;
+  };
+  SimultaneousSearchResult simultaneousSearch(const BattleState& root_state, int depth) const;
+  // When non-zero, chooseBestMove plays the AI's most likely move in the
+  // equilibrium of a simultaneous search to this depth
+  void setSimultaneousSearchDepth(int depth) { simultaneous_depth_ = depth; }
+  int getSimultaneousSearchDepth() const { return simultaneous_depth_; }
+  // When non-zero, chooseBestMove plays the first move of an iterative
+  // deepening search bounded by this budget
+  void setSearchTimeBudget(std::chrono::milliseconds budget) { search_time_budget_ = budget; }
+  std::chrono::milliseconds getSearchTimeBudget() const { return search_time_budget_; }
+  // Statistics from the most recent miniMaxSearch call
+  struct SearchStatistics {
+    int nodes_evaluated;
+    int alpha_beta_cutoffs;
+    std::chrono::milliseconds search_time;
+    uint64_t tt_hits;
+    uint64_t tt_misses;
+    uint64_t tt_collisions;  // Probes that found a different position in the slot
+    std::vector<int> principal_variation;
+    double principal_variation_score;
+    int completed_depth;  // Deepest finished iteration (the requested depth for fixed-depth search)
+    int worker_threads;   // Threads that took part in the search
+    int chance_cutoffs;   // Chance nodes cut by Star1 windows or Star2 probes
+    int matrix_games_solved;  // Simultaneous search nodes solved
+  };
+  SearchStatistics getSearchStatistics() const;
+
   double evaluatePosition(const BattleState& battle_state) const;
+  double evaluateSearchState(const SearchContext& context, const SearchState& state) const;
   std::vector<BattleState> generateLegalMoves(const BattleState& current_state, bool for_ai) const;
   void orderMoves(std::vector<BattleState>& states, bool maximizing_player) const;
   
@@ -217,25 +297,119 @@ class ExpertAI : public AIStrategy {
     static constexpr int kMaxSearchDepth = 4;
     static constexpr int kMaxBranchingFactor = 8;  // Limit moves considered per position
     static constexpr double kAlphaBetaThreshold = 0.1;  // Pruning sensitivity
+    // Static evaluations are clamped to this range; Star1/Star2 rely on it
+    static constexpr double kMinEvaluation = PositionEvaluator::kMinScore;
+    static constexpr double kMaxEvaluation = PositionEvaluator::kMaxScore;
     
-    // Search statistics for performance analysis
-    mutable int nodes_evaluated_;
-    mutable int alpha_beta_cutoffs_;
-    mutable std::chrono::milliseconds search_time_;
+    // Search statistics for performance analysis, totalled over all workers
+    mutable int nodes_evaluated_ = 0;
+    mutable int alpha_beta_cutoffs_ = 0;
+    mutable int chance_cutoffs_ = 0;
+    mutable int matrix_games_solved_ = 0;
+    mutable std::chrono::milliseconds search_time_{0};
+    mutable uint64_t tt_hits_ = 0;
+    mutable uint64_t tt_misses_ = 0;
+    mutable uint64_t tt_collisions_ = 0;
+    mutable int worker_threads_ = 1;
     
     // Principal Variation (best line found)
     mutable std::vector<int> principal_variation_;
-    mutable double principal_variation_score_;
+    mutable double principal_variation_score_ = 0.0;
+
+    // Positions remembered across searches (keyed by Zobrist hash)
+    mutable TranspositionTable transposition_table_;
+
+    // Fixed-size line buffer so recursion doesn't allocate per node
+    struct SearchLine {
+      static constexpr int kMaxLength = 32;
+      int length = 0;
+      int moves[kMaxLength];
+    };
+
+    // Iterative deepening: the clock is polled every kDeadlineCheckInterval
+    // nodes and an expired budget abandons the current iteration
+    static constexpr int kDeadlineCheckInterval = 64;
+    mutable bool has_deadline_ = false;
+    mutable bool search_aborted_ = false;
+    mutable std::chrono::steady_clock::time_point deadline_;
+    mutable int completed_depth_ = 0;
+
+    // Previous iteration's line, tried first while the search stays on it
+    mutable SearchLine pv_hint_;
+
+    // Reproducible mode gives each root move a fresh table of this size
+    static constexpr size_t kPrivateTableEntries = size_t{1} << 14;
+
+    // Per-thread search state; the recursion only touches its own worker
+    struct SearchWorker {
+      TranspositionTable* table = nullptr;
+      const PositionEvaluator* evaluator = nullptr;  // Shared, read-only
+      const std::atomic<bool>* stop = nullptr;  // Raised when helpers should quit
+      int helper_id = 0;                        // 0 for the main search
+      int nodes_evaluated = 0;
+      int alpha_beta_cutoffs = 0;
+      int chance_cutoffs = 0;
+      int matrix_games_solved = 0;
+      bool following_pv = false;
+      bool aborted = false;
+    };
   };
 
+  // One fixed-depth pass over the tree, serial or parallel per
+  // parallel_settings_; sets search_engine_.search_aborted_ if the deadline hit
+  double runSearchIteration(const SearchContext& context, int depth, double alpha,
+                            double beta, bool maximizing_player,
+                            MiniMaxSearchEngine::SearchLine& line) const;
+  double runLazySmpIteration(const SearchContext& context, const PositionEvaluator& evaluator,
+                             int depth, double alpha, double beta, bool maximizing_player,
+                             int workers, MiniMaxSearchEngine::SearchLine& line) const;
+  double runRootSplitIteration(const SearchContext& context, const PositionEvaluator& evaluator,
+                               int depth, double alpha, double beta, bool maximizing_player,
+                               int workers, MiniMaxSearchEngine::SearchLine& line) const;
+  void beginSearch() const;
+  void finishSearch() const;
+  int resolveWorkerCount() const;
+
+  // Orders actions best-first: static evaluation (all children scored in
+  // one batch), then the hash move, then the previous iteration's move
+  // while the worker is following its line
+  void orderSearchActions(const SearchContext& context, const PositionEvaluator& evaluator,
+                          const SearchState& state, bool maximizing_player, int ply,
+                          int hash_move, bool on_pv, const SearchAction* actions,
+                          int action_count, int* order) const;
 
+  double searchNode(const SearchContext& context, SearchState& state, int depth,
+                    int ply, double alpha, double beta, bool maximizing_player,
+                    MiniMaxSearchEngine::SearchLine& line,
+                    MiniMaxSearchEngine::SearchWorker& worker) const;
+  // Value of one action for the side to move: switches lead straight to the
+  // next decision node, moves average over their chance outcomes. line
+  // receives the action followed by the most likely continuation.
+  double searchAction(const SearchContext& context, SearchState& state,
+                      const SearchAction& action, int depth, int ply, double alpha,
+                      double beta, bool maximizing_player, bool follow_pv,
+                      MiniMaxSearchEngine::SearchLine& line,
+                      MiniMaxSearchEngine::SearchWorker& worker) const;
+  // Star2 probe: the value of the first-ordered action at a decision node,
+  // which bounds the node's value from the mover's side
+  double probeSuccessor(const SearchContext& context, SearchState& state, int depth,
+                        int ply, bool maximizing_player,
+                        MiniMaxSearchEngine::SearchWorker& worker) const;
+  // Value of a simultaneous-move node; fills root with the equilibrium when given
+  double searchSimultaneousNode(const SearchContext& context, SearchState& state, int depth,
+                                int ply, MiniMaxSearchEngine::SearchWorker& worker,
+                                SimultaneousSearchResult* root) const;
 
   // Phase 1 member variables
   mutable BayesianOpponentModel bayesian_model_;
   mutable MiniMaxSearchEngine search_engine_;
   mutable MetaGameAnalyzer meta_analyzer_;
+  std::chrono::milliseconds search_time_budget_{0};
+  int simultaneous_depth_ = 0;
+  ParallelSearchSettings parallel_settings_;
+  ChanceSearchSettings chance_settings_;
   
   // Performance tracking
   mutable std::map<std::string, std::chrono::milliseconds> method_timings_;
-  mutable int total_positions_analyzed_;
+  mutable int total_positions_analyzed_ = 0;
 };
\ No newline at end of file
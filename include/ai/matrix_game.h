@@ -0,0 +1,41 @@
+#pragma once
+
+// Zero-sum matrix games for simultaneous-move search.
+//
+// Both sides of a battle choose their action for the turn without seeing the
+// other's choice, so a search node is a one-shot game: payoff[i][j] is the
+// AI's value when it plays row i and the opponent plays column j. The solver
+// returns an equilibrium mixed strategy for each side.
+
+struct MatrixGame {
+  static constexpr int kMaxActions = 8;  // ExpertAI's branching limit per side
+
+  int rows = 0;  // AI (maximizing) actions
+  int cols = 0;  // Opponent (minimizing) actions
+  double payoff[kMaxActions][kMaxActions];
+};
+
+struct MatrixGameSolution {
+  double value;  // AI's equilibrium payoff
+  double row_strategy[MatrixGame::kMaxActions];
+  double col_strategy[MatrixGame::kMaxActions];
+  int iterations;  // Regret matching iterations; 0 for a pure saddle point
+  double exploitability;  // Best-response gap of the returned strategies
+};
+
+class MatrixGameSolver {
+ public:
+  static constexpr int kDefaultMaxIterations = 2000;
+  static constexpr double kDefaultTolerance = 0.05;  // In payoff units
+
+  // Pure saddle points are found directly in O(rows * cols). Otherwise runs
+  // regret matching+ with alternating updates and linearly weighted averages
+  // until the averaged strategies are within tolerance of an equilibrium
+  // (the best-response gap) or max_iterations is reached. Never allocates.
+  static MatrixGameSolution solve(const MatrixGame& game,
+                                  int max_iterations = kDefaultMaxIterations,
+                                  double tolerance = kDefaultTolerance);
+
+ private:
+  static bool solvePure(const MatrixGame& game, MatrixGameSolution& solution);
+};
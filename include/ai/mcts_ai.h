@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "ai_strategy.h"
+#include "battle.h"
+
+// Information-set Monte Carlo Tree Search.
+//
+// The tree branches only on the AI's own actions (open loop), so every node
+// is shared by all the hidden states that reach it. Each playout
+// determinizes the opponent's choices by sampling them from a damage-weighted
+// opponent model, then plays the battle out with the headless engine
+// (Battle::runHeadless, i.e. the real executeMove) using a fast greedy
+// rollout policy. Selection is UCT over availability counts; parallel
+// workers share the tree and use virtual loss to spread out.
+class MCTSAI : public AIStrategy {
+ public:
+  struct Settings {
+    int max_playouts = 2000;                        // 0 = limited by time only
+    std::chrono::milliseconds time_budget{0};       // 0 = limited by playouts only
+    int worker_threads = 1;                         // 0 = one per hardware thread
+    double exploration = 1.41421356;                // UCT constant
+    int virtual_loss = 1;                           // Losses added per in-flight visit
+    int max_rollout_turns = 50;                     // Beyond the tree; then scored by HP
+    double rollout_epsilon = 0.2;                   // Chance of a random rollout move
+    uint32_t seed = 0;                              // 0 = nondeterministic
+  };
+
+  // Per root action results of the last search
+  struct RootActionStats {
+    Battle::BattleAction action;
+    int visits;
+    double mean_reward;  // AI win rate estimate in [0, 1]
+  };
+
+  struct SearchStatistics {
+    int playouts;
+    int tree_nodes;
+    int max_tree_depth;
+    int worker_threads;
+    std::chrono::milliseconds search_time;
+    double playouts_per_second;
+    std::vector<RootActionStats> root_actions;
+  };
+
+  MCTSAI() : AIStrategy(AIDifficulty::MCTS) {}
+  explicit MCTSAI(const Settings& settings)
+      : AIStrategy(AIDifficulty::MCTS), settings_(settings) {}
+
+  MoveEvaluation chooseBestMove(const BattleState& battleState) override;
+  SwitchEvaluation chooseBestSwitch(const BattleState& battleState) override;
+  bool shouldSwitch(const BattleState& battleState) override;
+
+  void setSettings(const Settings& settings) { settings_ = settings; }
+  const Settings& getSettings() const { return settings_; }
+
+  // Runs a search from battleState and returns the most visited root action.
+  // chooseBestMove/chooseBestSwitch/shouldSwitch share one search per position.
+  Battle::BattleAction search(const BattleState& battleState);
+  SearchStatistics getSearchStatistics() const { return statistics_; }
+
+ private:
+  struct Node;
+  struct Edge {
+    Battle::BattleAction action;
+    int visits = 0;
+    int virtual_loss = 0;
+    int availability = 0;  // Playouts in which this action was legal here
+    double reward = 0.0;
+    std::unique_ptr<Node> child;
+  };
+  struct Node {
+    std::deque<Edge> edges;  // Stable addresses while other workers hold them
+  };
+
+  // Shared by all workers of one search
+  struct Tree {
+    Node root;
+    std::mutex mutex;
+    int nodes = 1;
+    int max_depth = 0;
+  };
+
+  // Legal actions for the side described by state (moves, then switches)
+  static std::vector<Battle::BattleAction> legalActions(const BattleState& state);
+
+  // One determinized playout from the root position; returns the AI's reward
+  double runPlayout(const BattleState& root, Tree& tree, std::mt19937& rng) const;
+
+  // UCT choice among the legal actions at node; adds virtual loss
+  Edge* selectEdge(Node& node, const std::vector<Battle::BattleAction>& legal,
+                   std::mt19937& rng) const;
+
+  // Greedy damage policy with epsilon exploration, used for rollouts and as
+  // the opponent model
+  Battle::BattleAction rolloutAction(const BattleState& state, std::mt19937& rng) const;
+  Battle::BattleAction replacementAction(const BattleState& state) const;
+
+  // Cached result for the position last searched
+  Battle::BattleAction cachedSearch(const BattleState& battleState);
+  static uint64_t positionKey(const BattleState& battleState);
+
+  Settings settings_;
+  SearchStatistics statistics_{};
+  Battle::BattleAction best_action_{Battle::BattleAction::Type::MOVE, 0};
+  uint64_t cached_key_ = 0;
+  bool has_cached_result_ = false;
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+#include "search_state.h"
+
+// ExpertAI's static evaluation of compact search states.
+//
+// Everything the score needs that doesn't change during a search is
+// precomputed once per SearchContext: each combatant's max HP, and for every
+// (AI slot, opponent slot) matchup the type bonus of each AI move and the
+// speed comparison. Scoring a state is then a handful of table lookups.
+// evaluateBatch scores a contiguous array of states a chunk at a time,
+// transposing their HP into per-combatant columns so the material and health
+// terms run as straight loops over the chunk.
+class PositionEvaluator {
+ public:
+  static constexpr double kMinScore = -400.0;
+  static constexpr double kMaxScore = 400.0;
+  static constexpr int kBatchSize = 32;  // States per structure-of-arrays chunk
+
+  explicit PositionEvaluator(const SearchContext& context);
+
+  double evaluate(const SearchState& state) const;
+  // scores[i] = evaluate(states[i]), bit for bit
+  void evaluateBatch(const SearchState* states, int count, double* scores) const;
+
+ private:
+  void evaluateChunk(const SearchState* states, int count, double* scores) const;
+  // Adds the type matchup, speed and status terms for the two active
+  // Pokemon, term by term so rounding matches the original evaluation
+  double addActiveScore(const SearchState& state, double score) const;
+
+  static constexpr int kSlots = SearchState::kTeamSlots;
+
+  int present_count_;
+  int8_t present_[SearchState::kMaxCombatants];  // Combatant indices, AI side first
+  int8_t side_[SearchState::kMaxCombatants];
+  double max_hp_[SearchState::kMaxCombatants];   // 0 excludes the combatant from health
+  double move_matchup_[kSlots][kSlots][SearchState::kMaxMoves];  // Bonus when the move has PP
+  double speed_matchup_[kSlots][kSlots];
+};
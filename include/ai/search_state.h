@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "ai_strategy.h"
+
+// Compact value-type battle snapshot for ExpertAI's game-tree search.
+//
+// SearchState holds only what changes while searching (HP, status, stat
+// stages, PP, active slots, weather, turn) in a fixed-size, trivially
+// copyable struct: copying a node is a memcpy and the live Pokemon/Team
+// objects are never touched. Everything that stays constant for the duration
+// of a search (stats, types, move data, type matchups) is extracted once into
+// a SearchContext.
+
+// Mutable battle data for one team slot
+struct SearchCombatant {
+  int16_t hp;
+  uint8_t status;        // StatusCondition
+  uint8_t status_turns;
+  int8_t stages[5];      // attack, defense, sp. attack, sp. defense, speed
+  uint8_t pp[4];
+};
+
+struct SearchState {
+  static constexpr int kTeamSlots = 6;
+  static constexpr int kMaxCombatants = 2 * kTeamSlots;
+  static constexpr int kMaxMoves = 4;
+  static constexpr int kAISide = 0;
+  static constexpr int kOpponentSide = 1;
+
+  SearchCombatant combatants[kMaxCombatants];  // AI slots, then opponent slots
+  int8_t active[2];                            // Active team slot per side (-1 if none)
+  uint8_t weather;                             // WeatherCondition
+  uint8_t weather_turns;
+  uint16_t turn;
+
+  static int combatantIndex(int side, int slot) {
+    return side * kTeamSlots + slot;
+  }
+  int activeIndex(int side) const {
+    return active[side] < 0 ? -1 : combatantIndex(side, active[side]);
+  }
+};
+
+static_assert(std::is_trivially_copyable<SearchState>::value,
+              "SearchState must stay memcpy-able");
+
+// One side's action during search
+struct SearchAction {
+  // PASS is only used by simultaneous search, for the side that waits while
+  // the other replaces a fainted Pokemon; it is never encoded
+  enum class Type : uint8_t { MOVE, SWITCH, PASS };
+  Type type;
+  int8_t index;  // Move slot or team slot
+
+  // Integer encoding used for principal variations: moves are 0..3,
+  // switches are -(slot + 1)
+  int encode() const {
+    return type == Type::MOVE ? index : -(index + 1);
+  }
+  static SearchAction decode(int code) {
+    if (code >= 0) return {Type::MOVE, static_cast<int8_t>(code)};
+    return {Type::SWITCH, static_cast<int8_t>(-code - 1)};
+  }
+};
+
+// One chance outcome of a move. Outcomes that leave the defender in the same
+// HP bucket are merged, with their probability-weighted mean damage.
+struct SearchOutcome {
+  double probability;
+  int16_t damage;  // HP removed from the defender
+  bool acted;      // false when fully paralyzed: no PP spent, no effect
+  bool ailment;    // The move's secondary ailment lands
+};
+
+// What SearchContext::make needs to restore the previous state
+struct SearchUndo {
+  SearchCombatant attacker;
+  SearchCombatant defender;
+  int8_t attacker_index;
+  int8_t defender_index;  // -1 for switches
+  int8_t active[2];
+  uint16_t turn;
+};
+
+// What SearchContext::makeTurn needs to restore the previous state: one
+// record per action applied, in the order they were applied
+struct SearchTurnUndo {
+  SearchUndo steps[2];
+  int8_t count;
+};
+
+// Immutable per-search data extracted from the live battle
+class SearchContext {
+ public:
+  static constexpr int kWeatherCount = 5;
+  static constexpr int kHpBuckets = 16;           // Bucket 0 means fainted
+  static constexpr int kDamageRollBuckets = 4;    // Groups of the 16 85-100% rolls
+  static constexpr int kMaxOutcomes = 2 + 2 * kDamageRollBuckets * 2;
+  static constexpr double kFullParalysisChance = 0.25;
+
+  struct MoveInfo {
+    int16_t power;
+    int16_t accuracy;
+    int8_t priority;
+    bool special;
+    uint8_t ailment;         // StatusCondition inflicted (NONE if none)
+    uint8_t ailment_chance;
+    bool high_crit;               // 1/8 critical hit ratio instead of 1/16
+    double ailment_probability;   // 1.0 for pure status moves
+    double stab;
+    double weather_multiplier[kWeatherCount];                // Per WeatherCondition
+    double type_multiplier[SearchState::kTeamSlots];          // Against each opposing slot
+  };
+
+  struct CombatantInfo {
+    bool present;
+    int16_t max_hp;
+    int16_t attack;
+    int16_t defense;
+    int16_t special_attack;
+    int16_t special_defense;
+    int16_t speed;
+    uint8_t move_count;
+    MoveInfo moves[SearchState::kMaxMoves];
+  };
+
+  explicit SearchContext(const BattleState& battle_state);
+
+  const SearchState& root() const { return root_; }
+  const CombatantInfo& info(int combatant) const {
+    return combatants_[combatant];
+  }
+  int teamSize(int side) const { return team_size_[side]; }
+
+  // Identifies the species and moves in this battle, for hashing
+  uint64_t rosterKey() const { return roster_key_; }
+
+  // Mirrors AIStrategy::estimateDamage on the compact state
+  double estimateDamage(const SearchState& state, int attacker, int move_slot,
+                        int defender) const;
+
+  // Coarse HP band used to hash positions and merge chance outcomes
+  static int hpBucket(int hp, int max_hp);
+
+  int aliveCount(const SearchState& state, int side) const;
+  bool isTerminal(const SearchState& state) const;
+
+  // Legal actions for a side, moves before switches; returns the count written
+  int generateActions(const SearchState& state, int side, SearchAction* out,
+                      int max_actions) const;
+
+  // Applies one side's action in place; unmake restores it from the undo record
+  void make(SearchState& state, int side, const SearchAction& action,
+            SearchUndo& undo) const;
+  static void unmake(SearchState& state, const SearchUndo& undo);
+
+  // Speed after stat stages and paralysis, as Pokemon::getEffectiveSpeed
+  int effectiveSpeed(const SearchState& state, int combatant) const;
+  // Order of two moves chosen in the same turn, as Battle::playerFirst:
+  // 1 if the AI's move goes first, -1 if the opponent's does, 0 on a speed
+  // tie (a coin flip in the engine)
+  int turnOrder(const SearchState& state, int ai_move_slot, int opponent_move_slot) const;
+  // Resolves one simultaneous turn in place, as Battle::executeHeadlessTurn:
+  // switches first, then moves in the given order, and a Pokemon knocked out
+  // before acting does nothing. actions are indexed by side. Undo with
+  // unmakeTurn.
+  void makeTurn(SearchState& state, const SearchAction* actions, bool ai_first,
+                SearchTurnUndo& undo) const;
+  static void unmakeTurn(SearchState& state, const SearchTurnUndo& undo);
+
+  // Chance outcomes of the side's active Pokemon using move_slot, as the
+  // battle engine rolls them: full paralysis, accuracy, critical hit, damage
+  // roll and secondary ailment. Probabilities sum to 1; returns the count.
+  int chanceOutcomes(const SearchState& state, int side, int move_slot,
+                     SearchOutcome* out) const;
+  // Applies one outcome of move_slot in place; undo with unmake
+  void makeOutcome(SearchState& state, int side, int move_slot,
+                   const SearchOutcome& outcome, SearchUndo& undo) const;
+
+ private:
+  // Damage before the critical-hit average and the 1 HP floor
+  double baseDamage(const SearchState& state, int attacker, int move_slot,
+                    int defender) const;
+  // Records what make/makeOutcome may change; returns the attacker index
+  static int saveUndo(SearchState& state, int side, SearchUndo& undo);
+
+  CombatantInfo combatants_[SearchState::kMaxCombatants];
+  int team_size_[2];
+  uint64_t roster_key_;
+  SearchState root_;
+};
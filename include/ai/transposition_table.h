@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "search_state.h"
+
+// Zobrist hashing of compact search states.
+//
+// A position hashes its active slots, per-combatant HP bucket, status, stat
+// stages and PP, the weather and the side to move. HP is bucketed so that
+// near-identical positions share an entry. SearchContext::rosterKey() folds in
+// the species and moves present, so entries from one battle can't be mistaken
+// for another's.
+class ZobristHasher {
+ public:
+  static constexpr int kHpBuckets = SearchContext::kHpBuckets;
+  static constexpr int kStatusValues = 8;
+  static constexpr int kStageValues = 13;  // -6..+6
+  static constexpr int kPpValues = 64;     // PP above 63 shares the last key
+
+  static uint64_t hash(const SearchContext& context, const SearchState& state,
+                       bool ai_to_move);
+
+ private:
+  struct Keys;
+  static const Keys& keys();
+};
+
+// Fixed-size transposition table shared by ExpertAI searches.
+//
+// Each slot stores the key XOR-ed with its packed payload, so readers never
+// lock: a torn write simply fails verification and reads as a miss.
+class TranspositionTable {
+ public:
+  enum class Bound : uint8_t { NONE, EXACT, LOWER, UPPER };
+
+  struct Entry {
+    double score;
+    int depth;
+    Bound bound;
+    int best_move;  // SearchAction::encode(), or kNoMove
+  };
+
+  static constexpr int kNoMove = 127;
+  static constexpr size_t kDefaultEntries = size_t{1} << 16;
+
+  explicit TranspositionTable(size_t entries = kDefaultEntries);
+
+  // Looks up key; counts a hit, a miss (empty slot) or a collision
+  // (slot holds a different position)
+  bool probe(uint64_t key, Entry& entry) const;
+
+  // Depth-preferred replacement; entries from earlier searches are always
+  // replaceable
+  void store(uint64_t key, const Entry& entry);
+
+  // Starts a new search generation so stale entries age out
+  void newSearch();
+  void clear();
+
+  size_t capacity() const { return mask_ + 1; }
+
+  uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+  uint64_t collisions() const {
+    return collisions_.load(std::memory_order_relaxed);
+  }
+  void resetCounters();
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> check;  // key ^ data
+    std::atomic<uint64_t> data;
+  };
+
+  static uint64_t pack(const Entry& entry, uint8_t generation);
+  static Entry unpack(uint64_t data);
+  static uint8_t generationOf(uint64_t data);
+  static int depthOf(uint64_t data);
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t mask_;
+  uint8_t generation_;
+
+  mutable std::atomic<uint64_t> hits_{0};
+  mutable std::atomic<uint64_t> misses_{0};
+  mutable std::atomic<uint64_t> collisions_{0};
+};
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <memory>
-#include <random>
 #include <unordered_map>
 
+#include "ai_strategy.h"
+#include "battle_rng.h"
 #include "move.h"
 #include "pokemon.h"
 #include "team.h"
@@ -14,6 +17,8 @@
 #include "health_bar_animator.h"
 #include "health_bar_event_listener.h"
 
+struct BattleReplay;
+
 class Battle {
  public:
   // AI Difficulty Levels
@@ -37,6 +42,62 @@ class Battle {
 
   BattleResult getBattleResult() const;
 
+  // Headless simulation interface (no console I/O, no delays)
+  // An action for one side of a turn: a move slot or a team slot to switch to
+  struct BattleAction {
+    enum class Type { MOVE, SWITCH };
+    Type type;
+    int index;
+  };
+
+  // Chooses an action for the side described by the BattleState; aiPokemon and
+  // aiTeam always refer to the side being asked. When that side's active
+  // Pokemon has fainted, the provider is expected to return a SWITCH.
+  using ActionProvider = std::function<BattleAction(const BattleState &)>;
+
+  struct HeadlessResult {
+    BattleResult result;  // DRAW if the turn limit was reached
+    int turns;
+  };
+
+  static constexpr int kDefaultHeadlessTurnLimit = 1000;
+
+  // Adapts an AIStrategy (chooseBestMove/chooseBestSwitch/shouldSwitch) to an
+  // ActionProvider. The strategy must outlive the returned provider.
+  static ActionProvider makeActionProvider(AIStrategy &strategy);
+
+  // Runs the battle to completion with both sides driven by providers
+  HeadlessResult runHeadless(const ActionProvider &playerProvider,
+                             const ActionProvider &opponentProvider,
+                             int maxTurns = kDefaultHeadlessTurnLimit);
+  HeadlessResult runHeadless(AIStrategy &playerStrategy,
+                             AIStrategy &opponentStrategy,
+                             int maxTurns = kDefaultHeadlessTurnLimit);
+
+  // Reseeds the battle's random stream, which drives every roll: accuracy,
+  // critical hits, damage spread, secondary effects, status, speed ties and
+  // the built-in AI. Equal seeds replay equal battles. skipDraws resumes the
+  // stream that many draws in.
+  void seedRandom(uint64_t seed, uint64_t skipDraws = 0);
+
+  // The seed of the random stream; unseeded battles draw one at construction
+  uint64_t getRandomSeed() const { return randomSeed; }
+  uint64_t getRandomDraws() const { return rng.draws(); }
+
+  // Records each later headless run into replay, replacing its contents;
+  // nullptr stops recording. The replay must outlive the runs.
+  void recordReplay(BattleReplay *replay) { this->replay = replay; }
+
+  // Where a headless run begins: active team slots (-1 picks the first
+  // healthy Pokemon) and weather, so a battle in progress can be resumed
+  struct HeadlessStart {
+    int playerActive;
+    int opponentActive;
+    WeatherCondition weather;
+    int weatherTurns;
+  };
+  void setHeadlessStart(const HeadlessStart &start);
+
  private:
   Team playerTeam;
   Team opponentTeam;
@@ -50,6 +111,11 @@ class Battle {
   WeatherCondition currentWeather;
   int weatherTurnsRemaining;
 
+  // Headless mode suppresses all console output
+  bool headless;
+  HeadlessStart headlessStart;
+  std::ostream &out() const;
+
   // Battle flow methods
   void selectPokemon();
   void selectOpponentPokemon();
@@ -94,6 +160,21 @@ class Battle {
   
   // Status condition handling with events
   void processStatusConditionWithEvents(Pokemon& pokemon);
+  // Reports a move use; effectiveness is only worked out if someone listens
+  void notifyMoveUsed(Pokemon &user, const Move &move, Pokemon &target,
+                      bool successful, bool critical);
+  void notifyHeadlessSwitch(Pokemon *oldPokemon, Pokemon *newPokemon,
+                            bool forPlayer);
+
+  // Headless turn helpers
+  BattleState makeBattleState(bool forPlayer, int turnNumber);
+  BattleAction chooseHeadlessAction(const ActionProvider &provider,
+                                    bool forPlayer, int turnNumber);
+  void executeHeadlessTurn(const BattleAction &playerAction,
+                           const BattleAction &opponentAction);
+  // Returns the team slot sent in, or -1 if there was nothing to replace
+  int replaceFaintedHeadless(const ActionProvider &provider, bool forPlayer,
+                             int turnNumber);
 
   // Input handling
   int getMoveChoice() const;
@@ -113,13 +194,15 @@ class Battle {
   // AI strategy helpers
   int evaluateMoveScore(const Move &move, const Pokemon &attacker,
                         const Pokemon &defender) const;
-  double
-  calculateTypeAdvantage(const std::string &moveType,
-                         const std::vector<std::string> &defenderTypes) const;
+  double calculateTypeAdvantage(PokemonType moveType,
+                                const PokemonTypes &defenderTypes) const;
+
+  // The one random stream of this battle
+  uint64_t randomSeed;
+  mutable BattleRng rng;
 
-  // Random number generation for critical hits
-  mutable std::mt19937 rng;
-  mutable std::uniform_real_distribution<double> criticalDistribution;
+  // Where headless runs are recorded, if anywhere
+  BattleReplay *replay;
   
   // Battle event system
   BattleEvents::BattleEventManager eventManager;
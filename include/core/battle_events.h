@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <functional>
@@ -13,13 +14,57 @@ enum class WeatherCondition;
 
 namespace BattleEvents {
 
+// What caused an event. Interned so emitting an event never builds a string;
+// listeners that want text call getSourceName().
+enum class EventSource : uint8_t {
+    MOVE,
+    OHKO,
+    HEAL,
+    DRAIN,
+    RECOIL,
+    WEATHER,
+    STATUS,
+    SWITCH,
+    ITEM,
+    OTHER
+};
+
+const char* getSourceName(EventSource source);
+
+// Event kinds, one bit each in an EventMask
+enum class EventType : uint8_t {
+    HEALTH_CHANGED,
+    STATUS_CHANGED,
+    MOVE_USED,
+    WEATHER_CHANGED,
+    POKEMON_SWITCH,
+    BATTLE_START,
+    BATTLE_END,
+    TURN_START,
+    TURN_END,
+    MULTI_TURN_MOVE,
+    COUNT
+};
+
+using EventMask = uint16_t;
+
+constexpr EventMask eventBit(EventType type) {
+    return static_cast<EventMask>(1u << static_cast<unsigned>(type));
+}
+
+constexpr EventMask kAllEvents = (1u << static_cast<unsigned>(EventType::COUNT)) - 1;
+
 // Event data structures
 struct HealthChangeEvent {
     Pokemon* pokemon;
     int oldHealth;
     int newHealth;
     int damage;  // Positive for damage taken, negative for healing
-    std::string source;  // "move", "weather", "status", etc.
+    EventSource source;
+    const Move* move = nullptr;         // The move responsible, if any
+    const Pokemon* attacker = nullptr;  // Who used it, for MOVE and OHKO damage
+    WeatherCondition weather{};         // The weather, for WEATHER damage
+    StatusCondition status{};           // The condition, for STATUS damage
 };
 
 struct StatusChangeEvent {
@@ -27,7 +72,7 @@ struct StatusChangeEvent {
     StatusCondition oldStatus;
     StatusCondition newStatus;
     int turnsRemaining;
-    std::string source;
+    EventSource source;
 };
 
 struct MoveUsedEvent {
@@ -65,14 +110,25 @@ struct MultiTurnMoveEvent {
     Pokemon* pokemon;
     const Move* move;
     enum class Phase { CHARGING, EXECUTING, RECHARGING } phase;
-    std::string message;  // Display message for the UI
+    bool skippedCharge = false;  // Executed at once, e.g. Solar Beam in sun
 };
 
+// The display message for a multi-turn move event, built on request
+std::string describeMultiTurnMove(const MultiTurnMoveEvent& event);
+
+// What changed a Pokemon's health, e.g. "Pikachu's thunderbolt",
+// "Sandstorm damage" or "giga-drain (drain)", built on request
+std::string describeHealthSource(const HealthChangeEvent& event);
+
 // Abstract observer interface
 class BattleEventListener {
 public:
     virtual ~BattleEventListener() = default;
     
+    // The events this listener handles; the manager only calls it for these.
+    // Read once at subscription.
+    virtual EventMask subscribedEvents() const { return kAllEvents; }
+    
     // Event handlers - override only the events you care about
     virtual void onHealthChanged(const HealthChangeEvent& /*event*/) {}
     virtual void onStatusChanged(const StatusChangeEvent& /*event*/) {}
@@ -86,7 +142,12 @@ public:
     virtual void onMultiTurnMove(const MultiTurnMoveEvent& /*event*/) {}
 };
 
-// Event manager - handles subscription and notification
+// Event manager - handles subscription and notification.
+//
+// Listeners are indexed by the events they subscribe to, so notifying an
+// event nobody wants is one inline mask test, and callers can check
+// isSubscribed() to skip building the event at all. Dispatch walks raw
+// pointers; listeners unsubscribed mid-dispatch are kept alive until it ends.
 class BattleEventManager {
 public:
     using ListenerPtr = std::shared_ptr<BattleEventListener>;
@@ -96,42 +157,105 @@ public:
     void unsubscribe(ListenerPtr listener);
     void clear();
     
+    // Whether any listener handles events of this type
+    bool isSubscribed(EventType type) const { return (mask_ & eventBit(type)) != 0; }
+    
     // Event notification methods
-    void notifyHealthChanged(const HealthChangeEvent& event);
-    void notifyStatusChanged(const StatusChangeEvent& event);
-    void notifyMoveUsed(const MoveUsedEvent& event);
-    void notifyWeatherChanged(const WeatherChangeEvent& event);
-    void notifyPokemonSwitch(const PokemonSwitchEvent& event);
-    void notifyBattleStart(const BattleStartEvent& event);
-    void notifyBattleEnd(const BattleEndEvent& event);
-    void notifyTurnStart(int turnNumber);
-    void notifyTurnEnd(int turnNumber);
-    void notifyMultiTurnMove(const MultiTurnMoveEvent& event);
+    void notifyHealthChanged(const HealthChangeEvent& event) {
+        if (isSubscribed(EventType::HEALTH_CHANGED)) dispatch(EventType::HEALTH_CHANGED, &BattleEventListener::onHealthChanged, event);
+    }
+    void notifyStatusChanged(const StatusChangeEvent& event) {
+        if (isSubscribed(EventType::STATUS_CHANGED)) dispatch(EventType::STATUS_CHANGED, &BattleEventListener::onStatusChanged, event);
+    }
+    void notifyMoveUsed(const MoveUsedEvent& event) {
+        if (isSubscribed(EventType::MOVE_USED)) dispatch(EventType::MOVE_USED, &BattleEventListener::onMoveUsed, event);
+    }
+    void notifyWeatherChanged(const WeatherChangeEvent& event) {
+        if (isSubscribed(EventType::WEATHER_CHANGED)) dispatch(EventType::WEATHER_CHANGED, &BattleEventListener::onWeatherChanged, event);
+    }
+    void notifyPokemonSwitch(const PokemonSwitchEvent& event) {
+        if (isSubscribed(EventType::POKEMON_SWITCH)) dispatch(EventType::POKEMON_SWITCH, &BattleEventListener::onPokemonSwitch, event);
+    }
+    void notifyBattleStart(const BattleStartEvent& event) {
+        if (isSubscribed(EventType::BATTLE_START)) dispatch(EventType::BATTLE_START, &BattleEventListener::onBattleStart, event);
+    }
+    void notifyBattleEnd(const BattleEndEvent& event) {
+        if (isSubscribed(EventType::BATTLE_END)) dispatch(EventType::BATTLE_END, &BattleEventListener::onBattleEnd, event);
+    }
+    void notifyTurnStart(int turnNumber) {
+        if (isSubscribed(EventType::TURN_START)) dispatch(EventType::TURN_START, &BattleEventListener::onTurnStart, turnNumber);
+    }
+    void notifyTurnEnd(int turnNumber) {
+        if (isSubscribed(EventType::TURN_END)) dispatch(EventType::TURN_END, &BattleEventListener::onTurnEnd, turnNumber);
+    }
+    void notifyMultiTurnMove(const MultiTurnMoveEvent& event) {
+        if (isSubscribed(EventType::MULTI_TURN_MOVE)) dispatch(EventType::MULTI_TURN_MOVE, &BattleEventListener::onMultiTurnMove, event);
+    }
     
     // Utility methods
     size_t getListenerCount() const { return listeners_.size(); }
     bool hasListeners() const { return !listeners_.empty(); }
     
     // Convenience methods for common event creation
-    HealthChangeEvent createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp, 
-                                            const std::string& source);
-    StatusChangeEvent createStatusChangeEvent(Pokemon* pokemon, StatusCondition oldStatus, 
-                                            StatusCondition newStatus, int turns, 
-                                            const std::string& source);
-    MoveUsedEvent createMoveUsedEvent(Pokemon* user, const Move* move, Pokemon* target, 
-                                    bool successful, bool critical, double effectiveness);
-    MultiTurnMoveEvent createMultiTurnMoveEvent(Pokemon* pokemon, const Move* move, 
-                                              MultiTurnMoveEvent::Phase phase, 
-                                              const std::string& message);
+    static HealthChangeEvent createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp, 
+                                                     EventSource source, const Move* move = nullptr) {
+        return HealthChangeEvent{pokemon, oldHp, newHp, oldHp - newHp, source, move};
+    }
+    static StatusChangeEvent createStatusChangeEvent(Pokemon* pokemon, StatusCondition oldStatus, 
+                                                     StatusCondition newStatus, int turns, 
+                                                     EventSource source) {
+        return StatusChangeEvent{pokemon, oldStatus, newStatus, turns, source};
+    }
+    static MoveUsedEvent createMoveUsedEvent(Pokemon* user, const Move* move, Pokemon* target, 
+                                             bool successful, bool critical, double effectiveness) {
+        return MoveUsedEvent{user, move, target, successful, critical, effectiveness};
+    }
+    static MultiTurnMoveEvent createMultiTurnMoveEvent(Pokemon* pokemon, const Move* move, 
+                                                       MultiTurnMoveEvent::Phase phase, 
+                                                       bool skippedCharge = false) {
+        return MultiTurnMoveEvent{pokemon, move, phase, skippedCharge};
+    }
 
 private:
-    std::vector<ListenerPtr> listeners_;
+    struct Subscription {
+        ListenerPtr listener;
+        EventMask events;
+    };
     
-    // Helper to safely notify all listeners
-    template<typename EventType, typename NotifyFunc>
-    void notifyAll(const EventType& event, NotifyFunc func);
+    // Owning list, plus each event type's listeners in subscription order
+    std::vector<Subscription> listeners_;
+    std::vector<BattleEventListener*> byType_[static_cast<size_t>(EventType::COUNT)];
+    EventMask mask_ = 0;
+    
+    // Nesting depth of dispatch(), and listeners unsubscribed during it
+    int dispatching_ = 0;
+    std::vector<ListenerPtr> retired_;
+    
+    void rebuildIndex();
+    void endDispatch();
+    
+    template<typename Handler, typename Event>
+    void dispatch(EventType type, Handler handler, const Event& event);
 };
 
+template<typename Handler, typename Event>
+void BattleEventManager::dispatch(EventType type, Handler handler, const Event& event) {
+    const auto& listeners = byType_[static_cast<size_t>(type)];
+    ++dispatching_;
+    // Indexed, since a listener may subscribe others while being notified
+    for (size_t i = 0; i < listeners.size(); ++i) {
+        if (BattleEventListener* listener = listeners[i]) {
+            try {
+                (listener->*handler)(event);
+            } catch (...) {
+                // Swallow exceptions from listeners to prevent one bad listener 
+                // from breaking the notification chain
+            }
+        }
+    }
+    endDispatch();
+}
+
 // Convenience type aliases
 using EventManager = BattleEventManager;
 using EventListener = BattleEventListener;
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "battle.h"
+
+class Team;
+
+// A record of one headless battle, enough to re-run it exactly: the seed,
+// hashes of both teams, where the run started and every action each side
+// took. Battle is deterministic given these, so no transcript is kept.
+//
+// Encoded, a turn takes one byte of slot flags plus a byte per action
+// (typically three bytes), and a header and trailer of about 50 bytes. Encodings append,
+// so many replays can share one buffer and be decoded back in order.
+//
+//   BattleReplay replay;
+//   battle.recordReplay(&replay);
+//   battle.runHeadless(playerAI, opponentAI);
+//   replay.encode(archive);
+//   ...
+//   auto check = replay.verify(playerTeam, opponentTeam);
+struct BattleReplay {
+  // The actions a turn can record, in the order Battle asks for them
+  enum Slot { kPlayerAction, kOpponentAction, kPlayerReplacement, kOpponentReplacement, kSlotCount };
+
+  // An action packed into a byte: the move or team slot, plus kSwitchFlag
+  static constexpr uint8_t kNoAction = 0xFF;
+  static constexpr uint8_t kSwitchFlag = 0x80;
+
+  struct Turn {
+    std::array<uint8_t, kSlotCount> actions;
+    uint64_t draws;  // Random draws made by the end of the turn, if recorded
+
+    bool operator==(const Turn &other) const;
+  };
+
+  // Verification outcome
+  struct Verification {
+    bool matches = false;
+    std::string mismatch;  // First difference found, empty when matching
+    Battle::HeadlessResult outcome{Battle::BattleResult::ONGOING, 0};
+  };
+
+  uint64_t seed = 0;
+  uint64_t start_draws = 0;  // Draws made before the run began
+  uint64_t player_team_hash = 0;
+  uint64_t opponent_team_hash = 0;
+  Battle::HeadlessStart start{-1, -1, WeatherCondition::NONE, 0};
+  bool records_draws = false;  // Set before recording to log draw counts per turn
+  std::vector<Turn> turns;
+  Battle::BattleResult result = Battle::BattleResult::ONGOING;
+  uint64_t end_draws = 0;
+  uint64_t end_state_hash = 0;  // hashTeams of both teams as the run ended
+
+  static uint8_t encodeAction(const Battle::BattleAction &action);
+  static Battle::BattleAction decodeAction(uint8_t action);
+
+  // Hashes the parts of a team that affect a battle: species, stats, current
+  // HP, status and stages, and each move with its remaining PP
+  static uint64_t hashTeam(const Team &team);
+  static uint64_t hashTeams(const Team &playerTeam, const Team &opponentTeam);
+
+  // Appends the compact encoding to out
+  void encode(std::vector<uint8_t> &out) const;
+
+  // Decodes one replay from the front of data. Returns the bytes it used, or
+  // 0 if the data is truncated or not a replay.
+  static size_t decode(const uint8_t *data, size_t size, BattleReplay &replay);
+
+  // Re-runs the battle headlessly from the given teams, feeding back the
+  // recorded actions, and checks it plays out the same turn for turn. The
+  // teams must be the ones recorded, as the team hashes confirm.
+  Verification verify(const Team &playerTeam, const Team &opponentTeam) const;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// The random stream of one battle.
+//
+// A counter-based generator: the n-th output is a fixed mix of (key, n), so
+// the whole state is two words and copying, seeding and forking are free.
+// Outputs are SplitMix64, which passes BigCrush. Unlike the std
+// distributions, the helpers below produce the same values on every standard
+// library, so a seed reproduces a battle bit for bit anywhere.
+//
+// Satisfies UniformRandomBitGenerator. Not thread-safe; give each battle (or
+// thread) its own stream, e.g. with fork().
+class BattleRng {
+ public:
+  using result_type = uint64_t;
+
+  explicit BattleRng(uint64_t seed = 0) { this->seed(seed); }
+
+  void seed(uint64_t seed) {
+    key_ = mix(seed);
+    counter_ = 0;
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  result_type operator()() { return mix(key_ + kGamma * ++counter_); }
+
+  // Outputs drawn since seeding; skipping ahead is just moving the counter
+  uint64_t draws() const { return counter_; }
+  void discard(uint64_t count) { counter_ += count; }
+
+  // Uniform in [low, high]; low <= high
+  int uniformInt(int low, int high) {
+    uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(high) - low) + 1;
+    // Multiply-shift on the top 32 bits: bias below 2^-32 for any span here
+    return low + static_cast<int>(((operator()() >> 32) * span) >> 32);
+  }
+
+  // Uniform index into a container of size count > 0
+  size_t index(size_t count) {
+    return static_cast<size_t>(((operator()() >> 32) * count) >> 32);
+  }
+
+  // Uniform in [0, 1), with 53 random bits
+  double uniformReal() { return static_cast<double>(operator()() >> 11) * 0x1.0p-53; }
+
+  // True with the given chance out of 100, as a 1-100 roll <= percent
+  bool percentChance(int percent) { return uniformInt(1, 100) <= percent; }
+
+  // An independent stream derived from this one's key, e.g. one per worker
+  BattleRng fork(uint64_t stream) const { return BattleRng(mix(key_ ^ mix(stream + kGamma))); }
+
+ private:
+  static constexpr uint64_t kGamma = 0x9E3779B97F4A7C15ULL;
+
+  static uint64_t mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  uint64_t key_;
+  uint64_t counter_;
+};
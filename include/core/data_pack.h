@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class Pokemon;
+struct MoveDef;
+
+// Compiled form of data/pokemon and data/moves.
+//
+// A pack is one versioned binary file: a header, four sorted tables of
+// fixed-size records and a string table they index into. It is mmap'd and
+// read in place, so a cold start costs one open and a directory scan instead
+// of validating and parsing every JSON file.
+//
+// The battle tables hold exactly what Pokemon::loadFromJson and
+// MoveDef::loadFromJson produce, keyed by file name; files those loaders reject
+// are left out so the constructors fall back to JSON (and report the error)
+// as before. The catalog tables hold what PokemonData loads, keyed by
+// normalized name.
+//
+// The header records a checksum of the source directories (file names, sizes
+// and modification times). A pack whose checksum no longer matches is stale
+// and ignored, and callers fall back to JSON until it is rebuilt.
+class DataPack {
+ public:
+  static constexpr uint32_t kVersion = 1;
+  static constexpr const char* kDefaultPokemonDir = "data/pokemon";
+  static constexpr const char* kDefaultMovesDir = "data/moves";
+  static constexpr const char* kDefaultPath = "data/pokedata.pack";
+
+  struct PokemonRecord {
+    uint32_t key;       // String offsets
+    uint32_t name;
+    uint32_t types[2];
+    uint16_t type_count;
+    int16_t id;
+    int16_t hp;
+    int16_t attack;
+    int16_t defense;
+    int16_t special_attack;
+    int16_t special_defense;
+    int16_t speed;
+  };
+
+  struct MoveRecord {
+    uint32_t key;       // String offsets
+    uint32_t name;
+    uint32_t type;      // Catalog only: battle moves use MoveTypeMapping
+    uint32_t damage_class;
+    uint32_t category;
+    uint32_t ailment_name;
+    int16_t accuracy;
+    int16_t effect_chance;
+    int16_t pp;
+    int16_t priority;
+    int16_t power;
+    int16_t ailment_chance;
+    int16_t crit_rate;
+    int16_t drain;
+    int16_t flinch_chance;
+    int16_t healing;
+    int16_t max_hits;
+    int16_t max_turns;
+    int16_t min_hits;
+    int16_t min_turns;
+    int16_t stat_chance;
+    int16_t reserved;
+  };
+
+  static_assert(std::is_trivially_copyable<PokemonRecord>::value &&
+                    std::is_trivially_copyable<MoveRecord>::value,
+                "Pack records are read in place");
+
+  struct BuildResult {
+    bool success;
+    std::string error_message;
+    int pokemon_count;  // Battle records written
+    int move_count;
+
+    BuildResult(bool success = true, const std::string& message = "",
+                int pokemon = 0, int moves = 0)
+        : success(success), error_message(message), pokemon_count(pokemon), move_count(moves) {}
+  };
+
+  DataPack() = default;
+  ~DataPack();
+  DataPack(const DataPack&) = delete;
+  DataPack& operator=(const DataPack&) = delete;
+
+  // Compiles both directories into pack_path. The file is written beside the
+  // target and renamed into place, so readers never see a partial pack.
+  static BuildResult build(const std::string& pokemon_dir, const std::string& moves_dir,
+                           const std::string& pack_path);
+
+  // First-run step: rebuilds pack_path unless it is already current for the
+  // directories. Returns true if a current pack exists afterwards.
+  static bool ensureCurrent(const std::string& pokemon_dir = kDefaultPokemonDir,
+                            const std::string& moves_dir = kDefaultMovesDir,
+                            const std::string& pack_path = kDefaultPath);
+
+  // Checksum of the .json files in both directories; 0 if either is missing
+  static uint64_t sourceChecksum(const std::string& pokemon_dir, const std::string& moves_dir);
+
+  // Pack path used for a data directory: beside it, e.g. data/pokedata.pack
+  static std::string packPathFor(const std::string& pokemon_dir);
+
+  // Pack for the default directories, opened on first use; nullptr if there
+  // is none or it is stale. Used by the Pokemon and Move constructors.
+  static std::shared_ptr<const DataPack> shared();
+  // Makes the next shared() open the pack again, e.g. after the data files
+  // changed; holders of the previous pack keep it until they let go
+  static void invalidateShared();
+
+  // Maps pack_path and checks its magic, version, layout and payload
+  // checksum. Returns false (leaving the pack closed) if any check fails.
+  bool open(const std::string& pack_path);
+  void close();
+  bool isOpen() const { return data_ != nullptr; }
+  bool isMapped() const { return mapped_; }
+
+  // True if the pack was compiled from the directories as they are now
+  bool isCurrent(const std::string& pokemon_dir, const std::string& moves_dir) const;
+
+  // Battle tables, keyed by data file name without extension
+  const PokemonRecord* findPokemon(const std::string& key) const;
+  const MoveRecord* findMove(const std::string& key) const;
+  // Fill a default-constructed object as the JSON loaders would
+  bool loadPokemon(const std::string& key, Pokemon& pokemon) const;
+  bool loadMove(const std::string& key, MoveDef& move) const;
+
+  // Catalog tables, sorted by normalized name
+  size_t catalogPokemonCount() const;
+  const PokemonRecord& catalogPokemon(size_t index) const;
+  size_t catalogMoveCount() const;
+  const MoveRecord& catalogMove(size_t index) const;
+  // PokemonData's file counts when the catalog was compiled
+  int catalogLoadedCount() const;
+  int catalogFailedCount() const;
+
+  const char* string(uint32_t offset) const;
+
+ private:
+  struct Header;
+
+  const Header& header() const;
+  const PokemonRecord* pokemonTable(int table) const;
+  const MoveRecord* moveTable(int table) const;
+  template <typename Record>
+  const Record* find(const Record* records, size_t count, const std::string& key) const;
+
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<uint8_t> buffer_;  // Used when the file can't be mapped
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "move.h"
+#include "pokemon.h"
+
+// Process-wide registry of interned species and move definitions.
+//
+// The first request for a name loads it once (data pack or JSON, through the
+// same validated path the constructors always used) and keeps it immutable:
+// every later Pokemon(name) is a copy of the species prototype and every
+// Move(name) points at the shared MoveDef, with no file access. Handles are
+// dense indices that stay valid for the life of the process, so callers that
+// resolve a name once can construct from the handle in O(1).
+//
+// Lookups take a shared lock and interning a new name an exclusive one, so
+// the registry is safe to use from any number of threads. Names that fail to
+// load are not cached: each attempt reports the error as before.
+//
+// Definitions are grouped into generations. reload() starts a new one in
+// which names whose data files changed are loaded again; lookups by name
+// from then on return the new definitions, while those of earlier
+// generations (and their handles) stay alive for battles already using them.
+class DataRegistry {
+ public:
+  using Handle = int32_t;
+  static constexpr Handle kNoHandle = -1;
+
+  static DataRegistry& instance();
+
+  // Interns the name on first use; kNoHandle if it can't be loaded
+  Handle speciesHandle(const std::string& name);
+  Handle moveHandle(const std::string& name);
+  // Interned species with this Pokedex number, or kNoHandle
+  Handle speciesHandleById(int id) const;
+
+  // Species prototype: fresh battle state, no moves
+  const Pokemon& species(Handle handle) const;
+  const MoveDef& moveDef(Handle handle) const;
+
+  // Shared copy of a custom definition (not loaded from data); identical
+  // definitions intern to the same object. The result is never freed.
+  const MoveDef& intern(const MoveDef& def);
+
+  // Interns every file in data/pokemon and data/moves up front, e.g. before
+  // starting worker threads; returns the number of species and moves interned
+  size_t preload();
+
+  // Re-reads every interned name whose data file changed (size or
+  // modification time) since it was loaded, reopening the shared data pack
+  // first. Names whose file is gone are forgotten. Starts a new generation
+  // if anything changed; returns the number of names re-read or forgotten.
+  size_t reload();
+  // 0 until a reload() changes something
+  uint64_t generation() const;
+
+  // Interned definitions, all generations included
+  size_t speciesCount() const;
+  size_t moveCount() const;
+
+ private:
+  DataRegistry() = default;
+
+  // What a data file held when an entry was loaded from it. Compared by
+  // content, so a file rewritten within the mtime resolution is still seen
+  // and one that was only touched is not loaded again
+  struct SourceStamp {
+    bool exists = false;
+    uintmax_t size = 0;
+    uint64_t hash = 0;  // PokemonData::contentHash of the file
+
+    bool operator==(const SourceStamp& other) const {
+      return exists == other.exists && size == other.size && hash == other.hash;
+    }
+  };
+
+  template <typename T>
+  struct Table {
+    explicit Table(const char* type) : data_type(type) {}
+
+    const char* data_type;                          // "pokemon" or "moves"
+    std::vector<std::unique_ptr<const T>> entries;  // Stable addresses
+    std::vector<SourceStamp> stamps;                // One per entry
+    std::unordered_map<std::string, Handle> by_name;  // Current generation
+  };
+
+  static SourceStamp stamp(const char* data_type, const std::string& name);
+
+  template <typename T>
+  Handle intern(Table<T>& table, const std::string& name);
+  // Installs entry as the current definition of name; caller holds the lock
+  template <typename T>
+  Handle install(Table<T>& table, const std::string& name, std::unique_ptr<T> entry,
+                 const SourceStamp& stamp);
+  template <typename T>
+  size_t reload(Table<T>& table);
+
+  mutable std::shared_mutex mutex_;
+  std::mutex reload_mutex_;  // One reload() at a time
+  uint64_t generation_ = 0;
+  Table<Pokemon> species_{"pokemon"};
+  Table<MoveDef> moves_{"moves"};
+  std::unordered_map<int, Handle> species_by_id_;
+  std::unordered_multimap<std::string, std::unique_ptr<const MoveDef>> custom_moves_;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct MoveDef;
+
+// One rule a data file broke
+struct SchemaError {
+  std::string field;    // Dotted path, e.g. "Info.ailment.name"; empty for the document
+  std::string message;
+
+  // "field: message", or just the message for document errors
+  std::string describe() const;
+};
+
+// Typed contents of a species file
+struct SpeciesRecord {
+  std::string name;
+  int id = 0;
+  std::vector<std::string> types;
+  int hp = 0;
+  int attack = 0;
+  int defense = 0;
+  int special_attack = 0;
+  int special_defense = 0;
+  int speed = 0;
+};
+
+// Declarative schemas for the move and species data files.
+//
+// Each schema is a table of field rules: path, kind, range, default and
+// allowed values. A file is checked in one SAX pass over its text that routes
+// values straight into per-field slots, with no json DOM in between; the
+// rules are then applied to the slots and the typed record filled. Every
+// broken rule is reported, not just the first.
+//
+// The rules are the ones the field-by-field loaders applied, quirks included:
+// a missing nullable field counts as null, unknown keys are ignored, and when
+// a key repeats its last occurrence wins, as it would in a DOM.
+class DataSchema {
+ public:
+  // Fills the move's file fields (not type or multi-turn behavior, which
+  // derive from the name). Returns false with errors set if the text isn't
+  // JSON or breaks the schema; the move is then partly filled.
+  static bool parseMove(std::string_view text, MoveDef &move, std::vector<SchemaError> &errors);
+
+  static bool parseSpecies(std::string_view text, SpeciesRecord &species,
+                           std::vector<SchemaError> &errors);
+};
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "json.hpp"
+#include "type_effectiveness.h"
 
 // Forward declaration
 enum class StatusCondition;
@@ -18,48 +21,97 @@ enum class MultiTurnBehavior {
   CHARGE_BOOST    // Charging turn with stat boost (Skull Bash)
 };
 
-class Move {
- public:
-  // Move stats
+// Damage class of a move
+enum class DamageClass : uint8_t { PHYSICAL, SPECIAL, STATUS };
+
+const char* damageClassName(DamageClass damage_class);
+// Returns false (leaving damage_class unchanged) for an unknown name
+bool parseDamageClass(const std::string& name, DamageClass& damage_class);
+
+// Ailment a move inflicts; OTHER covers those with no StatusCondition
+// (confusion, trap, ...)
+enum class MoveAilment : uint8_t { NONE, POISON, BURN, PARALYSIS, SLEEP, FREEZE, OTHER };
+
+// Returns OTHER for a name that is not "none" or a status condition
+MoveAilment parseMoveAilment(const std::string& name);
+
+// Effect category of a move, as far as the battle engine tells them apart
+enum class MoveCategory : uint8_t { DAMAGE, AILMENT, NET_GOOD_STATS, OHKO, OTHER };
+
+// Returns OTHER for any other category name
+MoveCategory parseMoveCategory(const std::string& name);
+
+// Immutable definition of a move, shared by every Move slot that uses it.
+// Definitions are interned in DataRegistry and never freed, so a Move only
+// holds a pointer to one.
+struct MoveDef {
   std::string name;
-  int accuracy;
-  int effect_chance;
-  int pp;          // Maximum PP
-  int current_pp;  // Current remaining PP
-  int priority;
-  int power;
+  int accuracy = 100;
+  int effect_chance = -1;
+  int pp = 0;  // Maximum PP
+  int priority = 0;
+  int power = 0;
 
   // Type of move
-  std::string damage_class;
+  DamageClass damage_class = DamageClass::PHYSICAL;
   std::string type;
+  PokemonType type_id = PokemonType::NONE;  // type, parsed when the def is loaded or interned
 
   // Move effects
-  std::string ailment_name;
-  int ailment_chance;
+  std::string ailment_name = "none";
+  MoveAilment ailment_id = MoveAilment::NONE;  // ailment_name, parsed like type_id
+  int ailment_chance = 0;
   std::string category;
-  int crit_rate;
-  int drain;
-  int flinch_chance;
-  int healing;
-  int max_hits;
-  int max_turns;
-  int min_hits;
-  int min_turns;
-  int stat_chance;
+  MoveCategory category_id = MoveCategory::OTHER;  // category, parsed like type_id
+  int crit_rate = 0;
+  int drain = 0;
+  int flinch_chance = 0;
+  int healing = 0;
+  int max_hits = 1;
+  int max_turns = 1;
+  int min_hits = 1;
+  int min_turns = 1;
+  int stat_chance = 0;
 
   // Multi-turn move properties
-  MultiTurnBehavior multi_turn_behavior;
-  bool is_weather_dependent;      // For Solar Beam - skips charge in sunny weather
-  bool boosts_defense_on_charge;  // For Skull Bash - defense boost during charge
+  MultiTurnBehavior multi_turn_behavior = MultiTurnBehavior::NONE;
+  bool is_weather_dependent = false;      // For Solar Beam - skips charge in sunny weather
+  bool boosts_defense_on_charge = false;  // For Skull Bash - defense boost during charge
+
+  // Loads the named data file (from the data pack when current); returns
+  // false if the name or file fails validation
+  bool loadFromData(const std::string &moveName);
+  // Returns false if the file is missing or fails validation
+  bool loadFromJson(const std::string &file_path);
+  // Multi-turn properties derived from the move name
+  void configureMultiTurnBehavior();
 
-  // Constructor
+  bool operator==(const MoveDef& other) const;
+  bool operator!=(const MoveDef& other) const { return !(*this == other); }
+};
+
+// One move slot of a Pokemon: the shared definition plus per-battle state.
+// Trivially copyable, so copying a team copies no strings.
+class Move {
+ public:
+  // Constructor: uses the interned definition from DataRegistry
   explicit Move(const std::string &moveName);
+  // Interns def (identical definitions are shared); PP starts full
+  explicit Move(const MoveDef &def);
+
+  // Default constructor: an empty definition with no PP
+  Move();
 
-  // Default constructor
-  Move() = default;
+  const MoveDef &def() const { return *def_; }
+  // Points this slot at another definition, keeping its remaining PP
+  // (capped at the new maximum)
+  void setDef(const MoveDef &def);
+
+  int current_pp;  // Current remaining PP
+  bool disabled;   // Cannot be selected this battle until cleared, whatever its PP
 
   // PP Management methods
-  bool canUse() const;              // Check if move has PP remaining
+  bool canUse() const;              // Check if move has PP remaining and is not disabled
   bool usePP();                     // Use 1 PP, returns false if no PP left
   void restorePP(int amount = -1);  // Restore PP (default restores to max)
   int getRemainingPP() const;       // Get current PP
@@ -77,5 +129,7 @@ class Move {
   MultiTurnBehavior getMultiTurnBehavior() const;
 
  private:
-  void loadFromJson(const std::string &file_path);
-};
\ No newline at end of file
+  const MoveDef *def_;
+};
+
+static_assert(std::is_trivially_copyable<Move>::value, "Move slots must stay memcpy-able");
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "battle_rng.h"
 #include "json.hpp"
 #include "move.h"
 
@@ -25,7 +26,7 @@ class Pokemon {
   // Basic info
   std::string name;
   int id;
-  std::vector<std::string> types;
+  PokemonTypes types;
 
   // Base stats
   int hp;
@@ -59,7 +60,7 @@ class Pokemon {
 
   // Constructors
   Pokemon();
-  explicit Pokemon(const std::string &pokemonName);
+  explicit Pokemon(const std::string &pokemonName);  // Copies the interned species
 
   // Utility methods
   void loadMoves();
@@ -68,12 +69,17 @@ class Pokemon {
   void takeDamage(int damage);
   void heal(int amount);
 
-  // Status condition methods
+  // Status condition methods. The overloads taking a BattleRng draw from
+  // the battle's stream; the others from a per-thread unseeded one.
   void applyStatusCondition(StatusCondition newStatus);
-  void processStatusCondition();
+  void applyStatusCondition(StatusCondition newStatus, BattleRng &rng);
+  void processStatusCondition(std::ostream &out = std::cout);
+  void processStatusCondition(std::ostream &out, BattleRng &rng);
   bool canAct() const;
+  bool canAct(BattleRng &rng) const;
   bool canAct(std::mt19937& rng) const;
   std::string getStatusConditionName() const;
+  static std::string getStatusConditionName(StatusCondition condition);
   bool hasStatusCondition() const { return status != StatusCondition::NONE; }
   void clearStatusCondition() {
     status = StatusCondition::NONE;
@@ -96,7 +102,8 @@ class Pokemon {
   void resetStatStages();
 
   // Multi-turn move state management
-  void startCharging(int moveIndex, const std::string& moveName);
+  void startCharging(int moveIndex, const std::string& moveName,
+                     std::ostream& out = std::cout);
   void finishCharging();
   void startRecharge();
   void finishRecharge();
@@ -105,7 +112,15 @@ class Pokemon {
   int getChargingMoveIndex() const { return charging_move_index; }
   std::string getChargingMoveName() const { return charging_move_name; }
   bool canActThisTurn() const;  // Combines status and multi-turn restrictions
+  bool canActThisTurn(BattleRng &rng) const;
 
  private:
-  void loadFromJson(const std::string &file_path);
+  friend class DataPack;
+  friend class DataRegistry;
+
+  // Loads the named data file (from the data pack when current); returns
+  // false if the name or file fails validation
+  bool loadFromData(const std::string &name);
+  // Returns false if the file is missing or fails validation
+  bool loadFromJson(const std::string &file_path);
 };
\ No newline at end of file
@@ -1,19 +1,35 @@
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <set>
 #include "json.hpp"
 #include "input_validator.h"
 
+class DataPack;
+
 /**
  * @brief Manages Pokemon and move data loading with security validation
  * 
  * This class provides secure access to Pokemon and move data from the data directory.
  * It uses InputValidator for all file operations and maintains caches of available
  * Pokemon and moves for efficient team building operations.
+ *
+ * The loaded data lives in an immutable Snapshot. Loads and reloads build a
+ * new snapshot and publish it atomically, so readers never block on a reload
+ * and anyone holding a snapshot keeps a consistent view of it.
  */
 class PokemonData {
 public:
@@ -63,6 +79,19 @@ public:
               ailment_name(ailment_name), ailment_chance(ailment_chance) {}
     };
 
+    /**
+     * @brief Wall-clock time spent in each phase of a load
+     *
+     * When the data pack is used, parse covers reading the pack and the
+     * other phases except index_build stay zero.
+     */
+    struct PhaseTimings {
+        std::chrono::microseconds scan{0};         ///< Listing the data directories
+        std::chrono::microseconds validation{0};   ///< File accessibility checks
+        std::chrono::microseconds parse{0};        ///< Reading and parsing the files
+        std::chrono::microseconds index_build{0};  ///< Merging and organizeDataByTypes
+    };
+
     /**
      * @brief Result of data loading operations
      */
@@ -71,14 +100,145 @@ public:
         std::string error_message;
         int loaded_count;
         int failed_count;
+        PhaseTimings timings;
+        unsigned int threads_used = 1;  ///< Loader threads, including the caller
+        int added_count = 0;            ///< Files reloadData() found new
+        int changed_count = 0;          ///< Files reloadData() found modified
+        int removed_count = 0;          ///< Files reloadData() found deleted
         
         LoadResult(bool success = true, const std::string& message = "", 
                   int loaded = 0, int failed = 0)
             : success(success), error_message(message), loaded_count(loaded), failed_count(failed) {}
     };
 
+    /**
+     * @brief Inclusive range of values; the default matches everything
+     */
+    struct IntRange {
+        int min = std::numeric_limits<int>::min();
+        int max = std::numeric_limits<int>::max();
+        
+        bool isUnbounded() const {
+            return min == std::numeric_limits<int>::min() && max == std::numeric_limits<int>::max();
+        }
+    };
+
+    /**
+     * @brief Criteria for a Pokemon query; empty criteria match everything
+     */
+    struct PokemonQuery {
+        std::vector<std::string> types;           ///< Must have every one of these types
+        std::vector<std::string> excluded_types;  ///< Must have none of these types
+        IntRange hp;
+        IntRange attack;
+        IntRange defense;
+        IntRange special_attack;
+        IntRange special_defense;
+        IntRange speed;
+    };
+
+    /**
+     * @brief Criteria for a move query; empty criteria match everything
+     */
+    struct MoveQuery {
+        std::string type;          ///< e.g. "water"
+        std::string damage_class;  ///< "physical", "special" or "status"
+        std::string ailment;       ///< Ailment name, e.g. "paralysis"
+        IntRange power;
+        IntRange priority;
+        IntRange accuracy;
+    };
+
+    /**
+     * @brief Position of an entry in a snapshot's name-sorted lists
+     *
+     * Ids are only meaningful for the snapshot that produced them.
+     */
+    using EntryId = uint32_t;
+
+    /**
+     * @brief Secondary indexes over one snapshot's entries
+     *
+     * Categorical fields map to bitsets over entry ids and numeric fields to
+     * ids ordered by value, so a compound query is a handful of bitset
+     * intersections. Built for every full load; a reload that only edits
+     * existing entries updates the bits and orderings of those entries.
+     */
+    struct QueryIndex {
+        using Bits = std::vector<uint64_t>;
+        
+        std::vector<const PokemonInfo*> pokemon;  ///< Sorted by name
+        std::vector<const MoveInfo*> moves;       ///< Sorted by name
+        std::vector<std::string> pokemon_names;   ///< Names of pokemon, in the same order
+        std::vector<std::string> move_names;      ///< Names of moves, in the same order
+        
+        std::unordered_map<std::string, Bits> pokemon_types;
+        std::array<std::vector<EntryId>, 6> pokemon_by_stat;  ///< hp ... speed, ascending
+        
+        std::unordered_map<std::string, Bits> move_types;
+        std::unordered_map<std::string, Bits> move_damage_classes;
+        std::unordered_map<std::string, Bits> move_ailments;
+        std::vector<EntryId> moves_by_power;
+        std::vector<EntryId> moves_by_priority;
+        std::vector<EntryId> moves_by_accuracy;
+    };
+
+    /**
+     * @brief Immutable view of the loaded data
+     *
+     * A reload never modifies a published snapshot; holding one (e.g. for
+     * the length of a battle) pins that version of the data.
+     */
+    struct Snapshot {
+        std::unordered_map<std::string, PokemonInfo> pokemon_data;
+        std::unordered_map<std::string, MoveInfo> move_data;
+        
+        // Type organization for quick lookups
+        std::unordered_map<std::string, std::vector<std::string>> pokemon_by_type;
+        std::unordered_map<std::string, std::vector<std::string>> moves_by_type;
+        std::unordered_map<std::string, std::vector<std::string>> moves_by_damage_class;
+        
+        QueryIndex index;
+        
+        bool from_pack = false;
+        uint64_t generation = 0;  ///< Increases with every published snapshot
+        
+        /**
+         * @brief Find the Pokemon matching every criterion of a query
+         * @return Ids in name order; resolve them with pokemon()
+         */
+        std::vector<EntryId> findPokemon(const PokemonQuery& query) const;
+        
+        /**
+         * @brief Find the moves matching every criterion of a query
+         * @return Ids in name order; resolve them with move()
+         */
+        std::vector<EntryId> findMoves(const MoveQuery& query) const;
+        
+        const PokemonInfo& pokemon(EntryId id) const { return *index.pokemon[id]; }
+        const MoveInfo& move(EntryId id) const { return *index.moves[id]; }
+        
+        /**
+         * @brief Look up a Pokemon in place
+         *
+         * Lowercase names are looked up without allocating.
+         * @param name Pokemon name (case-insensitive)
+         * @return The entry, or nullptr if there is none
+         */
+        const PokemonInfo* findPokemonInfo(const std::string& name) const;
+        
+        /**
+         * @brief Look up a move in place
+         * @param name Move name (case-insensitive)
+         * @return The entry, or nullptr if there is none
+         */
+        const MoveInfo* findMoveInfo(const std::string& name) const;
+    };
+
     // Constructor and initialization
     PokemonData();
+    PokemonData(const PokemonData&) = delete;
+    PokemonData& operator=(const PokemonData&) = delete;
 
     /**
      * @brief Initialize the data loader by scanning data directories
@@ -90,11 +250,47 @@ public:
                          const std::string& moves_dir = "data/moves");
 
     /**
-     * @brief Reload all data from directories (useful for data updates)
-     * @return LoadResult indicating success/failure and counts
+     * @brief Pick up changes to the data directories without a full reload
+     *
+     * Files whose size or modification time changed are re-read, and only
+     * those whose content hash also changed are parsed again; added and
+     * removed files are applied the same way. The indexes are updated for
+     * the affected entries and the result is published as a new snapshot.
+     * Nothing is published if no file changed. Data loaded from the pack is
+     * reloaded in full from JSON once the pack goes stale.
+     * DataRegistry::reload() runs as well, so Pokemon and moves built for
+     * new battles see the changes.
+     * @return LoadResult with the files parsed and the added/changed/removed counts
      */
     LoadResult reloadData();
 
+    /**
+     * @brief Check whether the current data was read from the compiled data pack
+     * @return True if data came from a current pack rather than the JSON files
+     */
+    bool isUsingDataPack() const { return snapshot()->from_pack; }
+
+    /**
+     * @brief Get the current snapshot
+     * @return Snapshot that stays valid and unchanged for as long as it is held
+     */
+    std::shared_ptr<const Snapshot> snapshot() const;
+
+    /**
+     * @brief Get the generation of the current snapshot
+     *
+     * Caches derived from this data compare it with the generation they were
+     * filled at and drop their entries when it moves on.
+     * @return Generation number, increasing with each load or reload
+     */
+    uint64_t generation() const { return snapshot()->generation; }
+
+    /**
+     * @brief Set how many threads initialize() uses to read JSON files
+     * @param threads Thread count; 0 (the default) uses one per hardware thread
+     */
+    void setLoaderThreads(unsigned int threads) { loader_threads = threads; }
+
     // Pokemon data access
     /**
      * @brief Get list of all available Pokemon names
@@ -102,6 +298,12 @@ public:
      */
     std::vector<std::string> getAvailablePokemon() const;
 
+    /**
+     * @brief Get the sorted Pokemon names without copying them
+     * @return Names, kept alive by the pointer across reloads
+     */
+    std::shared_ptr<const std::vector<std::string>> pokemonNames() const;
+
     /**
      * @brief Get information about a specific Pokemon
      * @param name Pokemon name (case-insensitive)
@@ -109,6 +311,13 @@ public:
      */
     std::optional<PokemonInfo> getPokemonInfo(const std::string& name) const;
 
+    /**
+     * @brief Get information about a specific Pokemon without copying it
+     * @param name Pokemon name (case-insensitive)
+     * @return The entry, kept alive by the pointer across reloads; null if not found
+     */
+    std::shared_ptr<const PokemonInfo> pokemonInfo(const std::string& name) const;
+
     /**
      * @brief Check if a Pokemon exists in the data
      * @param name Pokemon name (case-insensitive)
@@ -130,6 +339,12 @@ public:
      */
     std::vector<std::string> getAvailableMoves() const;
 
+    /**
+     * @brief Get the sorted move names without copying them
+     * @return Names, kept alive by the pointer across reloads
+     */
+    std::shared_ptr<const std::vector<std::string>> moveNames() const;
+
     /**
      * @brief Get information about a specific move
      * @param name Move name (case-insensitive)
@@ -137,6 +352,13 @@ public:
      */
     std::optional<MoveInfo> getMoveInfo(const std::string& name) const;
 
+    /**
+     * @brief Get information about a specific move without copying it
+     * @param name Move name (case-insensitive)
+     * @return The entry, kept alive by the pointer across reloads; null if not found
+     */
+    std::shared_ptr<const MoveInfo> moveInfo(const std::string& name) const;
+
     /**
      * @brief Check if a move exists in the data
      * @param name Move name (case-insensitive)
@@ -158,6 +380,25 @@ public:
      */
     std::vector<std::string> getMovesByDamageClass(const std::string& damage_class) const;
 
+    // Indexed queries
+    /**
+     * @brief Get the names of the Pokemon matching a query
+     *
+     * Use snapshot()->findPokemon() to get ids and read entries in place.
+     * @param query Criteria, all of which must match
+     * @return Matching Pokemon names, sorted
+     */
+    std::vector<std::string> findPokemonNames(const PokemonQuery& query) const;
+
+    /**
+     * @brief Get the names of the moves matching a query
+     *
+     * Use snapshot()->findMoves() to get ids and read entries in place.
+     * @param query Criteria, all of which must match
+     * @return Matching move names, sorted
+     */
+    std::vector<std::string> findMoveNames(const MoveQuery& query) const;
+
     // Team building utilities
     /**
      * @brief Check if Pokemon and move names are compatible for team building
@@ -198,56 +439,186 @@ public:
      */
     void clearCache();
 
+    /**
+     * @brief Hash used to tell whether a data file's contents changed
+     * @param contents Raw file contents
+     * @return FNV-1a (64-bit) of the contents
+     */
+    static uint64_t contentHash(const std::string& contents);
+
 private:
-    // Data storage
-    std::unordered_map<std::string, PokemonInfo> pokemon_data;
-    std::unordered_map<std::string, MoveInfo> move_data;
+    /**
+     * @brief What the last load or reload saw of a data file
+     */
+    struct SourceFile {
+        std::filesystem::file_time_type mtime{};
+        std::uintmax_t size = 0;
+        uint64_t hash = 0;  ///< FNV-1a of the contents
+        bool is_move = false;
+        std::string key;    ///< Normalized name it defines; empty if it failed to load
+    };
+    
+    /**
+     * @brief A data file found by a directory scan
+     */
+    struct ScannedFile {
+        std::string path;
+        std::filesystem::file_time_type mtime;
+        std::uintmax_t size;
+        bool is_move;
+    };
+    
+    /**
+     * @brief Outcome of reading and parsing one data file
+     */
+    struct ParsedFile {
+        bool read = false;    ///< Contents were read and hashed
+        bool parsed = false;
+        uint64_t hash = 0;
+        PokemonInfo pokemon;  ///< Set for a parsed Pokemon file
+        MoveInfo move;        ///< Set for a parsed move file
+    };
+    
+    // Current snapshot; only accessed through std::atomic_load/atomic_store
+    std::shared_ptr<const Snapshot> current_snapshot;
+    
+    // Serializes initialize, reloadData and clearCache; readers never take it
+    std::mutex reload_mutex;
     
     // Directory paths
     std::string pokemon_directory;
     std::string moves_directory;
     
-    // Type organization for quick lookups
-    std::unordered_map<std::string, std::vector<std::string>> pokemon_by_type;
-    std::unordered_map<std::string, std::vector<std::string>> moves_by_type;
-    std::unordered_map<std::string, std::vector<std::string>> moves_by_damage_class;
+    // Source files of the current JSON data by path, for reloadData; empty
+    // when the data came from a pack. Guarded by reload_mutex.
+    std::map<std::string, SourceFile> source_files;
     
     // Loading state
     bool is_initialized;
+    unsigned int loader_threads;
     
     // Helper methods
     /**
-     * @brief Load all Pokemon data from directory
-     * @param directory Path to Pokemon data directory
+     * @brief Publish a snapshot as the next generation
+     * @param snapshot Fully built snapshot; not modified after this call
+     */
+    void publish(std::shared_ptr<Snapshot> snapshot);
+    
+    /**
+     * @brief Publish a snapshot whose query index is already current
+     * @param snapshot Fully built and indexed snapshot
+     */
+    void publishIndexed(std::shared_ptr<Snapshot> snapshot);
+    
+    /**
+     * @brief Fill a snapshot's data maps from the catalog tables of a data pack
+     * @param pack Open pack that is current for the loaded directories
+     * @param snapshot Snapshot to fill
+     */
+    void loadFromPack(const DataPack& pack, Snapshot& snapshot) const;
+    
+    /**
+     * @brief Load both directories' JSON files across a pool of threads
+     *
+     * Files are listed, checked and parsed in parallel into per-file slots,
+     * then merged in file name order so the result doesn't depend on the
+     * thread count. Records every file in source_files.
+     * @param snapshot Snapshot to fill
+     * @return LoadResult with counts and per-phase timings
+     */
+    LoadResult loadJsonData(Snapshot& snapshot);
+    
+    /**
+     * @brief Full load into a new snapshot: the pack if current, else JSON
+     * @return LoadResult of the load; the snapshot is published either way
+     */
+    LoadResult loadAll();
+    
+    /**
+     * @brief The catalog part of reloadData(); caller holds reload_mutex
+     * @return LoadResult as described for reloadData()
+     */
+    LoadResult reloadChanged();
+    
+    /**
+     * @brief List the JSON files in both configured data directories
+     * @param files Receives Pokemon files, then move files, each sorted by path
      * @return LoadResult with success/failure information
      */
-    LoadResult loadPokemonData(const std::string& directory);
+    LoadResult scanDataDirectories(std::vector<ScannedFile>& files) const;
     
     /**
-     * @brief Load all move data from directory
-     * @param directory Path to moves data directory
+     * @brief List the JSON files in a data directory, sorted by name
+     * @param directory Path to the data directory
+     * @param label "Pokemon" or "Moves", used in error messages
+     * @param is_move Whether the directory holds moves
+     * @param files Receives the files
      * @return LoadResult with success/failure information
      */
-    LoadResult loadMoveData(const std::string& directory);
+    LoadResult scanDataDirectory(const std::string& directory, const std::string& label,
+                                 bool is_move, std::vector<ScannedFile>& files) const;
     
     /**
-     * @brief Load a single Pokemon JSON file with error handling
-     * @param file_path Path to Pokemon JSON file
-     * @return True if loaded successfully
+     * @brief Check, read, hash and parse files across a pool of threads
+     * @param files Files to parse
+     * @param result Receives the validation/parse timings and thread count
+     * @return One ParsedFile per input file, in the same order
      */
-    bool loadPokemonFile(const std::string& file_path);
+    std::vector<ParsedFile> parseFiles(const std::vector<ScannedFile>& files,
+                                       LoadResult& result) const;
     
     /**
-     * @brief Load a single move JSON file with error handling
-     * @param file_path Path to move JSON file
-     * @return True if loaded successfully
+     * @brief Parse a single Pokemon JSON file with error handling
+     * @param file_path Path to Pokemon JSON file, used in error messages
+     * @param contents The file's contents
+     * @param pokemon_info Receives the Pokemon on success
+     * @param log Stream for error messages
+     * @return True if parsed successfully
      */
-    bool loadMoveFile(const std::string& file_path);
+    bool parsePokemonFile(const std::string& file_path, const std::string& contents,
+                          PokemonInfo& pokemon_info, std::ostream& log) const;
     
     /**
-     * @brief Organize data by types for quick lookups
+     * @brief Parse a single move JSON file with error handling
+     * @param file_path Path to move JSON file, used in error messages
+     * @param contents The file's contents
+     * @param move_info Receives the move on success
+     * @param log Stream for error messages
+     * @return True if parsed successfully
      */
-    void organizeDataByTypes();
+    bool parseMoveFile(const std::string& file_path, const std::string& contents,
+                       MoveInfo& move_info, std::ostream& log) const;
+    
+    /**
+     * @brief Organize a snapshot's data by types for quick lookups
+     */
+    static void organizeDataByTypes(Snapshot& snapshot);
+    
+    /**
+     * @brief Build a snapshot's query index from its data maps
+     */
+    static void buildQueryIndex(Snapshot& snapshot);
+    
+    /**
+     * @brief Update a copied query index for entries edited in place
+     * @param snapshot Copy of a snapshot whose entries it was built from are
+     *                 still alive, with the changed entries replaced
+     * @param changed (is_move, key) of every entry that may have changed
+     * @return False, leaving the index to be rebuilt, if entries were added
+     *         or removed
+     */
+    static bool updateQueryIndex(Snapshot& snapshot,
+                                 const std::set<std::pair<bool, std::string>>& changed);
+    
+    /**
+     * @brief Set or erase one entry of a snapshot, keeping its indexes in step
+     * @param snapshot Snapshot being built
+     * @param key Normalized name
+     * @param parsed New value, or nullptr to erase the entry
+     * @param is_move Whether the entry is a move
+     */
+    static void replaceEntry(Snapshot& snapshot, const std::string& key,
+                             const ParsedFile* parsed, bool is_move);
     
     /**
      * @brief Normalize name for case-insensitive lookups
@@ -269,10 +640,4 @@ private:
      * @return True if valid Move JSON
      */
     bool validateMoveJson(const nlohmann::json& json_data) const;
-    
-    /**
-     * @brief Get type effectiveness data (hardcoded for now)
-     * @return Map of type effectiveness multipliers
-     */
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> getTypeChart() const;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -7,6 +9,7 @@
 #include <optional>
 #include "pokemon_data.h"
 #include "input_validator.h"
+#include "ai_strategy.h"
 
 /**
  * @brief Comprehensive team building system with validation and suggestions
@@ -661,6 +664,56 @@ public:
      */
     bool deleteCustomTeam(const std::string& filename);
 
+    // Simulation-backed Battle Prediction
+    /**
+     * @brief Budget and configuration for Monte Carlo matchup simulation
+     */
+    struct SimulationSettings {
+        int max_battles;                        // Sample budget (battles to play at most)
+        int min_battles;                        // Battles played before early stopping is considered
+        std::chrono::milliseconds time_budget;  // Wall-clock budget (0 for unlimited)
+        double target_half_width;               // Stop once the 95% interval half-width is below this (0 disables)
+        unsigned int worker_threads;            // Number of workers (0 for hardware concurrency)
+        uint64_t seed;                          // Base seed; each worker derives its own RNG stream
+        AIDifficulty ai_difficulty;             // AI driving both teams
+        int max_turns_per_battle;               // Turn limit before a battle is scored as a draw
+
+        SimulationSettings()
+            : max_battles(200), min_battles(30), time_budget(0), target_half_width(0.05),
+              worker_threads(0), seed(0), ai_difficulty(AIDifficulty::MEDIUM),
+              max_turns_per_battle(300) {}
+    };
+
+    /**
+     * @brief Outcome of a Monte Carlo matchup simulation
+     */
+    struct SimulationResult {
+        double team1_win_probability;           // Draws count as half a win
+        double confidence_low;                  // 95% Wilson score interval
+        double confidence_high;
+        int battles_played;
+        int team1_wins;
+        int team2_wins;
+        int draws;
+        double average_turns;
+        bool stopped_early;                     // Interval reached the target before the budget ran out
+
+        SimulationResult()
+            : team1_win_probability(0.5), confidence_low(0.0), confidence_high(1.0),
+              battles_played(0), team1_wins(0), team2_wins(0), draws(0),
+              average_turns(0.0), stopped_early(false) {}
+    };
+
+    /**
+     * @brief Estimate team1's win probability by playing seeded AI-vs-AI battles
+     * @param team1 First team (player side)
+     * @param team2 Second team (opponent side)
+     * @param settings Sample/time budget, worker count, seed and AI difficulty
+     * @return Win probability with confidence interval and battle tallies
+     */
+    SimulationResult simulateBattleOutcome(const Team& team1, const Team& team2,
+                                           const SimulationSettings& settings = SimulationSettings()) const;
+
     // Team Comparison and Analysis Methods
     /**
      * @brief Compare two teams and provide detailed analysis
@@ -688,6 +741,7 @@ public:
         // Predicted battle outcome
         double team1_win_probability;
         std::string battle_prediction_reasoning;
+        std::optional<SimulationResult> simulation;  // Set when the outcome was simulated
         
         // Improvement suggestions
         std::vector<std::string> team1_improvement_suggestions;
@@ -696,6 +750,16 @@ public:
     
     TeamComparison compareTeams(const Team& team1, const Team& team2) const;
 
+    /**
+     * @brief Compare two teams, predicting the outcome by simulation
+     * @param team1 First team to compare
+     * @param team2 Second team to compare
+     * @param simulation Simulation budget used for the win probability
+     * @return Detailed comparison analysis with simulation results attached
+     */
+    TeamComparison compareTeams(const Team& team1, const Team& team2,
+                                const SimulationSettings& simulation) const;
+
     // Battle History and Statistics Methods
     /**
      * @brief Record a battle result for team statistics
@@ -753,6 +817,22 @@ public:
     Team generateCounterTeam(const Team& target_team, const std::string& team_name,
                             double strictness = 0.7) const;
 
+    /**
+     * @brief Generate counter team, refining the heuristic picks by simulation
+     *
+     * Starts from the heuristic counter team and tries swapping in alternate
+     * counter Pokemon one slot at a time, keeping a swap when it raises the
+     * simulated win probability. The simulation budget is shared across all
+     * candidate evaluations.
+     * @param target_team Team to counter
+     * @param team_name Name for the counter team
+     * @param strictness How strictly to counter (0.0-1.0, higher = more focused)
+     * @param simulation Total simulation budget
+     * @return Generated counter team
+     */
+    Team generateCounterTeam(const Team& target_team, const std::string& team_name,
+                            double strictness, const SimulationSettings& simulation) const;
+
 private:
     std::shared_ptr<PokemonData> pokemon_data;
     ValidationSettings validation_settings;
@@ -768,9 +848,11 @@ private:
     // Draft session management
     std::unordered_map<std::string, DraftSession> active_draft_sessions;
     
-    // Performance optimization caches
+    // Performance optimization caches, filled from PokemonData generation
+    // cache_generation and dropped when a reload publishes a newer one
     mutable std::unordered_map<std::string, std::vector<std::string>> pokemon_type_cache;
     mutable std::unordered_map<std::string, std::vector<std::string>> pokemon_moves_cache;
+    mutable uint64_t cache_generation;
 
     // Validation helper methods
     bool validateTeamSize(const Team& team, std::vector<std::string>& errors, 
@@ -846,12 +928,15 @@ private:
     // Performance optimization helper methods
     void preloadPokemonData() const;
     void clearPerformanceCaches() const;
+    void dropStaleCaches() const;
     std::vector<std::string> getCachedPokemonTypes(const std::string& pokemon_name) const;
     std::vector<std::string> getCachedPokemonMoves(const std::string& pokemon_name) const;
 
     // Enhanced generation helper methods
     std::vector<std::string> getMetaTierPokemon(const std::string& tier) const;
     std::vector<std::string> getCounterPokemon(const std::string& target_pokemon) const;
+    std::vector<std::string> selectCounterPokemon(const Team& target_team, double strictness,
+                                                  size_t count) const;
     double calculatePokemonSynergy(const std::vector<std::string>& team_pokemon) const;
     std::vector<std::string> optimizeTeamComposition(const std::vector<std::string>& base_team) const;
 };
\ No newline at end of file
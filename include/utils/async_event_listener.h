@@ -0,0 +1,149 @@
+#pragma once
+
+#include "battle_events.h"
+#include "move.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// Event listener adapter that hands events to another listener on its own
+// thread, so slow consumers (rendering, logging, metrics) don't stall the
+// battle loop.
+//
+// Events are copied into a bounded single-producer/single-consumer ring and
+// drained by a consumer thread. Notification never locks unless the consumer
+// is parked and needs waking. The battle may have moved on, or be gone, by
+// the time an event arrives, so delivered events never point into it: each
+// Pokemon is a consumer-side stand-in with the name, HP and status it had
+// when the event was queued (one stand-in per battle Pokemon, so pointers
+// still work as identities within a battle), and each Move is a copy of the
+// slot. Both are valid for the duration of the call. Stand-ins are dropped
+// at each battle start and end, which the adapter always subscribes to and
+// forwards only if the target does.
+//
+// Subscribe the adapter to one event manager, notified from one thread.
+class AsyncEventListener : public BattleEvents::BattleEventListener {
+public:
+    // What to do with an event when the ring is full
+    enum class OverflowPolicy {
+        BLOCK,   // Wait for the consumer to make room
+        DROP,    // Discard the event
+        SAMPLE   // Past half full, keep one event in sampleEvery; discard when full
+    };
+
+    struct Config {
+        size_t capacity = 4096;  // Rounded up to a power of two
+        OverflowPolicy overflow = OverflowPolicy::DROP;
+        int sampleEvery = 8;
+    };
+
+    explicit AsyncEventListener(std::shared_ptr<BattleEvents::BattleEventListener> target);
+    AsyncEventListener(std::shared_ptr<BattleEvents::BattleEventListener> target,
+                       const Config& config);
+    // Delivers whatever is still queued, then stops the consumer thread
+    ~AsyncEventListener() override;
+
+    AsyncEventListener(const AsyncEventListener&) = delete;
+    AsyncEventListener& operator=(const AsyncEventListener&) = delete;
+
+    // BattleEventListener interface: the target's subscriptions plus battle
+    // start and end
+    BattleEvents::EventMask subscribedEvents() const override { return events_; }
+    void onHealthChanged(const BattleEvents::HealthChangeEvent& event) override;
+    void onStatusChanged(const BattleEvents::StatusChangeEvent& event) override;
+    void onMoveUsed(const BattleEvents::MoveUsedEvent& event) override;
+    void onWeatherChanged(const BattleEvents::WeatherChangeEvent& event) override;
+    void onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) override;
+    void onBattleStart(const BattleEvents::BattleStartEvent& event) override;
+    void onBattleEnd(const BattleEvents::BattleEndEvent& event) override;
+    void onTurnStart(int turnNumber) override;
+    void onTurnEnd(int turnNumber) override;
+    void onMultiTurnMove(const BattleEvents::MultiTurnMoveEvent& event) override;
+
+    // Waits until every event queued so far has been delivered
+    void flush();
+
+    size_t capacity() const { return slots_.size(); }
+    uint64_t queuedEvents() const { return queued_.load(std::memory_order_relaxed); }
+    uint64_t deliveredEvents() const { return head_.load(std::memory_order_acquire); }
+    // Events discarded because the ring was full, and of those, how many by sampling
+    uint64_t droppedEvents() const { return dropped_.load(std::memory_order_relaxed); }
+    uint64_t sampledOutEvents() const { return sampledOut_.load(std::memory_order_relaxed); }
+
+private:
+    struct TurnEvent {
+        int turnNumber;
+        bool isEnd;
+    };
+
+    // What targets may read of a Pokemon, copied when its event is queued
+    struct PokemonState {
+        const Pokemon* identity = nullptr;
+        std::string name;
+        int hp = 0;
+        int currentHp = 0;
+        StatusCondition status{};
+    };
+
+    using QueuedEvent = std::variant<BattleEvents::HealthChangeEvent,
+                                     BattleEvents::StatusChangeEvent,
+                                     BattleEvents::MoveUsedEvent,
+                                     BattleEvents::WeatherChangeEvent,
+                                     BattleEvents::PokemonSwitchEvent,
+                                     BattleEvents::BattleStartEvent,
+                                     BattleEvents::BattleEndEvent,
+                                     BattleEvents::MultiTurnMoveEvent,
+                                     TurnEvent>;
+
+    // An event and copies of the Pokemon and move it refers to
+    struct Slot {
+        QueuedEvent event;
+        PokemonState pokemon[2];
+        Move move;
+    };
+
+    std::shared_ptr<BattleEvents::BattleEventListener> target_;
+    BattleEvents::EventMask targetEvents_;
+    BattleEvents::EventMask events_;
+    OverflowPolicy overflow_;
+    int sampleEvery_;
+
+    std::vector<Slot> slots_;
+    size_t mask_;
+
+    // Producer and consumer positions on separate cache lines; each side
+    // caches the other's so it rarely has to read it
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    uint64_t cachedHead_ = 0;
+    uint64_t sampleCounter_ = 0;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint64_t cachedTail_ = 0;
+
+    alignas(64) std::atomic<uint64_t> queued_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> sampledOut_{0};
+
+    // Parking for the consumer when the ring is empty
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> consumerParked_{false};
+    std::atomic<bool> stopping_{false};
+    // Consumer-only: the stand-in for each Pokemon seen in the current battle
+    std::unordered_map<const Pokemon*, std::unique_ptr<Pokemon>> standIns_;
+    std::thread consumer_;
+
+    void push(const QueuedEvent& event, const Pokemon* first = nullptr,
+              const Pokemon* second = nullptr, const Move* move = nullptr);
+    static void capture(PokemonState& state, const Pokemon* pokemon);
+    void consume();
+    Pokemon* standIn(const PokemonState& state);
+    void deliver(Slot& slot);
+};
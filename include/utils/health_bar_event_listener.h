@@ -14,6 +14,7 @@ public:
     ~HealthBarEventListener() override = default;
 
     // BattleEventListener interface
+    BattleEvents::EventMask subscribedEvents() const override;
     void onHealthChanged(const BattleEvents::HealthChangeEvent& event) override;
     void onBattleStart(const BattleEvents::BattleStartEvent& event) override;
     void onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) override;
@@ -36,7 +37,7 @@ private:
     
     // Helper methods
     std::string getPokemonDisplayName(Pokemon* pokemon) const;
-    void updateHealthBar(Pokemon* pokemon, int newHealth, int previousHealth, const std::string& source);
+    void updateHealthBar(Pokemon* pokemon, int newHealth, int previousHealth, BattleEvents::EventSource source);
 };
 
 // Factory function for easy creation
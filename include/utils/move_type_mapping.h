@@ -1,22 +1,18 @@
 #pragma once
 
-#include <map>
 #include <string>
+#include <string_view>
 
+#include "type_effectiveness.h"
+
+// Built-in move name -> type table. The table is a constexpr array sorted by
+// name, so lookups are a binary search with no runtime initialisation and
+// are safe from any number of threads.
 class MoveTypeMapping {
  public:
-  // Get the type of a move by its name
+  // Get the type of a move by its name; "normal" if the move isn't known
   static std::string getMoveType(const std::string &moveName);
 
- private:
-  // Map of move names to their types
-  static std::map<std::string, std::string> moveTypeMap;
-
-  // Initialise the move type mapping
-  static void initialiseMoveTypes();
-
-  // Ensure mapping is initialised
-  static void ensureInitialised();
-
-  static bool initialised;
-};
\ No newline at end of file
+  // Same lookup as an enum; PokemonType::NORMAL if the move isn't known
+  static PokemonType getMoveTypeId(std::string_view moveName);
+};
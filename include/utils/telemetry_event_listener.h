@@ -0,0 +1,198 @@
+#pragma once
+
+#include "battle_events.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+struct MoveDef;
+
+// Columnar battle telemetry.
+//
+// Battle events are recorded as rows of a few fixed tables and written
+// column by column into append-only files, one per table, so analyses of
+// move usage or damage can read just the columns they need without parsing
+// logs. Species and move names are dictionary-encoded as dense IDs.
+//
+// File layout: each <table>.col file is a sequence of blocks, one per flush:
+//
+//   "PKCB" | u8 version | u32 rows | u8 columns
+//   per column: u8 name length | name | u8 ColumnType | u64 bytes | data
+//
+// Values are little-endian. A UTF8 column holds rows + 1 u32 offsets, then
+// the string bytes. The tables and their columns:
+//
+//   moves       battle, turn, user, move, target, hit, critical, effectiveness
+//   health      battle, turn, pokemon, old_hp, new_hp, damage, source, move
+//   switches    battle, turn, player, from, to
+//   weather     battle, turn, old_weather, new_weather, turns_remaining
+//   battles     battle, winner, turns
+//   dictionary  kind, id, name   (kind 0 is a species, 1 a move)
+//
+// Species and move IDs index the dictionary; kNoId marks "none".
+namespace Telemetry {
+
+enum class ColumnType : uint8_t { U8, U16, U32, I32, F32, UTF8 };
+
+constexpr uint32_t kNoId = 0xFFFFFFFF;
+
+// A table of equally long columns, appended row by row
+class ColumnTable {
+public:
+    struct Column {
+        std::string name;
+        ColumnType type;
+        std::vector<uint8_t> data;        // Fixed-width values, or string bytes
+        std::vector<uint32_t> offsets{0}; // UTF8 only: rows + 1 offsets into data
+    };
+
+    ColumnTable() = default;
+    ColumnTable(std::string name, std::vector<std::pair<std::string, ColumnType>> columns);
+
+    const std::string& name() const { return name_; }
+    size_t rows() const { return rows_; }
+    size_t columnCount() const { return columns_.size(); }
+    const Column& column(size_t index) const { return columns_[index]; }
+    // The column with this name, or nullptr
+    const Column* find(const std::string& name) const;
+
+    // Values for the current row, in column order; endRow() completes it
+    template<typename T>
+    void put(size_t column, T value);
+    void putString(size_t column, const std::string& value);
+    void endRow() { ++rows_; }
+
+    // Reads one value of a fixed-width column
+    template<typename T>
+    T get(size_t column, size_t row) const;
+    std::string getString(size_t column, size_t row) const;
+
+    // Appends another table with the same columns
+    void append(const ColumnTable& other);
+    void clear();
+
+    // Appends one block to file, returning false if a write failed;
+    // readBlock() reads it back into this table, replacing its contents.
+    // readBlock returns false at end or on bad data. Given onlyColumn, it
+    // keeps just that column and skips the others' data.
+    bool writeBlock(std::FILE* file) const;
+    bool readBlock(std::istream& in, const char* onlyColumn = nullptr);
+
+private:
+    std::string name_;
+    std::vector<Column> columns_;
+    size_t rows_ = 0;
+};
+
+// Shared sink that owns the files. Thread-safe: listeners on any number of
+// battle threads hand it their batches.
+class TelemetryWriter {
+public:
+    struct Config {
+        size_t flushRows = 1 << 16;  // Write once this many rows are pending
+        std::chrono::milliseconds flushInterval{5000};  // ...or this long has passed
+    };
+
+    // Creates the directory if needed; files are appended to, never truncated.
+    // Battle numbers and dictionary IDs carry on from what the files already
+    // hold, so successive writers (one at a time) can share a directory.
+    explicit TelemetryWriter(const std::string& directory);
+    TelemetryWriter(const std::string& directory, const Config& config);
+    ~TelemetryWriter();
+
+    TelemetryWriter(const TelemetryWriter&) = delete;
+    TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+    // False if a file could not be opened
+    bool isOpen() const { return open_; }
+
+    // Globally unique, increasing battle number
+    uint32_t nextBattleId();
+
+    // Dictionary IDs; new names are written with the next flush
+    uint32_t speciesId(const std::string& name);
+    uint32_t moveId(const std::string& name);
+
+    // Takes a listener's batch of rows (one table per kind); may flush
+    void append(const std::vector<ColumnTable>& batch);
+    void flush();
+
+    uint64_t rowsWritten() const;
+    // True once a write or flush has failed; rows for that table are
+    // dropped from then on and not counted as written
+    bool writeFailed() const;
+
+    static std::vector<ColumnTable> makeTables();
+
+private:
+    Config config_;
+    bool open_ = true;
+    bool writeFailed_ = false;
+    mutable std::mutex mutex_;
+    uint32_t nextBattle_ = 0;
+    std::unordered_map<std::string, uint32_t> ids_[2];
+    uint32_t nextId_[2] = {0, 0};
+    ColumnTable dictionary_;
+    std::vector<ColumnTable> pending_;
+    size_t pendingRows_ = 0;
+    uint64_t rowsWritten_ = 0;
+    std::chrono::steady_clock::time_point lastFlush_;
+    std::vector<std::FILE*> files_;  // One per table, then the dictionary
+
+    uint32_t internLocked(int kind, const std::string& name);
+    // Picks up battle numbers and dictionary IDs from earlier writers
+    void resume(const std::filesystem::path& directory);
+    void flushLocked();
+    // Writes and flushes one block; on failure reports it and closes file
+    bool writeLocked(const ColumnTable& table, std::FILE*& file);
+};
+
+// Event listener that turns one thread's battles into telemetry rows.
+//
+// Battles through a listener must run one at a time (a BattleStartEvent
+// begins each), so use one listener per battle thread, all sharing a writer.
+// Rows are buffered and handed over per battle or every batchRows rows.
+class TelemetryEventListener : public BattleEvents::BattleEventListener {
+public:
+    explicit TelemetryEventListener(std::shared_ptr<TelemetryWriter> writer,
+                                    size_t batchRows = 4096);
+    ~TelemetryEventListener() override;
+
+    BattleEvents::EventMask subscribedEvents() const override;
+    void onHealthChanged(const BattleEvents::HealthChangeEvent& event) override;
+    void onMoveUsed(const BattleEvents::MoveUsedEvent& event) override;
+    void onWeatherChanged(const BattleEvents::WeatherChangeEvent& event) override;
+    void onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) override;
+    void onBattleStart(const BattleEvents::BattleStartEvent& event) override;
+    void onBattleEnd(const BattleEvents::BattleEndEvent& event) override;
+    void onTurnStart(int turnNumber) override;
+
+    // Hands buffered rows to the writer
+    void submit();
+
+private:
+    std::shared_ptr<TelemetryWriter> writer_;
+    size_t batchRows_;
+    std::vector<ColumnTable> batch_;
+    size_t batchedRows_ = 0;
+    uint32_t battle_ = 0;
+    uint16_t turn_ = 0;
+
+    // Per-listener ID caches, so most events don't touch the writer's lock
+    std::unordered_map<std::string, uint32_t> species_;
+    std::unordered_map<const MoveDef*, uint32_t> moves_;
+
+    uint32_t speciesId(const Pokemon* pokemon);
+    uint32_t moveId(const Move* move);
+    void rowAdded();
+};
+
+} // namespace Telemetry
@@ -1,9 +1,88 @@
 #pragma once
 
-#include <map>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+// The 18 Pokemon types, in chart order. NONE stands for an unknown type
+// name, or the missing second type of a single-typed Pokemon; it is neutral
+// in every matchup.
+enum class PokemonType : uint8_t {
+  NORMAL,
+  FIRE,
+  WATER,
+  ELECTRIC,
+  GRASS,
+  ICE,
+  FIGHTING,
+  POISON,
+  GROUND,
+  FLYING,
+  PSYCHIC,
+  BUG,
+  ROCK,
+  GHOST,
+  DRAGON,
+  DARK,
+  STEEL,
+  FAIRY,
+  NONE
+};
+
+constexpr int kPokemonTypeCount = 18;
+
+// Lower-case type name, e.g. "fire"; "" for NONE
+const char *pokemonTypeName(PokemonType type);
+// Exact (case-sensitive) name match; NONE if the name isn't a type
+PokemonType parsePokemonType(std::string_view name);
+
+// A Pokemon's type names, with each parsed to PokemonType once on assignment
+// so battle and AI code can compare and look up enums. Reads like the
+// std::vector<std::string> it replaces and converts from one implicitly.
+class PokemonTypes {
+ public:
+  using const_iterator = std::vector<std::string>::const_iterator;
+
+  PokemonTypes() = default;
+  PokemonTypes(std::vector<std::string> names);  // NOLINT: implicit by design
+  PokemonTypes(std::initializer_list<std::string> names);
+
+  const_iterator begin() const { return names_.begin(); }
+  const_iterator end() const { return names_.end(); }
+  size_t size() const { return names_.size(); }
+  bool empty() const { return names_.empty(); }
+  const std::string &operator[](size_t index) const { return names_[index]; }
+  const std::string &front() const { return names_.front(); }
+  const std::vector<std::string> &names() const { return names_; }
+  operator const std::vector<std::string> &() const { return names_; }
+
+  void clear();
+  void push_back(std::string name);
+  template <typename... Args>
+  void emplace_back(Args &&...args) {
+    push_back(std::string(std::forward<Args>(args)...));
+  }
+
+  // Parsed types, NONE for names that aren't types
+  const std::vector<PokemonType> &ids() const { return ids_; }
+  PokemonType primary() const { return ids_.empty() ? PokemonType::NONE : ids_[0]; }
+  PokemonType secondary() const { return ids_.size() < 2 ? PokemonType::NONE : ids_[1]; }
+  // Whether one of the types is type; never true for NONE
+  bool contains(PokemonType type) const;
+
+  friend bool operator==(const PokemonTypes &a, const PokemonTypes &b) {
+    return a.names_ == b.names_;
+  }
+  friend bool operator!=(const PokemonTypes &a, const PokemonTypes &b) { return !(a == b); }
+
+ private:
+  std::vector<std::string> names_;
+  std::vector<PokemonType> ids_;
+};
+
 class TypeEffectiveness {
  public:
   // Type effectiveness multipliers
@@ -14,12 +93,34 @@ class TypeEffectiveness {
     SUPER_EFFECTIVE      // 2x damage
   };
 
-  // Get effectiveness multiplier for attacking type vs defending types
+  // Every defending combination: the 18 single types and the 153 unordered
+  // pairs of distinct types
+  static constexpr int kDefenderCount =
+      kPokemonTypeCount + kPokemonTypeCount * (kPokemonTypeCount - 1) / 2;
+
+  // Multiplier against a single- or dual-typed defender (second = NONE for
+  // single types). One lookup in a precomputed attack x defender table; a
+  // type listed twice counts twice, as it always has.
+  static double getEffectivenessMultiplier(PokemonType attackingType,
+                                           PokemonType firstType,
+                                           PokemonType secondType = PokemonType::NONE);
+
+  static double getEffectivenessMultiplier(
+      PokemonType attackingType, const std::vector<PokemonType> &defendingTypes);
+  static double getEffectivenessMultiplier(PokemonType attackingType,
+                                           const PokemonTypes &defendingTypes) {
+    return getEffectivenessMultiplier(attackingType, defendingTypes.ids());
+  }
+
+  // Get effectiveness multiplier for attacking type vs defending types.
+  // Unknown type names are neutral.
   static double getEffectivenessMultiplier(
       const std::string &attackingType,
       const std::vector<std::string> &defendingTypes);
 
   // Get effectiveness enum for a specific type matchup
+  static Effectiveness getEffectiveness(PokemonType attackingType,
+                                        PokemonType defendingType);
   static Effectiveness getEffectiveness(const std::string &attackingType,
                                         const std::string &defendingType);
 
@@ -29,16 +130,7 @@ class TypeEffectiveness {
   // Get all valid Pokemon types
   static std::vector<std::string> getAllTypes();
 
- private:
-  // Type effectiveness chart - maps attacking type to defending type
-  // effectiveness
-  static std::map<std::string, std::map<std::string, Effectiveness>> typeChart;
-
-  // Initialise the type effectiveness chart
-  static void initialiseTypeChart();
-
-  // Ensure type chart is initialised
-  static void ensureInitialised();
-
-  static bool initialised;
-};
\ No newline at end of file
+  // Column of the attack x defender table for a defending type combination;
+  // the order of the two types doesn't matter. -1 if there is no type.
+  static int defenderIndex(PokemonType firstType, PokemonType secondType);
+};
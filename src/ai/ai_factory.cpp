@@ -3,6 +3,7 @@
 #include "easy_ai.h"
 #include "expert_ai.h"
 #include "hard_ai.h"
+#include "mcts_ai.h"
 #include "medium_ai.h"
 
 std::unique_ptr<AIStrategy> AIFactory::createAI(AIDifficulty difficulty) {
@@ -15,6 +16,8 @@ std::unique_ptr<AIStrategy> AIFactory::createAI(AIDifficulty difficulty) {
       return std::make_unique<HardAI>();
     case AIDifficulty::EXPERT:
       return std::make_unique<ExpertAI>();
+    case AIDifficulty::MCTS:
+      return std::make_unique<MCTSAI>();
     default:
       return std::make_unique<EasyAI>();  // Default fallback
   }
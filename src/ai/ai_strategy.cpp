@@ -12,13 +12,18 @@ double AIStrategy::calculateTypeEffectiveness(
   return TypeEffectiveness::getEffectivenessMultiplier(moveType, defenderTypes);
 }
 
+double AIStrategy::calculateTypeEffectiveness(
+    PokemonType moveType, const PokemonTypes& defenderTypes) const {
+  return TypeEffectiveness::getEffectivenessMultiplier(moveType, defenderTypes);
+}
+
 double AIStrategy::estimateDamage(const Pokemon& attacker,
                                   const Pokemon& defender, const Move& move,
                                   WeatherCondition weather) const {
   // Simplified damage calculation for AI estimation
   // Based on the actual damage formula but streamlined for AI decision making
 
-  if (move.power <= 0) {
+  if (move.def().power <= 0) {
     return 0.0;  // Status moves do no direct damage
   }
 
@@ -26,7 +31,7 @@ double AIStrategy::estimateDamage(const Pokemon& attacker,
   int attackStat = attacker.attack;
   int defenseStat = defender.defense;
 
-  if (move.damage_class == "special") {
+  if (move.def().damage_class == DamageClass::SPECIAL) {
     attackStat = attacker.special_attack;
     defenseStat = defender.special_defense;
   }
@@ -41,23 +46,23 @@ double AIStrategy::estimateDamage(const Pokemon& attacker,
   // Base damage calculation (simplified Pokemon formula)
   double baseDamage = ((2.0 * 50 + 10) / 250.0) *
                           (static_cast<double>(attackStat) / defenseStat) *
-                          move.power +
+                          move.def().power +
                       2;
 
   // Type effectiveness
-  double typeMultiplier = calculateTypeEffectiveness(move.type, defender.types);
+  double typeMultiplier = calculateTypeEffectiveness(move.def().type_id, defender.types);
   baseDamage *= typeMultiplier;
 
   // STAB (Same Type Attack Bonus)
   bool hasSTAB = std::find(attacker.types.begin(), attacker.types.end(),
-                           move.type) != attacker.types.end();
+                           move.def().type) != attacker.types.end();
   if (hasSTAB) {
     baseDamage *= 1.5;
   }
 
   // Weather effects
   double weatherMultiplier =
-      Weather::getWeatherDamageMultiplier(weather, move.type);
+      Weather::getWeatherDamageMultiplier(weather, move.def().type);
   baseDamage *= weatherMultiplier;
 
   // Critical hit average (1/16 chance for 2x damage = ~1.06x average)
@@ -80,7 +85,7 @@ bool AIStrategy::isPokemonThreatened(const Pokemon& pokemon,
   for (const auto& move : opponent.moves) {
     if (!move.canUse()) continue;
 
-    double effectiveness = calculateTypeEffectiveness(move.type, pokemon.types);
+    double effectiveness = calculateTypeEffectiveness(move.def().type_id, pokemon.types);
     if (effectiveness >= 2.0) {  // Super effective
       // Estimate if this move could potentially KO
       double estimatedDamage =
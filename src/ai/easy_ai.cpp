@@ -22,7 +22,7 @@ MoveEvaluation EasyAI::chooseBestMove(const BattleState& battleState) {
     if (score > bestMove.score) {
       bestMove.moveIndex = static_cast<int>(i);
       bestMove.score = score;
-      bestMove.reasoning = "Easy AI: Power=" + std::to_string(move.power) +
+      bestMove.reasoning = "Easy AI: Power=" + std::to_string(move.def().power) +
                            ", Type effectiveness considered";
     }
   }
@@ -54,7 +54,7 @@ double EasyAI::scoreMoveBasic(const Move& move,
   double score = 0.0;
 
   // Base power contributes to score
-  score += move.power * 0.8;
+  score += move.def().power * 0.8;
 
   // Type effectiveness is major factor
   double typeEffectiveness =
@@ -62,10 +62,10 @@ double EasyAI::scoreMoveBasic(const Move& move,
   score += typeEffectiveness * 30.0;  // Weight type effectiveness heavily
 
   // Prefer moves with higher accuracy
-  score += move.accuracy * 0.1;
+  score += move.def().accuracy * 0.1;
 
   // Small bonus for status moves if opponent health is high
-  if (move.power == 0 &&
+  if (move.def().power == 0 &&
       calculateHealthRatio(*battleState.opponentPokemon) > 0.7) {
     score += 15.0;
   }
@@ -75,7 +75,7 @@ double EasyAI::scoreMoveBasic(const Move& move,
 
 double EasyAI::scoreTypeEffectiveness(const Move& move,
                                       const Pokemon& defender) const {
-  double effectiveness = calculateTypeEffectiveness(move.type, defender.types);
+  double effectiveness = calculateTypeEffectiveness(move.def().type_id, defender.types);
 
   if (effectiveness >= 2.0)
     return 100.0;  // Super effective
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <string>
+#include <thread>
 
 #include "weather.h"
 
@@ -21,6 +23,41 @@ MoveEvaluation ExpertAI::chooseBestMove(const BattleState& battleState) {
     return {0, -100.0, "No PP remaining on any moves"};
   }
 
+  // Simultaneous-move search, when enabled, plays the equilibrium's most
+  // likely move
+  if (simultaneous_depth_ > 0) {
+    SimultaneousSearchResult result = simultaneousSearch(battleState, simultaneous_depth_);
+    int best = -1;
+    double best_probability = 0.0;
+    for (size_t i = 0; i < result.ai_actions.size(); ++i) {
+      int code = result.ai_actions[i];
+      if (code >= 0 && code < static_cast<int>(battleState.aiPokemon->moves.size()) &&
+          battleState.aiPokemon->moves[code].canUse() &&
+          result.ai_strategy[i] > best_probability) {
+        best = code;
+        best_probability = result.ai_strategy[i];
+      }
+    }
+    if (best >= 0) {
+      return {best, result.value,
+              "Expert AI: Simultaneous-move equilibrium to depth " +
+                  std::to_string(simultaneous_depth_)};
+    }
+  }
+
+  // Budgeted tree search, when enabled, picks the move directly
+  if (search_time_budget_.count() > 0) {
+    std::vector<int> line;
+    double value = iterativeDeepeningSearch(battleState, search_time_budget_, line);
+    if (!line.empty() && line.front() >= 0 &&
+        line.front() < static_cast<int>(battleState.aiPokemon->moves.size()) &&
+        battleState.aiPokemon->moves[line.front()].canUse()) {
+      return {line.front(), value,
+              "Expert AI: Iterative deepening search to depth " +
+                  std::to_string(search_engine_.completed_depth_)};
+    }
+  }
+
   // Generate multi-turn plans
   std::vector<TurnPlan> plans = generateTurnPlans(battleState, 2);
 
@@ -40,7 +77,7 @@ MoveEvaluation ExpertAI::chooseBestMove(const BattleState& battleState) {
 
     // Counter-strategy considerations
     if (detectSetupAttempt(battleState) && shouldDisrupt(battleState)) {
-      if (move.ailment_name != "none" || move.power > 80) {
+      if (move.def().ailment_id != MoveAilment::NONE || move.def().power > 80) {
         score += 40.0;  // Bonus for disrupting setup
       }
     }
@@ -116,7 +153,7 @@ SwitchEvaluation ExpertAI::chooseBestSwitch(const BattleState& battleState) {
       for (const auto& move : pokemon->moves) {
         if (!move.canUse()) continue;
         double effectiveness =
-            calculateTypeEffectiveness(move.type, threat->types);
+            calculateTypeEffectiveness(move.def().type_id, threat->types);
         if (effectiveness >= 2.0) {
           threatsHandled++;
           break;
@@ -211,7 +248,7 @@ PredictionResult ExpertAI::predictOpponentAction(const BattleState& battleState,
     double score = 0.0;
 
     // Damage moves likely if they can KO
-    if (move.power > 0) {
+    if (move.def().power > 0) {
       double damage =
           estimateDamage(*battleState.opponentPokemon, *battleState.aiPokemon,
                          move, battleState.currentWeather);
@@ -224,12 +261,12 @@ PredictionResult ExpertAI::predictOpponentAction(const BattleState& battleState,
 
       // Type effectiveness consideration
       double effectiveness =
-          calculateTypeEffectiveness(move.type, battleState.aiPokemon->types);
+          calculateTypeEffectiveness(move.def().type_id, battleState.aiPokemon->types);
       score += effectiveness * 25.0;
     }
 
     // Status moves more likely early game or against healthy targets
-    if (move.power == 0 &&
+    if (move.def().power == 0 &&
         battleState.aiPokemon->status == StatusCondition::NONE) {
       double ourHealthRatio = calculateHealthRatio(*battleState.aiPokemon);
       score += ourHealthRatio * 30.0;
@@ -285,7 +322,7 @@ std::vector<ExpertAI::TurnPlan> ExpertAI::generateTurnPlans(
     const Move& move = battleState.aiPokemon->moves[i];
     plan.expectedValue = calculateExpectedValue(move, battleState, depth);
 
-    if (move.power > 0) {
+    if (move.def().power > 0) {
       plan.strategy = "Aggressive damage dealing";
     } else {
       plan.strategy = "Status/setup play";
@@ -328,14 +365,14 @@ double ExpertAI::calculateExpectedValue(const Move& move,
                                         int turnsAhead) const {
   double expectedValue = 0.0;
 
-  if (move.power > 0) {
+  if (move.def().power > 0) {
     // Damage move evaluation
     double baseDamage =
         estimateDamage(*battleState.aiPokemon, *battleState.opponentPokemon,
                        move, battleState.currentWeather);
 
     // Account for accuracy
-    double hitChance = move.accuracy / 100.0;
+    double hitChance = move.def().accuracy / 100.0;
     double expectedDamage = baseDamage * hitChance;
 
     expectedValue += expectedDamage * 1.5;
@@ -409,9 +446,9 @@ double ExpertAI::analyzeWinConditions(const BattleState& battleState) const {
       if (!oppPokemon || !oppPokemon->isAlive()) continue;
 
       for (const auto& move : ourPokemon->moves) {
-        if (move.power > 0) {
+        if (move.def().power > 0) {
           double effectiveness =
-              calculateTypeEffectiveness(move.type, oppPokemon->types);
+              calculateTypeEffectiveness(move.def().type_id, oppPokemon->types);
           if (effectiveness >= 2.0) typeAdvantages++;
         }
       }
@@ -437,14 +474,14 @@ ExpertAI::TeamRole ExpertAI::analyzePokemonRole(const Pokemon& pokemon) const {
   double avgPower = 0.0;
 
   for (const auto& move : pokemon.moves) {
-    if (move.power > 0) {
+    if (move.def().power > 0) {
       damageMoves++;
-      avgPower += move.power;
+      avgPower += move.def().power;
     } else {
       statusMoves++;
       // Simple setup move detection (would be more sophisticated in practice)
-      if (move.name.find("dance") != std::string::npos ||
-          move.name.find("growth") != std::string::npos) {
+      if (move.def().name.find("dance") != std::string::npos ||
+          move.def().name.find("growth") != std::string::npos) {
         setupMoves++;
       }
     }
@@ -580,7 +617,7 @@ double ExpertAI::detectSetupAttempt(const BattleState& battleState) const {
     if (!move.canUse()) continue;
     
     // Detect setup moves by name patterns
-    std::string moveName = move.name;
+    std::string moveName = move.def().name;
     if (moveName.find("dance") != std::string::npos ||
         moveName.find("growth") != std::string::npos ||
         moveName.find("calm-mind") != std::string::npos ||
@@ -633,14 +670,14 @@ double ExpertAI::evaluateCounterPlay(const BattleState& battleState) const {
   
   // Assess type advantages (Weight: 1.5x, Range: 25-45 points)
   for (const auto& move : battleState.aiPokemon->moves) {
-    if (!move.canUse() || move.power <= 0) continue;
+    if (!move.canUse() || move.def().power <= 0) continue;
     
-    double effectiveness = calculateTypeEffectiveness(move.type, battleState.opponentPokemon->types);
+    double effectiveness = calculateTypeEffectiveness(move.def().type_id, battleState.opponentPokemon->types);
     if (effectiveness >= 2.0) {
       counterScore += 20.0; // We have super effective moves
       
       // Extra points for high-power super effective moves
-      if (move.power >= 90) {
+      if (move.def().power >= 90) {
         counterScore += 15.0;
       }
     } else if (effectiveness <= 0.5) {
@@ -654,10 +691,10 @@ double ExpertAI::evaluateCounterPlay(const BattleState& battleState) const {
   if (oppHealthRatio < 0.3) {
     // Look for moves that can hit common switch-ins
     for (const auto& move : battleState.aiPokemon->moves) {
-      if (move.canUse() && move.power > 0) {
+      if (move.canUse() && move.def().power > 0) {
         // Coverage moves are valuable for switch prediction
-        if (move.type != battleState.aiPokemon->types[0] && 
-            (battleState.aiPokemon->types.size() == 1 || move.type != battleState.aiPokemon->types[1])) {
+        if (move.def().type != battleState.aiPokemon->types[0] && 
+            (battleState.aiPokemon->types.size() == 1 || move.def().type != battleState.aiPokemon->types[1])) {
           counterScore += 12.0; // Coverage move for potential switches
         }
       }
@@ -668,7 +705,7 @@ double ExpertAI::evaluateCounterPlay(const BattleState& battleState) const {
   for (const auto& move : battleState.aiPokemon->moves) {
     if (!move.canUse()) continue;
     
-    std::string moveName = move.name;
+    std::string moveName = move.def().name;
     // Moves that punish setup or specific strategies
     if (moveName.find("haze") != std::string::npos ||
         moveName.find("clear-smog") != std::string::npos) {
@@ -682,7 +719,7 @@ double ExpertAI::evaluateCounterPlay(const BattleState& battleState) const {
       // Check if opponent has status moves to disable
       int oppStatusMoves = 0;
       for (const auto& oppMove : battleState.opponentPokemon->moves) {
-        if (oppMove.power == 0) oppStatusMoves++;
+        if (oppMove.def().power == 0) oppStatusMoves++;
       }
       if (oppStatusMoves >= 2) {
         counterScore += 20.0; // Taunt is effective against status-heavy sets
@@ -735,8 +772,8 @@ double ExpertAI::assessPositionalAdvantage(
   // Evaluate how well-positioned we are type-wise
   double bestMatchupAdvantage = 0.0;
   for (const auto& move : battleState.aiPokemon->moves) {
-    if (move.canUse() && move.power > 0) {
-      double effectiveness = calculateTypeEffectiveness(move.type, battleState.opponentPokemon->types);
+    if (move.canUse() && move.def().power > 0) {
+      double effectiveness = calculateTypeEffectiveness(move.def().type_id, battleState.opponentPokemon->types);
       bestMatchupAdvantage = std::max(bestMatchupAdvantage, effectiveness);
     }
   }
@@ -753,7 +790,7 @@ double ExpertAI::assessPositionalAdvantage(
   for (const auto& move : battleState.aiPokemon->moves) {
     if (!move.canUse()) continue;
     
-    std::string moveName = move.name;
+    std::string moveName = move.def().name;
     if (moveName.find("u-turn") != std::string::npos ||
         moveName.find("volt-switch") != std::string::npos ||
         moveName.find("flip-turn") != std::string::npos) {
@@ -802,11 +839,11 @@ double ExpertAI::evaluateResourceManagement(
   
   for (const auto& move : battleState.aiPokemon->moves) {
     totalPPRemaining += move.current_pp;
-    totalPPCapacity += move.pp;
+    totalPPCapacity += move.def().pp;
     
-    if (move.current_pp <= 2 && move.pp > 5) {
+    if (move.current_pp <= 2 && move.def().pp > 5) {
       lowPPMoves++;
-      if (move.power >= 90) {
+      if (move.def().power >= 90) {
         highPowerLowPPMoves++;
       }
     }
@@ -826,7 +863,7 @@ double ExpertAI::evaluateResourceManagement(
   if (oppHealthRatio < 0.3) {
     // Look for efficient finishing moves rather than overkill
     for (const auto& move : battleState.aiPokemon->moves) {
-      if (move.canUse() && move.power > 0) {
+      if (move.canUse() && move.def().power > 0) {
         double estimatedDamage = estimateDamage(*battleState.aiPokemon, 
                                                *battleState.opponentPokemon, 
                                                move, battleState.currentWeather);
@@ -838,7 +875,7 @@ double ExpertAI::evaluateResourceManagement(
         }
         
         // Slight penalty for massive overkill (wasting a high-power move)
-        if (estimatedDamage > battleState.opponentPokemon->current_hp * 2.0 && move.power >= 100) {
+        if (estimatedDamage > battleState.opponentPokemon->current_hp * 2.0 && move.def().power >= 100) {
           resourceScore -= 3.0;
         }
       }
@@ -849,7 +886,7 @@ double ExpertAI::evaluateResourceManagement(
   // For now, consider status moves as "resource investment"
   int statusMoves = 0;
   for (const auto& move : battleState.aiPokemon->moves) {
-    if (move.power == 0) statusMoves++;
+    if (move.def().power == 0) statusMoves++;
   }
   
   // Balance between efficiency and effectiveness
@@ -910,10 +947,10 @@ ExpertAI::RiskAssessment ExpertAI::modelOutcome(
     const Move& move, const BattleState& battleState) const {
   RiskAssessment assessment;
 
-  double hitChance = move.accuracy / 100.0;
+  double hitChance = move.def().accuracy / 100.0;
   assessment.probability = hitChance;
 
-  if (move.power > 0) {
+  if (move.def().power > 0) {
     double damage =
         estimateDamage(*battleState.aiPokemon, *battleState.opponentPokemon,
                        move, battleState.currentWeather);
@@ -1049,9 +1086,9 @@ std::string ExpertAI::classifyOpponentPlayStyle(const BattleState& battle_state)
   for (const auto& pair : bayesian_model_.move_usage_count_) {
     if (pair.first >= 0 && pair.first < static_cast<int>(battle_state.opponentPokemon->moves.size())) {
       const Move& move = battle_state.opponentPokemon->moves[pair.first];
-      if (move.power > 0) {
+      if (move.def().power > 0) {
         damage_moves_used += pair.second;
-        if (move.power >= 100) {
+        if (move.def().power >= 100) {
           high_power_moves_used += pair.second;
         }
       } else {
@@ -1080,113 +1117,727 @@ std::string ExpertAI::classifyOpponentPlayStyle(const BattleState& battle_state)
 double ExpertAI::miniMaxSearch(const BattleState& root_state, int depth, double alpha, double beta, 
                               bool maximizing_player, std::vector<int>& best_line) const {
   auto start_time = std::chrono::high_resolution_clock::now();
+  beginSearch();
+  search_engine_.has_deadline_ = false;
+  
+  // Search runs on a compact copy; the live Pokemon are never touched
+  SearchContext context(root_state);
+  
+  MiniMaxSearchEngine::SearchLine line;
+  depth = std::min(depth, MiniMaxSearchEngine::SearchLine::kMaxLength);
+  double best_value = runSearchIteration(context, depth, alpha, beta, maximizing_player, line);
+  
+  best_line.assign(line.moves, line.moves + line.length);
+  search_engine_.principal_variation_ = best_line;
+  search_engine_.principal_variation_score_ = best_value;
+  search_engine_.completed_depth_ = depth;
+  finishSearch();
+  
+  auto end_time = std::chrono::high_resolution_clock::now();
+  search_engine_.search_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+  
+  return best_value;
+}
+
+double ExpertAI::iterativeDeepeningSearch(const BattleState& root_state,
+                                          std::chrono::milliseconds time_budget,
+                                          std::vector<int>& best_line, int max_depth) const {
+  auto start_time = std::chrono::steady_clock::now();
+  beginSearch();
+  search_engine_.deadline_ = start_time + time_budget;
+  
+  SearchContext context(root_state);
+  max_depth = std::clamp(max_depth, 1, MiniMaxSearchEngine::SearchLine::kMaxLength);
+  
+  MiniMaxSearchEngine::SearchLine line;
+  double best_value = 0.0;
+  for (int depth = 1; depth <= max_depth; ++depth) {
+    // The first iteration ignores the clock so there is always a move to play
+    search_engine_.has_deadline_ = depth > 1;
+    double value = runSearchIteration(context, depth, -1000.0, 1000.0, true, line);
+    if (search_engine_.search_aborted_) {
+      break;  // Partial iteration: keep the previous result
+    }
+    
+    best_value = value;
+    search_engine_.pv_hint_ = line;
+    search_engine_.completed_depth_ = depth;
+    if (std::chrono::steady_clock::now() >= search_engine_.deadline_) {
+      break;
+    }
+  }
+  search_engine_.has_deadline_ = false;
+  
+  const auto& pv = search_engine_.pv_hint_;
+  best_line.assign(pv.moves, pv.moves + pv.length);
+  search_engine_.principal_variation_ = best_line;
+  search_engine_.principal_variation_score_ = best_value;
+  finishSearch();
+  search_engine_.search_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start_time);
+  
+  return best_value;
+}
+
+ExpertAI::SimultaneousSearchResult ExpertAI::simultaneousSearch(const BattleState& root_state,
+                                                                int depth) const {
+  auto start_time = std::chrono::steady_clock::now();
+  beginSearch();
+  search_engine_.has_deadline_ = false;
+  search_engine_.worker_threads_ = 1;  // Serial: every node needs its whole matrix
+  
+  SearchContext context(root_state);
+  SearchState state = context.root();
+  depth = std::clamp(depth, 1, MiniMaxSearchEngine::SearchLine::kMaxLength);
+  
+  PositionEvaluator evaluator(context);
+  MiniMaxSearchEngine::SearchWorker worker;
+  worker.table = &search_engine_.transposition_table_;
+  worker.evaluator = &evaluator;
+  SimultaneousSearchResult result{};
+  result.value = searchSimultaneousNode(context, state, depth, 0, worker, &result);
+  
+  search_engine_.nodes_evaluated_ = worker.nodes_evaluated;
+  search_engine_.matrix_games_solved_ = worker.matrix_games_solved;
+  search_engine_.completed_depth_ = depth;
+  search_engine_.principal_variation_.clear();
+  if (!result.ai_actions.empty()) {
+    auto most_likely = std::max_element(result.ai_strategy.begin(), result.ai_strategy.end());
+    search_engine_.principal_variation_.push_back(
+        result.ai_actions[most_likely - result.ai_strategy.begin()]);
+  }
+  search_engine_.principal_variation_score_ = result.value;
+  finishSearch();
+  search_engine_.search_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start_time);
+  
+  return result;
+}
+
+void ExpertAI::beginSearch() const {
   search_engine_.nodes_evaluated_ = 0;
   search_engine_.alpha_beta_cutoffs_ = 0;
+  search_engine_.chance_cutoffs_ = 0;
+  search_engine_.matrix_games_solved_ = 0;
+  search_engine_.tt_hits_ = 0;
+  search_engine_.tt_misses_ = 0;
+  search_engine_.tt_collisions_ = 0;
+  search_engine_.transposition_table_.resetCounters();
+  search_engine_.transposition_table_.newSearch();
+  search_engine_.pv_hint_.length = 0;
+  search_engine_.completed_depth_ = 0;
+  search_engine_.worker_threads_ = resolveWorkerCount();
+}
+
+void ExpertAI::finishSearch() const {
+  // Private tables (reproducible mode) were already added per iteration
+  const auto& table = search_engine_.transposition_table_;
+  search_engine_.tt_hits_ += table.hits();
+  search_engine_.tt_misses_ += table.misses();
+  search_engine_.tt_collisions_ += table.collisions();
+  total_positions_analyzed_ += search_engine_.nodes_evaluated_;
+}
+
+int ExpertAI::resolveWorkerCount() const {
+  int workers = parallel_settings_.worker_threads;
+  if (workers <= 0) {
+    workers = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  return std::max(1, workers);
+}
+
+double ExpertAI::runSearchIteration(const SearchContext& context, int depth, double alpha,
+                                    double beta, bool maximizing_player,
+                                    MiniMaxSearchEngine::SearchLine& line) const {
+  search_engine_.search_aborted_ = false;
+  PositionEvaluator evaluator(context);
+  int workers = search_engine_.worker_threads_;
+  // Reproducible mode root-splits even on one thread: the shared table is
+  // lossy, so the serial path's result would depend on the thread count
+  if (parallel_settings_.reproducible) {
+    return runRootSplitIteration(context, evaluator, depth, alpha, beta, maximizing_player,
+                                 workers, line);
+  }
+  if (workers > 1) {
+    return runLazySmpIteration(context, evaluator, depth, alpha, beta, maximizing_player,
+                               workers, line);
+  }
+  
+  MiniMaxSearchEngine::SearchWorker worker;
+  worker.table = &search_engine_.transposition_table_;
+  worker.evaluator = &evaluator;
+  worker.following_pv = search_engine_.pv_hint_.length > 0;
+  SearchState state = context.root();
+  double value = searchNode(context, state, depth, 0, alpha, beta, maximizing_player, line, worker);
+  
+  search_engine_.nodes_evaluated_ += worker.nodes_evaluated;
+  search_engine_.alpha_beta_cutoffs_ += worker.alpha_beta_cutoffs;
+  search_engine_.chance_cutoffs_ += worker.chance_cutoffs;
+  search_engine_.search_aborted_ = worker.aborted;
+  return value;
+}
+
+double ExpertAI::runLazySmpIteration(const SearchContext& context,
+                                     const PositionEvaluator& evaluator, int depth, double alpha,
+                                     double beta, bool maximizing_player, int workers,
+                                     MiniMaxSearchEngine::SearchLine& line) const {
+  std::atomic<bool> stop_helpers{false};
+  std::vector<MiniMaxSearchEngine::SearchWorker> helpers(workers - 1);
+  std::vector<std::thread> threads;
+  threads.reserve(helpers.size());
+  
+  for (size_t i = 0; i < helpers.size(); ++i) {
+    auto& helper = helpers[i];
+    helper.table = &search_engine_.transposition_table_;
+    helper.evaluator = &evaluator;
+    helper.stop = &stop_helpers;
+    helper.helper_id = static_cast<int>(i) + 1;
+    // Odd helpers look one ply further ahead and leave deeper entries behind
+    int helper_depth = std::min(depth + (helper.helper_id & 1),
+                                MiniMaxSearchEngine::SearchLine::kMaxLength);
+    threads.emplace_back([this, &context, &helper, helper_depth, alpha, beta, maximizing_player]() {
+      SearchState state = context.root();
+      MiniMaxSearchEngine::SearchLine helper_line;
+      searchNode(context, state, helper_depth, 0, alpha, beta, maximizing_player, helper_line, helper);
+    });
+  }
+  
+  // The main search's result is authoritative; helpers only warm the table
+  MiniMaxSearchEngine::SearchWorker main_worker;
+  main_worker.table = &search_engine_.transposition_table_;
+  main_worker.evaluator = &evaluator;
+  main_worker.following_pv = search_engine_.pv_hint_.length > 0;
+  SearchState state = context.root();
+  double value = searchNode(context, state, depth, 0, alpha, beta, maximizing_player, line, main_worker);
+  
+  stop_helpers.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  
+  search_engine_.nodes_evaluated_ += main_worker.nodes_evaluated;
+  search_engine_.alpha_beta_cutoffs_ += main_worker.alpha_beta_cutoffs;
+  search_engine_.chance_cutoffs_ += main_worker.chance_cutoffs;
+  for (const auto& helper : helpers) {
+    search_engine_.nodes_evaluated_ += helper.nodes_evaluated;
+    search_engine_.alpha_beta_cutoffs_ += helper.alpha_beta_cutoffs;
+    search_engine_.chance_cutoffs_ += helper.chance_cutoffs;
+  }
+  search_engine_.search_aborted_ = main_worker.aborted;
+  return value;
+}
+
+double ExpertAI::runRootSplitIteration(const SearchContext& context,
+                                       const PositionEvaluator& evaluator, int depth,
+                                       double alpha, double beta, bool maximizing_player,
+                                       int workers, MiniMaxSearchEngine::SearchLine& line) const {
+  line.length = 0;
+  constexpr int kBranching = MiniMaxSearchEngine::kMaxBranchingFactor;
+  int side = maximizing_player ? SearchState::kAISide : SearchState::kOpponentSide;
+  SearchState root = context.root();
+  search_engine_.nodes_evaluated_++;
+  
+  SearchAction actions[kBranching];
+  int action_count = 0;
+  if (depth > 0 && !context.isTerminal(root)) {
+    action_count = context.generateActions(root, side, actions, kBranching);
+  }
+  if (action_count == 0) {
+    return evaluator.evaluate(root);
+  }
+  
+  // Order as the serial search would, minus the shared-table hint
+  const auto& pv_hint = search_engine_.pv_hint_;
+  int order[kBranching];
+  orderSearchActions(context, evaluator, root, maximizing_player, 0, TranspositionTable::kNoMove,
+                     pv_hint.length > 0, actions, action_count, order);
+  
+  // Every root move gets a full window and a fresh private table, so each
+  // child's value and line depend only on the position
+  struct RootResult {
+    double value = 0.0;
+    MiniMaxSearchEngine::SearchLine line;
+  };
+  std::vector<RootResult> results(action_count);
+  std::vector<MiniMaxSearchEngine::SearchWorker> pool(std::min(workers, action_count));
+  std::vector<uint64_t> tt_counts(pool.size() * 3, 0);
+  std::vector<std::thread> threads;
+  threads.reserve(pool.size());
+  
+  for (size_t t = 0; t < pool.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      TranspositionTable table(MiniMaxSearchEngine::kPrivateTableEntries);
+      auto& worker = pool[t];
+      worker.table = &table;
+      worker.evaluator = &evaluator;
+      for (size_t i = t; i < results.size() && !worker.aborted; i += pool.size()) {
+        const SearchAction& action = actions[order[i]];
+        table.clear();
+        SearchState state = root;
+        bool follow_pv = pv_hint.length > 0 && action.encode() == pv_hint.moves[0];
+        results[i].value = searchAction(context, state, action, depth, 0, alpha, beta,
+                                        maximizing_player, follow_pv, results[i].line, worker);
+        tt_counts[t * 3] += table.hits();
+        tt_counts[t * 3 + 1] += table.misses();
+        tt_counts[t * 3 + 2] += table.collisions();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
   
-  if (depth <= 0 || isEndgamePosition(root_state)) {
-    search_engine_.nodes_evaluated_++;
-    return evaluatePosition(root_state);
+  bool aborted = false;
+  for (size_t t = 0; t < pool.size(); ++t) {
+    search_engine_.nodes_evaluated_ += pool[t].nodes_evaluated;
+    search_engine_.alpha_beta_cutoffs_ += pool[t].alpha_beta_cutoffs;
+    search_engine_.chance_cutoffs_ += pool[t].chance_cutoffs;
+    search_engine_.tt_hits_ += tt_counts[t * 3];
+    search_engine_.tt_misses_ += tt_counts[t * 3 + 1];
+    search_engine_.tt_collisions_ += tt_counts[t * 3 + 2];
+    aborted = aborted || pool[t].aborted;
   }
+  search_engine_.search_aborted_ = aborted;
   
-  std::vector<BattleState> legal_moves = generateLegalMoves(root_state, maximizing_player);
-  if (legal_moves.empty()) {
-    return evaluatePosition(root_state);
+  // Merge in move order: the first strictly better move wins ties
+  double best_value = maximizing_player ? -1000.0 : 1000.0;
+  for (int i = 0; i < action_count; ++i) {
+    double value = results[i].value;
+    bool improved = maximizing_player ? (value > best_value) : (value < best_value);
+    if (improved) {
+      best_value = value;
+      line = results[i].line;
+    }
   }
+  return best_value;
+}
+
+ExpertAI::SearchStatistics ExpertAI::getSearchStatistics() const {
+  return {search_engine_.nodes_evaluated_,
+          search_engine_.alpha_beta_cutoffs_,
+          search_engine_.search_time_,
+          search_engine_.tt_hits_,
+          search_engine_.tt_misses_,
+          search_engine_.tt_collisions_,
+          search_engine_.principal_variation_,
+          search_engine_.principal_variation_score_,
+          search_engine_.completed_depth_,
+          search_engine_.worker_threads_,
+          search_engine_.chance_cutoffs_,
+          search_engine_.matrix_games_solved_};
+}
+
+void ExpertAI::orderSearchActions(const SearchContext& context,
+                                  const PositionEvaluator& evaluator, const SearchState& state,
+                                  bool maximizing_player, int ply, int hash_move, bool on_pv,
+                                  const SearchAction* actions, int action_count,
+                                  int* order) const {
+  int side = maximizing_player ? SearchState::kAISide : SearchState::kOpponentSide;
+  
+  // Order children by static evaluation: lay them out contiguously and
+  // score them in one batch, before sorting
+  constexpr int kBranching = MiniMaxSearchEngine::kMaxBranchingFactor;
+  SearchState children[kBranching];
+  double order_scores[kBranching];
+  for (int i = 0; i < action_count; ++i) {
+    children[i] = state;
+    SearchUndo undo;
+    context.make(children[i], side, actions[i], undo);
+    order[i] = i;
+  }
+  evaluator.evaluateBatch(children, action_count, order_scores);
+  std::stable_sort(order, order + action_count, [&](int a, int b) {
+    return maximizing_player ? (order_scores[a] > order_scores[b])
+                             : (order_scores[a] < order_scores[b]);
+  });
   
-  orderMoves(legal_moves, maximizing_player);
+  // The stored best move is tried first
+  for (int i = 1; i < action_count; ++i) {
+    if (actions[order[i]].encode() == hash_move) {
+      std::rotate(order, order + i, order + i + 1);
+      break;
+    }
+  }
   
-  double best_value = maximizing_player ? -1000.0 : 1000.0;
-  std::vector<int> current_best_line;
+  // While on the previous iteration's line, its move goes ahead of everything
+  if (on_pv) {
+    const auto& pv_hint = search_engine_.pv_hint_;
+    for (int i = 1; i < action_count; ++i) {
+      if (actions[order[i]].encode() == pv_hint.moves[ply]) {
+        std::rotate(order, order + i, order + i + 1);
+        break;
+      }
+    }
+  }
+}
+
+double ExpertAI::searchNode(const SearchContext& context, SearchState& state, int depth,
+                            int ply, double alpha, double beta, bool maximizing_player,
+                            MiniMaxSearchEngine::SearchLine& line,
+                            MiniMaxSearchEngine::SearchWorker& worker) const {
+  line.length = 0;
+  worker.nodes_evaluated++;
+  
+  if (!worker.aborted &&
+      worker.nodes_evaluated % MiniMaxSearchEngine::kDeadlineCheckInterval == 0) {
+    if ((worker.stop && worker.stop->load(std::memory_order_relaxed)) ||
+        (search_engine_.has_deadline_ &&
+         std::chrono::steady_clock::now() >= search_engine_.deadline_)) {
+      worker.aborted = true;
+    }
+  }
+  if (worker.aborted) {
+    return 0.0;  // Discarded by the caller
+  }
+  
+  if (depth <= 0 || context.isTerminal(state)) {
+    return worker.evaluator->evaluate(state);
+  }
+  
+  // Transposition table: reuse results for positions reached by other move orders
+  TranspositionTable& table = *worker.table;
+  const double original_alpha = alpha;
+  const double original_beta = beta;
+  const uint64_t key = ZobristHasher::hash(context, state, maximizing_player);
+  int hash_move = TranspositionTable::kNoMove;
+  TranspositionTable::Entry entry;
+  if (table.probe(key, entry)) {
+    hash_move = entry.best_move;
+    // Never cut at the root so the caller always gets a full line
+    if (ply > 0 && entry.depth >= depth &&
+        (entry.bound == TranspositionTable::Bound::EXACT ||
+         (entry.bound == TranspositionTable::Bound::LOWER && entry.score >= beta) ||
+         (entry.bound == TranspositionTable::Bound::UPPER && entry.score <= alpha))) {
+      if (hash_move != TranspositionTable::kNoMove) {
+        line.moves[0] = hash_move;
+        line.length = 1;
+      }
+      return entry.score;
+    }
+  }
+  
+  constexpr int kBranching = MiniMaxSearchEngine::kMaxBranchingFactor;
+  int side = maximizing_player ? SearchState::kAISide : SearchState::kOpponentSide;
+  SearchAction actions[kBranching];
+  int action_count = context.generateActions(state, side, actions, kBranching);
+  if (action_count == 0) {
+    return worker.evaluator->evaluate(state);
+  }
+  
+  const auto& pv_hint = search_engine_.pv_hint_;
+  const bool on_pv = worker.following_pv && ply < pv_hint.length;
+  int order[kBranching];
+  orderSearchActions(context, *worker.evaluator, state, maximizing_player, ply, hash_move, on_pv,
+                     actions, action_count, order);
+  
+  // Lazy SMP helpers start on different root moves to spread the work
+  if (ply == 0 && worker.helper_id > 0) {
+    std::rotate(order, order + worker.helper_id % action_count, order + action_count);
+  }
   
-  for (size_t i = 0; i < legal_moves.size() && i < static_cast<size_t>(MiniMaxSearchEngine::kMaxBranchingFactor); ++i) {
-    std::vector<int> child_line;
-    double value = miniMaxSearch(legal_moves[i], depth - 1, alpha, beta, !maximizing_player, child_line);
+  double best_value = maximizing_player ? -1000.0 : 1000.0;
+  MiniMaxSearchEngine::SearchLine action_line;
+  
+  for (int i = 0; i < action_count; ++i) {
+    const SearchAction& action = actions[order[i]];
+    bool follow_pv = on_pv && action.encode() == pv_hint.moves[ply];
+    double value = searchAction(context, state, action, depth, ply, alpha, beta,
+                                maximizing_player, follow_pv, action_line, worker);
+    if (worker.aborted) {
+      return 0.0;  // Don't let a partial subtree reach the table
+    }
+    
+    bool improved = maximizing_player ? (value > best_value) : (value < best_value);
+    if (improved) {
+      best_value = value;
+      line = action_line;
+    }
     
     if (maximizing_player) {
-      if (value > best_value) {
-        best_value = value;
-        current_best_line = child_line;
-      }
       alpha = std::max(alpha, value);
-      if (beta <= alpha) {
-        search_engine_.alpha_beta_cutoffs_++;
-        break;  // Alpha-beta pruning
-      }
     } else {
-      if (value < best_value) {
-        best_value = value;
-        current_best_line = child_line;
-      }
       beta = std::min(beta, value);
-      if (beta <= alpha) {
-        search_engine_.alpha_beta_cutoffs_++;
-        break;  // Alpha-beta pruning
-      }
+    }
+    if (beta <= alpha) {
+      worker.alpha_beta_cutoffs++;
+      break;  // Alpha-beta pruning
     }
   }
   
-  if (depth == MiniMaxSearchEngine::kMaxSearchDepth) {
-    search_engine_.principal_variation_ = current_best_line;
-    search_engine_.principal_variation_score_ = best_value;
-    
-    auto end_time = std::chrono::high_resolution_clock::now();
-    search_engine_.search_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
+  TranspositionTable::Bound bound = TranspositionTable::Bound::EXACT;
+  if (best_value <= original_alpha) {
+    bound = TranspositionTable::Bound::UPPER;
+  } else if (best_value >= original_beta) {
+    bound = TranspositionTable::Bound::LOWER;
   }
+  table.store(key, {best_value, depth, bound,
+                    line.length > 0 ? line.moves[0] : TranspositionTable::kNoMove});
   
-  best_line = current_best_line;
   return best_value;
 }
 
-double ExpertAI::evaluatePosition(const BattleState& battle_state) const {
-  double score = 0.0;
-  
-  // Material advantage (Pokemon count and health)
-  int ai_alive = battle_state.aiTeam->getAlivePokemon().size();
-  int opp_alive = battle_state.opponentTeam->getAlivePokemon().size();
-  score += (ai_alive - opp_alive) * 30.0;
+double ExpertAI::searchAction(const SearchContext& context, SearchState& state,
+                              const SearchAction& action, int depth, int ply, double alpha,
+                              double beta, bool maximizing_player, bool follow_pv,
+                              MiniMaxSearchEngine::SearchLine& line,
+                              MiniMaxSearchEngine::SearchWorker& worker) const {
+  int side = maximizing_player ? SearchState::kAISide : SearchState::kOpponentSide;
+  MiniMaxSearchEngine::SearchLine child_line;
+  line.moves[0] = action.encode();
+  line.length = 1;
+  
+  auto take_line = [&line](const MiniMaxSearchEngine::SearchLine& child) {
+    std::copy(child.moves, child.moves + child.length, line.moves + 1);
+    line.length = child.length + 1;
+  };
+  
+  if (action.type == SearchAction::Type::SWITCH || !chance_settings_.chance_nodes) {
+    SearchUndo undo;
+    context.make(state, side, action, undo);
+    worker.following_pv = follow_pv;
+    double value = searchNode(context, state, depth - 1, ply + 1, alpha, beta,
+                              !maximizing_player, child_line, worker);
+    SearchContext::unmake(state, undo);
+    take_line(child_line);
+    return value;
+  }
+  
+  SearchOutcome outcomes[SearchContext::kMaxOutcomes];
+  int outcome_count = context.chanceOutcomes(state, side, action.index, outcomes);
+  // Likely outcomes first: they tighten the Star1 windows fastest
+  std::stable_sort(outcomes, outcomes + outcome_count,
+                   [](const SearchOutcome& a, const SearchOutcome& b) {
+                     return a.probability > b.probability;
+                   });
+  
+  const double lo = MiniMaxSearchEngine::kMinEvaluation;
+  const double hi = MiniMaxSearchEngine::kMaxEvaluation;
+  
+  // Star2: probing one action below each outcome bounds the chance node from
+  // the opponent's side (upper bounds when the opponent moves next, lower
+  // bounds when the AI does), often enough to fail without a full search
+  if (chance_settings_.star2_probing && outcome_count > 1 && depth > 1) {
+    double bound = 0.0;
+    for (int i = 0; i < outcome_count; ++i) {
+      SearchUndo undo;
+      context.makeOutcome(state, side, action.index, outcomes[i], undo);
+      double probe = probeSuccessor(context, state, depth - 1, ply + 1, !maximizing_player, worker);
+      SearchContext::unmake(state, undo);
+      if (worker.aborted) return 0.0;
+      bound += outcomes[i].probability * probe;
+    }
+    if ((maximizing_player && bound <= alpha) || (!maximizing_player && bound >= beta)) {
+      worker.chance_cutoffs++;
+      return bound;
+    }
+  }
   
-  // Health advantage
-  double ai_health_total = 0.0, opp_health_total = 0.0;
-  for (int i = 0; i < static_cast<int>(battle_state.aiTeam->size()); ++i) {
-    Pokemon* pokemon = battle_state.aiTeam->getPokemon(i);
-    if (pokemon && pokemon->isAlive()) {
-      ai_health_total += calculateHealthRatio(*pokemon);
+  // Star1: each outcome is searched with the window that could still move
+  // the expectation across alpha or beta, given the evaluation bounds
+  double expected = 0.0;
+  double remaining = 1.0;
+  double line_probability = -1.0;
+  for (int i = 0; i < outcome_count; ++i) {
+    double probability = outcomes[i].probability;
+    remaining = std::max(0.0, remaining - probability);
+    double child_alpha = (alpha - expected - hi * remaining) / probability;
+    double child_beta = (beta - expected - lo * remaining) / probability;
+    if (child_alpha >= hi) {
+      worker.chance_cutoffs++;
+      return expected + hi * (remaining + probability);  // Can't reach alpha
+    }
+    if (child_beta <= lo) {
+      worker.chance_cutoffs++;
+      return expected + lo * (remaining + probability);  // Can't fall below beta
+    }
+    
+    SearchUndo undo;
+    context.makeOutcome(state, side, action.index, outcomes[i], undo);
+    worker.following_pv = follow_pv;
+    double value = searchNode(context, state, depth - 1, ply + 1, std::max(lo, child_alpha),
+                              std::min(hi, child_beta), !maximizing_player, child_line, worker);
+    SearchContext::unmake(state, undo);
+    if (worker.aborted) return 0.0;
+    
+    expected += probability * value;
+    if (probability > line_probability) {
+      line_probability = probability;
+      take_line(child_line);
+    }
+    if (value <= child_alpha) {
+      worker.chance_cutoffs++;
+      return expected + hi * remaining;  // Fail low: at most alpha
+    }
+    if (value >= child_beta) {
+      worker.chance_cutoffs++;
+      return expected + lo * remaining;  // Fail high: at least beta
     }
   }
-  for (int i = 0; i < static_cast<int>(battle_state.opponentTeam->size()); ++i) {
-    Pokemon* pokemon = battle_state.opponentTeam->getPokemon(i);
-    if (pokemon && pokemon->isAlive()) {
-      opp_health_total += calculateHealthRatio(*pokemon);
+  return expected;
+}
+
+double ExpertAI::probeSuccessor(const SearchContext& context, SearchState& state, int depth,
+                                int ply, bool maximizing_player,
+                                MiniMaxSearchEngine::SearchWorker& worker) const {
+  if (context.isTerminal(state)) {
+    return worker.evaluator->evaluate(state);
+  }
+  
+  constexpr int kBranching = MiniMaxSearchEngine::kMaxBranchingFactor;
+  int side = maximizing_player ? SearchState::kAISide : SearchState::kOpponentSide;
+  SearchAction actions[kBranching];
+  int action_count = context.generateActions(state, side, actions, kBranching);
+  if (action_count == 0) {
+    return worker.evaluator->evaluate(state);
+  }
+  
+  int order[kBranching];
+  orderSearchActions(context, *worker.evaluator, state, maximizing_player, ply,
+                     TranspositionTable::kNoMove, false, actions, action_count, order);
+  MiniMaxSearchEngine::SearchLine probe_line;
+  return searchAction(context, state, actions[order[0]], depth, ply,
+                      MiniMaxSearchEngine::kMinEvaluation, MiniMaxSearchEngine::kMaxEvaluation,
+                      maximizing_player, false, probe_line, worker);
+}
+
+double ExpertAI::searchSimultaneousNode(const SearchContext& context, SearchState& state,
+                                        int depth, int ply,
+                                        MiniMaxSearchEngine::SearchWorker& worker,
+                                        SimultaneousSearchResult* root) const {
+  worker.nodes_evaluated++;
+  if (depth <= 0 || context.isTerminal(state)) {
+    return worker.evaluator->evaluate(state);
+  }
+  
+  // Kept apart from alternating-search entries for the same position
+  constexpr uint64_t kSimultaneousKey = 0x51A17A9E0C3B5D27ULL;
+  TranspositionTable& table = *worker.table;
+  const uint64_t key = ZobristHasher::hash(context, state, true) ^ kSimultaneousKey;
+  TranspositionTable::Entry entry;
+  if (!root && table.probe(key, entry) && entry.depth >= depth &&
+      entry.bound == TranspositionTable::Bound::EXACT) {
+    return entry.score;
+  }
+  
+  // A side whose active Pokemon fainted picks a replacement while the other
+  // waits; that exchange doesn't count as a turn
+  bool replacing[2];
+  for (int side = 0; side < 2; ++side) {
+    int active = state.activeIndex(side);
+    replacing[side] = active < 0 || state.combatants[active].hp <= 0;
+  }
+  const bool replacement = replacing[0] || replacing[1];
+  const int child_depth = replacement ? depth : depth - 1;
+  
+  constexpr int kBranching = MiniMaxSearchEngine::kMaxBranchingFactor;
+  SearchAction actions[2][kBranching];
+  int action_count[2];
+  for (int side = 0; side < 2; ++side) {
+    action_count[side] = replacement && !replacing[side]
+                             ? 0
+                             : context.generateActions(state, side, actions[side], kBranching);
+    if (action_count[side] == 0) {
+      actions[side][0] = {SearchAction::Type::PASS, 0};
+      action_count[side] = 1;
     }
   }
-  score += (ai_health_total - opp_health_total) * 20.0;
   
-  // Positional factors
-  if (battle_state.aiPokemon && battle_state.opponentPokemon) {
-    // Type matchup advantage
-    for (const auto& move : battle_state.aiPokemon->moves) {
-      if (move.power > 0 && move.canUse()) {
-        double effectiveness = calculateTypeEffectiveness(move.type, battle_state.opponentPokemon->types);
-        if (effectiveness >= 2.0) score += 15.0;
-        else if (effectiveness >= 1.5) score += 8.0;
-        else if (effectiveness <= 0.5) score -= 10.0;
+  MatrixGame game;
+  game.rows = action_count[SearchState::kAISide];
+  game.cols = action_count[SearchState::kOpponentSide];
+  if (child_depth == 0) {
+    // Every cell is a leaf: lay out the resulting positions (both orders on
+    // a speed tie) and score them in one batch
+    constexpr int kMaxLeaves = 2 * kBranching * kBranching;
+    SearchState leaves[kMaxLeaves];
+    double scores[kMaxLeaves];
+    int first_leaf[kBranching][kBranching];
+    bool tied[kBranching][kBranching];
+    int leaf_count = 0;
+    auto add_leaf = [&](const SearchAction* turn, bool ai_first) {
+      SearchTurnUndo undo;
+      leaves[leaf_count] = state;
+      context.makeTurn(leaves[leaf_count++], turn, ai_first, undo);
+    };
+    for (int i = 0; i < game.rows; ++i) {
+      for (int j = 0; j < game.cols; ++j) {
+        SearchAction turn[2] = {actions[SearchState::kAISide][i],
+                                actions[SearchState::kOpponentSide][j]};
+        int order = 1;
+        if (turn[0].type == SearchAction::Type::MOVE && turn[1].type == SearchAction::Type::MOVE) {
+          order = context.turnOrder(state, turn[0].index, turn[1].index);
+        }
+        first_leaf[i][j] = leaf_count;
+        tied[i][j] = order == 0;
+        add_leaf(turn, order >= 0);
+        if (tied[i][j]) add_leaf(turn, false);
       }
     }
-    
-    // Speed advantage
-    if (battle_state.aiPokemon->speed > battle_state.opponentPokemon->speed) {
-      score += 10.0;
-    } else if (battle_state.aiPokemon->speed < battle_state.opponentPokemon->speed) {
-      score -= 5.0;
+    worker.evaluator->evaluateBatch(leaves, leaf_count, scores);
+    worker.nodes_evaluated += leaf_count;
+    for (int i = 0; i < game.rows; ++i) {
+      for (int j = 0; j < game.cols; ++j) {
+        const double* cell = scores + first_leaf[i][j];
+        game.payoff[i][j] = tied[i][j] ? 0.5 * (cell[0] + cell[1]) : cell[0];
+      }
+    }
+  } else {
+    for (int i = 0; i < game.rows; ++i) {
+      for (int j = 0; j < game.cols; ++j) {
+        SearchAction turn[2] = {actions[SearchState::kAISide][i],
+                                actions[SearchState::kOpponentSide][j]};
+        auto resolve = [&](bool ai_first) {
+          SearchTurnUndo undo;
+          context.makeTurn(state, turn, ai_first, undo);
+          double value =
+              searchSimultaneousNode(context, state, child_depth, ply + 1, worker, nullptr);
+          SearchContext::unmakeTurn(state, undo);
+          return value;
+        };
+      
+        int order = 1;
+        if (turn[0].type == SearchAction::Type::MOVE && turn[1].type == SearchAction::Type::MOVE) {
+          order = context.turnOrder(state, turn[0].index, turn[1].index);
+        }
+        game.payoff[i][j] = order == 0 ? 0.5 * (resolve(true) + resolve(false)) : resolve(order > 0);
+      }
     }
-    
-    // Status condition factors
-    if (battle_state.opponentPokemon->status != StatusCondition::NONE) score += 25.0;
-    if (battle_state.aiPokemon->status != StatusCondition::NONE) score -= 20.0;
   }
   
+  MatrixGameSolution solution = MatrixGameSolver::solve(game);
+  worker.matrix_games_solved++;
+  
+  auto encode = [](const SearchAction& action) {
+    return action.type == SearchAction::Type::PASS ? TranspositionTable::kNoMove
+                                                   : action.encode();
+  };
+  int best_row = static_cast<int>(
+      std::max_element(solution.row_strategy, solution.row_strategy + game.rows) -
+      solution.row_strategy);
+  table.store(key, {solution.value, depth, TranspositionTable::Bound::EXACT,
+                    encode(actions[SearchState::kAISide][best_row])});
+  
+  if (root) {
+    for (int i = 0; i < game.rows; ++i) {
+      root->ai_actions.push_back(encode(actions[SearchState::kAISide][i]));
+      root->ai_strategy.push_back(solution.row_strategy[i]);
+    }
+    for (int j = 0; j < game.cols; ++j) {
+      root->opponent_actions.push_back(encode(actions[SearchState::kOpponentSide][j]));
+      root->opponent_strategy.push_back(solution.col_strategy[j]);
+    }
+  }
+  return solution.value;
+}
+
+double ExpertAI::evaluatePosition(const BattleState& battle_state) const {
+  SearchContext context(battle_state);
   total_positions_analyzed_++;
-  return score;
+  return evaluateSearchState(context, context.root());
+}
+
+double ExpertAI::evaluateSearchState(const SearchContext& context, const SearchState& state) const {
+  return PositionEvaluator(context).evaluate(state);
 }
 
 std::vector<BattleState> ExpertAI::generateLegalMoves(const BattleState& current_state, bool for_ai) const {
@@ -1221,7 +1872,7 @@ std::vector<BattleState> ExpertAI::generateLegalMoves(const BattleState& current
     attacker->moves[i].current_pp = std::max(0, attacker->moves[i].current_pp - 1);
     
     // Apply move effects if it deals damage
-    if (move.power > 0) {
+    if (move.def().power > 0) {
       double damage = estimateDamage(*attacker, *defender, move, new_state.currentWeather);
       int actualDamage = static_cast<int>(damage);
       defender->current_hp = std::max(0, defender->current_hp - actualDamage);
@@ -1233,13 +1884,13 @@ std::vector<BattleState> ExpertAI::generateLegalMoves(const BattleState& current
     }
     
     // Apply status effects if move has them
-    if (move.ailment_name != "none" && move.ailment_chance > 0) {
+    if (move.def().ailment_id != MoveAilment::NONE && move.def().ailment_chance > 0) {
       // Simplified status application - in full implementation would check chance
-      if (move.ailment_name == "paralysis") {
+      if (move.def().ailment_id == MoveAilment::PARALYSIS) {
         defender->status = StatusCondition::PARALYSIS;
-      } else if (move.ailment_name == "poison") {
+      } else if (move.def().ailment_id == MoveAilment::POISON) {
         defender->status = StatusCondition::POISON;
-      } else if (move.ailment_name == "burn") {
+      } else if (move.def().ailment_id == MoveAilment::BURN) {
         defender->status = StatusCondition::BURN;
       }
     }
@@ -1280,13 +1931,26 @@ std::vector<BattleState> ExpertAI::generateLegalMoves(const BattleState& current
 }
 
 void ExpertAI::orderMoves(std::vector<BattleState>& states, bool maximizing_player) const {
-  // Simple move ordering - prioritize high-damage moves for better alpha-beta pruning
-  // In practice, this would use more sophisticated heuristics
-  std::sort(states.begin(), states.end(), [this, maximizing_player](const BattleState& a, const BattleState& b) {
-    double score_a = evaluatePosition(a);
-    double score_b = evaluatePosition(b);
-    return maximizing_player ? (score_a > score_b) : (score_a < score_b);
+  // Simple move ordering - prioritize high-damage moves for better alpha-beta pruning.
+  // Each state is scored once up front rather than on every comparison.
+  std::vector<double> scores;
+  scores.reserve(states.size());
+  for (const BattleState& state : states) {
+    scores.push_back(evaluatePosition(state));
+  }
+  
+  std::vector<size_t> order(states.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&scores, maximizing_player](size_t a, size_t b) {
+    return maximizing_player ? (scores[a] > scores[b]) : (scores[a] < scores[b]);
   });
+  
+  std::vector<BattleState> sorted;
+  sorted.reserve(states.size());
+  for (size_t index : order) {
+    sorted.push_back(states[index]);
+  }
+  states = std::move(sorted);
 }
 
 // Meta-Game Analysis Implementation
@@ -1318,9 +1982,9 @@ ExpertAI::MetaGameAnalyzer::TeamArchetype ExpertAI::analyzeTeamArchetype(const T
     
     // Check for setup moves
     for (const auto& move : pokemon->moves) {
-      if (move.power == 0 && (move.name.find("dance") != std::string::npos ||
-                              move.name.find("growth") != std::string::npos ||
-                              move.name.find("calm-mind") != std::string::npos)) {
+      if (move.def().power == 0 && (move.def().name.find("dance") != std::string::npos ||
+                              move.def().name.find("growth") != std::string::npos ||
+                              move.def().name.find("calm-mind") != std::string::npos)) {
         setup_sweepers++;
         break;
       }
@@ -1329,7 +1993,7 @@ ExpertAI::MetaGameAnalyzer::TeamArchetype ExpertAI::analyzeTeamArchetype(const T
     // Count status/support moves
     int status_moves = 0;
     for (const auto& move : pokemon->moves) {
-      if (move.power == 0) status_moves++;
+      if (move.def().power == 0) status_moves++;
     }
     if (status_moves >= 2) support_pokemon++;
   }
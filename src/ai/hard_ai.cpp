@@ -24,7 +24,7 @@ MoveEvaluation HardAI::chooseBestMove(const BattleState& battleState) {
     double score = evaluateComplexMove(move, battleState);
 
     // Bonus for setup moves when opportunity is good
-    if (move.power == 0 && setupValue > 0) {
+    if (move.def().power == 0 && setupValue > 0) {
       double statModValue = calculateStatModificationValue(move, battleState);
       score += statModValue + setupValue;
     }
@@ -73,8 +73,8 @@ SwitchEvaluation HardAI::chooseBestSwitch(const BattleState& battleState) {
     for (const auto& move : pokemon->moves) {
       if (!move.canUse()) continue;
       double effectiveness = calculateTypeEffectiveness(
-          move.type, battleState.opponentPokemon->types);
-      immediateMatchup += effectiveness * move.power * 0.1;
+          move.def().type_id, battleState.opponentPokemon->types);
+      immediateMatchup += effectiveness * move.def().power * 0.1;
     }
     score += immediateMatchup;
 
@@ -136,7 +136,7 @@ double HardAI::evaluateComplexMove(const Move& move,
                                    const BattleState& battleState) const {
   double score = 0.0;
 
-  if (move.power > 0) {
+  if (move.def().power > 0) {
     // Damage move evaluation
     double estimatedDamage =
         estimateDamage(*battleState.aiPokemon, *battleState.opponentPokemon,
@@ -151,7 +151,7 @@ double HardAI::evaluateComplexMove(const Move& move,
 
     // Weather synergy
     double weatherMultiplier = Weather::getWeatherDamageMultiplier(
-        battleState.currentWeather, move.type);
+        battleState.currentWeather, move.def().type);
     score += (weatherMultiplier - 1.0) * 30.0;
 
     // Consider if this move helps against opponent's team
@@ -160,7 +160,7 @@ double HardAI::evaluateComplexMove(const Move& move,
       Pokemon* opponent = battleState.opponentTeam->getPokemon(i);
       if (opponent && opponent->isAlive()) {
         double effectiveness =
-            calculateTypeEffectiveness(move.type, opponent->types);
+            calculateTypeEffectiveness(move.def().type_id, opponent->types);
         if (effectiveness >= 2.0) threatsHandled++;
       }
     }
@@ -175,7 +175,7 @@ double HardAI::evaluateComplexMove(const Move& move,
                        40.0);  // Status moves better vs healthy opponents
 
       // Specific status considerations
-      if (move.ailment_name == "sleep" || move.ailment_name == "paralysis") {
+      if (move.def().ailment_id == MoveAilment::SLEEP || move.def().ailment_id == MoveAilment::PARALYSIS) {
         score += 25.0;  // These are very disruptive
       }
     }
@@ -195,11 +195,11 @@ double HardAI::analyzeTeamThreat(const Pokemon& pokemon,
     // Check how well this Pokemon matches up against each opponent
     double bestMoveScore = 0.0;
     for (const auto& move : pokemon.moves) {
-      if (!move.canUse() || move.power <= 0) continue;
+      if (!move.canUse() || move.def().power <= 0) continue;
 
       double effectiveness =
-          calculateTypeEffectiveness(move.type, opponent->types);
-      double moveScore = move.power * effectiveness;
+          calculateTypeEffectiveness(move.def().type_id, opponent->types);
+      double moveScore = move.def().power * effectiveness;
       bestMoveScore = std::max(bestMoveScore, moveScore);
     }
 
@@ -217,7 +217,7 @@ double HardAI::analyzeTeamThreat(const Pokemon& pokemon,
 double HardAI::calculateStatModificationValue(
     const Move& move, const BattleState& battleState) const {
   // Simplified stat mod evaluation - in reality would check specific moves
-  if (move.power > 0) return 0.0;  // Not a stat modification move
+  if (move.def().power > 0) return 0.0;  // Not a stat modification move
 
   double value = 20.0;  // Base value for stat modifications
 
@@ -250,7 +250,7 @@ double HardAI::evaluateSetupOpportunity(const BattleState& battleState) const {
   // Better when opponent is low on damaging moves
   int opponentDamageMoves = 0;
   for (const auto& move : battleState.opponentPokemon->moves) {
-    if (move.canUse() && move.power > 0) opponentDamageMoves++;
+    if (move.canUse() && move.def().power > 0) opponentDamageMoves++;
   }
 
   if (opponentDamageMoves <= 1) setupValue += 25.0;
@@ -273,11 +273,11 @@ bool HardAI::canSweepTeam(const Pokemon& sweeper,
     // Check if we have a move that can deal significant damage to this opponent
     bool canThreaten = false;
     for (const auto& move : sweeper.moves) {
-      if (!move.canUse() || move.power <= 0) continue;
+      if (!move.canUse() || move.def().power <= 0) continue;
 
       double effectiveness =
-          calculateTypeEffectiveness(move.type, opponent->types);
-      if (effectiveness >= 1.0 && move.power >= 60) {
+          calculateTypeEffectiveness(move.def().type_id, opponent->types);
+      if (effectiveness >= 1.0 && move.def().power >= 60) {
         canThreaten = true;
         break;
       }
@@ -305,7 +305,7 @@ double HardAI::predictOpponentDamage(const BattleState& battleState) const {
 
   // Look at opponent's moves and estimate best damage they can do
   for (const auto& move : battleState.opponentPokemon->moves) {
-    if (!move.canUse() || move.power <= 0) continue;
+    if (!move.canUse() || move.def().power <= 0) continue;
 
     double estimatedDamage =
         estimateDamage(*battleState.opponentPokemon, *battleState.aiPokemon,
@@ -327,10 +327,10 @@ int HardAI::countTeamThreats(const Pokemon& pokemon,
 
     // Check if we have a super effective move against this opponent
     for (const auto& move : pokemon.moves) {
-      if (!move.canUse() || move.power <= 0) continue;
+      if (!move.canUse() || move.def().power <= 0) continue;
 
       double effectiveness =
-          calculateTypeEffectiveness(move.type, opponent->types);
+          calculateTypeEffectiveness(move.def().type_id, opponent->types);
       if (effectiveness >= 2.0) {
         threatCount++;
         break;  // Found one super effective move, that's enough
@@ -346,12 +346,12 @@ double HardAI::assessRisk(const Move& move,
   double riskScore = 0.0;
 
   // Accuracy risk
-  if (move.accuracy < 100) {
-    double missChance = (100 - move.accuracy) / 100.0;
+  if (move.def().accuracy < 100) {
+    double missChance = (100 - move.def().accuracy) / 100.0;
     riskScore -= missChance * 15.0;  // Penalty for miss chance
 
     // But bonus if it's high power and could KO
-    if (move.power >= 100 &&
+    if (move.def().power >= 100 &&
         estimateDamage(*battleState.aiPokemon, *battleState.opponentPokemon,
                        move, battleState.currentWeather) >=
             battleState.opponentPokemon->current_hp) {
@@ -382,7 +382,7 @@ bool HardAI::isLowRiskHighReward(const Move& move,
 
   // Low risk: high accuracy and we won't get KO'd back
   bool lowRisk =
-      (move.accuracy >= 90) && (predictOpponentDamage(battleState) <
+      (move.def().accuracy >= 90) && (predictOpponentDamage(battleState) <
                                 battleState.aiPokemon->current_hp * 0.7);
 
   return highReward && lowRisk;
@@ -0,0 +1,155 @@
+#include "matrix_game.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+constexpr int kMax = MatrixGame::kMaxActions;
+
+// Strategy proportional to the positive regrets; uniform when there are none
+void regretStrategy(const double* regrets, int count, double* strategy) {
+  double total = 0.0;
+  for (int i = 0; i < count; ++i) total += regrets[i];
+  for (int i = 0; i < count; ++i) {
+    strategy[i] = total > 0.0 ? regrets[i] / total : 1.0 / count;
+  }
+}
+
+// Best responses to the opponent's strategy: the AI's best row payoff
+// against col_strategy and the opponent's best (lowest) column payoff
+// against row_strategy. Their difference is the equilibrium gap.
+void bestResponses(const MatrixGame& game, const double* row_strategy,
+                   const double* col_strategy, double& row_best, double& col_best) {
+  row_best = -std::numeric_limits<double>::infinity();
+  for (int i = 0; i < game.rows; ++i) {
+    double payoff = 0.0;
+    for (int j = 0; j < game.cols; ++j) payoff += game.payoff[i][j] * col_strategy[j];
+    row_best = std::max(row_best, payoff);
+  }
+  col_best = std::numeric_limits<double>::infinity();
+  for (int j = 0; j < game.cols; ++j) {
+    double payoff = 0.0;
+    for (int i = 0; i < game.rows; ++i) payoff += game.payoff[i][j] * row_strategy[i];
+    col_best = std::min(col_best, payoff);
+  }
+}
+
+}  // namespace
+
+bool MatrixGameSolver::solvePure(const MatrixGame& game, MatrixGameSolution& solution) {
+  // Maximin over rows and minimax over columns meet at a saddle point
+  int best_row = 0;
+  double maximin = -std::numeric_limits<double>::infinity();
+  for (int i = 0; i < game.rows; ++i) {
+    double row_min = *std::min_element(game.payoff[i], game.payoff[i] + game.cols);
+    if (row_min > maximin) {
+      maximin = row_min;
+      best_row = i;
+    }
+  }
+  int best_col = 0;
+  double minimax = std::numeric_limits<double>::infinity();
+  for (int j = 0; j < game.cols; ++j) {
+    double col_max = -std::numeric_limits<double>::infinity();
+    for (int i = 0; i < game.rows; ++i) col_max = std::max(col_max, game.payoff[i][j]);
+    if (col_max < minimax) {
+      minimax = col_max;
+      best_col = j;
+    }
+  }
+  if (maximin < minimax) return false;
+
+  std::fill(solution.row_strategy, solution.row_strategy + kMax, 0.0);
+  std::fill(solution.col_strategy, solution.col_strategy + kMax, 0.0);
+  solution.row_strategy[best_row] = 1.0;
+  solution.col_strategy[best_col] = 1.0;
+  solution.value = game.payoff[best_row][best_col];
+  solution.iterations = 0;
+  solution.exploitability = 0.0;
+  return true;
+}
+
+MatrixGameSolution MatrixGameSolver::solve(const MatrixGame& game, int max_iterations,
+                                           double tolerance) {
+  MatrixGameSolution solution;
+  if (game.rows <= 0 || game.cols <= 0) {
+    std::fill(solution.row_strategy, solution.row_strategy + kMax, 0.0);
+    std::fill(solution.col_strategy, solution.col_strategy + kMax, 0.0);
+    solution.value = 0.0;
+    solution.iterations = 0;
+    solution.exploitability = 0.0;
+    return solution;
+  }
+  if (solvePure(game, solution)) {
+    return solution;
+  }
+
+  const int rows = game.rows;
+  const int cols = game.cols;
+  double row_regret[kMax] = {};
+  double col_regret[kMax] = {};
+  double row_current[kMax];
+  double col_current[kMax];
+  double row_average[kMax] = {};
+  double col_average[kMax] = {};
+  double utility[kMax];
+  regretStrategy(row_regret, rows, row_current);
+  regretStrategy(col_regret, cols, col_current);
+
+  // The gap is checked every few iterations; it costs as much as one update
+  constexpr int kCheckInterval = 8;
+  double row_best = 0.0;
+  double col_best = 0.0;
+  int iteration = 0;
+  while (iteration < std::max(1, max_iterations)) {
+    ++iteration;
+
+    // AI update against the opponent's current strategy
+    double expected = 0.0;
+    for (int i = 0; i < rows; ++i) {
+      utility[i] = 0.0;
+      for (int j = 0; j < cols; ++j) utility[i] += game.payoff[i][j] * col_current[j];
+      expected += utility[i] * row_current[i];
+    }
+    for (int i = 0; i < rows; ++i) {
+      row_regret[i] = std::max(0.0, row_regret[i] + utility[i] - expected);
+    }
+    regretStrategy(row_regret, rows, row_current);
+
+    // Opponent update against the AI's new strategy; it minimizes the payoff
+    expected = 0.0;
+    for (int j = 0; j < cols; ++j) {
+      utility[j] = 0.0;
+      for (int i = 0; i < rows; ++i) utility[j] += game.payoff[i][j] * row_current[i];
+      expected += utility[j] * col_current[j];
+    }
+    for (int j = 0; j < cols; ++j) {
+      col_regret[j] = std::max(0.0, col_regret[j] + expected - utility[j]);
+    }
+    regretStrategy(col_regret, cols, col_current);
+
+    // Later iterates are closer to equilibrium, so they weigh more
+    for (int i = 0; i < rows; ++i) row_average[i] += iteration * row_current[i];
+    for (int j = 0; j < cols; ++j) col_average[j] += iteration * col_current[j];
+
+    if (iteration % kCheckInterval == 0 || iteration == max_iterations) {
+      double weight = iteration * (iteration + 1) / 2.0;
+      for (int i = 0; i < rows; ++i) solution.row_strategy[i] = row_average[i] / weight;
+      for (int j = 0; j < cols; ++j) solution.col_strategy[j] = col_average[j] / weight;
+      bestResponses(game, solution.row_strategy, solution.col_strategy, row_best, col_best);
+      if (row_best - col_best <= tolerance) break;
+    }
+  }
+
+  double weight = iteration * (iteration + 1) / 2.0;
+  for (int i = 0; i < kMax; ++i) {
+    solution.row_strategy[i] = i < rows ? row_average[i] / weight : 0.0;
+    solution.col_strategy[i] = i < cols ? col_average[i] / weight : 0.0;
+  }
+  bestResponses(game, solution.row_strategy, solution.col_strategy, row_best, col_best);
+  solution.value = (row_best + col_best) / 2.0;
+  solution.iterations = iteration;
+  solution.exploitability = row_best - col_best;
+  return solution;
+}
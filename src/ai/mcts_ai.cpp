@@ -0,0 +1,361 @@
+#include "mcts_ai.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "search_state.h"
+#include "transposition_table.h"
+
+namespace {
+
+int teamSlotOf(const Team* team, const Pokemon* pokemon) {
+  for (int i = 0; i < static_cast<int>(team->size()); ++i) {
+    if (team->getPokemon(i) == pokemon) return i;
+  }
+  return -1;
+}
+
+// Share of the remaining HP fraction held by the AI, for unfinished playouts
+double healthShare(const Team* ai_team, const Team* opponent_team) {
+  auto total = [](const Team* team) {
+    double sum = 0.0;
+    for (int i = 0; i < static_cast<int>(team->size()); ++i) {
+      const Pokemon* pokemon = team->getPokemon(i);
+      if (pokemon && pokemon->hp > 0) {
+        sum += static_cast<double>(std::max(0, pokemon->current_hp)) / pokemon->hp;
+      }
+    }
+    return sum;
+  };
+  double ai = total(ai_team);
+  double opponent = total(opponent_team);
+  return ai + opponent > 0.0 ? ai / (ai + opponent) : 0.5;
+}
+
+}  // namespace
+
+MoveEvaluation MCTSAI::chooseBestMove(const BattleState& battleState) {
+  std::vector<Move*> usableMoves = getUsableMoves(*battleState.aiPokemon);
+  if (usableMoves.empty()) {
+    return {0, -100.0, "No PP remaining on any moves"};
+  }
+
+  cachedSearch(battleState);
+
+  // Best move even when the search prefers switching out
+  const RootActionStats* best = nullptr;
+  for (const auto& stats : statistics_.root_actions) {
+    if (stats.action.type == Battle::BattleAction::Type::MOVE &&
+        (!best || stats.visits > best->visits)) {
+      best = &stats;
+    }
+  }
+  if (!best) {
+    int index = static_cast<int>(usableMoves.front() - &battleState.aiPokemon->moves[0]);
+    return {index, 0.0, "MCTS AI: No move explored, using first usable move"};
+  }
+  return {best->action.index, best->mean_reward * 100.0,
+          "MCTS AI: Most visited move over " + std::to_string(statistics_.playouts) +
+              " playouts"};
+}
+
+SwitchEvaluation MCTSAI::chooseBestSwitch(const BattleState& battleState) {
+  cachedSearch(battleState);
+
+  const RootActionStats* best = nullptr;
+  for (const auto& stats : statistics_.root_actions) {
+    if (stats.action.type == Battle::BattleAction::Type::SWITCH &&
+        (!best || stats.visits > best->visits)) {
+      best = &stats;
+    }
+  }
+  if (!best) {
+    return {-1, -100.0, "No Pokemon available to switch"};
+  }
+  return {best->action.index, best->mean_reward * 100.0,
+          "MCTS AI: Most visited switch over " + std::to_string(statistics_.playouts) +
+              " playouts"};
+}
+
+bool MCTSAI::shouldSwitch(const BattleState& battleState) {
+  return cachedSearch(battleState).type == Battle::BattleAction::Type::SWITCH;
+}
+
+Battle::BattleAction MCTSAI::cachedSearch(const BattleState& battleState) {
+  uint64_t key = positionKey(battleState);
+  if (!has_cached_result_ || key != cached_key_) {
+    search(battleState);
+    cached_key_ = key;
+    has_cached_result_ = true;
+  }
+  return best_action_;
+}
+
+uint64_t MCTSAI::positionKey(const BattleState& battleState) {
+  SearchContext context(battleState);
+  return ZobristHasher::hash(context, context.root(), true) ^
+         (static_cast<uint64_t>(battleState.turnNumber) * 0x9E3779B97F4A7C15ULL);
+}
+
+Battle::BattleAction MCTSAI::search(const BattleState& battleState) {
+  auto start_time = std::chrono::steady_clock::now();
+  // Computed before the workers start: building the SearchContext also
+  // initialises the shared type chart that rollouts read
+  uint64_t key = positionKey(battleState);
+
+  Settings settings = settings_;
+  if (settings.max_playouts <= 0 && settings.time_budget.count() <= 0) {
+    settings.max_playouts = Settings{}.max_playouts;  // Some budget is required
+  }
+  int workers = settings.worker_threads > 0
+                    ? settings.worker_threads
+                    : static_cast<int>(std::thread::hardware_concurrency());
+  workers = std::max(1, workers);
+
+  Tree tree;
+  std::atomic<int> claimed{0};
+  std::atomic<int> completed{0};
+  const auto deadline = start_time + settings.time_budget;
+
+  auto run_worker = [&](int index) {
+    std::seed_seq seq{settings.seed != 0 ? settings.seed : std::random_device{}(),
+                      static_cast<uint32_t>(index)};
+    std::mt19937 rng(seq);
+    while (true) {
+      if (settings.max_playouts > 0 && claimed.fetch_add(1) >= settings.max_playouts) break;
+      if (settings.time_budget.count() > 0 && std::chrono::steady_clock::now() >= deadline) break;
+      runPlayout(battleState, tree, rng);
+      completed.fetch_add(1, std::memory_order_relaxed);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < workers; ++i) {
+    threads.emplace_back(run_worker, i);
+  }
+  run_worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Most visited root action; ties go to the higher mean reward
+  statistics_.root_actions.clear();
+  const Edge* best = nullptr;
+  for (const Edge& edge : tree.root.edges) {
+    double mean = edge.visits > 0 ? edge.reward / edge.visits : 0.0;
+    statistics_.root_actions.push_back({edge.action, edge.visits, mean});
+    if (!best || edge.visits > best->visits ||
+        (edge.visits == best->visits && edge.visits > 0 &&
+         mean > best->reward / best->visits)) {
+      best = &edge;
+    }
+  }
+  best_action_ = best ? best->action
+                      : Battle::BattleAction{Battle::BattleAction::Type::MOVE, 0};
+
+  auto elapsed = std::chrono::steady_clock::now() - start_time;
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  statistics_.playouts = completed.load();
+  statistics_.tree_nodes = tree.nodes;
+  statistics_.max_tree_depth = tree.max_depth;
+  statistics_.worker_threads = workers;
+  statistics_.search_time = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed);
+  statistics_.playouts_per_second = seconds > 0.0 ? statistics_.playouts / seconds : 0.0;
+
+  // A direct search also refreshes the cache used by the strategy methods
+  cached_key_ = key;
+  has_cached_result_ = true;
+  return best_action_;
+}
+
+double MCTSAI::runPlayout(const BattleState& root, Tree& tree, std::mt19937& rng) const {
+  std::vector<Edge*> path;
+  Node* node = &tree.root;  // nullptr once the playout has left the tree
+
+  // Takes one tree step at the current node; expanding a new edge leaves the tree
+  auto tree_step = [&](const std::vector<Battle::BattleAction>& legal) {
+    std::lock_guard<std::mutex> lock(tree.mutex);
+    Edge* edge = selectEdge(*node, legal, rng);
+    path.push_back(edge);
+    tree.max_depth = std::max(tree.max_depth, static_cast<int>(path.size()));
+    if (!edge->child) {
+      edge->child = std::make_unique<Node>();
+      tree.nodes++;
+      node = nullptr;
+    } else {
+      node = edge->child.get();
+    }
+    return edge->action;
+  };
+
+  // A fainted active Pokemon makes the root decision a replacement, taken
+  // before the battle resumes
+  int ai_lead = teamSlotOf(root.aiTeam, root.aiPokemon);
+  if (!root.aiPokemon->isAlive()) {
+    std::vector<Battle::BattleAction> legal = legalActions(root);
+    if (!legal.empty()) {
+      ai_lead = tree_step(legal).index;
+    }
+  }
+
+  Battle battle(*root.aiTeam, *root.opponentTeam);
+  battle.seedRandom(rng());
+  battle.setHeadlessStart({ai_lead, teamSlotOf(root.opponentTeam, root.opponentPokemon),
+                           root.currentWeather, root.weatherTurnsRemaining});
+
+  const Team* ai_team = nullptr;
+  const Team* opponent_team = nullptr;
+  auto ai_provider = [&](const BattleState& state) -> Battle::BattleAction {
+    ai_team = state.aiTeam;
+    opponent_team = state.opponentTeam;
+    if (!state.aiPokemon->isAlive()) return replacementAction(state);
+    if (!node) return rolloutAction(state, rng);
+    std::vector<Battle::BattleAction> legal = legalActions(state);
+    if (legal.empty()) return rolloutAction(state, rng);
+    return tree_step(legal);
+  };
+  // Determinization: the opponent's hidden choice is sampled every turn
+  auto opponent_provider = [&](const BattleState& state) -> Battle::BattleAction {
+    if (!state.aiPokemon->isAlive()) return replacementAction(state);
+    return rolloutAction(state, rng);
+  };
+
+  int turn_limit = settings_.max_rollout_turns + static_cast<int>(path.size());
+  {
+    std::lock_guard<std::mutex> lock(tree.mutex);
+    turn_limit += tree.max_depth;
+  }
+  Battle::HeadlessResult result = battle.runHeadless(ai_provider, opponent_provider, turn_limit);
+
+  double reward = 0.5;
+  if (result.result == Battle::BattleResult::PLAYER_WINS) {
+    reward = 1.0;
+  } else if (result.result == Battle::BattleResult::OPPONENT_WINS) {
+    reward = 0.0;
+  } else if (ai_team && opponent_team) {
+    reward = healthShare(ai_team, opponent_team);
+  }
+
+  std::lock_guard<std::mutex> lock(tree.mutex);
+  for (Edge* edge : path) {
+    edge->visits++;
+    edge->virtual_loss -= settings_.virtual_loss;
+    edge->reward += reward;
+  }
+  return reward;
+}
+
+MCTSAI::Edge* MCTSAI::selectEdge(Node& node, const std::vector<Battle::BattleAction>& legal,
+                                 std::mt19937& rng) const {
+  std::vector<Edge*> candidates;
+  candidates.reserve(legal.size());
+  for (const auto& action : legal) {
+    auto it = std::find_if(node.edges.begin(), node.edges.end(), [&](const Edge& edge) {
+      return edge.action.type == action.type && edge.action.index == action.index;
+    });
+    if (it == node.edges.end()) {
+      node.edges.emplace_back();
+      node.edges.back().action = action;
+      it = std::prev(node.edges.end());
+    }
+    it->availability++;
+    candidates.push_back(&*it);
+  }
+
+  // Untried actions first, in random order
+  std::vector<Edge*> untried;
+  for (Edge* edge : candidates) {
+    if (edge->visits + edge->virtual_loss == 0) untried.push_back(edge);
+  }
+
+  Edge* chosen = nullptr;
+  if (!untried.empty()) {
+    std::uniform_int_distribution<size_t> pick(0, untried.size() - 1);
+    chosen = untried[pick(rng)];
+  } else {
+    // UCT over availability; in-flight visits count as losses
+    double best_score = -std::numeric_limits<double>::infinity();
+    for (Edge* edge : candidates) {
+      double visits = edge->visits + edge->virtual_loss;
+      double score = edge->reward / visits +
+                     settings_.exploration *
+                         std::sqrt(std::log(static_cast<double>(edge->availability)) / visits);
+      if (score > best_score) {
+        best_score = score;
+        chosen = edge;
+      }
+    }
+  }
+
+  chosen->virtual_loss += settings_.virtual_loss;
+  return chosen;
+}
+
+std::vector<Battle::BattleAction> MCTSAI::legalActions(const BattleState& state) {
+  std::vector<Battle::BattleAction> actions;
+  const Pokemon* active = state.aiPokemon;
+  if (active->isAlive()) {
+    for (size_t i = 0; i < active->moves.size(); ++i) {
+      if (active->moves[i].canUse()) {
+        actions.push_back({Battle::BattleAction::Type::MOVE, static_cast<int>(i)});
+      }
+    }
+  }
+  for (int i = 0; i < static_cast<int>(state.aiTeam->size()); ++i) {
+    const Pokemon* pokemon = state.aiTeam->getPokemon(i);
+    if (pokemon && pokemon != active && pokemon->isAlive()) {
+      actions.push_back({Battle::BattleAction::Type::SWITCH, i});
+    }
+  }
+  return actions;
+}
+
+Battle::BattleAction MCTSAI::rolloutAction(const BattleState& state, std::mt19937& rng) const {
+  const Pokemon& attacker = *state.aiPokemon;
+  std::vector<int> usable;
+  for (size_t i = 0; i < attacker.moves.size(); ++i) {
+    if (attacker.moves[i].canUse()) usable.push_back(static_cast<int>(i));
+  }
+  if (usable.empty()) {
+    return {Battle::BattleAction::Type::MOVE, 0};
+  }
+
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  if (coin(rng) < settings_.rollout_epsilon) {
+    std::uniform_int_distribution<size_t> pick(0, usable.size() - 1);
+    return {Battle::BattleAction::Type::MOVE, usable[pick(rng)]};
+  }
+
+  int best = usable.front();
+  double best_damage = -1.0;
+  for (int index : usable) {
+    double damage = estimateDamage(attacker, *state.opponentPokemon, attacker.moves[index],
+                                   state.currentWeather);
+    if (damage > best_damage) {
+      best_damage = damage;
+      best = index;
+    }
+  }
+  return {Battle::BattleAction::Type::MOVE, best};
+}
+
+Battle::BattleAction MCTSAI::replacementAction(const BattleState& state) const {
+  int best = -1;
+  double best_damage = -1.0;
+  for (int i = 0; i < static_cast<int>(state.aiTeam->size()); ++i) {
+    const Pokemon* pokemon = state.aiTeam->getPokemon(i);
+    if (!pokemon || !pokemon->isAlive() || pokemon == state.aiPokemon) continue;
+    for (const Move& move : pokemon->moves) {
+      double damage = estimateDamage(*pokemon, *state.opponentPokemon, move, state.currentWeather);
+      if (damage > best_damage) {
+        best_damage = damage;
+        best = i;
+      }
+    }
+    if (best < 0) best = i;
+  }
+  return {Battle::BattleAction::Type::SWITCH, best};
+}
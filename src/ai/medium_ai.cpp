@@ -78,7 +78,7 @@ bool MediumAI::shouldSwitch(const BattleState& battleState) {
 
 double MediumAI::scoreMoveAdvanced(const Move& move,
                                    const BattleState& battleState) const {
-  if (move.power > 0) {
+  if (move.def().power > 0) {
     return scoreDamageMove(move, battleState);
   } else {
     return scoreStatusMove(move, battleState);
@@ -100,15 +100,15 @@ double MediumAI::scoreStatusMove(const Move& move,
   }
 
   // Specific status move evaluation
-  if (move.ailment_name == "poison" || move.ailment_name == "burn") {
+  if (move.def().ailment_id == MoveAilment::POISON || move.def().ailment_id == MoveAilment::BURN) {
     // Poison/burn better against high HP Pokemon
     score += battleState.opponentPokemon->current_hp * 0.3;
-  } else if (move.ailment_name == "paralysis") {
+  } else if (move.def().ailment_id == MoveAilment::PARALYSIS) {
     // Paralysis good against fast Pokemon
     if (battleState.opponentPokemon->speed > battleState.aiPokemon->speed) {
       score += 25.0;
     }
-  } else if (move.ailment_name == "sleep") {
+  } else if (move.def().ailment_id == MoveAilment::SLEEP) {
     // Sleep is generally powerful
     score += 35.0;
   }
@@ -134,17 +134,17 @@ double MediumAI::scoreDamageMove(const Move& move,
   score += scoreWeatherAdvantage(move, battleState.currentWeather);
 
   // Accuracy consideration
-  score += (move.accuracy - 80) * 0.5;  // Penalty for low accuracy moves
+  score += (move.def().accuracy - 80) * 0.5;  // Penalty for low accuracy moves
 
   // Prefer moves that can KO, with very strong preference for reliable KOs  
   if (estimatedDamage >= battleState.opponentPokemon->current_hp) {
     // For KO moves, accuracy is critical - scale bonus heavily by reliability
-    double accuracyFactor = move.accuracy / 100.0;
+    double accuracyFactor = move.def().accuracy / 100.0;
     double koBonus = 200.0 * accuracyFactor;  // Large bonus scaled by accuracy
     score += koBonus;
     
     // Massive additional bonus for guaranteed KOs (perfect accuracy)
-    if (move.accuracy >= 100) {
+    if (move.def().accuracy >= 100) {
       score += 100.0;  // Huge reliability bonus for guaranteed success
     }
   }
@@ -152,7 +152,7 @@ double MediumAI::scoreDamageMove(const Move& move,
   // STAB consideration (already in damage estimate, but small extra bonus)
   bool hasSTAB = std::find(battleState.aiPokemon->types.begin(),
                            battleState.aiPokemon->types.end(),
-                           move.type) != battleState.aiPokemon->types.end();
+                           move.def().type) != battleState.aiPokemon->types.end();
   if (hasSTAB) score += 5.0;
 
   return score;
@@ -160,15 +160,15 @@ double MediumAI::scoreDamageMove(const Move& move,
 
 double MediumAI::scoreWeatherAdvantage(const Move& move,
                                        WeatherCondition weather) const {
-  double multiplier = Weather::getWeatherDamageMultiplier(weather, move.type);
+  double multiplier = Weather::getWeatherDamageMultiplier(weather, move.def().type);
 
   if (multiplier > 1.0) {
     // Weather boost - bonus proportional to power increase
-    return (multiplier - 1.0) * move.power * 0.5;
+    return (multiplier - 1.0) * move.def().power * 0.5;
   }
   if (multiplier < 1.0) {
     // Weather penalty - penalty proportional to power reduction
-    return (multiplier - 1.0) * move.power * 2.0;  // Stronger penalty to account for damage weighting
+    return (multiplier - 1.0) * move.def().power * 2.0;  // Stronger penalty to account for damage weighting
   }
   return 0.0;  // No weather effect
 }
@@ -179,10 +179,10 @@ double MediumAI::evaluatePokemonMatchup(const Pokemon& attacker,
 
   // Check type advantages for attacker's moves
   for (const auto& move : attacker.moves) {
-    if (!move.canUse() || move.power <= 0) continue;
+    if (!move.canUse() || move.def().power <= 0) continue;
 
     double typeEffectiveness =
-        calculateTypeEffectiveness(move.type, defender.types);
+        calculateTypeEffectiveness(move.def().type_id, defender.types);
     if (typeEffectiveness >= 2.0)
       score += 40.0;  // Super effective
     else if (typeEffectiveness <= 0.5)
@@ -201,10 +201,10 @@ double MediumAI::evaluatePokemonMatchup(const Pokemon& attacker,
   // This is simplified - in reality would check all of defender's potential
   // moves
   bool hasTypeResistance = false;
-  for (const auto& defenderType : defender.types) {
-    for (const auto& attackerType : attacker.types) {
+  for (PokemonType defenderType : defender.types.ids()) {
+    for (PokemonType attackerType : attacker.types.ids()) {
       double resistance =
-          calculateTypeEffectiveness(defenderType, {attackerType});
+          TypeEffectiveness::getEffectivenessMultiplier(defenderType, attackerType);
       if (resistance >= 2.0) {
         score -= 15.0;  // Defender can hit us super effectively
         break;
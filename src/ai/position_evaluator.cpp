@@ -0,0 +1,129 @@
+#include "position_evaluator.h"
+
+#include <algorithm>
+
+#include "ai_strategy.h"
+
+namespace {
+
+constexpr double kAliveWeight = 30.0;
+constexpr double kHealthWeight = 20.0;
+constexpr uint8_t kNoStatus = static_cast<uint8_t>(StatusCondition::NONE);
+
+}  // namespace
+
+PositionEvaluator::PositionEvaluator(const SearchContext& context) : present_count_(0) {
+  for (int side = 0; side < 2; ++side) {
+    for (int slot = 0; slot < context.teamSize(side); ++slot) {
+      int index = SearchState::combatantIndex(side, slot);
+      const auto& info = context.info(index);
+      if (!info.present) continue;
+      present_[present_count_] = static_cast<int8_t>(index);
+      side_[present_count_] = static_cast<int8_t>(side);
+      max_hp_[present_count_] = info.max_hp > 0 ? info.max_hp : 0.0;
+      ++present_count_;
+    }
+  }
+
+  for (int ai_slot = 0; ai_slot < kSlots; ++ai_slot) {
+    const auto& ai_info =
+        context.info(SearchState::combatantIndex(SearchState::kAISide, ai_slot));
+    for (int opp_slot = 0; opp_slot < kSlots; ++opp_slot) {
+      const auto& opp_info =
+          context.info(SearchState::combatantIndex(SearchState::kOpponentSide, opp_slot));
+
+      for (int m = 0; m < SearchState::kMaxMoves; ++m) {
+        double bonus = 0.0;
+        if (m < ai_info.move_count && ai_info.moves[m].power > 0) {
+          double effectiveness = ai_info.moves[m].type_multiplier[opp_slot];
+          if (effectiveness >= 2.0) bonus = 15.0;
+          else if (effectiveness >= 1.5) bonus = 8.0;
+          else if (effectiveness <= 0.5) bonus = -10.0;
+        }
+        move_matchup_[ai_slot][opp_slot][m] = bonus;
+      }
+
+      speed_matchup_[ai_slot][opp_slot] =
+          ai_info.speed > opp_info.speed ? 10.0 : (ai_info.speed < opp_info.speed ? -5.0 : 0.0);
+    }
+  }
+}
+
+double PositionEvaluator::addActiveScore(const SearchState& state, double score) const {
+  int ai_slot = state.active[SearchState::kAISide];
+  int opp_slot = state.active[SearchState::kOpponentSide];
+  if (ai_slot < 0 || opp_slot < 0) return score;
+
+  const SearchCombatant& ai = state.combatants[state.activeIndex(SearchState::kAISide)];
+  const SearchCombatant& opp = state.combatants[state.activeIndex(SearchState::kOpponentSide)];
+  const double* matchup = move_matchup_[ai_slot][opp_slot];
+
+  for (int m = 0; m < SearchState::kMaxMoves; ++m) {
+    if (ai.pp[m] > 0) score += matchup[m];
+  }
+  score += speed_matchup_[ai_slot][opp_slot];
+  if (opp.status != kNoStatus) score += 25.0;
+  if (ai.status != kNoStatus) score -= 20.0;
+  return score;
+}
+
+double PositionEvaluator::evaluate(const SearchState& state) const {
+  int alive[2] = {0, 0};
+  double health[2] = {0.0, 0.0};
+  for (int i = 0; i < present_count_; ++i) {
+    int hp = state.combatants[present_[i]].hp;
+    if (hp > 0) {
+      alive[side_[i]]++;
+      if (max_hp_[i] > 0.0) health[side_[i]] += hp / max_hp_[i];
+    }
+  }
+
+  double score = (alive[SearchState::kAISide] - alive[SearchState::kOpponentSide]) * kAliveWeight;
+  score += (health[SearchState::kAISide] - health[SearchState::kOpponentSide]) * kHealthWeight;
+  score = addActiveScore(state, score);
+  return std::clamp(score, kMinScore, kMaxScore);
+}
+
+void PositionEvaluator::evaluateBatch(const SearchState* states, int count,
+                                      double* scores) const {
+  for (int start = 0; start < count; start += kBatchSize) {
+    evaluateChunk(states + start, std::min(kBatchSize, count - start), scores + start);
+  }
+}
+
+void PositionEvaluator::evaluateChunk(const SearchState* states, int count,
+                                      double* scores) const {
+  // Transpose HP into one column per combatant
+  int16_t hp[SearchState::kMaxCombatants][kBatchSize];
+  for (int n = 0; n < count; ++n) {
+    for (int i = 0; i < present_count_; ++i) {
+      hp[i][n] = states[n].combatants[present_[i]].hp;
+    }
+  }
+
+  int alive[2][kBatchSize] = {};
+  double health[2][kBatchSize] = {};
+  for (int i = 0; i < present_count_; ++i) {
+    int* side_alive = alive[side_[i]];
+    double* side_health = health[side_[i]];
+    const int16_t* column = hp[i];
+    const double max_hp = max_hp_[i];
+    for (int n = 0; n < count; ++n) {
+      side_alive[n] += column[n] > 0;
+    }
+    if (max_hp > 0.0) {
+      for (int n = 0; n < count; ++n) {
+        side_health[n] += column[n] > 0 ? column[n] / max_hp : 0.0;
+      }
+    }
+  }
+
+  for (int n = 0; n < count; ++n) {
+    double score = (alive[SearchState::kAISide][n] - alive[SearchState::kOpponentSide][n]) *
+                   kAliveWeight;
+    score += (health[SearchState::kAISide][n] - health[SearchState::kOpponentSide][n]) *
+             kHealthWeight;
+    score = addActiveScore(states[n], score);
+    scores[n] = std::clamp(score, kMinScore, kMaxScore);
+  }
+}
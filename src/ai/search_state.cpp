@@ -0,0 +1,433 @@
+#include "search_state.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "type_effectiveness.h"
+#include "weather.h"
+
+namespace {
+
+int16_t clampToInt16(int value) {
+  return static_cast<int16_t>(std::clamp(value, 0, 32767));
+}
+
+uint8_t clampToUint8(int value) {
+  return static_cast<uint8_t>(std::clamp(value, 0, 255));
+}
+
+int8_t clampStage(int value) {
+  return static_cast<int8_t>(std::clamp(value, -6, 6));
+}
+
+}  // namespace
+
+SearchContext::SearchContext(const BattleState& battle_state) {
+  std::memset(combatants_, 0, sizeof(combatants_));
+  std::memset(&root_, 0, sizeof(root_));
+  team_size_[0] = team_size_[1] = 0;
+  roster_key_ = 0;
+  root_.active[0] = root_.active[1] = -1;
+  root_.weather = static_cast<uint8_t>(battle_state.currentWeather);
+  root_.weather_turns = clampToUint8(battle_state.weatherTurnsRemaining);
+  root_.turn = static_cast<uint16_t>(std::max(0, battle_state.turnNumber));
+
+  const Team* teams[2] = {battle_state.aiTeam, battle_state.opponentTeam};
+  const Pokemon* actives[2] = {battle_state.aiPokemon,
+                               battle_state.opponentPokemon};
+  const Pokemon* slots[2][SearchState::kTeamSlots] = {};
+
+  for (int side = 0; side < 2; ++side) {
+    if (!teams[side]) continue;
+    int size = std::min(static_cast<int>(teams[side]->size()),
+                        SearchState::kTeamSlots);
+    for (int slot = 0; slot < size; ++slot) {
+      const Pokemon* pokemon = teams[side]->getPokemon(slot);
+      if (!pokemon) continue;
+      slots[side][slot] = pokemon;
+      team_size_[side] = slot + 1;
+      if (pokemon == actives[side]) {
+        root_.active[side] = static_cast<int8_t>(slot);
+      }
+    }
+  }
+
+  for (int side = 0; side < 2; ++side) {
+    for (int slot = 0; slot < team_size_[side]; ++slot) {
+      const Pokemon* pokemon = slots[side][slot];
+      if (!pokemon) continue;
+
+      int index = SearchState::combatantIndex(side, slot);
+      CombatantInfo& info = combatants_[index];
+      info.present = true;
+      roster_key_ = roster_key_ * 31 + std::hash<std::string>{}(pokemon->name) + index;
+      info.max_hp = clampToInt16(pokemon->hp);
+      info.attack = clampToInt16(pokemon->attack);
+      info.defense = clampToInt16(pokemon->defense);
+      info.special_attack = clampToInt16(pokemon->special_attack);
+      info.special_defense = clampToInt16(pokemon->special_defense);
+      info.speed = clampToInt16(pokemon->speed);
+      info.move_count = static_cast<uint8_t>(
+          std::min(pokemon->moves.size(),
+                   static_cast<size_t>(SearchState::kMaxMoves)));
+
+      SearchCombatant& combatant = root_.combatants[index];
+      combatant.hp = clampToInt16(pokemon->current_hp);
+      combatant.status = static_cast<uint8_t>(pokemon->status);
+      combatant.status_turns = clampToUint8(pokemon->status_turns_remaining);
+      combatant.stages[0] = clampStage(pokemon->attack_stage);
+      combatant.stages[1] = clampStage(pokemon->defense_stage);
+      combatant.stages[2] = clampStage(pokemon->special_attack_stage);
+      combatant.stages[3] = clampStage(pokemon->special_defense_stage);
+      combatant.stages[4] = clampStage(pokemon->speed_stage);
+
+      for (int m = 0; m < info.move_count; ++m) {
+        const Move& move = pokemon->moves[m];
+        MoveInfo& move_info = info.moves[m];
+        move_info.power = clampToInt16(move.def().power);
+        move_info.accuracy = clampToInt16(move.def().accuracy);
+        move_info.priority = static_cast<int8_t>(std::clamp(move.def().priority, -7, 7));
+        move_info.special = move.def().damage_class == DamageClass::SPECIAL;
+        move_info.ailment = static_cast<uint8_t>(move.getStatusCondition());
+        move_info.ailment_chance = clampToUint8(move.def().ailment_chance);
+        move_info.high_crit = move.def().crit_rate > 0;
+        move_info.ailment_probability =
+            move.def().category_id == MoveCategory::AILMENT
+                ? 1.0
+                : std::clamp(move.def().ailment_chance, 0, 100) / 100.0;
+        move_info.stab = pokemon->types.contains(move.def().type_id) ? 1.5 : 1.0;
+        for (int w = 0; w < kWeatherCount; ++w) {
+          move_info.weather_multiplier[w] = Weather::getWeatherDamageMultiplier(
+              static_cast<WeatherCondition>(w), move.def().type);
+        }
+        for (int target = 0; target < SearchState::kTeamSlots; ++target) {
+          const Pokemon* defender = slots[1 - side][target];
+          move_info.type_multiplier[target] =
+              defender ? TypeEffectiveness::getEffectivenessMultiplier(
+                             move.def().type_id, defender->types)
+                       : 1.0;
+        }
+        // A disabled move is searched as one with no PP left
+        combatant.pp[m] = move.disabled ? 0 : clampToUint8(move.current_pp);
+        roster_key_ = roster_key_ * 31 + std::hash<std::string>{}(move.def().name);
+      }
+    }
+  }
+}
+
+double SearchContext::baseDamage(const SearchState& state, int attacker,
+                                 int move_slot, int defender) const {
+  const CombatantInfo& attacker_info = combatants_[attacker];
+  const CombatantInfo& defender_info = combatants_[defender];
+  const MoveInfo& move = attacker_info.moves[move_slot];
+
+  int attack_stat = move.special ? attacker_info.special_attack : attacker_info.attack;
+  int defense_stat = move.special ? defender_info.special_defense : defender_info.defense;
+
+  // Same simplified stage handling as AIStrategy::estimateDamage
+  double attack_multiplier = 1.0 + (state.combatants[attacker].stages[0] * 0.5);
+  double defense_multiplier = 1.0 + (state.combatants[defender].stages[1] * 0.5);
+
+  attack_stat = static_cast<int>(attack_stat * attack_multiplier);
+  defense_stat = std::max(1, static_cast<int>(defense_stat * defense_multiplier));
+
+  double base_damage = ((2.0 * 50 + 10) / 250.0) *
+                           (static_cast<double>(attack_stat) / defense_stat) *
+                           move.power +
+                       2;
+
+  int defender_slot = defender % SearchState::kTeamSlots;
+  base_damage *= move.type_multiplier[defender_slot];
+  base_damage *= move.stab;
+  base_damage *= move.weather_multiplier[std::min<int>(state.weather, kWeatherCount - 1)];
+  return base_damage;
+}
+
+double SearchContext::estimateDamage(const SearchState& state, int attacker,
+                                     int move_slot, int defender) const {
+  if (combatants_[attacker].moves[move_slot].power <= 0) {
+    return 0.0;  // Status moves do no direct damage
+  }
+
+  // Critical hit average (1/16 chance for 2x damage = ~1.06x average)
+  double base_damage = baseDamage(state, attacker, move_slot, defender) * 1.06;
+
+  return std::max(1.0, base_damage);
+}
+
+int SearchContext::hpBucket(int hp, int max_hp) {
+  if (hp <= 0 || max_hp <= 0) return 0;
+  return std::min(1 + (hp * (kHpBuckets - 2)) / max_hp, kHpBuckets - 1);
+}
+
+int SearchContext::aliveCount(const SearchState& state, int side) const {
+  int alive = 0;
+  for (int slot = 0; slot < team_size_[side]; ++slot) {
+    int index = SearchState::combatantIndex(side, slot);
+    if (combatants_[index].present && state.combatants[index].hp > 0) {
+      ++alive;
+    }
+  }
+  return alive;
+}
+
+bool SearchContext::isTerminal(const SearchState& state) const {
+  return aliveCount(state, SearchState::kAISide) == 0 ||
+         aliveCount(state, SearchState::kOpponentSide) == 0;
+}
+
+int SearchContext::generateActions(const SearchState& state, int side,
+                                   SearchAction* out, int max_actions) const {
+  int count = 0;
+  int active = state.activeIndex(side);
+
+  // Move options: the active Pokemon must be alive, awake and unfrozen
+  if (active >= 0 && state.combatants[active].hp > 0) {
+    auto status = static_cast<StatusCondition>(state.combatants[active].status);
+    if (status != StatusCondition::SLEEP && status != StatusCondition::FREEZE) {
+      for (int m = 0; m < combatants_[active].move_count && count < max_actions; ++m) {
+        if (state.combatants[active].pp[m] > 0) {
+          out[count++] = {SearchAction::Type::MOVE, static_cast<int8_t>(m)};
+        }
+      }
+    }
+  }
+
+  // Switch options: any other living team member
+  for (int slot = 0; slot < team_size_[side] && count < max_actions; ++slot) {
+    int index = SearchState::combatantIndex(side, slot);
+    if (index == active || !combatants_[index].present ||
+        state.combatants[index].hp <= 0) {
+      continue;
+    }
+    out[count++] = {SearchAction::Type::SWITCH, static_cast<int8_t>(slot)};
+  }
+
+  return count;
+}
+
+int SearchContext::saveUndo(SearchState& state, int side, SearchUndo& undo) {
+  int attacker = state.activeIndex(side);
+  undo.attacker_index = static_cast<int8_t>(attacker);
+  undo.defender_index = -1;
+  undo.active[0] = state.active[0];
+  undo.active[1] = state.active[1];
+  undo.turn = state.turn;
+  if (attacker >= 0) {
+    undo.attacker = state.combatants[attacker];
+  }
+  return attacker;
+}
+
+void SearchContext::make(SearchState& state, int side,
+                         const SearchAction& action, SearchUndo& undo) const {
+  int attacker = saveUndo(state, side, undo);
+  state.turn++;
+
+  if (action.type == SearchAction::Type::PASS) return;
+
+  if (action.type == SearchAction::Type::SWITCH) {
+    // Stat stages reset when a Pokemon leaves the field
+    if (attacker >= 0) {
+      std::memset(state.combatants[attacker].stages, 0,
+                  sizeof(state.combatants[attacker].stages));
+    }
+    state.active[side] = action.index;
+    return;
+  }
+
+  if (attacker < 0) return;
+
+  SearchCombatant& user = state.combatants[attacker];
+  if (user.pp[action.index] > 0) {
+    user.pp[action.index]--;
+  }
+
+  int defender = state.activeIndex(1 - side);
+  if (defender < 0) return;
+
+  undo.defender_index = static_cast<int8_t>(defender);
+  undo.defender = state.combatants[defender];
+
+  SearchCombatant& target = state.combatants[defender];
+  const MoveInfo& move = combatants_[attacker].moves[action.index];
+
+  if (move.power > 0 && target.hp > 0) {
+    int damage = static_cast<int>(estimateDamage(state, attacker, action.index, defender));
+    target.hp = static_cast<int16_t>(std::max(0, target.hp - damage));
+  }
+
+  // Secondary ailments land only on healthy, unaffected targets
+  if (move.ailment != static_cast<uint8_t>(StatusCondition::NONE) &&
+      move.ailment_chance > 0 && target.hp > 0 &&
+      target.status == static_cast<uint8_t>(StatusCondition::NONE)) {
+    target.status = move.ailment;
+  }
+}
+
+int SearchContext::effectiveSpeed(const SearchState& state, int combatant) const {
+  const SearchCombatant& current = state.combatants[combatant];
+  int speed = combatants_[combatant].speed;
+  if (current.status == static_cast<uint8_t>(StatusCondition::PARALYSIS)) {
+    speed /= 2;
+  }
+  int stage = current.stages[4];
+  double multiplier = stage >= 0 ? 1.0 + stage * 0.5 : 1.0 / (1.0 - stage * 0.5);
+  return static_cast<int>(speed * multiplier);
+}
+
+int SearchContext::turnOrder(const SearchState& state, int ai_move_slot,
+                             int opponent_move_slot) const {
+  int ai = state.activeIndex(SearchState::kAISide);
+  int opponent = state.activeIndex(SearchState::kOpponentSide);
+  int ai_priority = combatants_[ai].moves[ai_move_slot].priority;
+  int opponent_priority = combatants_[opponent].moves[opponent_move_slot].priority;
+  if (ai_priority != opponent_priority) {
+    return ai_priority > opponent_priority ? 1 : -1;
+  }
+  int ai_speed = effectiveSpeed(state, ai);
+  int opponent_speed = effectiveSpeed(state, opponent);
+  if (ai_speed != opponent_speed) {
+    return ai_speed > opponent_speed ? 1 : -1;
+  }
+  return 0;
+}
+
+void SearchContext::makeTurn(SearchState& state, const SearchAction* actions, bool ai_first,
+                             SearchTurnUndo& undo) const {
+  undo.count = 0;
+
+  // Switches resolve before any move
+  for (int side = 0; side < 2; ++side) {
+    if (actions[side].type == SearchAction::Type::SWITCH) {
+      make(state, side, actions[side], undo.steps[undo.count++]);
+    }
+  }
+
+  int first = ai_first ? SearchState::kAISide : SearchState::kOpponentSide;
+  for (int side : {first, 1 - first}) {
+    if (actions[side].type != SearchAction::Type::MOVE) continue;
+    int user = state.activeIndex(side);
+    if (user < 0 || state.combatants[user].hp <= 0) continue;  // Knocked out first
+    make(state, side, actions[side], undo.steps[undo.count++]);
+  }
+}
+
+void SearchContext::unmakeTurn(SearchState& state, const SearchTurnUndo& undo) {
+  for (int i = undo.count - 1; i >= 0; --i) {
+    unmake(state, undo.steps[i]);
+  }
+}
+
+int SearchContext::chanceOutcomes(const SearchState& state, int side, int move_slot,
+                                  SearchOutcome* out) const {
+  int count = 0;
+  int attacker = state.activeIndex(side);
+  int defender = state.activeIndex(1 - side);
+  const MoveInfo& move = combatants_[attacker].moves[move_slot];
+  const int target_hp = defender >= 0 ? state.combatants[defender].hp : 0;
+  const int target_max_hp = defender >= 0 ? combatants_[defender].max_hp : 0;
+
+  // Outcomes that leave the defender in the same HP bucket are merged
+  auto add = [&](double probability, double damage, bool acted, bool ailment) {
+    if (probability <= 0.0) return;
+    int dealt = std::min(static_cast<int>(damage), target_hp);
+    int bucket = hpBucket(target_hp - dealt, target_max_hp);
+    ailment = ailment && target_hp - dealt > 0;
+    for (int i = 0; i < count; ++i) {
+      SearchOutcome& existing = out[i];
+      if (existing.acted == acted && existing.ailment == ailment &&
+          hpBucket(target_hp - existing.damage, target_max_hp) == bucket) {
+        double total = existing.probability + probability;
+        existing.damage = static_cast<int16_t>(
+            (existing.damage * existing.probability + dealt * probability) / total + 0.5);
+        existing.probability = total;
+        return;
+      }
+    }
+    out[count++] = {probability, static_cast<int16_t>(dealt), acted, ailment};
+  };
+
+  double act_chance = 1.0;
+  if (state.combatants[attacker].status == static_cast<uint8_t>(StatusCondition::PARALYSIS)) {
+    act_chance -= kFullParalysisChance;
+    add(kFullParalysisChance, 0.0, false, false);
+  }
+
+  // Accuracy 0 never misses, as in Battle::checkMoveAccuracy
+  double hit_chance = move.accuracy <= 0 ? 1.0 : std::min<int>(move.accuracy, 100) / 100.0;
+  add(act_chance * (1.0 - hit_chance), 0.0, true, false);
+  if (defender < 0) {
+    add(act_chance * hit_chance, 0.0, true, false);
+    return count;
+  }
+
+  double ailment_chance =
+      move.ailment != static_cast<uint8_t>(StatusCondition::NONE) &&
+              state.combatants[defender].status ==
+                  static_cast<uint8_t>(StatusCondition::NONE)
+          ? move.ailment_probability
+          : 0.0;
+  double hit = act_chance * hit_chance;
+
+  if (move.power <= 0 || target_hp <= 0) {
+    add(hit * ailment_chance, 0.0, true, true);
+    add(hit * (1.0 - ailment_chance), 0.0, true, false);
+    return count;
+  }
+
+  // Critical hits double damage; the 16 damage rolls (85-100%) are grouped
+  // into equally likely buckets at their mean factor
+  double base = baseDamage(state, attacker, move_slot, defender);
+  double crit_chance = move.high_crit ? 1.0 / 8.0 : 1.0 / 16.0;
+  constexpr int kRollsPerBucket = 16 / kDamageRollBuckets;
+  for (int crit = 0; crit < 2; ++crit) {
+    double crit_probability = crit ? crit_chance : 1.0 - crit_chance;
+    for (int bucket = 0; bucket < kDamageRollBuckets; ++bucket) {
+      double roll = 0.85 + (bucket * kRollsPerBucket + (kRollsPerBucket - 1) / 2.0) / 100.0;
+      double damage = std::max(1.0, base * (crit ? 2.0 : 1.0) * roll);
+      double probability = hit * crit_probability / kDamageRollBuckets;
+      add(probability * ailment_chance, damage, true, true);
+      add(probability * (1.0 - ailment_chance), damage, true, false);
+    }
+  }
+  return count;
+}
+
+void SearchContext::makeOutcome(SearchState& state, int side, int move_slot,
+                                const SearchOutcome& outcome, SearchUndo& undo) const {
+  int attacker = saveUndo(state, side, undo);
+  state.turn++;
+  if (attacker < 0 || !outcome.acted) return;
+
+  SearchCombatant& user = state.combatants[attacker];
+  if (user.pp[move_slot] > 0) {
+    user.pp[move_slot]--;
+  }
+
+  int defender = state.activeIndex(1 - side);
+  if (defender < 0) return;
+
+  undo.defender_index = static_cast<int8_t>(defender);
+  undo.defender = state.combatants[defender];
+
+  SearchCombatant& target = state.combatants[defender];
+  target.hp = static_cast<int16_t>(std::max(0, target.hp - outcome.damage));
+  if (outcome.ailment && target.hp > 0 &&
+      target.status == static_cast<uint8_t>(StatusCondition::NONE)) {
+    target.status = combatants_[attacker].moves[move_slot].ailment;
+  }
+}
+
+void SearchContext::unmake(SearchState& state, const SearchUndo& undo) {
+  if (undo.defender_index >= 0) {
+    state.combatants[undo.defender_index] = undo.defender;
+  }
+  if (undo.attacker_index >= 0) {
+    state.combatants[undo.attacker_index] = undo.attacker;
+  }
+  state.active[0] = undo.active[0];
+  state.active[1] = undo.active[1];
+  state.turn = undo.turn;
+}
@@ -0,0 +1,189 @@
+#include "transposition_table.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// SplitMix64: fixed-seed generator so keys are identical across runs
+uint64_t splitMix64(uint64_t& state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+size_t roundUpToPowerOfTwo(size_t value) {
+  size_t result = 1;
+  while (result < value) result <<= 1;
+  return result;
+}
+
+}  // namespace
+
+// ──────────────────────────────────────────────────────────────────
+// ZobristHasher
+// ──────────────────────────────────────────────────────────────────
+
+struct ZobristHasher::Keys {
+  static constexpr int kCombatants = SearchState::kMaxCombatants;
+
+  uint64_t active[2][SearchState::kTeamSlots + 1];  // Last entry: no active
+  uint64_t hp[kCombatants][kHpBuckets];
+  uint64_t status[kCombatants][kStatusValues];
+  uint64_t stages[kCombatants][5][kStageValues];
+  uint64_t pp[kCombatants][SearchState::kMaxMoves][kPpValues];
+  uint64_t weather[SearchContext::kWeatherCount];
+  uint64_t ai_to_move;
+
+  Keys() {
+    uint64_t seed = 0x5EED0F2A7B1C3D4EULL;
+    auto fill = [&seed](uint64_t* keys, size_t count) {
+      for (size_t i = 0; i < count; ++i) keys[i] = splitMix64(seed);
+    };
+    fill(&active[0][0], sizeof(active) / sizeof(uint64_t));
+    fill(&hp[0][0], sizeof(hp) / sizeof(uint64_t));
+    fill(&status[0][0], sizeof(status) / sizeof(uint64_t));
+    fill(&stages[0][0][0], sizeof(stages) / sizeof(uint64_t));
+    fill(&pp[0][0][0], sizeof(pp) / sizeof(uint64_t));
+    fill(weather, SearchContext::kWeatherCount);
+    ai_to_move = splitMix64(seed);
+  }
+};
+
+const ZobristHasher::Keys& ZobristHasher::keys() {
+  static const Keys instance;  // Thread-safe static initialisation
+  return instance;
+}
+
+uint64_t ZobristHasher::hash(const SearchContext& context,
+                             const SearchState& state, bool ai_to_move) {
+  const Keys& k = keys();
+  uint64_t key = context.rosterKey();
+
+  for (int side = 0; side < 2; ++side) {
+    int slot = state.active[side] < 0 ? SearchState::kTeamSlots : state.active[side];
+    key ^= k.active[side][slot];
+
+    for (int s = 0; s < context.teamSize(side); ++s) {
+      int index = SearchState::combatantIndex(side, s);
+      const auto& info = context.info(index);
+      if (!info.present) continue;
+      const SearchCombatant& combatant = state.combatants[index];
+
+      key ^= k.hp[index][SearchContext::hpBucket(combatant.hp, info.max_hp)];
+      key ^= k.status[index][combatant.status % kStatusValues];
+      for (int stat = 0; stat < 5; ++stat) {
+        key ^= k.stages[index][stat][combatant.stages[stat] + 6];
+      }
+      for (int m = 0; m < info.move_count; ++m) {
+        key ^= k.pp[index][m][std::min<int>(combatant.pp[m], kPpValues - 1)];
+      }
+    }
+  }
+
+  key ^= k.weather[std::min<int>(state.weather, SearchContext::kWeatherCount - 1)];
+  if (ai_to_move) key ^= k.ai_to_move;
+  return key;
+}
+
+// ──────────────────────────────────────────────────────────────────
+// TranspositionTable
+// ──────────────────────────────────────────────────────────────────
+
+// Payload layout: score (float bits 0-31), depth (32-39), bound (40-41),
+// best move (48-55), generation (56-63). Bound NONE marks an empty slot.
+
+TranspositionTable::TranspositionTable(size_t entries)
+    : slots_(new Slot[roundUpToPowerOfTwo(std::max<size_t>(entries, 1))]),
+      mask_(roundUpToPowerOfTwo(std::max<size_t>(entries, 1)) - 1),
+      generation_(0) {
+  clear();
+}
+
+uint64_t TranspositionTable::pack(const Entry& entry, uint8_t generation) {
+  float score = static_cast<float>(entry.score);
+  uint32_t score_bits;
+  std::memcpy(&score_bits, &score, sizeof(score_bits));
+
+  uint64_t data = score_bits;
+  data |= static_cast<uint64_t>(std::clamp(entry.depth, 0, 255)) << 32;
+  data |= static_cast<uint64_t>(static_cast<uint8_t>(entry.bound) & 0x3) << 40;
+  data |= static_cast<uint64_t>(static_cast<uint8_t>(static_cast<int8_t>(entry.best_move))) << 48;
+  data |= static_cast<uint64_t>(generation) << 56;
+  return data;
+}
+
+TranspositionTable::Entry TranspositionTable::unpack(uint64_t data) {
+  uint32_t score_bits = static_cast<uint32_t>(data & 0xFFFFFFFFULL);
+  float score;
+  std::memcpy(&score, &score_bits, sizeof(score));
+
+  Entry entry;
+  entry.score = score;
+  entry.depth = depthOf(data);
+  entry.bound = static_cast<Bound>((data >> 40) & 0x3);
+  entry.best_move = static_cast<int8_t>(static_cast<uint8_t>((data >> 48) & 0xFF));
+  return entry;
+}
+
+uint8_t TranspositionTable::generationOf(uint64_t data) {
+  return static_cast<uint8_t>(data >> 56);
+}
+
+int TranspositionTable::depthOf(uint64_t data) {
+  return static_cast<int>((data >> 32) & 0xFF);
+}
+
+bool TranspositionTable::probe(uint64_t key, Entry& entry) const {
+  const Slot& slot = slots_[key & mask_];
+  uint64_t check = slot.check.load(std::memory_order_relaxed);
+  uint64_t data = slot.data.load(std::memory_order_relaxed);
+
+  Bound bound = static_cast<Bound>((data >> 40) & 0x3);
+  if (bound == Bound::NONE) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  if ((check ^ data) != key) {
+    collisions_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  entry = unpack(data);
+  hits_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void TranspositionTable::store(uint64_t key, const Entry& entry) {
+  Slot& slot = slots_[key & mask_];
+  uint64_t old_data = slot.data.load(std::memory_order_relaxed);
+  uint64_t old_check = slot.check.load(std::memory_order_relaxed);
+
+  bool empty = static_cast<Bound>((old_data >> 40) & 0x3) == Bound::NONE;
+  bool same_position = (old_check ^ old_data) == key;
+  bool stale = generationOf(old_data) != generation_;
+  if (!empty && !same_position && !stale && depthOf(old_data) > entry.depth) {
+    return;  // Keep the deeper result from this search
+  }
+
+  uint64_t data = pack(entry, generation_);
+  slot.check.store(key ^ data, std::memory_order_relaxed);
+  slot.data.store(data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::newSearch() { generation_++; }
+
+void TranspositionTable::clear() {
+  for (size_t i = 0; i <= mask_; ++i) {
+    slots_[i].check.store(0, std::memory_order_relaxed);
+    slots_[i].data.store(0, std::memory_order_relaxed);
+  }
+  resetCounters();
+}
+
+void TranspositionTable::resetCounters() {
+  hits_.store(0, std::memory_order_relaxed);
+  misses_.store(0, std::memory_order_relaxed);
+  collisions_.store(0, std::memory_order_relaxed);
+}
@@ -4,9 +4,9 @@
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
-#include <ctime>
 #include <iostream>
 #include <limits>
+#include <random>
 #include <thread>
 #include <functional>
 
@@ -14,6 +14,7 @@
 #include "weather.h"
 #include "input_validator.h"
 #include "battle_events.h"
+#include "battle_replay.h"
 
 Battle::Battle(const Team &playerTeam, const Team &opponentTeam,
                AIDifficulty aiDifficulty)
@@ -24,9 +25,12 @@ Battle::Battle(const Team &playerTeam, const Team &opponentTeam,
       aiDifficulty(aiDifficulty),
       currentWeather(WeatherCondition::NONE),
       weatherTurnsRemaining(0),
-      rng(std::random_device{}()),
-      criticalDistribution(0.0, 1.0) {
-  srand(time(0));  // Seed random number generator once
+      headless(false),
+      headlessStart{-1, -1, WeatherCondition::NONE, 0},
+      randomSeed((static_cast<uint64_t>(std::random_device{}()) << 32) |
+                 std::random_device{}()),
+      rng(randomSeed),
+      replay(nullptr) {
   
   // Initialize health bar animation system with auto-detection
   auto config = HealthBarAnimator::detectOptimalConfig();
@@ -37,14 +41,27 @@ Battle::Battle(const Team &playerTeam, const Team &opponentTeam,
   eventManager.subscribe(healthBarListener);
 }
 
+namespace {
+// Stream without a buffer: every insertion is a no-op. Thread-local so that
+// concurrent headless battles never share stream state.
+std::ostream &nullStream() {
+  thread_local std::ostream stream(nullptr);
+  return stream;
+}
+}  // namespace
+
+std::ostream &Battle::out() const {
+  return headless ? nullStream() : std::cout;
+}
+
 void Battle::displayHealth(const Pokemon &pokemon) const {
   if (!healthBarAnimator) {
     // Fallback to basic display if animator not initialized
-    std::cout << pokemon.name << " HP: " << pokemon.current_hp << "/" << pokemon.hp;
+    out() << pokemon.name << " HP: " << pokemon.current_hp << "/" << pokemon.hp;
     if (pokemon.hasStatusCondition()) {
-      std::cout << " (" << pokemon.getStatusConditionName() << ")";
+      out() << " (" << pokemon.getStatusConditionName() << ")";
     }
-    std::cout << std::endl;
+    out() << std::endl;
     return;
   }
 
@@ -56,13 +73,13 @@ void Battle::displayHealth(const Pokemon &pokemon) const {
 }
 
 void Battle::selectPokemon() {
-  std::cout << "\nSelect the Pokémon you want to send out first:" << std::endl;
+  out() << "\nSelect the Pokémon you want to send out first:" << std::endl;
 
   // Display available Pokemon
   for (int i = 0; i < static_cast<int>(playerTeam.size()); ++i) {
     const auto *pokemon = playerTeam.getPokemon(i);
     if (pokemon && pokemon->isAlive()) {
-      std::cout << "[" << i + 1 << "] - " << pokemon->name << std::endl;
+      out() << "[" << i + 1 << "] - " << pokemon->name << std::endl;
     }
   }
 
@@ -92,13 +109,13 @@ void Battle::selectPokemon() {
   );
   
   if (!pokemonResult.isValid()) {
-    std::cout << "Failed to get valid Pokemon selection: " << pokemonResult.errorMessage << std::endl;
+    out() << "Failed to get valid Pokemon selection: " << pokemonResult.errorMessage << std::endl;
     // Auto-select first available Pokemon as fallback
     for (int i = 0; i < static_cast<int>(playerTeam.size()); ++i) {
       auto *pokemon = playerTeam.getPokemon(i);
       if (pokemon && pokemon->isAlive()) {
         selectedPokemon = pokemon;
-        std::cout << "Auto-selecting " << selectedPokemon->name << " as fallback!" << std::endl;
+        out() << "Auto-selecting " << selectedPokemon->name << " as fallback!" << std::endl;
         return;
       }
     }
@@ -107,24 +124,24 @@ void Battle::selectPokemon() {
   
   int chosenPokemonNum = pokemonResult.value;
   selectedPokemon = playerTeam.getPokemon(chosenPokemonNum - 1);
-  std::cout << "\nYou have selected " << selectedPokemon->name
-            << " to send out!" << std::endl;
+  out() << "\nYou have selected " << selectedPokemon->name
+        << " to send out!" << std::endl;
   
   // Register Pokemon with health bar system
   if (healthBarListener && selectedPokemon) {
     healthBarListener->registerPokemon(selectedPokemon, "Player");
   }
   
-  std::cout << std::endl;
+  out() << std::endl;
 }
 
 void Battle::selectOpponentPokemon() {
   auto alivePokemon = opponentTeam.getAlivePokemon();
   if (!alivePokemon.empty()) {
-    auto randomIndex = rand() % alivePokemon.size();
+    auto randomIndex = rng.index(alivePokemon.size());
     opponentSelectedPokemon = alivePokemon[randomIndex];
-    std::cout << "\nThe opponent has selected " << opponentSelectedPokemon->name
-              << " to send out!" << std::endl;
+    out() << "\nThe opponent has selected " << opponentSelectedPokemon->name
+          << " to send out!" << std::endl;
     
     // Register opponent Pokemon with health bar system
     if (healthBarListener && opponentSelectedPokemon) {
@@ -136,16 +153,16 @@ void Battle::selectOpponentPokemon() {
 void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
   // Check if attacker must recharge this turn
   if (attacker.mustRecharge()) {
-    std::cout << attacker.name << " must recharge and cannot move!" << std::endl;
+    out() << attacker.name << " must recharge and cannot move!" << std::endl;
     attacker.finishRecharge();
     return;
   }
   
   // Check if attacker can act (not asleep, frozen, or fully paralyzed)
-  if (!attacker.canActThisTurn()) {
+  if (!attacker.canActThisTurn(rng)) {
     if (attacker.status == StatusCondition::PARALYSIS) {
-      std::cout << attacker.name << " is paralyzed and can't move!"
-                << std::endl;
+      out() << attacker.name << " is paralyzed and can't move!"
+            << std::endl;
     }
     return;
   }
@@ -154,21 +171,20 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
   Move &move = attacker.moves[moveIndex];
 
   if (!move.canUse()) {
-    std::cout << attacker.name << " tried to use " << move.name
-              << " but it has no PP left!" << std::endl;
+    out() << attacker.name << " tried to use " << move.def().name
+          << " but it has no PP left!" << std::endl;
     return;
   }
 
   // Handle multi-turn move state transitions
   if (attacker.isCharging() && attacker.getChargingMoveIndex() == moveIndex) {
     // Pokemon is finishing a charging move
-    std::cout << attacker.name << " unleashed " << move.name << "!" << std::endl;
+    out() << attacker.name << " unleashed " << move.def().name << "!" << std::endl;
     attacker.finishCharging();
     
     // Notify event system
     auto event = eventManager.createMultiTurnMoveEvent(
-      &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING,
-      attacker.name + " unleashed " + move.name + "!"
+      &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING
     );
     eventManager.notifyMultiTurnMove(event);
     
@@ -180,26 +196,24 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     
     // Check for Solar Beam sunny weather skip
     if (move.skipChargeInSunnyWeather() && currentWeather == WeatherCondition::SUN) {
-      std::cout << attacker.name << " used " << move.name << "!" << std::endl;
-      std::cout << "The sunlight is strong! " << attacker.name << " doesn't need to charge!" << std::endl;
+      out() << attacker.name << " used " << move.def().name << "!" << std::endl;
+      out() << "The sunlight is strong! " << attacker.name << " doesn't need to charge!" << std::endl;
       
       // Notify event system for weather skip
       auto event = eventManager.createMultiTurnMoveEvent(
-        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING,
-        "The sunlight is strong! " + attacker.name + " doesn't need to charge!"
+        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::EXECUTING, true
       );
       eventManager.notifyMultiTurnMove(event);
       
       skipCharge = true;
       move.usePP();
     } else {
-      std::cout << attacker.name << " began charging " << move.name << "!" << std::endl;
-      attacker.startCharging(moveIndex, move.name);
+      out() << attacker.name << " began charging " << move.def().name << "!" << std::endl;
+      attacker.startCharging(moveIndex, move.def().name, out());
       
       // Notify event system
       auto event = eventManager.createMultiTurnMoveEvent(
-        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::CHARGING,
-        attacker.name + " began charging " + move.name + "!"
+        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::CHARGING
       );
       eventManager.notifyMultiTurnMove(event);
       
@@ -212,7 +226,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
     }
   } else {
     // Regular move execution
-    std::cout << attacker.name << " used " << move.name << "!" << std::endl;
+    out() << attacker.name << " used " << move.def().name << "!" << std::endl;
     move.usePP();
     
     // Handle recharge moves
@@ -221,8 +235,7 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       
       // Notify event system
       auto event = eventManager.createMultiTurnMoveEvent(
-        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::RECHARGING,
-        attacker.name + " must recharge next turn!"
+        &attacker, &move, BattleEvents::MultiTurnMoveEvent::Phase::RECHARGING
       );
       eventManager.notifyMultiTurnMove(event);
     }
@@ -230,50 +243,55 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
 
   // Check if the move hits
   if (!checkMoveAccuracy(move)) {
-    std::cout << attacker.name << "'s attack missed!" << std::endl;
+    out() << attacker.name << "'s attack missed!" << std::endl;
+    notifyMoveUsed(attacker, move, defender, false, false);
     return;
   }
 
   // Handle OHKO moves first (Guillotine, Sheer Cold, etc.)
-  if (move.category == "ohko") {
+  if (move.def().category_id == MoveCategory::OHKO) {
     // OHKO moves ignore normal damage calculation
     // In real Pokemon, OHKO accuracy is based on level difference, but we'll
     // use base accuracy
-    std::cout << "It's a one-hit KO!" << std::endl;
+    out() << "It's a one-hit KO!" << std::endl;
     int previousHealth = defender.current_hp;
     defender.takeDamage(defender.current_hp);  // Deal enough damage to KO
     
     // Emit health change event for OHKO
     auto healthEvent = eventManager.createHealthChangeEvent(
-      &defender, previousHealth, defender.current_hp, attacker.name + "'s " + move.name + " (OHKO)"
+      &defender, previousHealth, defender.current_hp, BattleEvents::EventSource::OHKO, &move
     );
+    healthEvent.attacker = &attacker;
     eventManager.notifyHealthChanged(healthEvent);
+    notifyMoveUsed(attacker, move, defender, true, false);
     return;  // OHKO moves don't have other effects
   }
 
   // Handle healing moves (Recover, Soft-Boiled, etc.)
-  if (move.healing > 0) {
-    int healAmount = (attacker.hp * move.healing) / 100;
+  if (move.def().healing > 0) {
+    int healAmount = (attacker.hp * move.def().healing) / 100;
     int actualHeal = std::min(healAmount, attacker.hp - attacker.current_hp);
 
     if (actualHeal > 0) {
       int previousHealth = attacker.current_hp;
       attacker.heal(actualHeal);
-      std::cout << attacker.name << " restored " << actualHeal << " HP! ("
-                << healAmount << "% heal)" << std::endl;
+      out() << attacker.name << " restored " << actualHeal << " HP! ("
+            << healAmount << "% heal)" << std::endl;
       
       // Emit health change event for healing
       auto healthEvent = eventManager.createHealthChangeEvent(
-        &attacker, previousHealth, attacker.current_hp, move.name + " (heal)"
+        &attacker, previousHealth, attacker.current_hp, BattleEvents::EventSource::HEAL, &move
       );
       eventManager.notifyHealthChanged(healthEvent);
     } else {
-      std::cout << attacker.name << "'s HP is already full!" << std::endl;
+      out() << attacker.name << "'s HP is already full!" << std::endl;
     }
+    notifyMoveUsed(attacker, move, defender, true, false);
     return;  // Healing moves don't do damage or apply other effects
   }
 
-  if (move.power == -1 || move.power == 0) {
+  bool wasCritical = false;
+  if (move.def().power == -1 || move.def().power == 0) {
     // Status move or special move - move announcement already done above
 
     // Apply status condition if move has one
@@ -282,55 +300,51 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       // Check if status effect proc'd based on ailment_chance
       bool statusApplied = false;
 
-      if (move.category == "ailment") {
+      if (move.def().category_id == MoveCategory::AILMENT) {
         // Pure status moves have 100% chance (unless they miss)
         statusApplied = true;
-      } else if (move.ailment_chance > 0) {
+      } else if (move.def().ailment_chance > 0) {
         // Damage + ailment moves have specified chance
-        auto distribution = std::uniform_int_distribution<int>(1, 100);
-        statusApplied = distribution(rng) <= move.ailment_chance;
+        statusApplied = rng.percentChance(move.def().ailment_chance);
       }
 
       if (statusApplied && !defender.hasStatusCondition()) {
-        defender.applyStatusCondition(statusToApply);
-        std::cout << defender.name << " is now "
-                  << defender.getStatusConditionName() << "!" << std::endl;
+        defender.applyStatusCondition(statusToApply, rng);
+        out() << defender.name << " is now "
+              << defender.getStatusConditionName() << "!" << std::endl;
       } else if (statusApplied && defender.hasStatusCondition()) {
-        std::cout << "But it failed! " << defender.name
-                  << " is already affected by a status condition." << std::endl;
+        out() << "But it failed! " << defender.name
+              << " is already affected by a status condition." << std::endl;
       }
     }
 
     // Handle stat modification moves (Swords Dance, Growl, etc.)
-    if (move.category == "net-good-stats") {
+    if (move.def().category_id == MoveCategory::NET_GOOD_STATS) {
       applyStatModification(attacker, defender, move);
     }
     // Handle weather-setting moves
-    else if (move.name == "rain-dance") {
+    else if (move.def().name == "rain-dance") {
       setWeather(WeatherCondition::RAIN, 5);
-    } else if (move.name == "sunny-day") {
+    } else if (move.def().name == "sunny-day") {
       setWeather(WeatherCondition::SUN, 5);
-    } else if (move.name == "sandstorm") {
+    } else if (move.def().name == "sandstorm") {
       setWeather(WeatherCondition::SANDSTORM, 5);
-    } else if (move.name == "hail") {
+    } else if (move.def().name == "hail") {
       setWeather(WeatherCondition::HAIL, 5);
     } else if (statusToApply == StatusCondition::NONE) {
-      std::cout << "The move had no effect!" << std::endl;
+      out() << "The move had no effect!" << std::endl;
     }
   } else {
     // Damage-dealing move
 
     // Determine number of hits for multi-hit moves
     int numHits = 1;
-    if (move.min_hits > 0 && move.max_hits > 0) {
-      auto hitDistribution =
-          std::uniform_int_distribution<int>(move.min_hits, move.max_hits);
-      numHits = hitDistribution(rng);
+    if (move.def().min_hits > 0 && move.def().max_hits > 0) {
+      numHits = rng.uniformInt(move.def().min_hits, move.def().max_hits);
     }
 
     int totalDamage = 0;
     bool hadSTAB = false;
-    bool wasCritical = false;
     bool showEffectiveness = true;
 
     // Execute each hit
@@ -338,20 +352,20 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       auto damageResult = calculateDamageWithEffects(attacker, defender, move);
 
       if (numHits > 1) {
-        std::cout << "Hit " << (hit + 1) << ": ";
+        out() << "Hit " << (hit + 1) << ": ";
       }
 
-      std::cout << "It dealt " << damageResult.damage << " damage!";
+      out() << "It dealt " << damageResult.damage << " damage!";
 
       // Show weather boost if applicable
       double weatherMultiplier =
-          Weather::getWeatherDamageMultiplier(currentWeather, move.type);
+          Weather::getWeatherDamageMultiplier(currentWeather, move.def().type);
       if (weatherMultiplier > 1.0) {
-        std::cout << " (Boosted by " << Weather::getWeatherName(currentWeather)
-                  << "!)";
+        out() << " (Boosted by " << Weather::getWeatherName(currentWeather)
+              << "!)";
       } else if (weatherMultiplier < 1.0) {
-        std::cout << " (Weakened by " << Weather::getWeatherName(currentWeather)
-                  << "!)";
+        out() << " (Weakened by " << Weather::getWeatherName(currentWeather)
+              << "!)";
       }
 
       // Track overall move properties
@@ -360,25 +374,25 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       if (damageResult.wasCritical) wasCritical = true;
 
       if (damageResult.wasCritical) {
-        std::cout << " A critical hit!";
+        out() << " A critical hit!";
       }
 
       // Show type effectiveness only once for multi-hit moves
       if (showEffectiveness) {
         auto typeMultiplier = TypeEffectiveness::getEffectivenessMultiplier(
-            MoveTypeMapping::getMoveType(move.name), defender.types);
+            move.def().type_id, defender.types);
 
         if (typeMultiplier > 1.0) {
-          std::cout << " It's super effective!";
+          out() << " It's super effective!";
         } else if (typeMultiplier < 1.0 && typeMultiplier > 0.0) {
-          std::cout << " It's not very effective...";
+          out() << " It's not very effective...";
         } else if (typeMultiplier == 0.0) {
-          std::cout << " It has no effect!";
+          out() << " It has no effect!";
         }
         showEffectiveness = false;
       }
 
-      std::cout << std::endl;
+      out() << std::endl;
       
       // Store previous health for event
       int previousHealth = defender.current_hp;
@@ -386,93 +400,105 @@ void Battle::executeMove(Pokemon &attacker, Pokemon &defender, int moveIndex) {
       
       // Emit health change event
       auto healthEvent = eventManager.createHealthChangeEvent(
-        &defender, previousHealth, defender.current_hp, attacker.name + "'s " + move.name
+        &defender, previousHealth, defender.current_hp, BattleEvents::EventSource::MOVE, &move
       );
+      healthEvent.attacker = &attacker;
       eventManager.notifyHealthChanged(healthEvent);
     }
 
     // Show multi-hit summary
     if (numHits > 1) {
-      std::cout << "Hit " << numHits << " time(s) for " << totalDamage
-                << " total damage!";
+      out() << "Hit " << numHits << " time(s) for " << totalDamage
+            << " total damage!";
       if (hadSTAB) {
-        std::cout << " " << attacker.name << " gets STAB!";
+        out() << " " << attacker.name << " gets STAB!";
       }
       if (wasCritical) {
-        std::cout << " At least one critical hit!";
+        out() << " At least one critical hit!";
       }
-      std::cout << std::endl;
+      out() << std::endl;
     } else if (hadSTAB) {
-      std::cout << attacker.name << " gets STAB!" << std::endl;
+      out() << attacker.name << " gets STAB!" << std::endl;
     }
 
     // Handle draining moves (Mega Drain, Absorb, etc.)
-    if (move.drain > 0 && totalDamage > 0) {
-      int drainAmount = (totalDamage * move.drain) / 100;
+    if (move.def().drain > 0 && totalDamage > 0) {
+      int drainAmount = (totalDamage * move.def().drain) / 100;
       int actualHeal = std::min(drainAmount, attacker.hp - attacker.current_hp);
 
       if (actualHeal > 0) {
         int previousHealth = attacker.current_hp;
         attacker.heal(actualHeal);
-        std::cout << attacker.name << " absorbed " << actualHeal << " HP! ("
-                  << move.drain << "% of damage dealt)" << std::endl;
+        out() << attacker.name << " absorbed " << actualHeal << " HP! ("
+              << move.def().drain << "% of damage dealt)" << std::endl;
         
         // Emit health change event for drain healing
         auto healthEvent = eventManager.createHealthChangeEvent(
-          &attacker, previousHealth, attacker.current_hp, move.name + " (drain)"
+          &attacker, previousHealth, attacker.current_hp, BattleEvents::EventSource::DRAIN, &move
         );
         eventManager.notifyHealthChanged(healthEvent);
       }
     }
 
     // Handle recoil moves (Double Edge, Take Down, etc.)
-    if (move.drain < 0 && totalDamage > 0) {
+    if (move.def().drain < 0 && totalDamage > 0) {
       int recoilPercent =
-          -move.drain;  // Convert negative drain to positive percentage
+          -move.def().drain;  // Convert negative drain to positive percentage
       int recoilDamage = (totalDamage * recoilPercent) / 100;
 
       if (recoilDamage > 0) {
         int previousHealth = attacker.current_hp;
         attacker.takeDamage(recoilDamage);
-        std::cout << attacker.name << " is hit with recoil! (" << recoilPercent
-                  << "% of damage dealt = " << recoilDamage << " HP)"
-                  << std::endl;
+        out() << attacker.name << " is hit with recoil! (" << recoilPercent
+              << "% of damage dealt = " << recoilDamage << " HP)"
+              << std::endl;
         
         // Emit health change event for recoil damage
         auto healthEvent = eventManager.createHealthChangeEvent(
-          &attacker, previousHealth, attacker.current_hp, move.name + " (recoil)"
+          &attacker, previousHealth, attacker.current_hp, BattleEvents::EventSource::RECOIL, &move
         );
         eventManager.notifyHealthChanged(healthEvent);
       }
     }
 
     // Apply flinch effect if move has flinch chance and defender is still alive
-    if (move.flinch_chance > 0 && defender.isAlive()) {
-      auto flinchDistribution = std::uniform_int_distribution<int>(1, 100);
-      if (flinchDistribution(rng) <= move.flinch_chance) {
-        defender.applyStatusCondition(StatusCondition::FLINCH);
-        std::cout << defender.name << " flinched!" << std::endl;
+    if (move.def().flinch_chance > 0 && defender.isAlive()) {
+      if (rng.percentChance(move.def().flinch_chance)) {
+        defender.applyStatusCondition(StatusCondition::FLINCH, rng);
+        out() << defender.name << " flinched!" << std::endl;
       }
     }
 
     // Apply status condition from damage moves
     StatusCondition statusToApply = move.getStatusCondition();
-    if (statusToApply != StatusCondition::NONE && move.ailment_chance > 0) {
-      auto distribution = std::uniform_int_distribution<int>(1, 100);
-      if (distribution(rng) <= move.ailment_chance &&
+    if (statusToApply != StatusCondition::NONE && move.def().ailment_chance > 0) {
+      if (rng.percentChance(move.def().ailment_chance) &&
           !defender.hasStatusCondition()) {
-        defender.applyStatusCondition(statusToApply);
-        std::cout << defender.name << " is now "
-                  << defender.getStatusConditionName() << "!" << std::endl;
+        defender.applyStatusCondition(statusToApply, rng);
+        out() << defender.name << " is now "
+              << defender.getStatusConditionName() << "!" << std::endl;
       }
     }
   }
+
+  notifyMoveUsed(attacker, move, defender, true, wasCritical);
+}
+
+void Battle::notifyMoveUsed(Pokemon &user, const Move &move, Pokemon &target,
+                            bool successful, bool critical) {
+  if (!eventManager.isSubscribed(BattleEvents::EventType::MOVE_USED)) {
+    return;
+  }
+  double effectiveness = TypeEffectiveness::getEffectivenessMultiplier(
+      move.def().type_id, target.types);
+  eventManager.notifyMoveUsed(eventManager.createMoveUsedEvent(
+      &user, &move, &target, successful, critical, effectiveness));
 }
 
 Battle::DamageResult Battle::calculateDamageWithEffects(
     const Pokemon &attacker, const Pokemon &defender, const Move &move) const {
   // Status moves don't deal damage
-  if (move.power <= 0) {
+  if (move.def().power <= 0) {
     return {0, false, false};
   }
 
@@ -481,11 +507,11 @@ Battle::DamageResult Battle::calculateDamageWithEffects(
 
   // Apply type effectiveness
   double typeMultiplier =
-      TypeEffectiveness::getEffectivenessMultiplier(move.type, defender.types);
+      TypeEffectiveness::getEffectivenessMultiplier(move.def().type_id, defender.types);
 
   // Apply weather effects
   double weatherMultiplier =
-      Weather::getWeatherDamageMultiplier(currentWeather, move.type);
+      Weather::getWeatherDamageMultiplier(currentWeather, move.def().type);
 
   // Check for STAB and critical hit
   auto hasStab = hasSTAB(attacker, move);
@@ -507,7 +533,7 @@ Battle::DamageResult Battle::calculateDamageWithEffects(
 
 int Battle::calculateDamage(const Pokemon &attacker, const Pokemon &defender,
                             const Move &move) const {
-  if (move.power <= 0) {
+  if (move.def().power <= 0) {
     return 0;
   }
 
@@ -518,7 +544,7 @@ int Battle::calculateDamage(const Pokemon &attacker, const Pokemon &defender,
 
   // Determine which attack stat to use
   int attackStat;
-  if (move.damage_class == "physical") {
+  if (move.def().damage_class == DamageClass::PHYSICAL) {
     attackStat = effectiveAttack;
   } else {
     attackStat = attacker.special_attack;
@@ -526,7 +552,7 @@ int Battle::calculateDamage(const Pokemon &attacker, const Pokemon &defender,
 
   // Determine which defense stat to use
   int defenseStat;
-  if (move.damage_class == "physical") {
+  if (move.def().damage_class == DamageClass::PHYSICAL) {
     defenseStat = defense;
   } else {
     defenseStat = defender.special_defense;
@@ -534,10 +560,10 @@ int Battle::calculateDamage(const Pokemon &attacker, const Pokemon &defender,
 
   // Pokemon damage formula (simplified but balanced)
   // Base calculation: ((2*Level/5+2)*Power*Attack/Defense)/50 + 2
-  double damage = (((2.0 * level / 5.0 + 2.0) * move.power * attackStat / defenseStat) / 50.0) + 2.0;
+  double damage = (((2.0 * level / 5.0 + 2.0) * move.def().power * attackStat / defenseStat) / 50.0) + 2.0;
   
   // Add some randomness (85-100% of calculated damage)
-  double randomFactor = 0.85 + (rand() % 16) / 100.0;  // 0.85 to 1.00
+  double randomFactor = 0.85 + rng.uniformInt(0, 15) / 100.0;  // 0.85 to 1.00
   damage *= randomFactor;
 
   return static_cast<int>(damage);
@@ -545,23 +571,23 @@ int Battle::calculateDamage(const Pokemon &attacker, const Pokemon &defender,
 
 bool Battle::playerFirst(const Move &playerMove,
                          const Move &opponentMove) const {
-  if (playerMove.priority != opponentMove.priority) {
-    return playerMove.priority > opponentMove.priority;
+  if (playerMove.def().priority != opponentMove.def().priority) {
+    return playerMove.def().priority > opponentMove.def().priority;
   }
   if (selectedPokemon->getEffectiveSpeed() !=
       opponentSelectedPokemon->getEffectiveSpeed()) {
     return selectedPokemon->getEffectiveSpeed() >
            opponentSelectedPokemon->getEffectiveSpeed();
   }
-  return rand() % 2;  // Randomize if speeds are equal
+  return rng.uniformInt(0, 1) == 1;  // Randomize if speeds are equal
 }
 
 int Battle::getMoveChoice() const {
-  std::cout << "\nChoose an action:\n";
+  out() << "\nChoose an action:\n";
 
   // Check if Pokemon must recharge
   if (selectedPokemon->mustRecharge()) {
-    std::cout << "\n" << selectedPokemon->name << " must recharge this turn and cannot act!\n";
+    out() << "\n" << selectedPokemon->name << " must recharge this turn and cannot act!\n";
     return -2; // Special value to indicate forced recharge
   }
   
@@ -569,34 +595,34 @@ int Battle::getMoveChoice() const {
   if (selectedPokemon->isCharging()) {
     int chargingMoveIndex = selectedPokemon->getChargingMoveIndex();
     std::string chargingMoveName = selectedPokemon->getChargingMoveName();
-    std::cout << "\n" << selectedPokemon->name << " is charging " << chargingMoveName << " and must execute it!\n";
+    out() << "\n" << selectedPokemon->name << " is charging " << chargingMoveName << " and must execute it!\n";
     return chargingMoveIndex; // Must execute the charging move
   }
 
   // Show moves
   for (size_t i = 0; i < selectedPokemon->moves.size(); ++i) {
     const Move &move = selectedPokemon->moves[i];
-    std::cout << "    " << (i + 1) << ". " << move.name
-              << " (Type: " << move.type << ", Power: " << move.power
-              << ", Accuracy: " << move.accuracy
-              << ", PP: " << move.getRemainingPP() << "/" << move.getMaxPP()
-              << ", Class: " << move.damage_class << ")";
+    out() << "    " << (i + 1) << ". " << move.def().name
+          << " (Type: " << move.def().type << ", Power: " << move.def().power
+          << ", Accuracy: " << move.def().accuracy
+          << ", PP: " << move.getRemainingPP() << "/" << move.getMaxPP()
+          << ", Class: " << damageClassName(move.def().damage_class) << ")";
 
     // Show "No PP!" if move can't be used
     if (!move.canUse()) {
-      std::cout << " [No PP!]";
+      out() << " [No PP!]";
     }
     
     // Show multi-turn information
     if (move.requiresCharging()) {
-      std::cout << " [Charging move - takes 2 turns]";
+      out() << " [Charging move - takes 2 turns]";
       if (move.skipChargeInSunnyWeather() && currentWeather == WeatherCondition::SUN) {
-        std::cout << " [Sunny weather: no charge needed!]";
+        out() << " [Sunny weather: no charge needed!]";
       }
     } else if (move.requiresRecharge()) {
-      std::cout << " [Recharge move - requires rest turn after use]";
+      out() << " [Recharge move - requires rest turn after use]";
     }
-    std::cout << "\n";
+    out() << "\n";
   }
 
   // Show switch option if other Pokemon are available
@@ -610,8 +636,8 @@ int Battle::getMoveChoice() const {
   }
 
   if (canSwitch) {
-    std::cout << "    " << (selectedPokemon->moves.size() + 1)
-              << ". Switch Pokémon\n";
+    out() << "    " << (selectedPokemon->moves.size() + 1)
+          << ". Switch Pokémon\n";
   }
 
   // Secure action selection with validation
@@ -633,7 +659,7 @@ int Battle::getMoveChoice() const {
       if (!selectedMove.canUse()) {
         return InputValidator::ValidationResult<int>(
           InputValidator::ValidationError::INVALID_INPUT,
-          selectedMove.name + " has no PP left! Choose another action"
+          selectedMove.def().name + " has no PP left! Choose another action"
         );
       }
       
@@ -690,20 +716,20 @@ int Battle::getMoveChoice() const {
   );
   
   if (!actionResult.isValid()) {
-    std::cout << "Failed to get valid action selection: " << actionResult.errorMessage << std::endl;
+    out() << "Failed to get valid action selection: " << actionResult.errorMessage << std::endl;
     
     // Handle multi-turn move constraints in fallback
     if (selectedPokemon->mustRecharge()) {
-      std::cout << "Pokemon must recharge - returning recharge indicator.\n";
+      out() << "Pokemon must recharge - returning recharge indicator.\n";
       return -2; // Special value for forced recharge
     }
     
     if (selectedPokemon->isCharging()) {
-      std::cout << "Pokemon is charging - returning charging move index.\n";
+      out() << "Pokemon is charging - returning charging move index.\n";
       return selectedPokemon->getChargingMoveIndex();
     }
     
-    std::cout << "Auto-selecting first available move as fallback.\n";
+    out() << "Auto-selecting first available move as fallback.\n";
     
     // Find first usable move as fallback
     for (size_t i = 0; i < selectedPokemon->moves.size(); ++i) {
@@ -733,7 +759,7 @@ int Battle::getMoveChoice() const {
 }
 
 int Battle::getPokemonChoice() const {
-  std::cout << "\nChoose a Pokémon to send out:\n";
+  out() << "\nChoose a Pokémon to send out:\n";
 
   // Show available Pokemon (exclude currently selected one)
   std::vector<int> availableIndices;
@@ -741,24 +767,24 @@ int Battle::getPokemonChoice() const {
     const auto *pokemon = playerTeam.getPokemon(i);
     if (pokemon && pokemon->isAlive() && pokemon != selectedPokemon) {
       availableIndices.push_back(i);
-      std::cout << "    [" << availableIndices.size() << "] - "
-                << pokemon->name;
+      out() << "    [" << availableIndices.size() << "] - "
+            << pokemon->name;
 
       // Show health percentage
       double healthPercent = pokemon->getHealthPercentage();
-      std::cout << " (HP: " << static_cast<int>(healthPercent) << "%)";
+      out() << " (HP: " << static_cast<int>(healthPercent) << "%)";
 
       // Show status condition if any
       if (pokemon->hasStatusCondition()) {
-        std::cout << " (" << pokemon->getStatusConditionName() << ")";
+        out() << " (" << pokemon->getStatusConditionName() << ")";
       }
 
-      std::cout << "\n";
+      out() << "\n";
     }
   }
 
   if (availableIndices.empty()) {
-    std::cout << "No other Pokémon available!\n";
+    out() << "No other Pokémon available!\n";
     return -1;  // No Pokemon to switch to
   }
 
@@ -791,8 +817,8 @@ int Battle::getPokemonChoice() const {
   );
   
   if (!switchResult.isValid()) {
-    std::cout << "Failed to get valid Pokemon switch selection: " << switchResult.errorMessage << std::endl;
-    std::cout << "Auto-selecting first available Pokemon as fallback.\n";
+    out() << "Failed to get valid Pokemon switch selection: " << switchResult.errorMessage << std::endl;
+    out() << "Auto-selecting first available Pokemon as fallback.\n";
     
     // Return first available Pokemon as fallback
     if (!availableIndices.empty()) {
@@ -824,10 +850,10 @@ bool Battle::isBattleOver() const {
 }
 
 void Battle::startBattle() {
-  std::cout << "\n======================================================== "
+  out() << "\n======================================================== "
                "BATTLE START "
-            << "========================================================="
-            << std::endl;
+        << "========================================================="
+        << std::endl;
 
   // Initial Pokemon selection
   selectOpponentPokemon();
@@ -835,11 +861,11 @@ void Battle::startBattle() {
 
   // Main battle loop
   while (!isBattleOver()) {
-    std::cout
+    out()
         << "==============================================================="
         << "==============================================================="
         << std::endl;
-    std::cout << std::endl;
+    out() << std::endl;
 
     // Process status conditions at start of turn
     if (selectedPokemon->hasStatusCondition()) {
@@ -864,7 +890,7 @@ void Battle::startBattle() {
       if (playerChoice == -2) {
         // Pokemon must recharge - skip turn
         selectedPokemon->finishRecharge();
-        std::cout << selectedPokemon->name << " is recharging and cannot move!" << std::endl;
+        out() << selectedPokemon->name << " is recharging and cannot move!" << std::endl;
         
         // Opponent still gets to attack
         int opponentMoveIndex = getAIMoveChoice();
@@ -872,20 +898,20 @@ void Battle::startBattle() {
         // Handle opponent recharge state
         if (opponentMoveIndex == -2) {
           opponentSelectedPokemon->finishRecharge();
-          std::cout << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
+          out() << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
         } else {
           executeMove(*opponentSelectedPokemon, *selectedPokemon, opponentMoveIndex);
         }
         
-        std::cout << std::endl;
+        out() << std::endl;
       } else if (playerChoice == -1) {
         // Player wants to switch Pokemon
         int chosenIndex = getPokemonChoice();
         if (chosenIndex >= 0) {
-          std::cout << "\n"
-                    << selectedPokemon->name << ", come back!" << std::endl;
+          out() << "\n"
+                << selectedPokemon->name << ", come back!" << std::endl;
           selectedPokemon = playerTeam.getPokemon(chosenIndex);
-          std::cout << "Go, " << selectedPokemon->name << "!" << std::endl;
+          out() << "Go, " << selectedPokemon->name << "!" << std::endl;
           
           // Register new Pokemon with health bar system
           if (healthBarListener && selectedPokemon) {
@@ -900,13 +926,13 @@ void Battle::startBattle() {
           // Handle opponent recharge state
           if (opponentMoveIndex == -2) {
             opponentSelectedPokemon->finishRecharge();
-            std::cout << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
+            out() << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
           } else {
             executeMove(*opponentSelectedPokemon, *selectedPokemon,
                         opponentMoveIndex);
           }
 
-          std::cout << std::endl;
+          out() << std::endl;
         }
       } else {
         // Player chose a move
@@ -919,7 +945,7 @@ void Battle::startBattle() {
         if (opponentMoveIndex == -2) {
           // AI must recharge
           opponentSelectedPokemon->finishRecharge();
-          std::cout << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
+          out() << opponentSelectedPokemon->name << " is recharging and cannot move!" << std::endl;
           
           // Only player moves
           executeMove(*selectedPokemon, *opponentSelectedPokemon, playerChoice);
@@ -948,7 +974,7 @@ void Battle::startBattle() {
         std::this_thread::sleep_for(std::chrono::seconds(1));
 
         // Health bars updated through event system
-        std::cout << std::endl;
+        out() << std::endl;
 
         // Wait a moment to simulate turn processing
         std::this_thread::sleep_for(std::chrono::seconds(1));
@@ -957,23 +983,23 @@ void Battle::startBattle() {
 
     // Handle fainted Pokemon (simplified for now)
     if (!selectedPokemon->isAlive()) {
-      std::cout << "\n"
-                << selectedPokemon->name << " has fainted!" << std::endl;
+      out() << "\n"
+            << selectedPokemon->name << " has fainted!" << std::endl;
       auto *newPokemon = playerTeam.getFirstAlivePokemon();
       if (newPokemon) {
         selectedPokemon = newPokemon;
-        std::cout << "\nYou send out " << selectedPokemon->name << "!\n";
+        out() << "\nYou send out " << selectedPokemon->name << "!\n";
       }
     }
 
     if (!opponentSelectedPokemon->isAlive()) {
-      std::cout << "\nOpponent's " << opponentSelectedPokemon->name
-                << " has fainted!" << std::endl;
+      out() << "\nOpponent's " << opponentSelectedPokemon->name
+            << " has fainted!" << std::endl;
       auto *newPokemon = opponentTeam.getFirstAlivePokemon();
       if (newPokemon) {
         opponentSelectedPokemon = newPokemon;
-        std::cout << "\nOpponent sends out " << opponentSelectedPokemon->name
-                  << "!\n";
+        out() << "\nOpponent sends out " << opponentSelectedPokemon->name
+              << "!\n";
         
         // Register new opponent Pokemon with health bar system
         if (healthBarListener && opponentSelectedPokemon) {
@@ -987,29 +1013,286 @@ void Battle::startBattle() {
   BattleResult result = getBattleResult();
   switch (result) {
     case BattleResult::PLAYER_WINS:
-      std::cout
+      out()
           << "\nAll opponent's Pokémon have fainted! You won the battle!\n";
       break;
     case BattleResult::OPPONENT_WINS:
-      std::cout << "\nAll your Pokémon have fainted! You lost the battle.\n";
+      out() << "\nAll your Pokémon have fainted! You lost the battle.\n";
       break;
     case BattleResult::DRAW:
-      std::cout << "\nIt's a draw! All Pokémon have fainted.\n";
+      out() << "\nIt's a draw! All Pokémon have fainted.\n";
       break;
     default:
       break;
   }
 }
 
+void Battle::seedRandom(uint64_t seed, uint64_t skipDraws) {
+  randomSeed = seed;
+  rng.seed(seed);
+  rng.discard(skipDraws);
+}
+
+void Battle::setHeadlessStart(const HeadlessStart &start) {
+  headlessStart = start;
+}
+
+Battle::ActionProvider Battle::makeActionProvider(AIStrategy &strategy) {
+  return [&strategy](const BattleState &state) -> BattleAction {
+    // Forced replacement after a faint, or a voluntary switch
+    if (!state.aiPokemon->isAlive() || strategy.shouldSwitch(state)) {
+      SwitchEvaluation switchChoice = strategy.chooseBestSwitch(state);
+      if (switchChoice.pokemonIndex >= 0) {
+        return {BattleAction::Type::SWITCH, switchChoice.pokemonIndex};
+      }
+    }
+
+    MoveEvaluation moveChoice = strategy.chooseBestMove(state);
+    return {BattleAction::Type::MOVE, moveChoice.moveIndex};
+  };
+}
+
+Battle::HeadlessResult Battle::runHeadless(AIStrategy &playerStrategy,
+                                           AIStrategy &opponentStrategy,
+                                           int maxTurns) {
+  return runHeadless(makeActionProvider(playerStrategy),
+                     makeActionProvider(opponentStrategy), maxTurns);
+}
+
+Battle::HeadlessResult Battle::runHeadless(
+    const ActionProvider &playerProvider,
+    const ActionProvider &opponentProvider, int maxTurns) {
+  headless = true;
+
+  // Health bar rendering is terminal output - detach it for the run
+  if (healthBarListener) {
+    eventManager.unsubscribe(healthBarListener);
+  }
+
+  // Both sides lead with the configured slot, or their first healthy Pokemon
+  auto leadFor = [](Team &team, int slot) {
+    Pokemon *lead = slot >= 0 ? team.getPokemon(slot) : nullptr;
+    return lead && lead->isAlive() ? lead : team.getFirstAlivePokemon();
+  };
+  selectedPokemon = leadFor(playerTeam, headlessStart.playerActive);
+  opponentSelectedPokemon = leadFor(opponentTeam, headlessStart.opponentActive);
+  currentWeather = headlessStart.weather;
+  weatherTurnsRemaining = headlessStart.weatherTurns;
+
+  if (replay) {
+    replay->seed = randomSeed;
+    replay->start_draws = rng.draws();
+    replay->player_team_hash = BattleReplay::hashTeam(playerTeam);
+    replay->opponent_team_hash = BattleReplay::hashTeam(opponentTeam);
+    replay->start = headlessStart;
+    replay->turns.clear();
+  }
+  eventManager.notifyBattleStart({selectedPokemon, opponentSelectedPokemon});
+
+  int turns = 0;
+  while (!isBattleOver() && turns < maxTurns) {
+    ++turns;
+    eventManager.notifyTurnStart(turns);
+    BattleReplay::Turn record;
+    record.actions.fill(BattleReplay::kNoAction);
+
+    // Process status conditions at start of turn
+    if (selectedPokemon->hasStatusCondition()) {
+      processStatusConditionWithEvents(*selectedPokemon);
+    }
+    if (opponentSelectedPokemon->hasStatusCondition()) {
+      processStatusConditionWithEvents(*opponentSelectedPokemon);
+    }
+
+    processWeather();
+
+    if (selectedPokemon->isAlive() && opponentSelectedPokemon->isAlive()) {
+      BattleAction playerAction =
+          chooseHeadlessAction(playerProvider, true, turns);
+      BattleAction opponentAction =
+          chooseHeadlessAction(opponentProvider, false, turns);
+      record.actions[BattleReplay::kPlayerAction] =
+          BattleReplay::encodeAction(playerAction);
+      record.actions[BattleReplay::kOpponentAction] =
+          BattleReplay::encodeAction(opponentAction);
+      executeHeadlessTurn(playerAction, opponentAction);
+    }
+
+    int playerSlot = replaceFaintedHeadless(playerProvider, true, turns);
+    int opponentSlot = replaceFaintedHeadless(opponentProvider, false, turns);
+
+    if (replay) {
+      if (playerSlot >= 0) {
+        record.actions[BattleReplay::kPlayerReplacement] = BattleReplay::encodeAction(
+            {BattleAction::Type::SWITCH, playerSlot});
+      }
+      if (opponentSlot >= 0) {
+        record.actions[BattleReplay::kOpponentReplacement] = BattleReplay::encodeAction(
+            {BattleAction::Type::SWITCH, opponentSlot});
+      }
+      record.draws = replay->records_draws ? rng.draws() : 0;
+      replay->turns.push_back(record);
+    }
+    eventManager.notifyTurnEnd(turns);
+  }
+
+  if (healthBarListener) {
+    eventManager.subscribe(healthBarListener);
+  }
+  headless = false;
+
+  BattleResult result = getBattleResult();
+  if (result == BattleResult::ONGOING) {
+    result = BattleResult::DRAW;  // Turn limit reached
+  }
+  if (eventManager.isSubscribed(BattleEvents::EventType::BATTLE_END)) {
+    auto winner = result == BattleResult::PLAYER_WINS
+                      ? BattleEvents::BattleEndEvent::Winner::PLAYER
+                  : result == BattleResult::OPPONENT_WINS
+                      ? BattleEvents::BattleEndEvent::Winner::AI
+                      : BattleEvents::BattleEndEvent::Winner::DRAW;
+    eventManager.notifyBattleEnd({winner, turns});
+  }
+  if (replay) {
+    replay->result = result;
+    replay->end_draws = rng.draws();
+    replay->end_state_hash = BattleReplay::hashTeams(playerTeam, opponentTeam);
+  }
+  return {result, turns};
+}
+
+BattleState Battle::makeBattleState(bool forPlayer, int turnNumber) {
+  BattleState state;
+  state.aiPokemon = forPlayer ? selectedPokemon : opponentSelectedPokemon;
+  state.opponentPokemon = forPlayer ? opponentSelectedPokemon : selectedPokemon;
+  state.aiTeam = forPlayer ? &playerTeam : &opponentTeam;
+  state.opponentTeam = forPlayer ? &opponentTeam : &playerTeam;
+  state.currentWeather = currentWeather;
+  state.weatherTurnsRemaining = weatherTurnsRemaining;
+  state.turnNumber = turnNumber;
+  return state;
+}
+
+Battle::BattleAction Battle::chooseHeadlessAction(
+    const ActionProvider &provider, bool forPlayer, int turnNumber) {
+  Pokemon *active = forPlayer ? selectedPokemon : opponentSelectedPokemon;
+  const Team &team = forPlayer ? playerTeam : opponentTeam;
+
+  // Multi-turn moves lock the action in; executeMove handles recharging
+  if (active->mustRecharge()) {
+    return {BattleAction::Type::MOVE, 0};
+  }
+  if (active->isCharging()) {
+    return {BattleAction::Type::MOVE, active->getChargingMoveIndex()};
+  }
+
+  BattleAction action = provider(makeBattleState(forPlayer, turnNumber));
+
+  if (action.type == BattleAction::Type::SWITCH) {
+    const Pokemon *target = team.getPokemon(action.index);
+    if (target && target->isAlive() && target != active) {
+      return action;
+    }
+  } else if (action.index >= 0 &&
+             action.index < static_cast<int>(active->moves.size()) &&
+             active->moves[action.index].canUse()) {
+    return action;
+  }
+
+  // Invalid choice - fall back to the first move with PP
+  for (size_t i = 0; i < active->moves.size(); ++i) {
+    if (active->moves[i].canUse()) {
+      return {BattleAction::Type::MOVE, static_cast<int>(i)};
+    }
+  }
+  return {BattleAction::Type::MOVE, 0};  // executeMove reports the missing PP
+}
+
+void Battle::executeHeadlessTurn(const BattleAction &playerAction,
+                                 const BattleAction &opponentAction) {
+  // Switches resolve before any move
+  if (playerAction.type == BattleAction::Type::SWITCH) {
+    Pokemon *previous = selectedPokemon;
+    selectedPokemon = playerTeam.getPokemon(playerAction.index);
+    notifyHeadlessSwitch(previous, selectedPokemon, true);
+  }
+  if (opponentAction.type == BattleAction::Type::SWITCH) {
+    Pokemon *previous = opponentSelectedPokemon;
+    opponentSelectedPokemon = opponentTeam.getPokemon(opponentAction.index);
+    notifyHeadlessSwitch(previous, opponentSelectedPokemon, false);
+  }
+
+  bool playerMoves = playerAction.type == BattleAction::Type::MOVE &&
+                     !selectedPokemon->moves.empty();
+  bool opponentMoves = opponentAction.type == BattleAction::Type::MOVE &&
+                       !opponentSelectedPokemon->moves.empty();
+
+  if (playerMoves && opponentMoves) {
+    const Move &playerMove = selectedPokemon->moves[playerAction.index];
+    const Move &opponentMove =
+        opponentSelectedPokemon->moves[opponentAction.index];
+
+    if (playerFirst(playerMove, opponentMove)) {
+      executeMove(*selectedPokemon, *opponentSelectedPokemon,
+                  playerAction.index);
+      if (opponentSelectedPokemon->isAlive()) {
+        executeMove(*opponentSelectedPokemon, *selectedPokemon,
+                    opponentAction.index);
+      }
+    } else {
+      executeMove(*opponentSelectedPokemon, *selectedPokemon,
+                  opponentAction.index);
+      if (selectedPokemon->isAlive()) {
+        executeMove(*selectedPokemon, *opponentSelectedPokemon,
+                    playerAction.index);
+      }
+    }
+  } else if (playerMoves) {
+    executeMove(*selectedPokemon, *opponentSelectedPokemon, playerAction.index);
+  } else if (opponentMoves) {
+    executeMove(*opponentSelectedPokemon, *selectedPokemon,
+                opponentAction.index);
+  }
+}
+
+void Battle::notifyHeadlessSwitch(Pokemon *oldPokemon, Pokemon *newPokemon,
+                                  bool forPlayer) {
+  if (oldPokemon != newPokemon) {
+    eventManager.notifyPokemonSwitch({oldPokemon, newPokemon, forPlayer});
+  }
+}
+
+int Battle::replaceFaintedHeadless(const ActionProvider &provider,
+                                   bool forPlayer, int turnNumber) {
+  Pokemon *&active = forPlayer ? selectedPokemon : opponentSelectedPokemon;
+  Team &team = forPlayer ? playerTeam : opponentTeam;
+
+  if (active->isAlive() || !team.hasAlivePokemon()) {
+    return -1;
+  }
+
+  BattleAction action = provider(makeBattleState(forPlayer, turnNumber));
+  Pokemon *replacement = action.type == BattleAction::Type::SWITCH
+                             ? team.getPokemon(action.index)
+                             : nullptr;
+  if (!replacement || !replacement->isAlive()) {
+    replacement = team.getFirstAlivePokemon();
+  }
+  notifyHeadlessSwitch(active, replacement, forPlayer);
+  active = replacement;
+
+  for (int slot = 0; slot < static_cast<int>(team.size()); ++slot) {
+    if (team.getPokemon(slot) == replacement) {
+      return slot;
+    }
+  }
+  return -1;
+}
+
 // STAB (Same Type Attack Bonus) implementation
 bool Battle::hasSTAB(const Pokemon &attacker, const Move &move) const {
   // Check if the move type matches any of the attacker's types
-  for (const std::string &type : attacker.types) {
-    if (type == move.type) {
-      return true;
-    }
-  }
-  return false;
+  return attacker.types.contains(move.def().type_id);
 }
 
 double Battle::calculateSTABMultiplier(const Pokemon &attacker,
@@ -1023,14 +1306,14 @@ bool Battle::isCriticalHit(const Move &move) const {
   double criticalRatio = 1.0 / 16.0;
 
   // Some moves have higher critical hit ratios
-  if (move.crit_rate > 0) {
+  if (move.def().crit_rate > 0) {
     // Moves with high critical hit ratio (like Slash, Razor Leaf) have 1/8
     // chance
     criticalRatio = 1.0 / 8.0;
   }
 
   // Generate random number and check if it's a critical hit
-  return criticalDistribution(rng) < criticalRatio;
+  return rng.uniformReal() < criticalRatio;
 }
 
 double Battle::calculateCriticalMultiplier(const Move &move) const {
@@ -1040,13 +1323,12 @@ double Battle::calculateCriticalMultiplier(const Move &move) const {
 // Accuracy checking implementation
 bool Battle::checkMoveAccuracy(const Move &move) const {
   // Moves with accuracy = 0 never miss (like Swift, Aerial Ace)
-  if (move.accuracy == 0) {
+  if (move.def().accuracy == 0) {
     return true;
   }
 
   // Roll 1-100 vs accuracy value
-  auto accuracyDistribution = std::uniform_int_distribution<int>(1, 100);
-  return accuracyDistribution(rng) <= move.accuracy;
+  return rng.percentChance(move.def().accuracy);
 }
 
 void Battle::executeTurn() {
@@ -1071,7 +1353,7 @@ void Battle::executeTurn() {
   for (int i = 0; i < static_cast<int>(opponentSelectedPokemon->moves.size());
        ++i) {
     if (opponentSelectedPokemon->moves[i].canUse()) {
-      if (opponentMoveIndex == -1 || rand() % 2) {
+      if (opponentMoveIndex == -1 || rng.uniformInt(0, 1) == 1) {
         opponentMoveIndex = i;
       }
     }
@@ -1105,7 +1387,7 @@ void Battle::executeTurn() {
 void Battle::handlePokemonFainted() {
   // Handle player Pokemon fainting
   if (!selectedPokemon->isAlive()) {
-    std::cout << "\n" << selectedPokemon->name << " has fainted!" << std::endl;
+    out() << "\n" << selectedPokemon->name << " has fainted!" << std::endl;
 
     // Check if player has any Pokemon left
     if (!playerTeam.hasAlivePokemon()) {
@@ -1116,7 +1398,7 @@ void Battle::handlePokemonFainted() {
     int chosenIndex = getPokemonChoice();
     if (chosenIndex >= 0) {
       selectedPokemon = playerTeam.getPokemon(chosenIndex);
-      std::cout << "\nYou send out " << selectedPokemon->name << "!\n";
+      out() << "\nYou send out " << selectedPokemon->name << "!\n";
       
       // Register new Pokemon with health bar system
       if (healthBarListener && selectedPokemon) {
@@ -1127,8 +1409,8 @@ void Battle::handlePokemonFainted() {
 
   // Handle opponent Pokemon fainting
   if (!opponentSelectedPokemon->isAlive()) {
-    std::cout << "\nOpponent's " << opponentSelectedPokemon->name
-              << " has fainted!" << std::endl;
+    out() << "\nOpponent's " << opponentSelectedPokemon->name
+          << " has fainted!" << std::endl;
 
     // Check if opponent has any Pokemon left
     if (!opponentTeam.hasAlivePokemon()) {
@@ -1139,8 +1421,8 @@ void Battle::handlePokemonFainted() {
     auto *newPokemon = opponentTeam.getFirstAlivePokemon();
     if (newPokemon) {
       opponentSelectedPokemon = newPokemon;
-      std::cout << "\nOpponent sends out " << opponentSelectedPokemon->name
-                << "!\n";
+      out() << "\nOpponent sends out " << opponentSelectedPokemon->name
+            << "!\n";
       
       // Register new opponent Pokemon with health bar system
       if (healthBarListener && opponentSelectedPokemon) {
@@ -1155,59 +1437,59 @@ void Battle::applyStatModification(Pokemon &attacker, Pokemon &defender,
   // Map move names to stat modifications
   // Format: {stat, stages, target} where target: true=self, false=opponent
 
-  if (move.name == "swords-dance") {
+  if (move.def().name == "swords-dance") {
     attacker.modifyAttack(2);
-    std::cout << attacker.name << "'s Attack rose sharply!" << std::endl;
-  } else if (move.name == "growl") {
+    out() << attacker.name << "'s Attack rose sharply!" << std::endl;
+  } else if (move.def().name == "growl") {
     defender.modifyAttack(-1);
-    std::cout << defender.name << "'s Attack fell!" << std::endl;
-  } else if (move.name == "agility") {
+    out() << defender.name << "'s Attack fell!" << std::endl;
+  } else if (move.def().name == "agility") {
     attacker.modifySpeed(2);
-    std::cout << attacker.name << "'s Speed rose sharply!" << std::endl;
-  } else if (move.name == "harden") {
+    out() << attacker.name << "'s Speed rose sharply!" << std::endl;
+  } else if (move.def().name == "harden") {
     attacker.modifyDefense(1);
-    std::cout << attacker.name << "'s Defense rose!" << std::endl;
-  } else if (move.name == "defense-curl") {
+    out() << attacker.name << "'s Defense rose!" << std::endl;
+  } else if (move.def().name == "defense-curl") {
     attacker.modifyDefense(1);
-    std::cout << attacker.name << "'s Defense rose!" << std::endl;
-  } else if (move.name == "iron-defense") {
+    out() << attacker.name << "'s Defense rose!" << std::endl;
+  } else if (move.def().name == "iron-defense") {
     attacker.modifyDefense(2);
-    std::cout << attacker.name << "'s Defense rose sharply!" << std::endl;
-  } else if (move.name == "calm-mind") {
+    out() << attacker.name << "'s Defense rose sharply!" << std::endl;
+  } else if (move.def().name == "calm-mind") {
     attacker.modifySpecialAttack(1);
     attacker.modifySpecialDefense(1);
-    std::cout << attacker.name << "'s Special Attack and Special Defense rose!"
-              << std::endl;
-  } else if (move.name == "leer") {
+    out() << attacker.name << "'s Special Attack and Special Defense rose!"
+          << std::endl;
+  } else if (move.def().name == "leer") {
     defender.modifyDefense(-1);
-    std::cout << defender.name << "'s Defense fell!" << std::endl;
-  } else if (move.name == "tail-whip") {
+    out() << defender.name << "'s Defense fell!" << std::endl;
+  } else if (move.def().name == "tail-whip") {
     defender.modifyDefense(-1);
-    std::cout << defender.name << "'s Defense fell!" << std::endl;
-  } else if (move.name == "amnesia") {
+    out() << defender.name << "'s Defense fell!" << std::endl;
+  } else if (move.def().name == "amnesia") {
     attacker.modifySpecialDefense(2);
-    std::cout << attacker.name << "'s Special Defense rose sharply!"
-              << std::endl;
-  } else if (move.name == "barrier") {
+    out() << attacker.name << "'s Special Defense rose sharply!"
+          << std::endl;
+  } else if (move.def().name == "barrier") {
     attacker.modifyDefense(2);
-    std::cout << attacker.name << "'s Defense rose sharply!" << std::endl;
-  } else if (move.name == "sharpen") {
+    out() << attacker.name << "'s Defense rose sharply!" << std::endl;
+  } else if (move.def().name == "sharpen") {
     attacker.modifyAttack(1);
-    std::cout << attacker.name << "'s Attack rose!" << std::endl;
-  } else if (move.name == "meditate") {
+    out() << attacker.name << "'s Attack rose!" << std::endl;
+  } else if (move.def().name == "meditate") {
     attacker.modifyAttack(1);
-    std::cout << attacker.name << "'s Attack rose!" << std::endl;
-  } else if (move.name == "dragon-dance") {
+    out() << attacker.name << "'s Attack rose!" << std::endl;
+  } else if (move.def().name == "dragon-dance") {
     attacker.modifyAttack(1);
     attacker.modifySpeed(1);
-    std::cout << attacker.name << "'s Attack and Speed rose!" << std::endl;
-  } else if (move.name == "nasty-plot") {
+    out() << attacker.name << "'s Attack and Speed rose!" << std::endl;
+  } else if (move.def().name == "nasty-plot") {
     attacker.modifySpecialAttack(2);
-    std::cout << attacker.name << "'s Special Attack rose sharply!"
-              << std::endl;
+    out() << attacker.name << "'s Special Attack rose sharply!"
+          << std::endl;
   } else {
-    std::cout << attacker.name << " used " << move.name
-              << ", but it had no stat effect!" << std::endl;
+    out() << attacker.name << " used " << move.def().name
+          << ", but it had no stat effect!" << std::endl;
   }
 }
 
@@ -1217,29 +1499,29 @@ void Battle::processWeather() {
   }
 
   // Display weather effect
-  std::cout << "Weather: " << Weather::getWeatherName(currentWeather);
+  out() << "Weather: " << Weather::getWeatherName(currentWeather);
   if (weatherTurnsRemaining > 0) {
-    std::cout << " (" << weatherTurnsRemaining << " turns left)";
+    out() << " (" << weatherTurnsRemaining << " turns left)";
   }
 
   // Show current weather boosts
   switch (currentWeather) {
     case WeatherCondition::RAIN:
-      std::cout << " [Water +50%, Fire -50%]";
+      out() << " [Water +50%, Fire -50%]";
       break;
     case WeatherCondition::SUN:
-      std::cout << " [Fire +50%, Water -50%]";
+      out() << " [Fire +50%, Water -50%]";
       break;
     case WeatherCondition::SANDSTORM:
-      std::cout << " [Sandstorm damage]";
+      out() << " [Sandstorm damage]";
       break;
     case WeatherCondition::HAIL:
-      std::cout << " [Hail damage]";
+      out() << " [Hail damage]";
       break;
     default:
       break;
   }
-  std::cout << std::endl;
+  out() << std::endl;
 
   // Apply weather damage to Pokemon
   if (selectedPokemon && selectedPokemon->isAlive()) {
@@ -1250,15 +1532,16 @@ void Battle::processWeather() {
       if (damage > 0) {
         int previousHealth = selectedPokemon->current_hp;
         selectedPokemon->takeDamage(damage);
-        std::cout << selectedPokemon->name << " is hurt by "
-                  << Weather::getWeatherName(currentWeather) << "! (-" << damage
-                  << " HP)" << std::endl;
+        out() << selectedPokemon->name << " is hurt by "
+              << Weather::getWeatherName(currentWeather) << "! (-" << damage
+              << " HP)" << std::endl;
         
         // Emit health change event for weather damage
         auto healthEvent = eventManager.createHealthChangeEvent(
           selectedPokemon, previousHealth, selectedPokemon->current_hp, 
-          Weather::getWeatherName(currentWeather) + " damage"
+          BattleEvents::EventSource::WEATHER
         );
+        healthEvent.weather = currentWeather;
         eventManager.notifyHealthChanged(healthEvent);
       }
     }
@@ -1272,15 +1555,16 @@ void Battle::processWeather() {
       if (damage > 0) {
         int previousHealth = opponentSelectedPokemon->current_hp;
         opponentSelectedPokemon->takeDamage(damage);
-        std::cout << opponentSelectedPokemon->name << " is hurt by "
-                  << Weather::getWeatherName(currentWeather) << "! (-" << damage
-                  << " HP)" << std::endl;
+        out() << opponentSelectedPokemon->name << " is hurt by "
+              << Weather::getWeatherName(currentWeather) << "! (-" << damage
+              << " HP)" << std::endl;
         
         // Emit health change event for weather damage
         auto healthEvent = eventManager.createHealthChangeEvent(
           opponentSelectedPokemon, previousHealth, opponentSelectedPokemon->current_hp,
-          Weather::getWeatherName(currentWeather) + " damage"
+          BattleEvents::EventSource::WEATHER
         );
+        healthEvent.weather = currentWeather;
         eventManager.notifyHealthChanged(healthEvent);
       }
     }
@@ -1290,47 +1574,50 @@ void Battle::processWeather() {
   if (weatherTurnsRemaining > 0) {
     weatherTurnsRemaining--;
     if (weatherTurnsRemaining == 0) {
-      std::cout << "The " << Weather::getWeatherName(currentWeather)
-                << " stopped." << std::endl;
+      out() << "The " << Weather::getWeatherName(currentWeather)
+            << " stopped." << std::endl;
+      eventManager.notifyWeatherChanged(
+          {currentWeather, WeatherCondition::NONE, 0});
       currentWeather = WeatherCondition::NONE;
     }
   }
 }
 
 void Battle::setWeather(WeatherCondition weather, int turns) {
+  eventManager.notifyWeatherChanged({currentWeather, weather, turns});
   currentWeather = weather;
   weatherTurnsRemaining = turns;
   if (weather != WeatherCondition::NONE) {
-    std::cout << Weather::getWeatherName(weather) << " started!";
+    out() << Weather::getWeatherName(weather) << " started!";
 
     // Show what boost the weather provides
     switch (weather) {
       case WeatherCondition::RAIN:
-        std::cout << " (Water moves boosted 1.5x, Fire moves weakened 0.5x)";
+        out() << " (Water moves boosted 1.5x, Fire moves weakened 0.5x)";
         break;
       case WeatherCondition::SUN:
-        std::cout << " (Fire moves boosted 1.5x, Water moves weakened 0.5x)";
+        out() << " (Fire moves boosted 1.5x, Water moves weakened 0.5x)";
         break;
       case WeatherCondition::SANDSTORM:
-        std::cout << " (Non Rock/Ground/Steel types take damage each turn)";
+        out() << " (Non Rock/Ground/Steel types take damage each turn)";
         break;
       case WeatherCondition::HAIL:
-        std::cout << " (Non Ice types take damage each turn)";
+        out() << " (Non Ice types take damage each turn)";
         break;
       default:
         break;
     }
-    std::cout << std::endl;
+    out() << std::endl;
   }
 }
 
 void Battle::displayWeather() const {
   if (currentWeather != WeatherCondition::NONE) {
-    std::cout << "Current weather: " << Weather::getWeatherName(currentWeather);
+    out() << "Current weather: " << Weather::getWeatherName(currentWeather);
     if (weatherTurnsRemaining > 0) {
-      std::cout << " (" << weatherTurnsRemaining << " turns remaining)";
+      out() << " (" << weatherTurnsRemaining << " turns remaining)";
     }
-    std::cout << std::endl;
+    out() << std::endl;
   }
 }
 
@@ -1378,7 +1665,7 @@ int Battle::getAIMoveEasy() const {
   }
 
   // Choose random move from usable moves
-  return usableMoves[rand() % usableMoves.size()];
+  return usableMoves[rng.index(usableMoves.size())];
 }
 
 // Medium AI: Basic type effectiveness consideration
@@ -1395,10 +1682,10 @@ int Battle::getAIMoveMedium() const {
       // Calculate type effectiveness score
       const Move &move = opponentSelectedPokemon->moves[i];
       double typeMultiplier =
-          calculateTypeAdvantage(move.type, selectedPokemon->types);
+          calculateTypeAdvantage(move.def().type_id, selectedPokemon->types);
 
       // Score based on type effectiveness and move power
-      double score = (move.power > 0 ? move.power : 50) * typeMultiplier;
+      double score = (move.def().power > 0 ? move.def().power : 50) * typeMultiplier;
       moveScores.push_back(score);
     }
   }
@@ -1419,7 +1706,7 @@ int Battle::getAIMoveMedium() const {
   }
 
   // Randomly select from the best moves
-  return bestMoves[rand() % bestMoves.size()];
+  return bestMoves[rng.index(bestMoves.size())];
 }
 
 // Hard AI: Smart type effectiveness, strategic switching, status moves
@@ -1439,22 +1726,22 @@ int Battle::getAIMoveHard() const {
       // Hard AI considerations:
       
       // 1. Prioritize OHKO moves against low health targets
-      if (move.category == "ohko" && selectedPokemon->getHealthPercentage() < 30) {
+      if (move.def().category_id == MoveCategory::OHKO && selectedPokemon->getHealthPercentage() < 30) {
         score += 200;
       }
       
       // 2. Prefer status moves early in battle if opponent is healthy
-      if (move.power <= 0 && selectedPokemon->getHealthPercentage() > 70) {
+      if (move.def().power <= 0 && selectedPokemon->getHealthPercentage() > 70) {
         if (!selectedPokemon->hasStatusCondition()) {
-          if (move.name == "toxic" || move.name == "will-o-wisp" || 
-              move.name == "sleep-powder" || move.name == "thunder-wave") {
+          if (move.def().name == "toxic" || move.def().name == "will-o-wisp" || 
+              move.def().name == "sleep-powder" || move.def().name == "thunder-wave") {
             score += 60;
           }
         }
       }
       
       // 3. Heavily favor super effective moves
-      double typeMultiplier = calculateTypeAdvantage(move.type, selectedPokemon->types);
+      double typeMultiplier = calculateTypeAdvantage(move.def().type_id, selectedPokemon->types);
       if (typeMultiplier >= 2.0) {
         score *= 1.8; // Extra boost for super effective
       } else if (typeMultiplier <= 0.5) {
@@ -1463,19 +1750,19 @@ int Battle::getAIMoveHard() const {
       
       // 4. Consider opponent's health for finishing moves
       if (selectedPokemon->getHealthPercentage() < 25) {
-        if (move.power > 0) {
+        if (move.def().power > 0) {
           score *= 1.5; // Prioritize damage when opponent is low
         }
       }
       
       // 5. Weather synergy
-      double weatherMultiplier = Weather::getWeatherDamageMultiplier(currentWeather, move.type);
+      double weatherMultiplier = Weather::getWeatherDamageMultiplier(currentWeather, move.def().type);
       if (weatherMultiplier > 1.0) {
         score *= 1.3; // Boost weather-synergistic moves
       }
       
       // 6. Stat modification strategy
-      if (move.category == "net-good-stats") {
+      if (move.def().category_id == MoveCategory::NET_GOOD_STATS) {
         // Prefer setup moves if we have health and no stat boosts yet
         if (opponentSelectedPokemon->getHealthPercentage() > 60) {
           score += 45;
@@ -1502,7 +1789,7 @@ int Battle::getAIMoveHard() const {
   std::sort(scoredMoves.begin(), scoredMoves.end(), std::greater<>());
 
   // Weighted selection: 50% chance for best move, 30% for second best, 20% for others
-  int randomValue = rand() % 100;
+  int randomValue = rng.uniformInt(0, 99);
   
   if (randomValue < 50 || scoredMoves.size() == 1) {
     return scoredMoves[0].second; // Best move
@@ -1510,7 +1797,7 @@ int Battle::getAIMoveHard() const {
     return scoredMoves[1].second; // Second best move
   } else {
     // Random selection from remaining moves
-    int randomIndex = 2 + (rand() % std::max(1, static_cast<int>(scoredMoves.size()) - 2));
+    int randomIndex = 2 + rng.uniformInt(0, std::max(1, static_cast<int>(scoredMoves.size()) - 2) - 1);
     if (randomIndex >= static_cast<int>(scoredMoves.size())) {
       randomIndex = static_cast<int>(scoredMoves.size()) - 1;
     }
@@ -1528,15 +1815,15 @@ int Battle::getAIMoveExpert() const {
 int Battle::evaluateMoveScore(const Move &move, const Pokemon &attacker,
                               const Pokemon &defender) const {
   // Base score from move power
-  int baseScore = move.power > 0 ? move.power : 50;
+  int baseScore = move.def().power > 0 ? move.def().power : 50;
 
   // Type effectiveness multiplier
-  double typeMultiplier = calculateTypeAdvantage(move.type, defender.types);
+  double typeMultiplier = calculateTypeAdvantage(move.def().type_id, defender.types);
 
   // STAB (Same Type Attack Bonus)
   double stabMultiplier = 1.0;
   for (const auto &type : attacker.types) {
-    if (type == move.type) {
+    if (type == move.def().type) {
       stabMultiplier = 1.5;
       break;
     }
@@ -1544,19 +1831,19 @@ int Battle::evaluateMoveScore(const Move &move, const Pokemon &attacker,
 
   // Weather bonus
   double weatherMultiplier =
-      Weather::getWeatherDamageMultiplier(currentWeather, move.type);
+      Weather::getWeatherDamageMultiplier(currentWeather, move.def().type);
 
   // Calculate final score
   double finalScore =
       baseScore * typeMultiplier * stabMultiplier * weatherMultiplier;
 
   // Bonus for status moves that could be beneficial
-  if (move.power <= 0) {
-    if (move.stat_chance > 0) {
+  if (move.def().power <= 0) {
+    if (move.def().stat_chance > 0) {
       finalScore += 30; // Buff/debuff moves get bonus points
     }
-    if (move.name == "toxic" || move.name == "will-o-wisp" ||
-        move.name == "sleep-powder") {
+    if (move.def().name == "toxic" || move.def().name == "will-o-wisp" ||
+        move.def().name == "sleep-powder") {
       finalScore += 40; // Status condition moves get bonus points
     }
   }
@@ -1566,8 +1853,7 @@ int Battle::evaluateMoveScore(const Move &move, const Pokemon &attacker,
 
 // Calculate type advantage multiplier (placeholder for future AI levels)
 double Battle::calculateTypeAdvantage(
-    const std::string &moveType,
-    const std::vector<std::string> &defenderTypes) const {
+    PokemonType moveType, const PokemonTypes &defenderTypes) const {
   // TODO: Use this for Medium/Hard/Expert AI levels
   return TypeEffectiveness::getEffectivenessMultiplier(moveType, defenderTypes);
 }
@@ -1593,8 +1879,8 @@ int Battle::getAIPokemonChoice() const {
         
         // 2. Type advantage assessment
         for (const auto& move : pokemon->moves) {
-          if (move.canUse() && move.power > 0) {
-            double typeMultiplier = calculateTypeAdvantage(move.type, selectedPokemon->types);
+          if (move.canUse() && move.def().power > 0) {
+            double typeMultiplier = calculateTypeAdvantage(move.def().type_id, selectedPokemon->types);
             if (typeMultiplier >= 2.0) {
               score += 40; // Big bonus for super effective moves
             } else if (typeMultiplier >= 1.0) {
@@ -1606,8 +1892,8 @@ int Battle::getAIPokemonChoice() const {
         // 3. Defensive typing (resistance to opponent's moves)
         int resistanceCount = 0;
         for (const auto& move : selectedPokemon->moves) {
-          if (move.canUse() && move.power > 0) {
-            double typeMultiplier = calculateTypeAdvantage(move.type, pokemon->types);
+          if (move.canUse() && move.def().power > 0) {
+            double typeMultiplier = calculateTypeAdvantage(move.def().type_id, pokemon->types);
             if (typeMultiplier <= 0.5) {
               resistanceCount++;
             }
@@ -1649,10 +1935,10 @@ int Battle::getAIPokemonChoice() const {
     int bestIndex = std::distance(pokemonScores.begin(), maxIt);
     
     // 80% chance to pick the best, 20% chance for random
-    if (rand() % 100 < 80) {
+    if (rng.uniformInt(0, 99) < 80) {
       return availablePokemon[bestIndex];
     } else {
-      return availablePokemon[rand() % availablePokemon.size()];
+      return availablePokemon[rng.index(availablePokemon.size())];
     }
   } else {
     // Easy/Medium AI: just return first available or best for Medium
@@ -1687,8 +1973,8 @@ bool Battle::shouldAISwitch() const {
     if (opponentSelectedPokemon->getHealthPercentage() < 30) {
       // Check if player has super effective moves
       for (const auto& move : selectedPokemon->moves) {
-        if (move.canUse() && move.power > 0) {
-          double typeMultiplier = calculateTypeAdvantage(move.type, opponentSelectedPokemon->types);
+        if (move.canUse() && move.def().power > 0) {
+          double typeMultiplier = calculateTypeAdvantage(move.def().type_id, opponentSelectedPokemon->types);
           if (typeMultiplier >= 2.0) {
             return opponentTeam.hasAlivePokemon() && getAIPokemonChoice() != -1;
           }
@@ -1702,8 +1988,8 @@ bool Battle::shouldAISwitch() const {
       int advantageCount = 0;
       
       for (const auto& move : selectedPokemon->moves) {
-        if (move.canUse() && move.power > 0) {
-          double typeMultiplier = calculateTypeAdvantage(move.type, opponentSelectedPokemon->types);
+        if (move.canUse() && move.def().power > 0) {
+          double typeMultiplier = calculateTypeAdvantage(move.def().type_id, opponentSelectedPokemon->types);
           if (typeMultiplier >= 2.0) {
             disadvantageCount++;
           }
@@ -1711,8 +1997,8 @@ bool Battle::shouldAISwitch() const {
       }
       
       for (const auto& move : opponentSelectedPokemon->moves) {
-        if (move.canUse() && move.power > 0) {
-          double typeMultiplier = calculateTypeAdvantage(move.type, selectedPokemon->types);
+        if (move.canUse() && move.def().power > 0) {
+          double typeMultiplier = calculateTypeAdvantage(move.def().type_id, selectedPokemon->types);
           if (typeMultiplier >= 2.0) {
             advantageCount++;
           }
@@ -1772,14 +2058,16 @@ void Battle::processStatusConditionWithEvents(Pokemon& pokemon) {
   if (!pokemon.hasStatusCondition()) return;
   
   int previousHealth = pokemon.current_hp;
-  pokemon.processStatusCondition();
+  StatusCondition condition = pokemon.status;
+  pokemon.processStatusCondition(out(), rng);
   
   // Only emit event if health actually changed
   if (pokemon.current_hp != previousHealth) {
     auto healthEvent = eventManager.createHealthChangeEvent(
       &pokemon, previousHealth, pokemon.current_hp, 
-      pokemon.getStatusConditionName() + " damage"
+      BattleEvents::EventSource::STATUS
     );
+    healthEvent.status = condition;
     eventManager.notifyHealthChanged(healthEvent);
   }
 }
\ No newline at end of file
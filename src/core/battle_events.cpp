@@ -1,158 +1,157 @@
 #include "battle_events.h"
 #include "pokemon.h"
 #include "move.h"
+#include "weather.h"
 #include <algorithm>
 
 namespace BattleEvents {
 
-// BattleEventManager implementation
-
-void BattleEventManager::subscribe(ListenerPtr listener) {
-    if (listener && std::find(listeners_.begin(), listeners_.end(), listener) == listeners_.end()) {
-        listeners_.push_back(listener);
+const char* getSourceName(EventSource source) {
+    switch (source) {
+        case EventSource::MOVE: return "move";
+        case EventSource::OHKO: return "OHKO";
+        case EventSource::HEAL: return "heal";
+        case EventSource::DRAIN: return "drain";
+        case EventSource::RECOIL: return "recoil";
+        case EventSource::WEATHER: return "weather";
+        case EventSource::STATUS: return "status";
+        case EventSource::SWITCH: return "switch";
+        case EventSource::ITEM: return "item";
+        case EventSource::OTHER: break;
     }
+    return "other";
+}
+
+std::string describeMultiTurnMove(const MultiTurnMoveEvent& event) {
+    const std::string& pokemon = event.pokemon->name;
+    switch (event.phase) {
+        case MultiTurnMoveEvent::Phase::CHARGING:
+            return pokemon + " began charging " + event.move->def().name + "!";
+        case MultiTurnMoveEvent::Phase::RECHARGING:
+            return pokemon + " must recharge next turn!";
+        case MultiTurnMoveEvent::Phase::EXECUTING:
+            break;
+    }
+    if (event.skippedCharge) {
+        return "The sunlight is strong! " + pokemon + " doesn't need to charge!";
+    }
+    return pokemon + " unleashed " + event.move->def().name + "!";
 }
 
-void BattleEventManager::unsubscribe(ListenerPtr listener) {
-    listeners_.erase(
-        std::remove(listeners_.begin(), listeners_.end(), listener),
-        listeners_.end()
-    );
-}
-
-void BattleEventManager::clear() {
-    listeners_.clear();
-}
-
-void BattleEventManager::notifyHealthChanged(const HealthChangeEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const HealthChangeEvent& e) {
-        listener->onHealthChanged(e);
-    });
-}
-
-void BattleEventManager::notifyStatusChanged(const StatusChangeEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const StatusChangeEvent& e) {
-        listener->onStatusChanged(e);
-    });
-}
-
-void BattleEventManager::notifyMoveUsed(const MoveUsedEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const MoveUsedEvent& e) {
-        listener->onMoveUsed(e);
-    });
-}
-
-void BattleEventManager::notifyWeatherChanged(const WeatherChangeEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const WeatherChangeEvent& e) {
-        listener->onWeatherChanged(e);
-    });
-}
-
-void BattleEventManager::notifyPokemonSwitch(const PokemonSwitchEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const PokemonSwitchEvent& e) {
-        listener->onPokemonSwitch(e);
-    });
-}
+std::string describeHealthSource(const HealthChangeEvent& event) {
+    switch (event.source) {
+        case EventSource::WEATHER:
+            return Weather::getWeatherName(event.weather) + " damage";
+        case EventSource::STATUS:
+            return Pokemon::getStatusConditionName(event.status) + " damage";
+        default:
+            break;
+    }
+    if (!event.move) {
+        return getSourceName(event.source);
+    }
 
-void BattleEventManager::notifyBattleStart(const BattleStartEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const BattleStartEvent& e) {
-        listener->onBattleStart(e);
-    });
+    std::string text = event.move->def().name;
+    switch (event.source) {
+        case EventSource::MOVE:
+        case EventSource::OHKO:
+            if (event.attacker) {
+                text = event.attacker->name + "'s " + text;
+            }
+            if (event.source == EventSource::OHKO) {
+                text += " (OHKO)";
+            }
+            break;
+        case EventSource::HEAL:
+        case EventSource::DRAIN:
+        case EventSource::RECOIL:
+            text += std::string(" (") + getSourceName(event.source) + ")";
+            break;
+        default:
+            break;
+    }
+    return text;
 }
 
-void BattleEventManager::notifyBattleEnd(const BattleEndEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const BattleEndEvent& e) {
-        listener->onBattleEnd(e);
-    });
-}
+// BattleEventManager implementation
 
-void BattleEventManager::notifyTurnStart(int turnNumber) {
-    for (auto& listener : listeners_) {
-        if (listener) {
-            listener->onTurnStart(turnNumber);
+void BattleEventManager::subscribe(ListenerPtr listener) {
+    if (!listener) {
+        return;
+    }
+    auto found = std::find_if(listeners_.begin(), listeners_.end(),
+                              [&](const Subscription& s) { return s.listener == listener; });
+    if (found != listeners_.end()) {
+        return;
+    }
+    
+    EventMask events = listener->subscribedEvents() & kAllEvents;
+    for (size_t type = 0; type < static_cast<size_t>(EventType::COUNT); ++type) {
+        if (events & (1u << type)) {
+            byType_[type].push_back(listener.get());
         }
     }
+    mask_ |= events;
+    listeners_.push_back({std::move(listener), events});
 }
 
-void BattleEventManager::notifyTurnEnd(int turnNumber) {
-    for (auto& listener : listeners_) {
-        if (listener) {
-            listener->onTurnEnd(turnNumber);
+void BattleEventManager::unsubscribe(ListenerPtr listener) {
+    auto found = std::find_if(listeners_.begin(), listeners_.end(),
+                              [&](const Subscription& s) { return s.listener == listener; });
+    if (found == listeners_.end()) {
+        return;
+    }
+    
+    if (dispatching_ > 0) {
+        // Blank its slots rather than shifting them under the running loop
+        for (auto& listeners : byType_) {
+            std::replace(listeners.begin(), listeners.end(), found->listener.get(),
+                         static_cast<BattleEventListener*>(nullptr));
         }
+        retired_.push_back(std::move(found->listener));
+        listeners_.erase(found);
+        return;
     }
+    listeners_.erase(found);
+    rebuildIndex();
 }
 
-void BattleEventManager::notifyMultiTurnMove(const MultiTurnMoveEvent& event) {
-    notifyAll(event, [](ListenerPtr listener, const MultiTurnMoveEvent& e) {
-        listener->onMultiTurnMove(e);
-    });
-}
-
-// Convenience event creation methods
-
-HealthChangeEvent BattleEventManager::createHealthChangeEvent(Pokemon* pokemon, int oldHp, int newHp, 
-                                                            const std::string& source) {
-    return HealthChangeEvent{
-        pokemon,
-        oldHp,
-        newHp,
-        oldHp - newHp,  // Positive for damage, negative for healing
-        source
-    };
-}
-
-StatusChangeEvent BattleEventManager::createStatusChangeEvent(Pokemon* pokemon, StatusCondition oldStatus, 
-                                                            StatusCondition newStatus, int turns, 
-                                                            const std::string& source) {
-    return StatusChangeEvent{
-        pokemon,
-        oldStatus,
-        newStatus,
-        turns,
-        source
-    };
-}
-
-MoveUsedEvent BattleEventManager::createMoveUsedEvent(Pokemon* user, const Move* move, Pokemon* target, 
-                                                    bool successful, bool critical, double effectiveness) {
-    return MoveUsedEvent{
-        user,
-        move,
-        target,
-        successful,
-        critical,
-        effectiveness
-    };
-}
-
-MultiTurnMoveEvent BattleEventManager::createMultiTurnMoveEvent(Pokemon* pokemon, const Move* move, 
-                                                              MultiTurnMoveEvent::Phase phase, 
-                                                              const std::string& message) {
-    return MultiTurnMoveEvent{
-        pokemon,
-        move,
-        phase,
-        message
-    };
+void BattleEventManager::clear() {
+    if (dispatching_ > 0) {
+        for (auto& subscription : listeners_) {
+            retired_.push_back(std::move(subscription.listener));
+        }
+        for (auto& listeners : byType_) {
+            std::fill(listeners.begin(), listeners.end(), nullptr);
+        }
+        listeners_.clear();
+        return;
+    }
+    listeners_.clear();
+    rebuildIndex();
 }
 
-// Template implementation for safe notification
-template<typename EventType, typename NotifyFunc>
-void BattleEventManager::notifyAll(const EventType& event, NotifyFunc func) {
-    // Create a copy of listeners to avoid issues if listeners are modified during notification
-    auto listenersCopy = listeners_;
-    
-    for (auto& listener : listenersCopy) {
-        if (listener) {
-            try {
-                func(listener, event);
-            } catch (...) {
-                // Swallow exceptions from listeners to prevent one bad listener 
-                // from breaking the notification chain
-                // In a production system, you might want to log this
+void BattleEventManager::rebuildIndex() {
+    mask_ = 0;
+    for (auto& listeners : byType_) {
+        listeners.clear();
+    }
+    for (const auto& subscription : listeners_) {
+        for (size_t type = 0; type < static_cast<size_t>(EventType::COUNT); ++type) {
+            if (subscription.events & (1u << type)) {
+                byType_[type].push_back(subscription.listener.get());
             }
         }
+        mask_ |= subscription.events;
+    }
+}
+
+void BattleEventManager::endDispatch() {
+    if (--dispatching_ > 0 || retired_.empty()) {
+        return;
     }
+    retired_.clear();
+    rebuildIndex();
 }
 
-} // namespace BattleEvents
\ No newline at end of file
+} // namespace BattleEvents
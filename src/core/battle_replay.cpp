@@ -0,0 +1,325 @@
+#include "battle_replay.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "team.h"
+
+namespace {
+
+constexpr char kMagic[4] = {'P', 'K', 'R', 'P'};
+constexpr uint8_t kVersion = 1;
+constexpr uint8_t kRecordsDraws = 0x01;
+
+// FNV-1a, 64-bit
+constexpr uint64_t kFnvOffset = 0xCBF29CE484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001B3ULL;
+
+void hashBytes(uint64_t &hash, const void *data, size_t size) {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= kFnvPrime;
+  }
+}
+
+void hashInt(uint64_t &hash, int64_t value) { hashBytes(hash, &value, sizeof(value)); }
+
+void hashString(uint64_t &hash, const std::string &value) {
+  hashInt(hash, static_cast<int64_t>(value.size()));
+  hashBytes(hash, value.data(), value.size());
+}
+
+void putFixed64(std::vector<uint8_t> &out, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+void putVarint(std::vector<uint8_t> &out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+// Signed values as zigzag varints, so small negatives stay one byte
+void putSigned(std::vector<uint8_t> &out, int64_t value) {
+  putVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+// Bounds-checked cursor over an encoded replay; any overrun clears ok
+class Reader {
+ public:
+  Reader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+  bool ok() const { return ok_; }
+  size_t position() const { return position_; }
+
+  uint8_t byte() {
+    if (position_ >= size_) {
+      ok_ = false;
+      return 0;
+    }
+    return data_[position_++];
+  }
+
+  uint64_t fixed64() {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+      value |= static_cast<uint64_t>(byte()) << (8 * i);
+    }
+    return value;
+  }
+
+  uint64_t varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t next = byte();
+      value |= static_cast<uint64_t>(next & 0x7F) << shift;
+      if ((next & 0x80) == 0) {
+        return value;
+      }
+    }
+    ok_ = false;
+    return 0;
+  }
+
+  int64_t signedVarint() {
+    uint64_t value = varint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+ private:
+  const uint8_t *data_;
+  size_t size_;
+  size_t position_ = 0;
+  bool ok_ = true;
+};
+
+const char *slotName(int slot) {
+  switch (slot) {
+    case BattleReplay::kPlayerAction:
+      return "player action";
+    case BattleReplay::kOpponentAction:
+      return "opponent action";
+    case BattleReplay::kPlayerReplacement:
+      return "player replacement";
+    default:
+      return "opponent replacement";
+  }
+}
+
+}  // namespace
+
+bool BattleReplay::Turn::operator==(const Turn &other) const {
+  return actions == other.actions && draws == other.draws;
+}
+
+uint8_t BattleReplay::encodeAction(const Battle::BattleAction &action) {
+  auto slot = static_cast<uint8_t>(action.index & 0x7F);
+  return action.type == Battle::BattleAction::Type::SWITCH ? slot | kSwitchFlag : slot;
+}
+
+Battle::BattleAction BattleReplay::decodeAction(uint8_t action) {
+  auto type = (action & kSwitchFlag) != 0 ? Battle::BattleAction::Type::SWITCH
+                                          : Battle::BattleAction::Type::MOVE;
+  return {type, action & 0x7F};
+}
+
+uint64_t BattleReplay::hashTeam(const Team &team) {
+  uint64_t hash = kFnvOffset;
+  hashInt(hash, static_cast<int64_t>(team.size()));
+  for (int slot = 0; slot < static_cast<int>(team.size()); ++slot) {
+    const Pokemon *pokemon = team.getPokemon(slot);
+    if (pokemon == nullptr) {
+      hashInt(hash, -1);
+      continue;
+    }
+    hashString(hash, pokemon->name);
+    for (int value : {pokemon->hp, pokemon->current_hp, pokemon->attack, pokemon->defense,
+                      pokemon->special_attack, pokemon->special_defense, pokemon->speed,
+                      static_cast<int>(pokemon->status), pokemon->status_turns_remaining,
+                      pokemon->attack_stage, pokemon->defense_stage,
+                      pokemon->special_attack_stage, pokemon->special_defense_stage,
+                      pokemon->speed_stage}) {
+      hashInt(hash, value);
+    }
+    for (const auto &type : pokemon->types) {
+      hashString(hash, type);
+    }
+    for (const auto &move : pokemon->moves) {
+      hashString(hash, move.def().name);
+      hashInt(hash, move.current_pp);
+      if (move.disabled) {
+        hashInt(hash, -1);  // Only when set, so recorded hashes stay valid
+      }
+    }
+  }
+  return hash;
+}
+
+uint64_t BattleReplay::hashTeams(const Team &playerTeam, const Team &opponentTeam) {
+  uint64_t hash = kFnvOffset;
+  for (uint64_t team : {hashTeam(playerTeam), hashTeam(opponentTeam)}) {
+    hashBytes(hash, &team, sizeof(team));
+  }
+  return hash;
+}
+
+void BattleReplay::encode(std::vector<uint8_t> &out) const {
+  out.insert(out.end(), std::begin(kMagic), std::end(kMagic));
+  out.push_back(kVersion);
+  out.push_back(records_draws ? kRecordsDraws : 0);
+  putFixed64(out, seed);
+  putVarint(out, start_draws);
+  putFixed64(out, player_team_hash);
+  putFixed64(out, opponent_team_hash);
+  putSigned(out, start.playerActive);
+  putSigned(out, start.opponentActive);
+  out.push_back(static_cast<uint8_t>(start.weather));
+  putSigned(out, start.weatherTurns);
+
+  putVarint(out, turns.size());
+  uint64_t draws = start_draws;
+  for (const auto &turn : turns) {
+    // Which slots hold an action, then those actions
+    uint8_t present = 0;
+    for (int slot = 0; slot < kSlotCount; ++slot) {
+      if (turn.actions[slot] != kNoAction) {
+        present |= 1 << slot;
+      }
+    }
+    out.push_back(present);
+    for (uint8_t action : turn.actions) {
+      if (action != kNoAction) {
+        out.push_back(action);
+      }
+    }
+    if (records_draws) {
+      putVarint(out, turn.draws - draws);
+      draws = turn.draws;
+    }
+  }
+
+  out.push_back(static_cast<uint8_t>(result));
+  putVarint(out, end_draws);
+  putFixed64(out, end_state_hash);
+}
+
+size_t BattleReplay::decode(const uint8_t *data, size_t size, BattleReplay &replay) {
+  if (size < sizeof(kMagic) + 2 || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+      data[sizeof(kMagic)] != kVersion) {
+    return 0;
+  }
+  Reader reader(data + sizeof(kMagic) + 1, size - sizeof(kMagic) - 1);
+
+  replay = BattleReplay();
+  replay.records_draws = (reader.byte() & kRecordsDraws) != 0;
+  replay.seed = reader.fixed64();
+  replay.start_draws = reader.varint();
+  replay.player_team_hash = reader.fixed64();
+  replay.opponent_team_hash = reader.fixed64();
+  replay.start.playerActive = static_cast<int>(reader.signedVarint());
+  replay.start.opponentActive = static_cast<int>(reader.signedVarint());
+  replay.start.weather = static_cast<WeatherCondition>(reader.byte());
+  replay.start.weatherTurns = static_cast<int>(reader.signedVarint());
+
+  uint64_t turn_count = reader.varint();
+  // Every turn takes at least a byte, which bounds a corrupt count
+  if (!reader.ok() || turn_count > size) {
+    return 0;
+  }
+  replay.turns.reserve(turn_count);
+  uint64_t draws = replay.start_draws;
+  for (uint64_t i = 0; i < turn_count && reader.ok(); ++i) {
+    Turn turn{};
+    turn.actions.fill(kNoAction);
+    uint8_t present = reader.byte();
+    for (int slot = 0; slot < kSlotCount; ++slot) {
+      if ((present & (1 << slot)) != 0) {
+        turn.actions[slot] = reader.byte();
+      }
+    }
+    if (replay.records_draws) {
+      draws += reader.varint();
+      turn.draws = draws;
+    }
+    replay.turns.push_back(turn);
+  }
+
+  uint8_t result = reader.byte();
+  replay.end_draws = reader.varint();
+  replay.end_state_hash = reader.fixed64();
+  if (!reader.ok() || result > static_cast<uint8_t>(Battle::BattleResult::DRAW)) {
+    return 0;
+  }
+  replay.result = static_cast<Battle::BattleResult>(result);
+  return sizeof(kMagic) + 1 + reader.position();
+}
+
+BattleReplay::Verification BattleReplay::verify(const Team &playerTeam,
+                                                 const Team &opponentTeam) const {
+  Verification verification;
+  if (hashTeam(playerTeam) != player_team_hash) {
+    verification.mismatch = "player team differs from the recorded one";
+    return verification;
+  }
+  if (hashTeam(opponentTeam) != opponent_team_hash) {
+    verification.mismatch = "opponent team differs from the recorded one";
+    return verification;
+  }
+
+  Battle battle(playerTeam, opponentTeam);
+  battle.seedRandom(seed, start_draws);
+  battle.setHeadlessStart(start);
+  BattleReplay rerun;
+  rerun.records_draws = records_draws;
+  battle.recordReplay(&rerun);
+
+  // Answer each request with the action recorded for it; the rerun's own
+  // record shows whether the battle asked for the same things
+  auto provider = [this](bool forPlayer) -> Battle::ActionProvider {
+    return [this, forPlayer](const BattleState &state) {
+      size_t turn = static_cast<size_t>(state.turnNumber - 1);
+      int slot = state.aiPokemon->isAlive()
+                     ? (forPlayer ? kPlayerAction : kOpponentAction)
+                     : (forPlayer ? kPlayerReplacement : kOpponentReplacement);
+      uint8_t action = turn < turns.size() ? turns[turn].actions[slot] : kNoAction;
+      return action != kNoAction ? decodeAction(action)
+                                 : Battle::BattleAction{Battle::BattleAction::Type::MOVE, 0};
+    };
+  };
+  verification.outcome =
+      battle.runHeadless(provider(true), provider(false), static_cast<int>(turns.size()));
+
+  size_t common = std::min(turns.size(), rerun.turns.size());
+  for (size_t i = 0; i < common; ++i) {
+    if (turns[i] == rerun.turns[i]) {
+      continue;
+    }
+    verification.mismatch = "turn " + std::to_string(i + 1) + ": ";
+    for (int slot = 0; slot < kSlotCount; ++slot) {
+      if (turns[i].actions[slot] != rerun.turns[i].actions[slot]) {
+        verification.mismatch += std::string(slotName(slot)) + " differs";
+        return verification;
+      }
+    }
+    verification.mismatch += "random draws differ";
+    return verification;
+  }
+  if (turns.size() != rerun.turns.size()) {
+    verification.mismatch = "replay ran " + std::to_string(rerun.turns.size()) +
+                            " turns, recorded " + std::to_string(turns.size());
+  } else if (rerun.result != result) {
+    verification.mismatch = "battle result differs";
+  } else if (rerun.end_draws != end_draws) {
+    verification.mismatch = "random draws differ at the end of the battle";
+  } else if (rerun.end_state_hash != end_state_hash) {
+    verification.mismatch = "teams differ at the end of the battle";
+  }
+  verification.matches = verification.mismatch.empty();
+  return verification;
+}
@@ -0,0 +1,572 @@
+#include "data_pack.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DATA_PACK_HAS_MMAP 1
+#endif
+
+#include "move.h"
+#include "move_type_mapping.h"
+#include "pokemon.h"
+#include "pokemon_data.h"
+
+namespace {
+
+constexpr char kMagic[8] = {'P', 'K', 'M', 'N', 'P', 'A', 'C', 'K'};
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr const char* kPackFileName = "pokedata.pack";
+
+enum Table { kBattlePokemon, kBattleMoves, kCatalogPokemon, kCatalogMoves, kTableCount };
+
+// FNV-1a, 64-bit
+constexpr uint64_t kFnvOffset = 0xCBF29CE484222325ULL;
+constexpr uint64_t kFnvPrime = 0x100000001B3ULL;
+
+uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+template <typename T>
+uint64_t fnv1aValue(uint64_t hash, T value) {
+  return fnv1a(hash, &value, sizeof(value));
+}
+
+// .json files in a directory, sorted by file name
+std::vector<std::filesystem::path> jsonFiles(const std::string& directory) {
+  std::vector<std::filesystem::path> files;
+  for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".json") {
+      files.push_back(entry.path());
+    }
+  }
+  std::sort(files.begin(), files.end(),
+            [](const auto& a, const auto& b) { return a.filename() < b.filename(); });
+  return files;
+}
+
+std::string toLower(std::string text) {
+  std::transform(text.begin(), text.end(), text.begin(), ::tolower);
+  return text;
+}
+
+// Deduplicating string table; offset 0 is the empty string
+class StringTable {
+ public:
+  StringTable() { bytes_.push_back('\0'); }
+
+  uint32_t add(const std::string& text) {
+    if (text.empty()) return 0;
+    auto it = offsets_.find(text);
+    if (it != offsets_.end()) return it->second;
+    auto offset = static_cast<uint32_t>(bytes_.size());
+    bytes_.insert(bytes_.end(), text.begin(), text.end());
+    bytes_.push_back('\0');
+    offsets_.emplace(text, offset);
+    return offset;
+  }
+
+  const std::vector<char>& bytes() const { return bytes_; }
+
+ private:
+  std::vector<char> bytes_;
+  std::unordered_map<std::string, uint32_t> offsets_;
+};
+
+DataPack::PokemonRecord makePokemonRecord(StringTable& strings, const std::string& key,
+                                          const std::string& name,
+                                          const std::vector<std::string>& types, int id,
+                                          int hp, int attack, int defense, int special_attack,
+                                          int special_defense, int speed) {
+  DataPack::PokemonRecord record{};
+  record.key = strings.add(key);
+  record.name = strings.add(name);
+  record.type_count = static_cast<uint16_t>(types.size());
+  for (size_t i = 0; i < types.size(); ++i) record.types[i] = strings.add(types[i]);
+  record.id = static_cast<int16_t>(id);
+  record.hp = static_cast<int16_t>(hp);
+  record.attack = static_cast<int16_t>(attack);
+  record.defense = static_cast<int16_t>(defense);
+  record.special_attack = static_cast<int16_t>(special_attack);
+  record.special_defense = static_cast<int16_t>(special_defense);
+  record.speed = static_cast<int16_t>(speed);
+  return record;
+}
+
+// Records paired with their key, sorted for binary search before writing
+template <typename Record>
+using KeyedRecords = std::vector<std::pair<std::string, Record>>;
+
+template <typename Record>
+void sortByKey(KeyedRecords<Record>& records) {
+  std::sort(records.begin(), records.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+}
+
+}  // namespace
+
+// ──────────────────────────────────────────────────────────────────
+// File layout
+// ──────────────────────────────────────────────────────────────────
+
+// Header, then the four record tables in Table order, then the string table.
+// Offsets are from the start of the file; everything is 4-byte aligned and
+// in the writer's byte order (checked through byte_order).
+struct DataPack::Header {
+  struct Section {
+    uint32_t offset;
+    uint32_t count;  // Records, or bytes for the string table
+  };
+
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t source_checksum;
+  uint64_t payload_checksum;  // Everything after the header
+  uint32_t payload_size;
+  int32_t catalog_loaded;
+  int32_t catalog_failed;
+  uint32_t reserved;
+  Section tables[kTableCount];
+  Section strings;
+};
+
+static_assert(sizeof(DataPack::PokemonRecord) % 4 == 0 && sizeof(DataPack::MoveRecord) % 4 == 0,
+              "Records must keep the tables aligned");
+
+DataPack::~DataPack() { close(); }
+
+// ──────────────────────────────────────────────────────────────────
+// Building
+// ──────────────────────────────────────────────────────────────────
+
+DataPack::BuildResult DataPack::build(const std::string& pokemon_dir,
+                                      const std::string& moves_dir,
+                                      const std::string& pack_path) {
+  uint64_t source_checksum = sourceChecksum(pokemon_dir, moves_dir);
+  if (source_checksum == 0) {
+    return BuildResult(false, "Data directories not found: " + pokemon_dir + ", " + moves_dir);
+  }
+
+  StringTable strings;
+  KeyedRecords<PokemonRecord> tables_pokemon[2];  // Battle, catalog
+  KeyedRecords<MoveRecord> tables_moves[2];
+
+  try {
+    // Battle tables: whatever the constructors' JSON loaders accept
+    for (const auto& path : jsonFiles(pokemon_dir)) {
+      Pokemon pokemon;
+      if (!pokemon.loadFromJson(path.string())) continue;
+      std::string key = path.stem().string();
+      tables_pokemon[0].emplace_back(
+          key, makePokemonRecord(strings, key, pokemon.name, pokemon.types, pokemon.id,
+                                 pokemon.hp, pokemon.attack, pokemon.defense,
+                                 pokemon.special_attack, pokemon.special_defense, pokemon.speed));
+    }
+
+    for (const auto& path : jsonFiles(moves_dir)) {
+      MoveDef move;
+      if (!move.loadFromJson(path.string())) continue;
+      std::string key = path.stem().string();
+      MoveRecord record{};
+      record.key = strings.add(key);
+      record.name = strings.add(move.name);
+      record.damage_class = strings.add(damageClassName(move.damage_class));
+      record.category = strings.add(move.category);
+      record.ailment_name = strings.add(move.ailment_name);
+      record.accuracy = static_cast<int16_t>(move.accuracy);
+      record.effect_chance = static_cast<int16_t>(move.effect_chance);
+      record.pp = static_cast<int16_t>(move.pp);
+      record.priority = static_cast<int16_t>(move.priority);
+      record.power = static_cast<int16_t>(move.power);
+      record.ailment_chance = static_cast<int16_t>(move.ailment_chance);
+      record.crit_rate = static_cast<int16_t>(move.crit_rate);
+      record.drain = static_cast<int16_t>(move.drain);
+      record.flinch_chance = static_cast<int16_t>(move.flinch_chance);
+      record.healing = static_cast<int16_t>(move.healing);
+      record.max_hits = static_cast<int16_t>(move.max_hits);
+      record.max_turns = static_cast<int16_t>(move.max_turns);
+      record.min_hits = static_cast<int16_t>(move.min_hits);
+      record.min_turns = static_cast<int16_t>(move.min_turns);
+      record.stat_chance = static_cast<int16_t>(move.stat_chance);
+      tables_moves[0].emplace_back(key, record);
+    }
+  } catch (const std::filesystem::filesystem_error& e) {
+    return BuildResult(false, "Filesystem error reading data: " + std::string(e.what()));
+  }
+
+  // Catalog tables: whatever PokemonData loads
+  PokemonData catalog;
+  auto catalog_result = catalog.initialize(pokemon_dir, moves_dir);
+  if (!catalog_result.success) {
+    return BuildResult(false, catalog_result.error_message);
+  }
+
+  for (const auto& name : catalog.getAvailablePokemon()) {
+    auto info = catalog.getPokemonInfo(name);
+    if (!info) continue;
+    if (info->types.size() > 2) {
+      return BuildResult(false, "Pokemon has more than two types: " + name);
+    }
+    std::string key = toLower(info->name);
+    tables_pokemon[1].emplace_back(
+        key, makePokemonRecord(strings, key, info->name, info->types, info->id, info->hp,
+                               info->attack, info->defense, info->special_attack,
+                               info->special_defense, info->speed));
+  }
+
+  for (const auto& name : catalog.getAvailableMoves()) {
+    auto info = catalog.getMoveInfo(name);
+    if (!info) continue;
+    std::string key = toLower(info->name);
+    MoveRecord record{};
+    record.key = strings.add(key);
+    record.name = strings.add(info->name);
+    record.type = strings.add(info->type);
+    record.damage_class = strings.add(info->damage_class);
+    record.category = strings.add(info->category);
+    record.ailment_name = strings.add(info->ailment_name);
+    record.accuracy = static_cast<int16_t>(info->accuracy);
+    record.pp = static_cast<int16_t>(info->pp);
+    record.priority = static_cast<int16_t>(info->priority);
+    record.power = static_cast<int16_t>(info->power);
+    record.ailment_chance = static_cast<int16_t>(info->ailment_chance);
+    tables_moves[1].emplace_back(key, record);
+  }
+
+  for (auto& table : tables_pokemon) sortByKey(table);
+  for (auto& table : tables_moves) sortByKey(table);
+
+  // Lay out the file
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.byte_order = kByteOrderMark;
+  header.source_checksum = source_checksum;
+  header.catalog_loaded = catalog_result.loaded_count;
+  header.catalog_failed = catalog_result.failed_count;
+
+  std::vector<uint8_t> file(sizeof(Header));
+  auto appendTable = [&file](Header::Section& section, const auto& records) {
+    using Record = typename std::decay_t<decltype(records)>::value_type::second_type;
+    section.offset = static_cast<uint32_t>(file.size());
+    section.count = static_cast<uint32_t>(records.size());
+    file.resize(file.size() + records.size() * sizeof(Record));
+    auto* out = file.data() + section.offset;
+    for (const auto& keyed : records) {
+      std::memcpy(out, &keyed.second, sizeof(Record));
+      out += sizeof(Record);
+    }
+  };
+  appendTable(header.tables[kBattlePokemon], tables_pokemon[0]);
+  appendTable(header.tables[kBattleMoves], tables_moves[0]);
+  appendTable(header.tables[kCatalogPokemon], tables_pokemon[1]);
+  appendTable(header.tables[kCatalogMoves], tables_moves[1]);
+
+  header.strings.offset = static_cast<uint32_t>(file.size());
+  header.strings.count = static_cast<uint32_t>(strings.bytes().size());
+  file.insert(file.end(), strings.bytes().begin(), strings.bytes().end());
+  file.resize((file.size() + 3) & ~size_t{3}, 0);
+
+  header.payload_size = static_cast<uint32_t>(file.size() - sizeof(Header));
+  header.payload_checksum = fnv1a(kFnvOffset, file.data() + sizeof(Header), header.payload_size);
+  std::memcpy(file.data(), &header, sizeof(Header));
+
+  // Write beside the target and rename over it
+  std::string temp_path = pack_path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+      return BuildResult(false, "Cannot write data pack: " + temp_path);
+    }
+    out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+    if (!out.good()) {
+      out.close();
+      std::remove(temp_path.c_str());
+      return BuildResult(false, "Failed writing data pack: " + temp_path);
+    }
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temp_path, pack_path, error);
+  if (error) {
+    std::remove(temp_path.c_str());
+    return BuildResult(false, "Cannot replace data pack " + pack_path + ": " + error.message());
+  }
+
+  return BuildResult(true, "", static_cast<int>(tables_pokemon[0].size()),
+                     static_cast<int>(tables_moves[0].size()));
+}
+
+bool DataPack::ensureCurrent(const std::string& pokemon_dir, const std::string& moves_dir,
+                             const std::string& pack_path) {
+  {
+    DataPack pack;
+    if (pack.open(pack_path) && pack.isCurrent(pokemon_dir, moves_dir)) return true;
+  }
+
+  auto result = build(pokemon_dir, moves_dir, pack_path);
+  if (!result.success) {
+    std::cerr << "Data pack not built, using JSON data: " << result.error_message << std::endl;
+  }
+  return result.success;
+}
+
+uint64_t DataPack::sourceChecksum(const std::string& pokemon_dir, const std::string& moves_dir) {
+  uint64_t hash = kFnvOffset;
+  try {
+    for (const std::string& directory : {pokemon_dir, moves_dir}) {
+      if (!std::filesystem::is_directory(directory)) return 0;
+      for (const auto& path : jsonFiles(directory)) {
+        std::string file_name = path.filename().string();
+        hash = fnv1a(hash, file_name.data(), file_name.size() + 1);
+        hash = fnv1aValue<uint64_t>(hash, std::filesystem::file_size(path));
+        hash = fnv1aValue<int64_t>(
+            hash, std::filesystem::last_write_time(path).time_since_epoch().count());
+      }
+      hash = fnv1aValue<uint8_t>(hash, 0xFF);  // Directory separator
+    }
+  } catch (const std::filesystem::filesystem_error&) {
+    return 0;
+  }
+  return hash == 0 ? 1 : hash;
+}
+
+std::string DataPack::packPathFor(const std::string& pokemon_dir) {
+  std::filesystem::path directory(pokemon_dir);
+  if (!directory.has_filename()) directory = directory.parent_path();  // Trailing slash
+  return (directory.parent_path() / kPackFileName).string();
+}
+
+namespace {
+
+// The shared pack, opened on first use after start-up or an invalidation
+struct SharedPack {
+  std::mutex mutex;
+  bool opened = false;
+  std::shared_ptr<const DataPack> pack;
+};
+
+SharedPack& sharedPack() {
+  static SharedPack shared;  // Thread-safe static initialisation
+  return shared;
+}
+
+}  // namespace
+
+std::shared_ptr<const DataPack> DataPack::shared() {
+  SharedPack& shared = sharedPack();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  if (!shared.opened) {
+    auto pack = std::make_shared<DataPack>();
+    if (pack->open(kDefaultPath) && pack->isCurrent(kDefaultPokemonDir, kDefaultMovesDir)) {
+      shared.pack = std::move(pack);
+    }
+    shared.opened = true;
+  }
+  return shared.pack;
+}
+
+void DataPack::invalidateShared() {
+  SharedPack& shared = sharedPack();
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  shared.opened = false;
+  shared.pack.reset();
+}
+
+// ──────────────────────────────────────────────────────────────────
+// Reading
+// ──────────────────────────────────────────────────────────────────
+
+bool DataPack::open(const std::string& pack_path) {
+  close();
+
+#ifdef DATA_PACK_HAS_MMAP
+  int fd = ::open(pack_path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  if (::fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(Header))) {
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping != MAP_FAILED) {
+      data_ = static_cast<const uint8_t*>(mapping);
+      size_ = static_cast<size_t>(info.st_size);
+      mapped_ = true;
+    }
+  }
+  ::close(fd);
+#endif
+
+  if (!data_) {
+    std::ifstream in(pack_path, std::ios::binary);
+    if (!in.is_open()) return false;
+    buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    if (buffer_.empty()) return false;
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+  }
+
+  // Validate before anything reads through the tables
+  bool valid = size_ >= sizeof(Header);
+  if (valid) {
+    const Header& h = header();
+    valid = std::memcmp(h.magic, kMagic, sizeof(kMagic)) == 0 && h.version == kVersion &&
+            h.byte_order == kByteOrderMark && h.payload_size == size_ - sizeof(Header) &&
+            h.payload_checksum == fnv1a(kFnvOffset, data_ + sizeof(Header), h.payload_size);
+
+    const size_t record_sizes[kTableCount] = {sizeof(PokemonRecord), sizeof(MoveRecord),
+                                              sizeof(PokemonRecord), sizeof(MoveRecord)};
+    for (int t = 0; valid && t < kTableCount; ++t) {
+      const auto& section = h.tables[t];
+      valid = section.offset % 4 == 0 && section.offset >= sizeof(Header) &&
+              section.offset + static_cast<uint64_t>(section.count) * record_sizes[t] <= size_;
+    }
+    valid = valid && h.strings.count > 0 && h.strings.offset >= sizeof(Header) &&
+            static_cast<uint64_t>(h.strings.offset) + h.strings.count <= size_ &&
+            data_[h.strings.offset + h.strings.count - 1] == '\0';
+  }
+
+  if (!valid) close();
+  return valid;
+}
+
+void DataPack::close() {
+#ifdef DATA_PACK_HAS_MMAP
+  if (mapped_ && data_) ::munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+  mapped_ = false;
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+}
+
+bool DataPack::isCurrent(const std::string& pokemon_dir, const std::string& moves_dir) const {
+  return isOpen() && header().source_checksum == sourceChecksum(pokemon_dir, moves_dir);
+}
+
+const DataPack::Header& DataPack::header() const {
+  return *reinterpret_cast<const Header*>(data_);
+}
+
+const DataPack::PokemonRecord* DataPack::pokemonTable(int table) const {
+  return reinterpret_cast<const PokemonRecord*>(data_ + header().tables[table].offset);
+}
+
+const DataPack::MoveRecord* DataPack::moveTable(int table) const {
+  return reinterpret_cast<const MoveRecord*>(data_ + header().tables[table].offset);
+}
+
+const char* DataPack::string(uint32_t offset) const {
+  const auto& strings = header().strings;
+  if (offset >= strings.count) return "";
+  return reinterpret_cast<const char*>(data_ + strings.offset + offset);
+}
+
+template <typename Record>
+const Record* DataPack::find(const Record* records, size_t count, const std::string& key) const {
+  const Record* end = records + count;
+  const Record* it = std::lower_bound(records, end, key, [this](const Record& record, const std::string& k) {
+    return std::strcmp(string(record.key), k.c_str()) < 0;
+  });
+  return it != end && key == string(it->key) ? it : nullptr;
+}
+
+const DataPack::PokemonRecord* DataPack::findPokemon(const std::string& key) const {
+  if (!isOpen()) return nullptr;
+  return find(pokemonTable(kBattlePokemon), header().tables[kBattlePokemon].count, key);
+}
+
+const DataPack::MoveRecord* DataPack::findMove(const std::string& key) const {
+  if (!isOpen()) return nullptr;
+  return find(moveTable(kBattleMoves), header().tables[kBattleMoves].count, key);
+}
+
+bool DataPack::loadPokemon(const std::string& key, Pokemon& pokemon) const {
+  const PokemonRecord* record = findPokemon(key);
+  if (!record) return false;
+
+  pokemon.name = string(record->name);
+  pokemon.id = record->id;
+  pokemon.types.clear();
+  for (int i = 0; i < record->type_count && i < 2; ++i) {
+    pokemon.types.emplace_back(string(record->types[i]));
+  }
+  pokemon.hp = record->hp;
+  pokemon.current_hp = record->hp;
+  pokemon.attack = record->attack;
+  pokemon.defense = record->defense;
+  pokemon.special_attack = record->special_attack;
+  pokemon.special_defense = record->special_defense;
+  pokemon.speed = record->speed;
+  pokemon.fainted = false;
+  return true;
+}
+
+bool DataPack::loadMove(const std::string& key, MoveDef& move) const {
+  const MoveRecord* record = findMove(key);
+  if (!record) return false;
+
+  move.name = string(record->name);
+  move.accuracy = record->accuracy;
+  move.effect_chance = record->effect_chance;
+  move.pp = record->pp;
+  move.priority = record->priority;
+  move.power = record->power;
+  parseDamageClass(string(record->damage_class), move.damage_class);
+  move.type = MoveTypeMapping::getMoveType(move.name);
+  move.type_id = parsePokemonType(move.type);
+  move.ailment_name = string(record->ailment_name);
+  move.ailment_id = parseMoveAilment(move.ailment_name);
+  move.ailment_chance = record->ailment_chance;
+  move.category = string(record->category);
+  move.category_id = parseMoveCategory(move.category);
+  move.crit_rate = record->crit_rate;
+  move.drain = record->drain;
+  move.flinch_chance = record->flinch_chance;
+  move.healing = record->healing;
+  move.max_hits = record->max_hits;
+  move.max_turns = record->max_turns;
+  move.min_hits = record->min_hits;
+  move.min_turns = record->min_turns;
+  move.stat_chance = record->stat_chance;
+  move.configureMultiTurnBehavior();
+  return true;
+}
+
+size_t DataPack::catalogPokemonCount() const {
+  return isOpen() ? header().tables[kCatalogPokemon].count : 0;
+}
+
+const DataPack::PokemonRecord& DataPack::catalogPokemon(size_t index) const {
+  return pokemonTable(kCatalogPokemon)[index];
+}
+
+size_t DataPack::catalogMoveCount() const {
+  return isOpen() ? header().tables[kCatalogMoves].count : 0;
+}
+
+const DataPack::MoveRecord& DataPack::catalogMove(size_t index) const {
+  return moveTable(kCatalogMoves)[index];
+}
+
+int DataPack::catalogLoadedCount() const { return isOpen() ? header().catalog_loaded : 0; }
+
+int DataPack::catalogFailedCount() const { return isOpen() ? header().catalog_failed : 0; }
@@ -0,0 +1,201 @@
+#include "data_registry.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+
+#include "data_pack.h"
+#include "input_validator.h"
+#include "pokemon_data.h"
+
+namespace {
+
+// Data file names without extension, sorted
+std::vector<std::string> dataFileNames(const std::string& directory) {
+  std::vector<std::string> names;
+  std::error_code error;
+  if (!std::filesystem::is_directory(directory, error)) return names;
+  for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+    if (entry.is_regular_file() && entry.path().extension() == ".json") {
+      names.push_back(entry.path().stem().string());
+    }
+  }
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+}  // namespace
+
+DataRegistry& DataRegistry::instance() {
+  static DataRegistry registry;  // Thread-safe static initialisation
+  return registry;
+}
+
+DataRegistry::SourceStamp DataRegistry::stamp(const char* data_type, const std::string& name) {
+  SourceStamp result;
+  auto path = InputValidator::validateDataFilePath(name, data_type, ".json");
+  if (!path.isValid()) return result;
+  std::ifstream file(path.value, std::ios::binary);
+  if (!file.is_open()) return result;
+  std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (file.bad()) return result;
+  result.exists = true;
+  result.size = contents.size();
+  result.hash = PokemonData::contentHash(contents);
+  return result;
+}
+
+template <typename T>
+DataRegistry::Handle DataRegistry::intern(Table<T>& table, const std::string& name) {
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = table.by_name.find(name);
+    if (it != table.by_name.end()) return it->second;
+  }
+
+  // Load outside the lock; if another thread interned the name meanwhile,
+  // its entry wins and this copy is dropped. The file is stamped first, so
+  // a change during the load is still seen by the next reload()
+  auto source = stamp(table.data_type, name);
+  auto entry = std::make_unique<T>();
+  if (!entry->loadFromData(name)) return kNoHandle;
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto it = table.by_name.find(name);
+  if (it != table.by_name.end()) return it->second;
+  return install(table, name, std::move(entry), source);
+}
+
+template <typename T>
+DataRegistry::Handle DataRegistry::install(Table<T>& table, const std::string& name,
+                                           std::unique_ptr<T> entry, const SourceStamp& source) {
+  auto handle = static_cast<Handle>(table.entries.size());
+  if constexpr (std::is_same<T, Pokemon>::value) {
+    species_by_id_[entry->id] = handle;
+  }
+  table.entries.push_back(std::move(entry));
+  table.stamps.push_back(source);
+  table.by_name[name] = handle;
+  return handle;
+}
+
+template <typename T>
+size_t DataRegistry::reload(Table<T>& table) {
+  // Which current entries are out of date; files are checked without the lock
+  std::vector<std::pair<std::string, SourceStamp>> current;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    current.reserve(table.by_name.size());
+    for (const auto& [name, handle] : table.by_name) {
+      current.emplace_back(name, table.stamps[static_cast<size_t>(handle)]);
+    }
+  }
+
+  size_t changed = 0;
+  for (const auto& [name, old_stamp] : current) {
+    auto source = stamp(table.data_type, name);
+    if (source == old_stamp) continue;
+
+    auto entry = std::make_unique<T>();
+    bool loaded = source.exists && entry->loadFromData(name);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (loaded) {
+      install(table, name, std::move(entry), source);
+    } else {
+      // Gone or no longer valid: the next lookup tries (and reports) again
+      auto it = table.by_name.find(name);
+      if constexpr (std::is_same<T, Pokemon>::value) {
+        auto by_id = species_by_id_.find(table.entries[static_cast<size_t>(it->second)]->id);
+        if (by_id != species_by_id_.end() && by_id->second == it->second) {
+          species_by_id_.erase(by_id);
+        }
+      }
+      table.by_name.erase(it);
+    }
+    ++changed;
+  }
+  return changed;
+}
+
+DataRegistry::Handle DataRegistry::speciesHandle(const std::string& name) {
+  return intern(species_, name);
+}
+
+DataRegistry::Handle DataRegistry::moveHandle(const std::string& name) {
+  return intern(moves_, name);
+}
+
+DataRegistry::Handle DataRegistry::speciesHandleById(int id) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto it = species_by_id_.find(id);
+  return it == species_by_id_.end() ? kNoHandle : it->second;
+}
+
+const Pokemon& DataRegistry::species(Handle handle) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return *species_.entries[static_cast<size_t>(handle)];
+}
+
+const MoveDef& DataRegistry::moveDef(Handle handle) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return *moves_.entries[static_cast<size_t>(handle)];
+}
+
+const MoveDef& DataRegistry::intern(const MoveDef& def) {
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto range = custom_moves_.equal_range(def.name);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (*it->second == def) return *it->second;
+    }
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  auto range = custom_moves_.equal_range(def.name);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (*it->second == def) return *it->second;
+  }
+  auto stored = std::make_unique<MoveDef>(def);
+  stored->type_id = parsePokemonType(stored->type);
+  stored->ailment_id = parseMoveAilment(stored->ailment_name);
+  stored->category_id = parseMoveCategory(stored->category);
+  auto it = custom_moves_.emplace(def.name, std::move(stored));
+  return *it->second;
+}
+
+size_t DataRegistry::preload() {
+  for (const auto& name : dataFileNames(DataPack::kDefaultPokemonDir)) speciesHandle(name);
+  for (const auto& name : dataFileNames(DataPack::kDefaultMovesDir)) moveHandle(name);
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return species_.by_name.size() + moves_.by_name.size();
+}
+
+size_t DataRegistry::reload() {
+  std::lock_guard<std::mutex> reload_lock(reload_mutex_);
+  // Changed files make the pack stale; reopening it sends loads to JSON
+  DataPack::invalidateShared();
+  size_t changed = reload(species_) + reload(moves_);
+  if (changed > 0) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    ++generation_;
+  }
+  return changed;
+}
+
+uint64_t DataRegistry::generation() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return generation_;
+}
+
+size_t DataRegistry::speciesCount() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return species_.entries.size();
+}
+
+size_t DataRegistry::moveCount() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return moves_.entries.size();
+}
@@ -0,0 +1,507 @@
+#include "data_schema.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "json.hpp"
+#include "move.h"
+
+using json = nlohmann::json;
+
+namespace {
+
+enum class Kind : uint8_t { kObject, kInteger, kString, kStringList };
+
+// What a missing or null value means
+enum class Presence : uint8_t {
+  kRequired,  // Missing is an error, as is null
+  kDefault,   // Missing means the fallback; null is an error
+  kNullable   // Missing or null means the fallback
+};
+
+template <typename Record>
+struct FieldRule {
+  const char *name;
+  int parent;  // Index of the enclosing object rule; -1 for the document
+  Kind kind;
+  Presence presence;
+  int min;  // Value range; the length for strings, the size for lists
+  int max;
+  int fallback;
+  const std::string_view *allowed;  // Permitted strings; nullptr for any
+  size_t allowed_count;
+  int Record::*integer;
+  std::string Record::*text;
+  std::vector<std::string> Record::*list;
+  bool (*convert)(const std::string &, Record &);  // Strings parsed into other members
+};
+
+template <typename Record>
+constexpr FieldRule<Record> objectField(const char *name, int parent) {
+  return {name,    parent,  Kind::kObject, Presence::kRequired, 0, 0, 0, nullptr, 0,
+          nullptr, nullptr, nullptr,       nullptr};
+}
+
+template <typename Record>
+constexpr FieldRule<Record> intField(const char *name, int parent, int Record::*member, int min,
+                                     int max, Presence presence = Presence::kRequired,
+                                     int fallback = 0) {
+  return {name,   parent,  Kind::kInteger, presence, min, max, fallback, nullptr, 0,
+          member, nullptr, nullptr,        nullptr};
+}
+
+template <typename Record>
+constexpr FieldRule<Record> stringField(const char *name, int parent, std::string Record::*member,
+                                        int min, int max) {
+  return {name,    parent, Kind::kString, Presence::kRequired, min, max, 0, nullptr, 0,
+          nullptr, member, nullptr,       nullptr};
+}
+
+template <typename Record, size_t N>
+constexpr FieldRule<Record> stringField(const char *name, int parent, std::string Record::*member,
+                                        int min, int max, const std::string_view (&allowed)[N]) {
+  return {name,    parent, Kind::kString, Presence::kRequired, min, max, 0, allowed, N,
+          nullptr, member, nullptr,       nullptr};
+}
+
+template <typename Record, size_t N>
+constexpr FieldRule<Record> convertedField(const char *name, int parent,
+                                           bool (*convert)(const std::string &, Record &), int min,
+                                           int max, const std::string_view (&allowed)[N]) {
+  return {name,    parent,  Kind::kString, Presence::kRequired, min, max, 0, allowed, N,
+          nullptr, nullptr, nullptr,       convert};
+}
+
+template <typename Record>
+constexpr FieldRule<Record> convertedField(const char *name, int parent,
+                                           bool (*convert)(const std::string &, Record &), int min,
+                                           int max) {
+  return {name,    parent,  Kind::kString, Presence::kRequired, min, max, 0, nullptr, 0,
+          nullptr, nullptr, nullptr,       convert};
+}
+
+template <typename Record, size_t N>
+constexpr FieldRule<Record> listField(const char *name, int parent,
+                                      std::vector<std::string> Record::*member, int min, int max,
+                                      const std::string_view (&allowed)[N]) {
+  return {name,    parent,  Kind::kStringList, Presence::kRequired, min, max, 0, allowed, N,
+          nullptr, nullptr, member,            nullptr};
+}
+
+template <typename Record, size_t N>
+constexpr bool parentsAreEarlierObjects(const FieldRule<Record> (&rules)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    int parent = rules[i].parent;
+    if (parent >= static_cast<int>(i) ||
+        (parent >= 0 && rules[parent].kind != Kind::kObject)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Move files
+
+constexpr std::string_view kDamageClasses[] = {"physical", "special", "status"};
+constexpr std::string_view kAilments[] = {"none",      "poison",  "burn",    "paralysis", "sleep",
+                                          "freeze",    "confusion", "heal",  "disable",   "yawn",
+                                          "nightmare", "swagger", "trap"};
+
+bool setDamageClass(const std::string &name, MoveDef &move) {
+  return parseDamageClass(name, move.damage_class);
+}
+
+// The ailment and category keep their names and are parsed once here, so
+// battle code compares enums
+bool setAilment(const std::string &name, MoveDef &move) {
+  move.ailment_name = name;
+  move.ailment_id = parseMoveAilment(name);
+  return true;
+}
+
+bool setCategory(const std::string &name, MoveDef &move) {
+  move.category = name;
+  move.category_id = parseMoveCategory(name);
+  return true;
+}
+
+constexpr int kDamageClassObject = 6;
+constexpr int kInfoObject = 8;
+constexpr int kAilmentObject = 9;
+constexpr int kCategoryObject = 12;
+
+constexpr FieldRule<MoveDef> kMoveRules[] = {
+    stringField("name", -1, &MoveDef::name, 1, 50),
+    intField("accuracy", -1, &MoveDef::accuracy, 0, 100, Presence::kNullable, 100),
+    intField("effect_chance", -1, &MoveDef::effect_chance, 0, 100, Presence::kNullable, -1),
+    intField("pp", -1, &MoveDef::pp, 1, 40),
+    intField("priority", -1, &MoveDef::priority, -7, 5, Presence::kDefault, 0),
+    intField("power", -1, &MoveDef::power, 0, 250, Presence::kNullable, -1),
+    objectField<MoveDef>("damage_class", -1),
+    convertedField("name", kDamageClassObject, &setDamageClass, 1, 20, kDamageClasses),
+    objectField<MoveDef>("Info", -1),
+    objectField<MoveDef>("ailment", kInfoObject),
+    convertedField("name", kAilmentObject, &setAilment, 1, 20, kAilments),
+    intField("ailment_chance", kInfoObject, &MoveDef::ailment_chance, 0, 100, Presence::kDefault, 0),
+    objectField<MoveDef>("category", kInfoObject),
+    convertedField("name", kCategoryObject, &setCategory, 1, 30),
+    intField("crit_rate", kInfoObject, &MoveDef::crit_rate, 0, 5, Presence::kDefault, 0),
+    intField("drain", kInfoObject, &MoveDef::drain, -100, 100, Presence::kDefault, 0),
+    intField("flinch_chance", kInfoObject, &MoveDef::flinch_chance, 0, 100, Presence::kDefault, 0),
+    intField("healing", kInfoObject, &MoveDef::healing, -100, 100, Presence::kDefault, 0),
+    intField("max_hits", kInfoObject, &MoveDef::max_hits, 1, 10, Presence::kNullable, 1),
+    intField("max_turns", kInfoObject, &MoveDef::max_turns, 1, 10, Presence::kNullable, 1),
+    intField("min_hits", kInfoObject, &MoveDef::min_hits, 1, 10, Presence::kNullable, 1),
+    intField("min_turns", kInfoObject, &MoveDef::min_turns, 1, 10, Presence::kNullable, 1),
+    intField("stat_chance", kInfoObject, &MoveDef::stat_chance, 0, 100),
+};
+
+static_assert(parentsAreEarlierObjects(kMoveRules), "Move rule parents must be earlier objects");
+
+// Species files
+
+// The types species files have always been checked against
+constexpr std::string_view kSpeciesTypes[] = {
+    "bug",   "dragon", "electric", "fairy",  "fighting", "fire",   "flying", "ghost",
+    "grass", "ground", "ice",      "normal", "poison",   "psychic", "rock",  "water"};
+
+constexpr int kBaseStatsObject = 3;
+
+constexpr FieldRule<SpeciesRecord> kSpeciesRules[] = {
+    stringField("name", -1, &SpeciesRecord::name, 1, 50),
+    intField("id", -1, &SpeciesRecord::id, 1, 999),
+    listField("types", -1, &SpeciesRecord::types, 1, 2, kSpeciesTypes),
+    objectField<SpeciesRecord>("base_stats", -1),
+    intField("hp", kBaseStatsObject, &SpeciesRecord::hp, 1, 255),
+    intField("attack", kBaseStatsObject, &SpeciesRecord::attack, 1, 255),
+    intField("defense", kBaseStatsObject, &SpeciesRecord::defense, 1, 255),
+    intField("special-attack", kBaseStatsObject, &SpeciesRecord::special_attack, 1, 255),
+    intField("special-defense", kBaseStatsObject, &SpeciesRecord::special_defense, 1, 255),
+    intField("speed", kBaseStatsObject, &SpeciesRecord::speed, 1, 255),
+};
+
+static_assert(parentsAreEarlierObjects(kSpeciesRules),
+              "Species rule parents must be earlier objects");
+
+// SAX handler for one record: routes each value to the slot of the rule at
+// its path and skips everything else without storing it
+template <typename Record>
+class RecordReader {
+ public:
+  static constexpr size_t kMaxRules = 32;
+
+  RecordReader(const FieldRule<Record> *rules, size_t rule_count)
+      : rules_(rules), rule_count_(rule_count) {}
+
+  bool null() { return scalar(Slot::kNull); }
+  bool boolean(bool) { return scalar(Slot::kOther); }
+  bool number_integer(json::number_integer_t value) { return scalar(Slot::kInteger, value); }
+  bool number_unsigned(json::number_unsigned_t value) {
+    constexpr auto kMax = static_cast<json::number_unsigned_t>(std::numeric_limits<int64_t>::max());
+    return scalar(Slot::kInteger, static_cast<int64_t>(value < kMax ? value : kMax));
+  }
+  bool number_float(json::number_float_t, const json::string_t &) {
+    return scalar(Slot::kOther);
+  }
+  bool string(json::string_t &value) { return scalar(Slot::kString, 0, &value); }
+  bool binary(json::binary_t &) { return scalar(Slot::kOther); }
+
+  bool start_object(size_t) { return startContainer(Kind::kObject); }
+  bool start_array(size_t) { return startContainer(Kind::kStringList); }
+  bool end_object() { return endContainer(); }
+  bool end_array() { return endContainer(); }
+
+  bool key(json::string_t &name) {
+    if (skip_depth_ > 0) {
+      return true;
+    }
+    int parent = frames_[depth_ - 1].rule;
+    pending_ = kSkipped;
+    for (size_t i = 0; i < rule_count_; ++i) {
+      if (rules_[i].parent == parent && name == rules_[i].name) {
+        pending_ = static_cast<int>(i);
+        // A repeated key replaces the earlier value and everything under it
+        if (slots_[i].state != Slot::kMissing) {
+          clear(pending_);
+        }
+        break;
+      }
+    }
+    return true;
+  }
+
+  bool parse_error(size_t, const std::string &, const json::exception &error) {
+    parse_error_ = error.what();
+    return false;
+  }
+
+  const std::string &parseError() const { return parse_error_; }
+
+  // Applies every rule whose enclosing objects are present
+  bool validate(Record &record, std::vector<SchemaError> &errors);
+
+ private:
+  static constexpr int kSkipped = -2;
+
+  struct Slot {
+    enum State : uint8_t { kMissing, kNull, kInteger, kString, kObject, kArray, kOther };
+    State state = kMissing;
+    int64_t integer = 0;
+    std::string text;
+    std::vector<std::string> items;  // String list elements
+    bool bad_item = false;           // A list element wasn't a string
+  };
+
+  struct Frame {
+    int rule;  // -1 for the document
+    bool is_list;
+  };
+
+  bool scalar(typename Slot::State state, int64_t integer = 0, json::string_t *text = nullptr) {
+    if (skip_depth_ > 0 || depth_ == 0) {
+      return true;
+    }
+    const Frame &top = frames_[depth_ - 1];
+    if (top.is_list) {
+      Slot &list = slots_[top.rule];
+      if (state == Slot::kString) {
+        list.items.push_back(std::move(*text));
+      } else {
+        list.bad_item = true;
+      }
+      return true;
+    }
+    if (pending_ == kSkipped) {
+      return true;
+    }
+    Slot &slot = slots_[pending_];
+    slot.state = state;
+    slot.integer = integer;
+    if (text != nullptr) {
+      slot.text = std::move(*text);
+    }
+    return true;
+  }
+
+  bool startContainer(Kind kind) {
+    if (skip_depth_ > 0) {
+      ++skip_depth_;
+      return true;
+    }
+    if (depth_ == 0) {
+      document_is_object_ = kind == Kind::kObject;
+      if (!document_is_object_) {
+        ++skip_depth_;
+        return true;
+      }
+      frames_[depth_++] = {-1, false};
+      return true;
+    }
+
+    const Frame &top = frames_[depth_ - 1];
+    if (top.is_list) {
+      slots_[top.rule].bad_item = true;
+      ++skip_depth_;
+      return true;
+    }
+    if (pending_ == kSkipped) {
+      ++skip_depth_;
+      return true;
+    }
+    Slot &slot = slots_[pending_];
+    if (rules_[pending_].kind != kind || depth_ == frames_.size()) {
+      slot.state = kind == Kind::kObject ? Slot::kObject : Slot::kArray;
+      ++skip_depth_;
+      return true;
+    }
+    slot.state = kind == Kind::kObject ? Slot::kObject : Slot::kArray;
+    slot.items.clear();
+    slot.bad_item = false;
+    frames_[depth_++] = {pending_, kind == Kind::kStringList};
+    return true;
+  }
+
+  bool endContainer() {
+    if (skip_depth_ > 0) {
+      --skip_depth_;
+    } else {
+      --depth_;
+    }
+    return true;
+  }
+
+  void clear(int rule) {
+    slots_[rule] = Slot();
+    for (size_t i = rule + 1; i < rule_count_; ++i) {
+      for (int ancestor = rules_[i].parent; ancestor >= 0; ancestor = rules_[ancestor].parent) {
+        if (ancestor == rule) {
+          slots_[i] = Slot();
+          break;
+        }
+      }
+    }
+  }
+
+  std::string path(size_t rule) const {
+    std::string result = rules_[rule].name;
+    for (int parent = rules_[rule].parent; parent >= 0; parent = rules_[parent].parent) {
+      result = std::string(rules_[parent].name) + "." + result;
+    }
+    return result;
+  }
+
+  bool isAllowed(const FieldRule<Record> &rule, const std::string &value) const {
+    if (rule.allowed == nullptr) {
+      return true;
+    }
+    for (size_t i = 0; i < rule.allowed_count; ++i) {
+      if (rule.allowed[i] == value) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const FieldRule<Record> *rules_;
+  size_t rule_count_;
+  std::array<Slot, kMaxRules> slots_;
+  std::array<Frame, 8> frames_{};
+  size_t depth_ = 0;
+  int skip_depth_ = 0;  // Nesting inside a container that no rule covers
+  int pending_ = kSkipped;  // Rule for the value after the last key
+  bool document_is_object_ = false;
+  std::string parse_error_;
+};
+
+template <typename Record>
+bool RecordReader<Record>::validate(Record &record, std::vector<SchemaError> &errors) {
+  if (!document_is_object_) {
+    errors.push_back({"", "expected an object"});
+    return false;
+  }
+
+  const size_t first_error = errors.size();
+  std::array<bool, kMaxRules> present{};  // Object rules found as objects
+  auto range = [](const FieldRule<Record> &rule) {
+    return " is out of range [" + std::to_string(rule.min) + ", " + std::to_string(rule.max) + "]";
+  };
+
+  for (size_t i = 0; i < rule_count_; ++i) {
+    const auto &rule = rules_[i];
+    if (rule.parent >= 0 && !present[rule.parent]) {
+      continue;
+    }
+    Slot &slot = slots_[i];
+    auto fail = [&](const std::string &message) { errors.push_back({path(i), message}); };
+
+    switch (rule.kind) {
+      case Kind::kObject:
+        if (slot.state == Slot::kObject) {
+          present[i] = true;
+        } else {
+          fail(slot.state == Slot::kMissing ? "is missing" : "expected an object");
+        }
+        break;
+
+      case Kind::kInteger: {
+        bool use_fallback =
+            (slot.state == Slot::kMissing && rule.presence != Presence::kRequired) ||
+            (slot.state == Slot::kNull && rule.presence == Presence::kNullable);
+        if (slot.state == Slot::kInteger) {
+          if (slot.integer < rule.min || slot.integer > rule.max) {
+            fail("value " + std::to_string(slot.integer) + range(rule));
+            break;
+          }
+          record.*rule.integer = static_cast<int>(slot.integer);
+        } else if (use_fallback) {
+          record.*rule.integer = rule.fallback;
+        } else {
+          fail(slot.state == Slot::kMissing ? "is missing" : "expected an integer");
+        }
+        break;
+      }
+
+      case Kind::kString: {
+        if (slot.state != Slot::kString) {
+          fail(slot.state == Slot::kMissing ? "is missing" : "expected a string");
+          break;
+        }
+        auto length = static_cast<int64_t>(slot.text.size());
+        if (length < rule.min || length > rule.max) {
+          fail("length " + std::to_string(length) + range(rule));
+          break;
+        }
+        if (!isAllowed(rule, slot.text) ||
+            (rule.convert != nullptr && !rule.convert(slot.text, record))) {
+          fail("'" + slot.text + "' is not an allowed value");
+          break;
+        }
+        if (rule.text != nullptr) {
+          record.*rule.text = std::move(slot.text);
+        }
+        break;
+      }
+
+      case Kind::kStringList: {
+        if (slot.state != Slot::kArray) {
+          fail(slot.state == Slot::kMissing ? "is missing" : "expected an array");
+          break;
+        }
+        auto size = static_cast<int64_t>(slot.items.size());
+        if (size < rule.min || size > rule.max) {
+          fail("size " + std::to_string(size) + range(rule));
+          break;
+        }
+        if (slot.bad_item) {
+          fail("expected an array of strings");
+          break;
+        }
+        bool allowed = true;
+        for (const auto &item : slot.items) {
+          if (!isAllowed(rule, item)) {
+            fail("'" + item + "' is not an allowed value");
+            allowed = false;
+            break;
+          }
+        }
+        if (allowed) {
+          record.*rule.list = std::move(slot.items);
+        }
+        break;
+      }
+    }
+  }
+  return errors.size() == first_error;
+}
+
+template <typename Record, size_t N>
+bool parseRecord(std::string_view text, const FieldRule<Record> (&rules)[N], Record &record,
+                 std::vector<SchemaError> &errors) {
+  static_assert(N <= RecordReader<Record>::kMaxRules, "Too many rules for one record");
+  RecordReader<Record> reader(rules, N);
+  // Not strict, like operator>>: text after the first value is ignored
+  if (!json::sax_parse(text.data(), text.data() + text.size(), &reader,
+                       json::input_format_t::json, false)) {
+    errors.push_back({"", reader.parseError()});
+    return false;
+  }
+  return reader.validate(record, errors);
+}
+
+}  // namespace
+
+std::string SchemaError::describe() const {
+  return field.empty() ? message : field + ": " + message;
+}
+
+bool DataSchema::parseMove(std::string_view text, MoveDef &move,
+                           std::vector<SchemaError> &errors) {
+  return parseRecord(text, kMoveRules, move, errors);
+}
+
+bool DataSchema::parseSpecies(std::string_view text, SpeciesRecord &species,
+                              std::vector<SchemaError> &errors) {
+  return parseRecord(text, kSpeciesRules, species, errors);
+}
@@ -1,268 +1,136 @@
 #include "move.h"
 
 #include <algorithm>
-#include <set>
+#include <filesystem>
+#include <iterator>
 
+#include "data_pack.h"
+#include "data_registry.h"
+#include "data_schema.h"
 #include "move_type_mapping.h"
 #include "pokemon.h"
 #include "input_validator.h"
 
-using json = nlohmann::json;
+namespace {
 
-Move::Move(const std::string &moveName) {
-  // Secure file path validation and construction
-  auto pathResult = InputValidator::validateDataFilePath(moveName, "moves", ".json");
-  if (!pathResult.isValid()) {
-    std::cerr << "Move loading failed - " << pathResult.errorMessage << std::endl;
-    return;
-  }
-  
-  loadFromJson(pathResult.value);
+// Definition of default-constructed moves
+const MoveDef& emptyDef() {
+  static const MoveDef def;
+  return def;
 }
 
-void Move::loadFromJson(const std::string &file_path) {
-  // Additional security validation for the file path
-  auto accessValidation = InputValidator::validateFileAccessibility(file_path);
-  if (!accessValidation.isValid()) {
-    std::cerr << "Move file accessibility check failed: " << accessValidation.errorMessage << std::endl;
-    return;
-  }
-
-  auto file = std::ifstream(file_path);
-  if (!file.is_open()) {
-    std::cerr << "Error opening file: " << file_path << std::endl;
-    return;
-  }
-
-  auto move_json = json{};
-  try {
-    file >> move_json;
-  } catch (const json::parse_error& e) {
-    std::cerr << "JSON parse error in " << file_path << ": " << e.what() << std::endl;
-    return;
-  }
-
-  // Define valid damage classes for validation
-  static const std::set<std::string> validDamageClasses = {
-    "physical", "special", "status"
-  };
-
-  // Define valid ailment names for validation
-  static const std::set<std::string> validAilments = {
-    "none", "poison", "burn", "paralysis", "sleep", "freeze", 
-    "confusion", "heal", "disable", "yawn", "nightmare", "swagger", "trap"
-  };
-
-  // Validate and extract name (1-50 characters, allowing hyphens for move names)
-  auto nameResult = InputValidator::getJsonString(move_json, "name", 1, 50);
-  if (!nameResult.isValid()) {
-    std::cerr << "Move name validation failed: " << nameResult.errorMessage << std::endl;
-    return;
-  }
-  name = nameResult.value;
-
-  // Handle accuracy field (can be null for moves that always hit)
-  if (move_json["accuracy"].is_null()) {
-    accuracy = 100;  // Default for moves that always hit
-  } else {
-    auto accuracyResult = InputValidator::getJsonInt(move_json, "accuracy", 0, 100);
-    if (!accuracyResult.isValid()) {
-      std::cerr << "Move accuracy validation failed: " << accuracyResult.errorMessage << std::endl;
-      return;
-    }
-    accuracy = accuracyResult.value;
-  }
-
-  // Handle effect_chance field (can be null for moves with no effect chance)
-  if (move_json["effect_chance"].is_null()) {
-    effect_chance = -1;  // No effect chance
-  } else {
-    auto effectChanceResult = InputValidator::getJsonInt(move_json, "effect_chance", 0, 100);
-    if (!effectChanceResult.isValid()) {
-      std::cerr << "Move effect_chance validation failed: " << effectChanceResult.errorMessage << std::endl;
-      return;
-    }
-    effect_chance = effectChanceResult.value;
-  }
+}  // namespace
 
-  // Validate and extract PP (1-40 typical range)
-  auto ppResult = InputValidator::getJsonInt(move_json, "pp", 1, 40);
-  if (!ppResult.isValid()) {
-    std::cerr << "Move PP validation failed: " << ppResult.errorMessage << std::endl;
-    return;
+const char* damageClassName(DamageClass damage_class) {
+  switch (damage_class) {
+    case DamageClass::PHYSICAL: return "physical";
+    case DamageClass::SPECIAL: return "special";
+    case DamageClass::STATUS: return "status";
   }
-  pp = ppResult.value;
-  current_pp = pp;  // Initialize current PP to maximum PP
-
-  // Validate and extract priority (-7 to +5 typical range for move priority)
-  auto priorityResult = InputValidator::getJsonInt(move_json, "priority", -7, 5, 0);
-  if (!priorityResult.isValid()) {
-    std::cerr << "Move priority validation failed: " << priorityResult.errorMessage << std::endl;
-    return;
-  }
-  priority = priorityResult.value;
+  return "physical";
+}
 
-  // Handle power field (can be null for status moves)
-  if (move_json["power"].is_null()) {
-    power = -1;  // Status moves have no power
+bool parseDamageClass(const std::string& name, DamageClass& damage_class) {
+  if (name == "physical") {
+    damage_class = DamageClass::PHYSICAL;
+  } else if (name == "special") {
+    damage_class = DamageClass::SPECIAL;
+  } else if (name == "status") {
+    damage_class = DamageClass::STATUS;
   } else {
-    auto powerResult = InputValidator::getJsonInt(move_json, "power", 0, 250);
-    if (!powerResult.isValid()) {
-      std::cerr << "Move power validation failed: " << powerResult.errorMessage << std::endl;
-      return;
-    }
-    power = powerResult.value;
-  }
-
-  // Validate damage_class nested object
-  if (move_json.find("damage_class") == move_json.end() || !move_json["damage_class"].is_object()) {
-    std::cerr << "Move damage_class field missing or invalid in " << file_path << std::endl;
-    return;
-  }
-
-  auto damageClassResult = InputValidator::getJsonString(move_json["damage_class"], "name", 1, 20);
-  if (!damageClassResult.isValid()) {
-    std::cerr << "Move damage_class name validation failed: " << damageClassResult.errorMessage << std::endl;
-    return;
-  }
-
-  if (validDamageClasses.find(damageClassResult.value) == validDamageClasses.end()) {
-    std::cerr << "Invalid damage class '" << damageClassResult.value << "' in " << file_path << std::endl;
-    return;
-  }
-  damage_class = damageClassResult.value;
-
-  // Get move type from mapping (this provides additional validation)
-  type = MoveTypeMapping::getMoveType(name);
-
-  // Validate Info object exists
-  if (move_json.find("Info") == move_json.end() || !move_json["Info"].is_object()) {
-    std::cerr << "Move Info field missing or invalid in " << file_path << std::endl;
-    return;
-  }
-
-  const auto& info = move_json["Info"];
-
-  // Validate ailment nested object
-  if (info.find("ailment") == info.end() || !info["ailment"].is_object()) {
-    std::cerr << "Move ailment field missing or invalid in " << file_path << std::endl;
-    return;
+    return false;
   }
+  return true;
+}
 
-  auto ailmentResult = InputValidator::getJsonString(info["ailment"], "name", 1, 20);
-  if (!ailmentResult.isValid()) {
-    std::cerr << "Move ailment name validation failed: " << ailmentResult.errorMessage << std::endl;
-    return;
-  }
+MoveAilment parseMoveAilment(const std::string& name) {
+  if (name == "none") return MoveAilment::NONE;
+  if (name == "poison") return MoveAilment::POISON;
+  if (name == "burn") return MoveAilment::BURN;
+  if (name == "paralysis") return MoveAilment::PARALYSIS;
+  if (name == "sleep") return MoveAilment::SLEEP;
+  if (name == "freeze") return MoveAilment::FREEZE;
+  return MoveAilment::OTHER;
+}
 
-  if (validAilments.find(ailmentResult.value) == validAilments.end()) {
-    std::cerr << "Invalid ailment '" << ailmentResult.value << "' in " << file_path << std::endl;
-    return;
-  }
-  ailment_name = ailmentResult.value;
+MoveCategory parseMoveCategory(const std::string& name) {
+  if (name == "damage") return MoveCategory::DAMAGE;
+  if (name == "ailment") return MoveCategory::AILMENT;
+  if (name == "net-good-stats") return MoveCategory::NET_GOOD_STATS;
+  if (name == "ohko") return MoveCategory::OHKO;
+  return MoveCategory::OTHER;
+}
 
-  // Validate and extract ailment_chance (0-100 range)
-  auto ailmentChanceResult = InputValidator::getJsonInt(info, "ailment_chance", 0, 100, 0);
-  if (!ailmentChanceResult.isValid()) {
-    std::cerr << "Move ailment_chance validation failed: " << ailmentChanceResult.errorMessage << std::endl;
-    return;
-  }
-  ailment_chance = ailmentChanceResult.value;
+Move::Move() : current_pp(0), disabled(false), def_(&emptyDef()) {}
 
-  // Validate category nested object
-  if (info.find("category") == info.end() || !info["category"].is_object()) {
-    std::cerr << "Move category field missing or invalid in " << file_path << std::endl;
-    return;
+Move::Move(const std::string &moveName) : Move() {
+  // Definitions are interned process-wide, so each data file is read at most once
+  auto& registry = DataRegistry::instance();
+  auto handle = registry.moveHandle(moveName);
+  if (handle != DataRegistry::kNoHandle) {
+    def_ = &registry.moveDef(handle);
+    current_pp = def_->pp;
   }
+}
 
-  auto categoryResult = InputValidator::getJsonString(info["category"], "name", 1, 30);
-  if (!categoryResult.isValid()) {
-    std::cerr << "Move category name validation failed: " << categoryResult.errorMessage << std::endl;
-    return;
-  }
-  category = categoryResult.value;
+Move::Move(const MoveDef &def)
+    : current_pp(def.pp), disabled(false), def_(&DataRegistry::instance().intern(def)) {}
 
-  // Validate and extract various Info fields with appropriate ranges
-  auto critRateResult = InputValidator::getJsonInt(info, "crit_rate", 0, 5, 0);
-  if (!critRateResult.isValid()) {
-    std::cerr << "Move crit_rate validation failed: " << critRateResult.errorMessage << std::endl;
-    return;
-  }
-  crit_rate = critRateResult.value;
+void Move::setDef(const MoveDef &def) {
+  def_ = &DataRegistry::instance().intern(def);
+  current_pp = std::min(current_pp, def_->pp);
+}
 
-  auto drainResult = InputValidator::getJsonInt(info, "drain", -100, 100, 0);
-  if (!drainResult.isValid()) {
-    std::cerr << "Move drain validation failed: " << drainResult.errorMessage << std::endl;
-    return;
+bool MoveDef::loadFromData(const std::string &moveName) {
+  // Secure file path validation and construction
+  auto pathResult = InputValidator::validateDataFilePath(moveName, "moves", ".json");
+  if (!pathResult.isValid()) {
+    std::cerr << "Move loading failed - " << pathResult.errorMessage << std::endl;
+    return false;
   }
-  drain = drainResult.value;
 
-  auto flinchChanceResult = InputValidator::getJsonInt(info, "flinch_chance", 0, 100, 0);
-  if (!flinchChanceResult.isValid()) {
-    std::cerr << "Move flinch_chance validation failed: " << flinchChanceResult.errorMessage << std::endl;
-    return;
+  // Compiled data pack first; JSON if there is no current pack or it lacks this file
+  auto pack = DataPack::shared();
+  if (pack && pack->loadMove(std::filesystem::path(pathResult.value).stem().string(), *this)) {
+    return true;
   }
-  flinch_chance = flinchChanceResult.value;
 
-  auto healingResult = InputValidator::getJsonInt(info, "healing", -100, 100, 0);
-  if (!healingResult.isValid()) {
-    std::cerr << "Move healing validation failed: " << healingResult.errorMessage << std::endl;
-    return;
-  }
-  healing = healingResult.value;
+  return loadFromJson(pathResult.value);
+}
 
-  // Handle hit/turn fields that can be null
-  if (info["max_hits"].is_null()) {
-    max_hits = 1;
-  } else {
-    auto maxHitsResult = InputValidator::getJsonInt(info, "max_hits", 1, 10);
-    if (!maxHitsResult.isValid()) {
-      std::cerr << "Move max_hits validation failed: " << maxHitsResult.errorMessage << std::endl;
-      return;
-    }
-    max_hits = maxHitsResult.value;
+bool MoveDef::loadFromJson(const std::string &file_path) {
+  // Additional security validation for the file path
+  auto accessValidation = InputValidator::validateFileAccessibility(file_path);
+  if (!accessValidation.isValid()) {
+    std::cerr << "Move file accessibility check failed: " << accessValidation.errorMessage << std::endl;
+    return false;
   }
 
-  if (info["max_turns"].is_null()) {
-    max_turns = 1;
-  } else {
-    auto maxTurnsResult = InputValidator::getJsonInt(info, "max_turns", 1, 10);
-    if (!maxTurnsResult.isValid()) {
-      std::cerr << "Move max_turns validation failed: " << maxTurnsResult.errorMessage << std::endl;
-      return;
-    }
-    max_turns = maxTurnsResult.value;
+  auto file = std::ifstream(file_path, std::ios::binary);
+  if (!file.is_open()) {
+    std::cerr << "Error opening file: " << file_path << std::endl;
+    return false;
   }
+  const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-  if (info["min_hits"].is_null()) {
-    min_hits = 1;
-  } else {
-    auto minHitsResult = InputValidator::getJsonInt(info, "min_hits", 1, 10);
-    if (!minHitsResult.isValid()) {
-      std::cerr << "Move min_hits validation failed: " << minHitsResult.errorMessage << std::endl;
-      return;
+  // One pass over the text checks every field against the move schema
+  std::vector<SchemaError> errors;
+  if (!DataSchema::parseMove(text, *this, errors)) {
+    for (const auto& error : errors) {
+      std::cerr << "Move validation failed in " << file_path << ": " << error.describe() << std::endl;
     }
-    min_hits = minHitsResult.value;
+    return false;
   }
 
-  if (info["min_turns"].is_null()) {
-    min_turns = 1;
-  } else {
-    auto minTurnsResult = InputValidator::getJsonInt(info, "min_turns", 1, 10);
-    if (!minTurnsResult.isValid()) {
-      std::cerr << "Move min_turns validation failed: " << minTurnsResult.errorMessage << std::endl;
-      return;
-    }
-    min_turns = minTurnsResult.value;
-  }
+  // Get move type from mapping (this provides additional validation)
+  type = MoveTypeMapping::getMoveType(name);
+  type_id = parsePokemonType(type);
 
-  auto statChanceResult = InputValidator::getJsonInt(info, "stat_chance", 0, 100);
-  if (!statChanceResult.isValid()) {
-    std::cerr << "Move stat_chance validation failed: " << statChanceResult.errorMessage << std::endl;
-    return;
-  }
-  stat_chance = statChanceResult.value;
+  configureMultiTurnBehavior();
+  return true;
+}
 
+void MoveDef::configureMultiTurnBehavior() {
   // Initialize multi-turn behavior based on move name and characteristics
   multi_turn_behavior = MultiTurnBehavior::NONE;
   is_weather_dependent = false;
@@ -284,18 +152,22 @@ void Move::loadFromJson(const std::string &file_path) {
   }
 }
 
-// Helper function to convert ailment name to StatusCondition enum
+// Status condition the move's ailment inflicts
 StatusCondition Move::getStatusCondition() const {
-  if (ailment_name == "poison") return StatusCondition::POISON;
-  if (ailment_name == "burn") return StatusCondition::BURN;
-  if (ailment_name == "paralysis") return StatusCondition::PARALYSIS;
-  if (ailment_name == "sleep") return StatusCondition::SLEEP;
-  if (ailment_name == "freeze") return StatusCondition::FREEZE;
+  switch (def_->ailment_id) {
+    case MoveAilment::POISON: return StatusCondition::POISON;
+    case MoveAilment::BURN: return StatusCondition::BURN;
+    case MoveAilment::PARALYSIS: return StatusCondition::PARALYSIS;
+    case MoveAilment::SLEEP: return StatusCondition::SLEEP;
+    case MoveAilment::FREEZE: return StatusCondition::FREEZE;
+    case MoveAilment::NONE:
+    case MoveAilment::OTHER: break;
+  }
   return StatusCondition::NONE;
 }
 
 // PP Management method implementations
-bool Move::canUse() const { return current_pp > 0; }
+bool Move::canUse() const { return current_pp > 0 && !disabled; }
 
 bool Move::usePP() {
   if (current_pp > 0) {
@@ -308,39 +180,54 @@ bool Move::usePP() {
 void Move::restorePP(int amount) {
   if (amount == -1) {
     // Restore to maximum PP
-    current_pp = pp;
+    current_pp = def_->pp;
   } else {
     // Restore specified amount, but don't exceed maximum
-    current_pp = std::min(pp, current_pp + amount);
+    current_pp = std::min(def_->pp, current_pp + amount);
   }
 }
 
 int Move::getRemainingPP() const { return current_pp; }
 
-int Move::getMaxPP() const { return pp; }
+int Move::getMaxPP() const { return def_->pp; }
 
 // Multi-turn move utility implementations
 bool Move::isMultiTurnMove() const {
-  return multi_turn_behavior != MultiTurnBehavior::NONE;
+  return def_->multi_turn_behavior != MultiTurnBehavior::NONE;
 }
 
 bool Move::requiresCharging() const {
-  return multi_turn_behavior == MultiTurnBehavior::CHARGE || 
-         multi_turn_behavior == MultiTurnBehavior::CHARGE_BOOST;
+  return def_->multi_turn_behavior == MultiTurnBehavior::CHARGE || 
+         def_->multi_turn_behavior == MultiTurnBehavior::CHARGE_BOOST;
 }
 
 bool Move::requiresRecharge() const {
-  return multi_turn_behavior == MultiTurnBehavior::RECHARGE;
+  return def_->multi_turn_behavior == MultiTurnBehavior::RECHARGE;
 }
 
 bool Move::skipChargeInSunnyWeather() const {
-  return is_weather_dependent && (name == "solar-beam" || name == "solarbeam");
+  return def_->is_weather_dependent && (def_->name == "solar-beam" || def_->name == "solarbeam");
 }
 
 bool Move::boostsDefenseOnCharge() const {
-  return boosts_defense_on_charge;
+  return def_->boosts_defense_on_charge;
 }
 
 MultiTurnBehavior Move::getMultiTurnBehavior() const {
-  return multi_turn_behavior;
-}
\ No newline at end of file
+  return def_->multi_turn_behavior;
+}
+
+bool MoveDef::operator==(const MoveDef& other) const {
+  return name == other.name && accuracy == other.accuracy &&
+         effect_chance == other.effect_chance && pp == other.pp &&
+         priority == other.priority && power == other.power &&
+         damage_class == other.damage_class && type == other.type &&
+         ailment_name == other.ailment_name && ailment_chance == other.ailment_chance &&
+         category == other.category && crit_rate == other.crit_rate && drain == other.drain &&
+         flinch_chance == other.flinch_chance && healing == other.healing &&
+         max_hits == other.max_hits && max_turns == other.max_turns &&
+         min_hits == other.min_hits && min_turns == other.min_turns &&
+         stat_chance == other.stat_chance && multi_turn_behavior == other.multi_turn_behavior &&
+         is_weather_dependent == other.is_weather_dependent &&
+         boosts_defense_on_charge == other.boosts_defense_on_charge;
+}
@@ -1,11 +1,27 @@
 #include "pokemon.h"
 
+#include <filesystem>
 #include <random>
-#include <set>
+#include <iterator>
+
+#include "data_pack.h"
+#include "data_registry.h"
+#include "data_schema.h"
 #include "input_validator.h"
 
 using json = nlohmann::json;
 
+namespace {
+
+// Stream for status rolls made outside a battle
+BattleRng &unseededRng() {
+  thread_local BattleRng rng((static_cast<uint64_t>(std::random_device{}()) << 32) |
+                             std::random_device{}());
+  return rng;
+}
+
+}  // namespace
+
 Pokemon::Pokemon()
     : name(""),
       id(0),
@@ -41,149 +57,69 @@ Pokemon::Pokemon(const std::string& pokemonName)
       special_attack_stage(0),
       special_defense_stage(0),
       speed_stage(0) {
-  
+  // Species are interned process-wide, so each data file is read at most once
+  auto& registry = DataRegistry::instance();
+  auto handle = registry.speciesHandle(pokemonName);
+  if (handle != DataRegistry::kNoHandle) {
+    *this = registry.species(handle);
+  }
+  // loadMoves(); // Removed - moves are loaded by Team::loadTeams()
+}
+
+bool Pokemon::loadFromData(const std::string& pokemonName) {
   // Secure file path validation and construction
   auto pathResult = InputValidator::validateDataFilePath(pokemonName, "pokemon", ".json");
   if (!pathResult.isValid()) {
     std::cerr << "Pokemon loading failed - " << pathResult.errorMessage << std::endl;
-    return;
+    return false;
   }
-  
-  loadFromJson(pathResult.value);
-  // loadMoves(); // Removed - moves are loaded by Team::loadTeams()
+
+  // Compiled data pack first; JSON if there is no current pack or it lacks this file
+  auto pack = DataPack::shared();
+  if (pack && pack->loadPokemon(std::filesystem::path(pathResult.value).stem().string(), *this)) {
+    return true;
+  }
+
+  return loadFromJson(pathResult.value);
 }
 
-void Pokemon::loadFromJson(const std::string& file_path) {
+bool Pokemon::loadFromJson(const std::string& file_path) {
   // Additional security validation for the file path
   auto accessValidation = InputValidator::validateFileAccessibility(file_path);
   if (!accessValidation.isValid()) {
     std::cerr << "Pokemon file accessibility check failed: " << accessValidation.errorMessage << std::endl;
-    return;
+    return false;
   }
 
-  auto file = std::ifstream(file_path);
+  auto file = std::ifstream(file_path, std::ios::binary);
   if (!file.is_open()) {
     std::cerr << "Error opening file: " << file_path << std::endl;
-    return;
-  }
-
-  auto pokemon_json = json{};
-  try {
-    file >> pokemon_json;
-  } catch (const json::parse_error& e) {
-    std::cerr << "JSON parse error in " << file_path << ": " << e.what() << std::endl;
-    return;
-  }
-
-  // Define valid Pokemon types for validation
-  static const std::set<std::string> validTypes = {
-    "bug", "dragon", "electric", "fairy", "fighting", "fire", 
-    "flying", "ghost", "grass", "ground", "ice", "normal", 
-    "poison", "psychic", "rock", "water"
-  };
-
-  // Validate and extract name (1-50 characters, alphanumeric and common symbols)
-  auto nameResult = InputValidator::getJsonString(pokemon_json, "name", 1, 50);
-  if (!nameResult.isValid()) {
-    std::cerr << "Pokemon name validation failed: " << nameResult.errorMessage << std::endl;
-    return;
-  }
-  name = nameResult.value;
-
-  // Validate and extract ID (1-999 range for Pokemon IDs)
-  auto idResult = InputValidator::getJsonInt(pokemon_json, "id", 1, 999);
-  if (!idResult.isValid()) {
-    std::cerr << "Pokemon ID validation failed: " << idResult.errorMessage << std::endl;
-    return;
-  }
-  id = idResult.value;
-
-  // Validate types array (must exist and be an array)
-  if (pokemon_json.find("types") == pokemon_json.end() || !pokemon_json["types"].is_array()) {
-    std::cerr << "Pokemon types field missing or invalid in " << file_path << std::endl;
-    return;
-  }
-
-  // Clear existing types and validate each type
-  types.clear();
-  const auto& typesArray = pokemon_json["types"];
-  if (typesArray.empty() || typesArray.size() > 2) {
-    std::cerr << "Pokemon must have 1-2 types in " << file_path << std::endl;
-    return;
+    return false;
   }
+  const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-  for (const auto& typeElement : typesArray) {
-    if (!typeElement.is_string()) {
-      std::cerr << "Invalid type format in " << file_path << std::endl;
-      return;
-    }
-    
-    std::string typeStr = typeElement.get<std::string>();
-    if (validTypes.find(typeStr) == validTypes.end()) {
-      std::cerr << "Invalid Pokemon type '" << typeStr << "' in " << file_path << std::endl;
-      return;
+  // One pass over the text checks every field against the species schema
+  SpeciesRecord record;
+  std::vector<SchemaError> errors;
+  if (!DataSchema::parseSpecies(text, record, errors)) {
+    for (const auto& error : errors) {
+      std::cerr << "Pokemon validation failed in " << file_path << ": " << error.describe() << std::endl;
     }
-    types.push_back(typeStr);
-  }
-
-  // Validate base_stats object exists
-  if (pokemon_json.find("base_stats") == pokemon_json.end() || !pokemon_json["base_stats"].is_object()) {
-    std::cerr << "Pokemon base_stats field missing or invalid in " << file_path << std::endl;
-    return;
+    return false;
   }
 
-  const auto& base_stats = pokemon_json["base_stats"];
-
-  // Validate and extract HP (1-255 typical range for Pokemon stats)
-  auto hpResult = InputValidator::getJsonInt(base_stats, "hp", 1, 255);
-  if (!hpResult.isValid()) {
-    std::cerr << "Pokemon HP validation failed: " << hpResult.errorMessage << std::endl;
-    return;
-  }
-  hp = hpResult.value;
+  name = std::move(record.name);
+  id = record.id;
+  types = std::move(record.types);
+  hp = record.hp;
   current_hp = hp;
-
-  // Validate and extract Attack (1-255 range)
-  auto attackResult = InputValidator::getJsonInt(base_stats, "attack", 1, 255);
-  if (!attackResult.isValid()) {
-    std::cerr << "Pokemon Attack validation failed: " << attackResult.errorMessage << std::endl;
-    return;
-  }
-  attack = attackResult.value;
-
-  // Validate and extract Defense (1-255 range)
-  auto defenseResult = InputValidator::getJsonInt(base_stats, "defense", 1, 255);
-  if (!defenseResult.isValid()) {
-    std::cerr << "Pokemon Defense validation failed: " << defenseResult.errorMessage << std::endl;
-    return;
-  }
-  defense = defenseResult.value;
-
-  // Validate and extract Special Attack (1-255 range)
-  auto specialAttackResult = InputValidator::getJsonInt(base_stats, "special-attack", 1, 255);
-  if (!specialAttackResult.isValid()) {
-    std::cerr << "Pokemon Special Attack validation failed: " << specialAttackResult.errorMessage << std::endl;
-    return;
-  }
-  special_attack = specialAttackResult.value;
-
-  // Validate and extract Special Defense (1-255 range)
-  auto specialDefenseResult = InputValidator::getJsonInt(base_stats, "special-defense", 1, 255);
-  if (!specialDefenseResult.isValid()) {
-    std::cerr << "Pokemon Special Defense validation failed: " << specialDefenseResult.errorMessage << std::endl;
-    return;
-  }
-  special_defense = specialDefenseResult.value;
-
-  // Validate and extract Speed (1-255 range)
-  auto speedResult = InputValidator::getJsonInt(base_stats, "speed", 1, 255);
-  if (!speedResult.isValid()) {
-    std::cerr << "Pokemon Speed validation failed: " << speedResult.errorMessage << std::endl;
-    return;
-  }
-  speed = speedResult.value;
-
+  attack = record.attack;
+  defense = record.defense;
+  special_attack = record.special_attack;
+  special_defense = record.special_defense;
+  speed = record.speed;
   fainted = false;
+  return true;
 }
 
 void Pokemon::loadMoves() {
@@ -221,6 +157,10 @@ void Pokemon::heal(int amount) {
 }
 
 void Pokemon::applyStatusCondition(StatusCondition newStatus) {
+  applyStatusCondition(newStatus, unseededRng());
+}
+
+void Pokemon::applyStatusCondition(StatusCondition newStatus, BattleRng &rng) {
   // Flinch can be applied even if Pokemon has another status condition
   if (newStatus == StatusCondition::FLINCH) {
     status = newStatus;
@@ -240,7 +180,7 @@ void Pokemon::applyStatusCondition(StatusCondition newStatus) {
   switch (newStatus) {
     case StatusCondition::SLEEP:
       // Sleep lasts 1-3 turns
-      status_turns_remaining = 1 + (std::rand() % 3);
+      status_turns_remaining = rng.uniformInt(1, 3);
       break;
     case StatusCondition::POISON:
     case StatusCondition::BURN:
@@ -258,7 +198,11 @@ void Pokemon::applyStatusCondition(StatusCondition newStatus) {
   }
 }
 
-void Pokemon::processStatusCondition() {
+void Pokemon::processStatusCondition(std::ostream& out) {
+  processStatusCondition(out, unseededRng());
+}
+
+void Pokemon::processStatusCondition(std::ostream& out, BattleRng& rng) {
   if (!hasStatusCondition()) return;
 
   switch (status) {
@@ -267,8 +211,8 @@ void Pokemon::processStatusCondition() {
       {
         int damage = std::max(1, hp / 8);
         takeDamage(damage);
-        std::cout << name << " is hurt by poison! (-" << damage << " HP)"
-                  << std::endl;
+        out << name << " is hurt by poison! (-" << damage << " HP)"
+            << std::endl;
       }
       break;
 
@@ -277,8 +221,8 @@ void Pokemon::processStatusCondition() {
       {
         int damage = std::max(1, hp / 16);
         takeDamage(damage);
-        std::cout << name << " is hurt by burn! (-" << damage << " HP)"
-                  << std::endl;
+        out << name << " is hurt by burn! (-" << damage << " HP)"
+            << std::endl;
       }
       break;
 
@@ -286,10 +230,10 @@ void Pokemon::processStatusCondition() {
       // Sleep countdown
       if (status_turns_remaining > 0) {
         status_turns_remaining--;
-        std::cout << name << " is fast asleep!" << std::endl;
+        out << name << " is fast asleep!" << std::endl;
         if (status_turns_remaining == 0) {
           clearStatusCondition();
-          std::cout << name << " woke up!" << std::endl;
+          out << name << " woke up!" << std::endl;
         }
       }
       break;
@@ -297,27 +241,23 @@ void Pokemon::processStatusCondition() {
     case StatusCondition::FREEZE:
       // 20% chance to thaw out each turn
       {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_real_distribution<> dis(0.0, 1.0);
-
-        if (dis(gen) < 0.20) {
+        if (rng.uniformReal() < 0.20) {
           clearStatusCondition();
-          std::cout << name << " thawed out!" << std::endl;
+          out << name << " thawed out!" << std::endl;
         } else {
-          std::cout << name << " is frozen solid!" << std::endl;
+          out << name << " is frozen solid!" << std::endl;
         }
       }
       break;
 
     case StatusCondition::PARALYSIS:
       // Paralysis persists until cured
-      std::cout << name << " is paralyzed!" << std::endl;
+      out << name << " is paralyzed!" << std::endl;
       break;
 
     case StatusCondition::FLINCH:
       // Flinch automatically clears after 1 turn
-      std::cout << name << " flinched and couldn't move!" << std::endl;
+      out << name << " flinched and couldn't move!" << std::endl;
       clearStatusCondition();
       break;
 
@@ -326,7 +266,9 @@ void Pokemon::processStatusCondition() {
   }
 }
 
-bool Pokemon::canAct() const {
+bool Pokemon::canAct() const { return canAct(unseededRng()); }
+
+bool Pokemon::canAct(BattleRng& rng) const {
   if (!isAlive()) return false;
 
   switch (status) {
@@ -337,12 +279,7 @@ bool Pokemon::canAct() const {
 
     case StatusCondition::PARALYSIS:
       // 25% chance to be fully paralyzed
-      {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        static std::uniform_real_distribution<> dis(0.0, 1.0);
-        return dis(gen) >= 0.25;
-      }
+      return rng.uniformReal() >= 0.25;
 
     default:
       return true;
@@ -371,7 +308,11 @@ bool Pokemon::canAct(std::mt19937& rng) const {
 }
 
 std::string Pokemon::getStatusConditionName() const {
-  switch (status) {
+  return getStatusConditionName(status);
+}
+
+std::string Pokemon::getStatusConditionName(StatusCondition condition) {
+  switch (condition) {
     case StatusCondition::POISON:
       return "Poisoned";
     case StatusCondition::BURN:
@@ -476,7 +417,8 @@ void Pokemon::resetStatStages() {
 }
 
 // Multi-turn move state management implementations
-void Pokemon::startCharging(int moveIndex, const std::string& moveName) {
+void Pokemon::startCharging(int moveIndex, const std::string& moveName,
+                            std::ostream& out) {
   is_charging = true;
   must_recharge = false;
   charging_move_index = moveIndex;
@@ -487,7 +429,7 @@ void Pokemon::startCharging(int moveIndex, const std::string& moveName) {
     const Move& move = moves[moveIndex];
     if (move.boostsDefenseOnCharge()) {
       modifyDefense(1);
-      std::cout << name << "'s Defense rose while charging " << moveName << "!" << std::endl;
+      out << name << "'s Defense rose while charging " << moveName << "!" << std::endl;
     }
   }
 }
@@ -509,9 +451,11 @@ void Pokemon::finishRecharge() {
   must_recharge = false;
 }
 
-bool Pokemon::canActThisTurn() const {
+bool Pokemon::canActThisTurn() const { return canActThisTurn(unseededRng()); }
+
+bool Pokemon::canActThisTurn(BattleRng& rng) const {
   // Check basic action ability (status conditions)
-  if (!canAct()) {
+  if (!canAct(rng)) {
     return false;
   }
   
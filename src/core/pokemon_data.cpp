@@ -1,193 +1,620 @@
 #include "pokemon_data.h"
+#include "data_pack.h"
+#include "data_registry.h"
+#include "type_effectiveness.h"
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <set>
 #include <sstream>
+#include <thread>
 
 using json = nlohmann::json;
 
-PokemonData::PokemonData() : is_initialized(false) {
-    // Initialize empty containers
-    pokemon_data.clear();
-    move_data.clear();
-    pokemon_by_type.clear();
-    moves_by_type.clear();
-    moves_by_damage_class.clear();
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using TypeIndex = std::unordered_map<std::string, std::vector<std::string>>;
+
+// Below this many files per thread, starting another thread costs more than
+// it saves
+constexpr size_t kMinFilesPerThread = 16;
+
+std::chrono::microseconds elapsed(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+}
+
+void removeFromIndex(TypeIndex& index, const std::string& key, const std::string& name) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return;
+    }
+    auto& names = it->second;
+    auto position = std::find(names.begin(), names.end(), name);
+    if (position != names.end()) {
+        names.erase(position);
+    }
+    if (names.empty()) {
+        index.erase(it);
+    }
+}
+
+using EntryId = PokemonData::EntryId;
+using Bits = PokemonData::QueryIndex::Bits;
+
+// Stat fields in the order of QueryIndex::pokemon_by_stat
+constexpr std::array<int PokemonData::PokemonInfo::*, 6> kStatFields = {
+    &PokemonData::PokemonInfo::hp,
+    &PokemonData::PokemonInfo::attack,
+    &PokemonData::PokemonInfo::defense,
+    &PokemonData::PokemonInfo::special_attack,
+    &PokemonData::PokemonInfo::special_defense,
+    &PokemonData::PokemonInfo::speed,
+};
+
+Bits allBits(size_t count) {
+    Bits bits((count + 63) / 64, ~0ULL);
+    if (count % 64 != 0) {
+        bits.back() = (1ULL << (count % 64)) - 1;
+    }
+    return bits;
+}
+
+void setBit(Bits& bits, size_t count, EntryId id) {
+    if (bits.empty()) {
+        bits.resize((count + 63) / 64);
+    }
+    bits[id / 64] |= 1ULL << (id % 64);
 }
 
+void intersect(Bits& bits, const Bits& other) {
+    for (size_t i = 0; i < bits.size(); ++i) {
+        bits[i] &= other[i];
+    }
+}
+
+// Keeps the bits of entries in a category; an unknown category matches nothing
+void intersectCategory(Bits& bits, const std::unordered_map<std::string, Bits>& index,
+                       const std::string& key) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        std::fill(bits.begin(), bits.end(), 0);
+        return;
+    }
+    intersect(bits, it->second);
+}
+
+// Keeps the bits of entries whose value lies in the range. The ids are
+// ordered by value, so the matches are one contiguous slice of them.
+template <typename Value>
+void intersectRange(Bits& bits, const std::vector<EntryId>& by_value,
+                    const PokemonData::IntRange& range, Value value) {
+    if (range.isUnbounded()) {
+        return;
+    }
+    auto first = std::partition_point(by_value.begin(), by_value.end(),
+                                      [&](EntryId id) { return value(id) < range.min; });
+    auto last = std::partition_point(first, by_value.end(),
+                                     [&](EntryId id) { return value(id) <= range.max; });
+    Bits in_range(bits.size(), 0);
+    for (auto it = first; it != last; ++it) {
+        in_range[*it / 64] |= 1ULL << (*it % 64);
+    }
+    intersect(bits, in_range);
+}
+
+// Finds a case-insensitive name among lowercase keys. Names that are
+// already lowercase, as most are, are looked up without a copy.
+template <typename Map>
+const typename Map::mapped_type* findByName(const Map& map, const std::string& name) {
+    auto is_upper = [](unsigned char c) { return std::isupper(c) != 0; };
+    if (std::none_of(name.begin(), name.end(), is_upper)) {
+        auto it = map.find(name);
+        return it != map.end() ? &it->second : nullptr;
+    }
+    std::string lowered = name;
+    std::transform(lowered.begin(), lowered.end(), lowered.begin(), ::tolower);
+    auto it = map.find(lowered);
+    return it != map.end() ? &it->second : nullptr;
+}
+
+std::vector<EntryId> collectIds(const Bits& bits) {
+    std::vector<EntryId> ids;
+    for (size_t i = 0; i < bits.size(); ++i) {
+        uint64_t word = bits[i];
+        for (EntryId bit = 0; word != 0; ++bit, word >>= 1) {
+            if (word & 1) {
+                ids.push_back(static_cast<EntryId>(i * 64) + bit);
+            }
+        }
+    }
+    return ids;
+}
+
+template <typename Value>
+std::vector<EntryId> sortedByValue(size_t count, Value value) {
+    std::vector<EntryId> ids(count);
+    for (size_t i = 0; i < count; ++i) {
+        ids[i] = static_cast<EntryId>(i);
+    }
+    std::stable_sort(ids.begin(), ids.end(),
+                     [&](EntryId a, EntryId b) { return value(a) < value(b); });
+    return ids;
+}
+
+void clearBit(std::unordered_map<std::string, Bits>& index, const std::string& key, EntryId id) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return;
+    }
+    it->second[id / 64] &= ~(1ULL << (id % 64));
+    if (std::all_of(it->second.begin(), it->second.end(), [](uint64_t word) { return word == 0; })) {
+        index.erase(it);
+    }
+}
+
+// Puts changed ids (sorted) back in their places among ids ordered by value,
+// breaking ties by id as sortedByValue does. The other ids stay in order, so
+// each changed one is a removal and a binary-search insertion.
+template <typename Value>
+void reorderIds(std::vector<EntryId>& ids, const std::vector<EntryId>& changed, Value value) {
+    ids.erase(std::remove_if(ids.begin(), ids.end(), [&](EntryId id) {
+        return std::binary_search(changed.begin(), changed.end(), id);
+    }), ids.end());
+    auto before = [&](EntryId a, EntryId b) {
+        return value(a) < value(b) || (!(value(b) < value(a)) && a < b);
+    };
+    for (EntryId id : changed) {
+        ids.insert(std::lower_bound(ids.begin(), ids.end(), id, before), id);
+    }
+}
+
+}  // namespace
+
+PokemonData::PokemonData()
+    : current_snapshot(std::make_shared<const Snapshot>()), is_initialized(false), loader_threads(0) {}
+
 PokemonData::LoadResult PokemonData::initialize(const std::string& pokemon_dir, 
                                                const std::string& moves_dir) {
-    // Clear any existing data
-    clearCache();
+    std::lock_guard<std::mutex> lock(reload_mutex);
     
     // Store directory paths
     pokemon_directory = pokemon_dir;
     moves_directory = moves_dir;
     
+    return loadAll();
+}
+
+PokemonData::LoadResult PokemonData::loadAll() {
+    // A failed load leaves no data, as clearCache() would
+    is_initialized = false;
+    source_files.clear();
+    auto snapshot = std::make_shared<Snapshot>();
+    
     // Validate directory paths
-    auto pokemon_path_result = InputValidator::validatePathWithinDataDirectory(pokemon_dir, {"pokemon"});
+    auto pokemon_path_result = InputValidator::validatePathWithinDataDirectory(pokemon_directory, {"pokemon"});
     if (!pokemon_path_result.isValid()) {
+        publish(std::move(snapshot));
         return LoadResult(false, "Invalid Pokemon directory: " + pokemon_path_result.errorMessage);
     }
     
-    auto moves_path_result = InputValidator::validatePathWithinDataDirectory(moves_dir, {"moves"});
+    auto moves_path_result = InputValidator::validatePathWithinDataDirectory(moves_directory, {"moves"});
     if (!moves_path_result.isValid()) {
+        publish(std::move(snapshot));
         return LoadResult(false, "Invalid moves directory: " + moves_path_result.errorMessage);
     }
     
-    // Load Pokemon data
-    auto pokemon_result = loadPokemonData(pokemon_dir);
-    if (!pokemon_result.success) {
-        return LoadResult(false, "Failed to load Pokemon data: " + pokemon_result.error_message);
-    }
-    
-    // Load move data
-    auto move_result = loadMoveData(moves_dir);
-    if (!move_result.success) {
-        return LoadResult(false, "Failed to load move data: " + move_result.error_message);
+    // Use the compiled data pack when it is current for these directories
+    DataPack pack;
+    auto parse_start = Clock::now();
+    if (pack.open(DataPack::packPathFor(pokemon_directory)) &&
+        pack.isCurrent(pokemon_directory, moves_directory)) {
+        loadFromPack(pack, *snapshot);
+        auto index_start = Clock::now();
+        organizeDataByTypes(*snapshot);
+        snapshot->from_pack = true;
+        LoadResult result(true, "Data loaded successfully",
+                         pack.catalogLoadedCount(), pack.catalogFailedCount());
+        result.timings.parse = elapsed(parse_start, index_start);
+        result.timings.index_build = elapsed(index_start, Clock::now());
+        publish(std::move(snapshot));
+        is_initialized = true;
+        return result;
     }
     
-    // Organize data for efficient lookups
-    organizeDataByTypes();
-    
-    is_initialized = true;
-    
-    return LoadResult(true, "Data loaded successfully", 
-                     pokemon_result.loaded_count + move_result.loaded_count,
-                     pokemon_result.failed_count + move_result.failed_count);
+    auto result = loadJsonData(*snapshot);
+    publish(std::move(snapshot));
+    is_initialized = result.success;
+    return result;
 }
 
 PokemonData::LoadResult PokemonData::reloadData() {
+    std::lock_guard<std::mutex> lock(reload_mutex);
     if (!is_initialized) {
         return LoadResult(false, "PokemonData not initialized. Call initialize() first.");
     }
     
-    return initialize(pokemon_directory, moves_directory);
+    auto result = reloadChanged();
+    // Battles build their Pokemon and moves from the registry, not from this
+    // catalog, so it has to pick the changes up too
+    DataRegistry::instance().reload();
+    return result;
 }
 
-PokemonData::LoadResult PokemonData::loadPokemonData(const std::string& directory) {
-    int loaded_count = 0;
-    int failed_count = 0;
+PokemonData::LoadResult PokemonData::reloadChanged() {
+    auto previous = snapshot();
+    if (previous->from_pack) {
+        // There are no per-file records for pack data: nothing has changed
+        // while the pack is current, and a stale pack means a full load
+        DataPack pack;
+        if (pack.open(DataPack::packPathFor(pokemon_directory)) &&
+            pack.isCurrent(pokemon_directory, moves_directory)) {
+            return LoadResult(true, "No data changes");
+        }
+        return loadAll();
+    }
     
-    try {
-        // Check if directory exists
-        if (!std::filesystem::exists(directory)) {
-            return LoadResult(false, "Pokemon directory does not exist: " + directory);
+    // Scan: new files, and known files whose size or modification time moved
+    LoadResult result;
+    auto scan_start = Clock::now();
+    std::vector<ScannedFile> files;
+    auto scan = scanDataDirectories(files);
+    if (!scan.success) {
+        return scan;
+    }
+    
+    std::vector<ScannedFile> candidates;
+    std::unordered_set<std::string> present;
+    for (const auto& file : files) {
+        present.insert(file.path);
+        auto known = source_files.find(file.path);
+        if (known == source_files.end() || known->second.mtime != file.mtime ||
+            known->second.size != file.size) {
+            candidates.push_back(file);
         }
-        
-        if (!std::filesystem::is_directory(directory)) {
-            return LoadResult(false, "Path is not a directory: " + directory);
+    }
+    std::vector<std::string> removed;
+    for (const auto& [path, source] : source_files) {
+        if (present.count(path) == 0) {
+            removed.push_back(path);
+        }
+    }
+    result.timings.scan = elapsed(scan_start, Clock::now());
+    
+    if (candidates.empty() && removed.empty()) {
+        result.error_message = "No data changes";
+        return result;
+    }
+    
+    auto parsed = parseFiles(candidates, result);
+    
+    // Work out which names are affected; a file whose content hash is
+    // unchanged was only touched
+    auto index_start = Clock::now();
+    auto next_files = source_files;
+    std::set<std::pair<bool, std::string>> affected;  // (is_move, key)
+    std::unordered_map<std::string, const ParsedFile*> fresh;
+    for (const auto& path : removed) {
+        const auto& source = source_files.at(path);
+        if (!source.key.empty()) {
+            affected.emplace(source.is_move, source.key);
+        }
+        next_files.erase(path);
+        result.removed_count++;
+    }
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        const auto& file = candidates[i];
+        const auto& outcome = parsed[i];
+        auto known = source_files.find(file.path);
+        if (known != source_files.end() && outcome.read && outcome.hash == known->second.hash) {
+            next_files[file.path].mtime = file.mtime;
+            continue;
         }
         
-        // Iterate through all JSON files in the directory
-        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
-            if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                std::string file_path = entry.path().string();
-                
-                // Validate file accessibility
-                auto file_validation = InputValidator::validateFileAccessibility(file_path);
-                if (!file_validation.isValid()) {
-                    std::cerr << "Skipping inaccessible Pokemon file: " << file_path 
-                             << " (" << file_validation.errorMessage << ")" << std::endl;
-                    failed_count++;
-                    continue;
-                }
-                
-                // Load the Pokemon file
-                if (loadPokemonFile(file_path)) {
-                    loaded_count++;
-                } else {
-                    failed_count++;
-                }
+        SourceFile source{file.mtime, file.size, outcome.hash, file.is_move, ""};
+        if (outcome.parsed) {
+            source.key = normalizeName(file.is_move ? outcome.move.name : outcome.pokemon.name);
+            affected.emplace(file.is_move, source.key);
+            fresh[file.path] = &outcome;
+            result.loaded_count++;
+        } else {
+            result.failed_count++;
+        }
+        if (known == source_files.end()) {
+            result.added_count++;
+        } else {
+            if (!known->second.key.empty()) {
+                affected.emplace(known->second.is_move, known->second.key);
             }
+            result.changed_count++;
         }
-        
-        return LoadResult(true, "Pokemon data loaded", loaded_count, failed_count);
+        next_files[file.path] = std::move(source);
     }
-    catch (const std::filesystem::filesystem_error& e) {
-        return LoadResult(false, "Filesystem error loading Pokemon data: " + std::string(e.what()));
+    
+    if (result.added_count + result.changed_count + result.removed_count == 0) {
+        source_files = std::move(next_files);
+        result.error_message = "No data changes";
+        return result;
     }
-    catch (const std::exception& e) {
-        return LoadResult(false, "Error loading Pokemon data: " + std::string(e.what()));
+    
+    // Each affected name goes to the last file defining it, as in a full load.
+    // That is usually a file just parsed; an unchanged file that takes a name
+    // over from a changed or removed one is parsed again.
+    auto lastDefinitions = [&affected](const std::map<std::string, SourceFile>& records) {
+        std::map<std::pair<bool, std::string>, std::string> owners;
+        for (const auto& [path, source] : records) {
+            auto key = std::make_pair(source.is_move, source.key);
+            if (!source.key.empty() && affected.count(key) != 0) {
+                owners[key] = path;
+            }
+        }
+        return owners;
+    };
+    auto old_owners = lastDefinitions(source_files);
+    auto new_owners = lastDefinitions(next_files);
+    
+    auto next = std::make_shared<Snapshot>(*previous);
+    std::vector<ScannedFile> takeovers;
+    for (const auto& key : affected) {
+        auto owner = new_owners.find(key);
+        if (owner == new_owners.end()) {
+            replaceEntry(*next, key.second, nullptr, key.first);
+            continue;
+        }
+        auto parsed_owner = fresh.find(owner->second);
+        if (parsed_owner != fresh.end()) {
+            replaceEntry(*next, key.second, parsed_owner->second, key.first);
+            continue;
+        }
+        auto old_owner = old_owners.find(key);
+        if (old_owner == old_owners.end() || old_owner->second != owner->second) {
+            const auto& source = next_files.at(owner->second);
+            takeovers.push_back({owner->second, source.mtime, source.size, source.is_move});
+        }
+    }
+    if (!takeovers.empty()) {
+        LoadResult takeover_result;
+        auto takeover_parsed = parseFiles(takeovers, takeover_result);
+        for (size_t i = 0; i < takeovers.size(); ++i) {
+            const auto& file = takeovers[i];
+            replaceEntry(*next, next_files.at(file.path).key,
+                         takeover_parsed[i].parsed ? &takeover_parsed[i] : nullptr, file.is_move);
+        }
     }
+    // Edits to existing entries keep every id, so only their bits move
+    if (!updateQueryIndex(*next, affected)) {
+        buildQueryIndex(*next);
+    }
+    result.timings.index_build = elapsed(index_start, Clock::now());
+    
+    source_files = std::move(next_files);
+    publishIndexed(std::move(next));
+    result.error_message = "Data reloaded successfully";
+    return result;
+}
+
+std::shared_ptr<const PokemonData::Snapshot> PokemonData::snapshot() const {
+    return std::atomic_load(&current_snapshot);
 }
 
-PokemonData::LoadResult PokemonData::loadMoveData(const std::string& directory) {
-    int loaded_count = 0;
-    int failed_count = 0;
+void PokemonData::publish(std::shared_ptr<Snapshot> snapshot) {
+    buildQueryIndex(*snapshot);
+    publishIndexed(std::move(snapshot));
+}
+
+void PokemonData::publishIndexed(std::shared_ptr<Snapshot> snapshot) {
+    snapshot->generation = std::atomic_load(&current_snapshot)->generation + 1;
+    std::atomic_store(&current_snapshot, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+}
+
+void PokemonData::loadFromPack(const DataPack& pack, Snapshot& snapshot) const {
+    for (size_t i = 0; i < pack.catalogPokemonCount(); ++i) {
+        const auto& record = pack.catalogPokemon(i);
+        std::vector<std::string> types;
+        for (int t = 0; t < record.type_count && t < 2; ++t) {
+            types.emplace_back(pack.string(record.types[t]));
+        }
+        snapshot.pokemon_data[pack.string(record.key)] = PokemonInfo(
+            pack.string(record.name), record.id, types, record.hp, record.attack,
+            record.defense, record.special_attack, record.special_defense, record.speed);
+    }
+    
+    for (size_t i = 0; i < pack.catalogMoveCount(); ++i) {
+        const auto& record = pack.catalogMove(i);
+        snapshot.move_data[pack.string(record.key)] = MoveInfo(
+            pack.string(record.name), record.accuracy, record.power, record.pp,
+            pack.string(record.type), pack.string(record.damage_class),
+            pack.string(record.category), record.priority,
+            pack.string(record.ailment_name), record.ailment_chance);
+    }
+}
+
+PokemonData::LoadResult PokemonData::loadJsonData(Snapshot& snapshot) {
+    LoadResult result;
+    
+    // Scan: Pokemon files first, then moves, each sorted by name
+    auto scan_start = Clock::now();
+    std::vector<ScannedFile> files;
+    auto scan = scanDataDirectories(files);
+    if (!scan.success) {
+        return scan;
+    }
+    result.timings.scan = elapsed(scan_start, Clock::now());
+    
+    auto parsed = parseFiles(files, result);
     
+    // Index build: merge in file order, then organize by type
+    auto index_start = Clock::now();
+    for (size_t i = 0; i < files.size(); ++i) {
+        const auto& file = files[i];
+        auto& outcome = parsed[i];
+        SourceFile source{file.mtime, file.size, outcome.hash, file.is_move, ""};
+        if (!outcome.parsed) {
+            result.failed_count++;
+        } else if (file.is_move) {
+            result.loaded_count++;
+            source.key = normalizeName(outcome.move.name);
+            snapshot.move_data[source.key] = std::move(outcome.move);
+        } else {
+            result.loaded_count++;
+            source.key = normalizeName(outcome.pokemon.name);
+            snapshot.pokemon_data[source.key] = std::move(outcome.pokemon);
+        }
+        source_files.emplace(file.path, std::move(source));
+    }
+    organizeDataByTypes(snapshot);
+    result.timings.index_build = elapsed(index_start, Clock::now());
+    
+    result.error_message = "Data loaded successfully";
+    return result;
+}
+
+PokemonData::LoadResult PokemonData::scanDataDirectories(std::vector<ScannedFile>& files) const {
+    auto pokemon_scan = scanDataDirectory(pokemon_directory, "Pokemon", false, files);
+    if (!pokemon_scan.success) {
+        return LoadResult(false, "Failed to load Pokemon data: " + pokemon_scan.error_message);
+    }
+    auto move_scan = scanDataDirectory(moves_directory, "Moves", true, files);
+    if (!move_scan.success) {
+        return LoadResult(false, "Failed to load move data: " + move_scan.error_message);
+    }
+    return LoadResult(true);
+}
+
+PokemonData::LoadResult PokemonData::scanDataDirectory(const std::string& directory,
+                                                       const std::string& label, bool is_move,
+                                                       std::vector<ScannedFile>& files) const {
     try {
         // Check if directory exists
         if (!std::filesystem::exists(directory)) {
-            return LoadResult(false, "Moves directory does not exist: " + directory);
+            return LoadResult(false, label + " directory does not exist: " + directory);
         }
         
         if (!std::filesystem::is_directory(directory)) {
             return LoadResult(false, "Path is not a directory: " + directory);
         }
         
-        // Iterate through all JSON files in the directory
+        size_t first = files.size();
         for (const auto& entry : std::filesystem::directory_iterator(directory)) {
             if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                std::string file_path = entry.path().string();
-                
-                // Validate file accessibility
-                auto file_validation = InputValidator::validateFileAccessibility(file_path);
-                if (!file_validation.isValid()) {
-                    std::cerr << "Skipping inaccessible move file: " << file_path 
-                             << " (" << file_validation.errorMessage << ")" << std::endl;
-                    failed_count++;
-                    continue;
-                }
-                
-                // Load the move file
-                if (loadMoveFile(file_path)) {
-                    loaded_count++;
-                } else {
-                    failed_count++;
-                }
+                files.push_back({entry.path().string(), entry.last_write_time(), entry.file_size(),
+                                 is_move});
             }
         }
+        std::sort(files.begin() + static_cast<std::ptrdiff_t>(first), files.end(),
+                  [](const ScannedFile& a, const ScannedFile& b) { return a.path < b.path; });
         
-        return LoadResult(true, "Move data loaded", loaded_count, failed_count);
+        return LoadResult(true);
     }
     catch (const std::filesystem::filesystem_error& e) {
-        return LoadResult(false, "Filesystem error loading move data: " + std::string(e.what()));
-    }
-    catch (const std::exception& e) {
-        return LoadResult(false, "Error loading move data: " + std::string(e.what()));
+        return LoadResult(false, "Filesystem error scanning " + directory + ": " + std::string(e.what()));
     }
 }
 
-bool PokemonData::loadPokemonFile(const std::string& file_path) {
-    try {
-        std::ifstream file(file_path);
-        if (!file.is_open()) {
-            std::cerr << "Failed to open Pokemon file: " << file_path << std::endl;
-            return false;
+std::vector<PokemonData::ParsedFile> PokemonData::parseFiles(const std::vector<ScannedFile>& files,
+                                                             LoadResult& result) const {
+    unsigned int workers = loader_threads;
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers = static_cast<unsigned int>(std::max<size_t>(1,
+        std::min<size_t>(workers, (files.size() + kMinFilesPerThread - 1) / kMinFilesPerThread)));
+    result.threads_used = workers;
+    
+    // Each worker claims files through a shared counter and writes only to
+    // its claimed files' slots and its own log buffer
+    std::vector<std::ostringstream> logs(workers);
+    auto run_parallel = [&](const std::function<void(size_t, std::ostream&)>& task) {
+        std::atomic<size_t> next_file{0};
+        auto worker = [&](unsigned int worker_id) {
+            for (size_t i = next_file.fetch_add(1, std::memory_order_relaxed); i < files.size();
+                 i = next_file.fetch_add(1, std::memory_order_relaxed)) {
+                task(i, logs[worker_id]);
+            }
+        };
+        
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (unsigned int i = 1; i < workers; ++i) {
+            threads.emplace_back(worker, i);
+        }
+        worker(0);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+    
+    // Validation
+    auto validation_start = Clock::now();
+    std::vector<char> accessible(files.size(), 0);
+    run_parallel([&](size_t i, std::ostream& log) {
+        auto file_validation = InputValidator::validateFileAccessibility(files[i].path);
+        if (file_validation.isValid()) {
+            accessible[i] = 1;
+        } else {
+            log << "Skipping inaccessible " << (files[i].is_move ? "move" : "Pokemon")
+                << " file: " << files[i].path << " (" << file_validation.errorMessage << ")" << std::endl;
+        }
+    });
+    result.timings.validation = elapsed(validation_start, Clock::now());
+    
+    // Parse
+    auto parse_start = Clock::now();
+    std::vector<ParsedFile> parsed(files.size());
+    run_parallel([&](size_t i, std::ostream& log) {
+        if (!accessible[i]) return;
+        const auto& file = files[i];
+        std::ifstream stream(file.path, std::ios::binary);
+        if (!stream.is_open()) {
+            log << "Failed to open " << (file.is_move ? "move" : "Pokemon") << " file: "
+                << file.path << std::endl;
+            return;
         }
+        std::string contents((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
         
-        json pokemon_json;
-        file >> pokemon_json;
+        ParsedFile& outcome = parsed[i];
+        outcome.read = true;
+        outcome.hash = contentHash(contents);
+        outcome.parsed = file.is_move
+            ? parseMoveFile(file.path, contents, outcome.move, log)
+            : parsePokemonFile(file.path, contents, outcome.pokemon, log);
+    });
+    result.timings.parse = elapsed(parse_start, Clock::now());
+    
+    for (const auto& log : logs) {
+        std::cerr << log.str();
+    }
+    return parsed;
+}
+
+bool PokemonData::parsePokemonFile(const std::string& file_path, const std::string& contents,
+                                   PokemonInfo& pokemon_info, std::ostream& log) const {
+    try {
+        json pokemon_json = json::parse(contents);
         
         // Validate JSON structure
         if (!validatePokemonJson(pokemon_json)) {
-            std::cerr << "Invalid Pokemon JSON structure: " << file_path << std::endl;
+            log << "Invalid Pokemon JSON structure: " << file_path << std::endl;
             return false;
         }
         
         // Extract and validate Pokemon data using InputValidator
         auto name_result = InputValidator::getJsonString(pokemon_json, "name", 1, 50);
         if (!name_result.isValid()) {
-            std::cerr << "Invalid Pokemon name in file: " << file_path 
+            log << "Invalid Pokemon name in file: " << file_path 
                      << " (" << name_result.errorMessage << ")" << std::endl;
             return false;
         }
         
         auto id_result = InputValidator::getJsonInt(pokemon_json, "id", 1, 9999);
         if (!id_result.isValid()) {
-            std::cerr << "Invalid Pokemon ID in file: " << file_path 
+            log << "Invalid Pokemon ID in file: " << file_path 
                      << " (" << id_result.errorMessage << ")" << std::endl;
             return false;
         }
@@ -206,13 +633,13 @@ bool PokemonData::loadPokemonFile(const std::string& file_path) {
         }
         
         if (types.empty()) {
-            std::cerr << "No valid types found for Pokemon: " << file_path << std::endl;
+            log << "No valid types found for Pokemon: " << file_path << std::endl;
             return false;
         }
         
         // Extract base stats
         if (!pokemon_json.contains("base_stats") || !pokemon_json["base_stats"].is_object()) {
-            std::cerr << "Missing base_stats in Pokemon file: " << file_path << std::endl;
+            log << "Missing base_stats in Pokemon file: " << file_path << std::endl;
             return false;
         }
         
@@ -227,12 +654,11 @@ bool PokemonData::loadPokemonFile(const std::string& file_path) {
         
         if (!hp_result.isValid() || !attack_result.isValid() || !defense_result.isValid() ||
             !sp_attack_result.isValid() || !sp_defense_result.isValid() || !speed_result.isValid()) {
-            std::cerr << "Invalid base stats in Pokemon file: " << file_path << std::endl;
+            log << "Invalid base stats in Pokemon file: " << file_path << std::endl;
             return false;
         }
         
-        // Create PokemonInfo and store it
-        PokemonInfo pokemon_info(
+        pokemon_info = PokemonInfo(
             name_result.value,
             id_result.value,
             types,
@@ -244,42 +670,33 @@ bool PokemonData::loadPokemonFile(const std::string& file_path) {
             speed_result.value
         );
         
-        std::string normalized_name = normalizeName(name_result.value);
-        pokemon_data[normalized_name] = pokemon_info;
-        
         return true;
     }
     catch (const json::exception& e) {
-        std::cerr << "JSON parsing error in Pokemon file " << file_path << ": " << e.what() << std::endl;
+        log << "JSON parsing error in Pokemon file " << file_path << ": " << e.what() << std::endl;
         return false;
     }
     catch (const std::exception& e) {
-        std::cerr << "Error loading Pokemon file " << file_path << ": " << e.what() << std::endl;
+        log << "Error loading Pokemon file " << file_path << ": " << e.what() << std::endl;
         return false;
     }
 }
 
-bool PokemonData::loadMoveFile(const std::string& file_path) {
+bool PokemonData::parseMoveFile(const std::string& file_path, const std::string& contents,
+                                MoveInfo& move_info, std::ostream& log) const {
     try {
-        std::ifstream file(file_path);
-        if (!file.is_open()) {
-            std::cerr << "Failed to open move file: " << file_path << std::endl;
-            return false;
-        }
-        
-        json move_json;
-        file >> move_json;
+        json move_json = json::parse(contents);
         
         // Validate JSON structure
         if (!validateMoveJson(move_json)) {
-            std::cerr << "Invalid move JSON structure: " << file_path << std::endl;
+            log << "Invalid move JSON structure: " << file_path << std::endl;
             return false;
         }
         
         // Extract and validate move data using InputValidator
         auto name_result = InputValidator::getJsonString(move_json, "name", 1, 50);
         if (!name_result.isValid()) {
-            std::cerr << "Invalid move name in file: " << file_path 
+            log << "Invalid move name in file: " << file_path 
                      << " (" << name_result.errorMessage << ")" << std::endl;
             return false;
         }
@@ -298,7 +715,7 @@ bool PokemonData::loadMoveFile(const std::string& file_path) {
         
         if (!accuracy_result.isValid() || !power_result.isValid() || 
             !pp_result.isValid() || !priority_result.isValid()) {
-            std::cerr << "Invalid move stats in file: " << file_path << std::endl;
+            log << "Invalid move stats in file: " << file_path << std::endl;
             return false;
         }
         
@@ -348,8 +765,7 @@ bool PokemonData::loadMoveFile(const std::string& file_path) {
             }
         }
         
-        // Create MoveInfo and store it
-        MoveInfo move_info(
+        move_info = MoveInfo(
             name_result.value,
             accuracy_result.value,
             power_result.value,
@@ -362,38 +778,255 @@ bool PokemonData::loadMoveFile(const std::string& file_path) {
             ailment_chance
         );
         
-        std::string normalized_name = normalizeName(name_result.value);
-        move_data[normalized_name] = move_info;
-        
         return true;
     }
     catch (const json::exception& e) {
-        std::cerr << "JSON parsing error in move file " << file_path << ": " << e.what() << std::endl;
+        log << "JSON parsing error in move file " << file_path << ": " << e.what() << std::endl;
         return false;
     }
     catch (const std::exception& e) {
-        std::cerr << "Error loading move file " << file_path << ": " << e.what() << std::endl;
+        log << "Error loading move file " << file_path << ": " << e.what() << std::endl;
         return false;
     }
 }
 
-void PokemonData::organizeDataByTypes() {
+void PokemonData::organizeDataByTypes(Snapshot& snapshot) {
     // Clear existing type mappings
-    pokemon_by_type.clear();
-    moves_by_type.clear();
-    moves_by_damage_class.clear();
+    snapshot.pokemon_by_type.clear();
+    snapshot.moves_by_type.clear();
+    snapshot.moves_by_damage_class.clear();
     
     // Organize Pokemon by type
-    for (const auto& [name, pokemon] : pokemon_data) {
+    for (const auto& [name, pokemon] : snapshot.pokemon_data) {
         for (const auto& type : pokemon.types) {
-            pokemon_by_type[type].push_back(pokemon.name);
+            snapshot.pokemon_by_type[type].push_back(pokemon.name);
         }
     }
     
     // Organize moves by type and damage class
-    for (const auto& [name, move] : move_data) {
-        moves_by_type[move.type].push_back(move.name);
-        moves_by_damage_class[move.damage_class].push_back(move.name);
+    for (const auto& [name, move] : snapshot.move_data) {
+        snapshot.moves_by_type[move.type].push_back(move.name);
+        snapshot.moves_by_damage_class[move.damage_class].push_back(move.name);
+    }
+}
+
+void PokemonData::buildQueryIndex(Snapshot& snapshot) {
+    QueryIndex index;
+    
+    index.pokemon.reserve(snapshot.pokemon_data.size());
+    for (const auto& [key, pokemon] : snapshot.pokemon_data) {
+        index.pokemon.push_back(&pokemon);
+    }
+    std::sort(index.pokemon.begin(), index.pokemon.end(),
+              [](const PokemonInfo* a, const PokemonInfo* b) { return a->name < b->name; });
+    
+    const size_t pokemon_count = index.pokemon.size();
+    index.pokemon_names.reserve(pokemon_count);
+    for (const PokemonInfo* pokemon : index.pokemon) {
+        index.pokemon_names.push_back(pokemon->name);
+    }
+    for (EntryId id = 0; id < pokemon_count; ++id) {
+        for (const auto& type : index.pokemon[id]->types) {
+            setBit(index.pokemon_types[type], pokemon_count, id);
+        }
+    }
+    for (size_t stat = 0; stat < kStatFields.size(); ++stat) {
+        auto field = kStatFields[stat];
+        index.pokemon_by_stat[stat] = sortedByValue(
+            pokemon_count, [&](EntryId id) { return index.pokemon[id]->*field; });
+    }
+    
+    index.moves.reserve(snapshot.move_data.size());
+    for (const auto& [key, move] : snapshot.move_data) {
+        index.moves.push_back(&move);
+    }
+    std::sort(index.moves.begin(), index.moves.end(),
+              [](const MoveInfo* a, const MoveInfo* b) { return a->name < b->name; });
+    
+    const size_t move_count = index.moves.size();
+    index.move_names.reserve(move_count);
+    for (const MoveInfo* move : index.moves) {
+        index.move_names.push_back(move->name);
+    }
+    for (EntryId id = 0; id < move_count; ++id) {
+        const auto& move = *index.moves[id];
+        setBit(index.move_types[move.type], move_count, id);
+        setBit(index.move_damage_classes[move.damage_class], move_count, id);
+        setBit(index.move_ailments[move.ailment_name], move_count, id);
+    }
+    index.moves_by_power = sortedByValue(
+        move_count, [&](EntryId id) { return index.moves[id]->power; });
+    index.moves_by_priority = sortedByValue(
+        move_count, [&](EntryId id) { return index.moves[id]->priority; });
+    index.moves_by_accuracy = sortedByValue(
+        move_count, [&](EntryId id) { return index.moves[id]->accuracy; });
+    
+    snapshot.index = std::move(index);
+}
+
+bool PokemonData::updateQueryIndex(Snapshot& snapshot,
+                                   const std::set<std::pair<bool, std::string>>& changed) {
+    auto& index = snapshot.index;
+    if (snapshot.pokemon_data.size() != index.pokemon.size() ||
+        snapshot.move_data.size() != index.moves.size()) {
+        return false;
+    }
+    
+    // Ids of the changed entries; a name the index does not have yet means
+    // the ids shift and the index has to be built again
+    std::vector<EntryId> pokemon_ids;
+    std::vector<EntryId> move_ids;
+    for (const auto& [is_move, key] : changed) {
+        const std::string* name = nullptr;
+        if (is_move) {
+            auto it = snapshot.move_data.find(key);
+            name = it != snapshot.move_data.end() ? &it->second.name : nullptr;
+        } else {
+            auto it = snapshot.pokemon_data.find(key);
+            name = it != snapshot.pokemon_data.end() ? &it->second.name : nullptr;
+        }
+        if (name == nullptr) {
+            return false;
+        }
+        const auto& names = is_move ? index.move_names : index.pokemon_names;
+        auto position = std::lower_bound(names.begin(), names.end(), *name);
+        if (position == names.end() || *position != *name) {
+            return false;
+        }
+        (is_move ? move_ids : pokemon_ids).push_back(static_cast<EntryId>(position - names.begin()));
+    }
+    std::sort(pokemon_ids.begin(), pokemon_ids.end());
+    std::sort(move_ids.begin(), move_ids.end());
+    
+    // The index still points at the entries it was built from; clear their
+    // bits before pointing it at this snapshot's entries
+    for (EntryId id : pokemon_ids) {
+        for (const auto& type : index.pokemon[id]->types) {
+            clearBit(index.pokemon_types, type, id);
+        }
+    }
+    for (EntryId id : move_ids) {
+        const auto& move = *index.moves[id];
+        clearBit(index.move_types, move.type, id);
+        clearBit(index.move_damage_classes, move.damage_class, id);
+        clearBit(index.move_ailments, move.ailment_name, id);
+    }
+    for (EntryId id = 0; id < index.pokemon.size(); ++id) {
+        index.pokemon[id] = findByName(snapshot.pokemon_data, index.pokemon_names[id]);
+    }
+    for (EntryId id = 0; id < index.moves.size(); ++id) {
+        index.moves[id] = findByName(snapshot.move_data, index.move_names[id]);
+    }
+    
+    const size_t pokemon_count = index.pokemon.size();
+    for (EntryId id : pokemon_ids) {
+        for (const auto& type : index.pokemon[id]->types) {
+            setBit(index.pokemon_types[type], pokemon_count, id);
+        }
+    }
+    for (size_t stat = 0; stat < kStatFields.size(); ++stat) {
+        auto field = kStatFields[stat];
+        reorderIds(index.pokemon_by_stat[stat], pokemon_ids,
+                   [&](EntryId id) { return index.pokemon[id]->*field; });
+    }
+    
+    const size_t move_count = index.moves.size();
+    for (EntryId id : move_ids) {
+        const auto& move = *index.moves[id];
+        setBit(index.move_types[move.type], move_count, id);
+        setBit(index.move_damage_classes[move.damage_class], move_count, id);
+        setBit(index.move_ailments[move.ailment_name], move_count, id);
+    }
+    reorderIds(index.moves_by_power, move_ids, [&](EntryId id) { return index.moves[id]->power; });
+    reorderIds(index.moves_by_priority, move_ids, [&](EntryId id) { return index.moves[id]->priority; });
+    reorderIds(index.moves_by_accuracy, move_ids, [&](EntryId id) { return index.moves[id]->accuracy; });
+    return true;
+}
+
+std::vector<PokemonData::EntryId> PokemonData::Snapshot::findPokemon(const PokemonQuery& query) const {
+    Bits bits = allBits(index.pokemon.size());
+    for (const auto& type : query.types) {
+        intersectCategory(bits, index.pokemon_types, type);
+    }
+    for (const auto& type : query.excluded_types) {
+        auto it = index.pokemon_types.find(type);
+        if (it == index.pokemon_types.end()) {
+            continue;
+        }
+        for (size_t i = 0; i < bits.size(); ++i) {
+            bits[i] &= ~it->second[i];
+        }
+    }
+    
+    const std::array<const IntRange*, 6> ranges = {
+        &query.hp, &query.attack, &query.defense,
+        &query.special_attack, &query.special_defense, &query.speed,
+    };
+    for (size_t stat = 0; stat < ranges.size(); ++stat) {
+        auto field = kStatFields[stat];
+        intersectRange(bits, index.pokemon_by_stat[stat], *ranges[stat],
+                       [&](EntryId id) { return index.pokemon[id]->*field; });
+    }
+    return collectIds(bits);
+}
+
+const PokemonData::PokemonInfo* PokemonData::Snapshot::findPokemonInfo(const std::string& name) const {
+    return findByName(pokemon_data, name);
+}
+
+const PokemonData::MoveInfo* PokemonData::Snapshot::findMoveInfo(const std::string& name) const {
+    return findByName(move_data, name);
+}
+
+std::vector<PokemonData::EntryId> PokemonData::Snapshot::findMoves(const MoveQuery& query) const {
+    Bits bits = allBits(index.moves.size());
+    if (!query.type.empty()) {
+        intersectCategory(bits, index.move_types, query.type);
+    }
+    if (!query.damage_class.empty()) {
+        intersectCategory(bits, index.move_damage_classes, query.damage_class);
+    }
+    if (!query.ailment.empty()) {
+        intersectCategory(bits, index.move_ailments, query.ailment);
+    }
+    intersectRange(bits, index.moves_by_power, query.power,
+                   [&](EntryId id) { return index.moves[id]->power; });
+    intersectRange(bits, index.moves_by_priority, query.priority,
+                   [&](EntryId id) { return index.moves[id]->priority; });
+    intersectRange(bits, index.moves_by_accuracy, query.accuracy,
+                   [&](EntryId id) { return index.moves[id]->accuracy; });
+    return collectIds(bits);
+}
+
+void PokemonData::replaceEntry(Snapshot& snapshot, const std::string& key,
+                               const ParsedFile* parsed, bool is_move) {
+    if (is_move) {
+        auto it = snapshot.move_data.find(key);
+        if (it != snapshot.move_data.end()) {
+            removeFromIndex(snapshot.moves_by_type, it->second.type, it->second.name);
+            removeFromIndex(snapshot.moves_by_damage_class, it->second.damage_class, it->second.name);
+            snapshot.move_data.erase(it);
+        }
+        if (parsed != nullptr) {
+            const auto& move = snapshot.move_data[key] = parsed->move;
+            snapshot.moves_by_type[move.type].push_back(move.name);
+            snapshot.moves_by_damage_class[move.damage_class].push_back(move.name);
+        }
+        return;
+    }
+    
+    auto it = snapshot.pokemon_data.find(key);
+    if (it != snapshot.pokemon_data.end()) {
+        for (const auto& type : it->second.types) {
+            removeFromIndex(snapshot.pokemon_by_type, type, it->second.name);
+        }
+        snapshot.pokemon_data.erase(it);
+    }
+    if (parsed != nullptr) {
+        const auto& pokemon = snapshot.pokemon_data[key] = parsed->pokemon;
+        for (const auto& type : pokemon.types) {
+            snapshot.pokemon_by_type[type].push_back(pokemon.name);
+        }
     }
 }
 
@@ -430,76 +1063,82 @@ bool PokemonData::validateMoveJson(const nlohmann::json& json_data) const {
 
 // Public interface methods
 std::vector<std::string> PokemonData::getAvailablePokemon() const {
-    std::vector<std::string> pokemon_names;
-    pokemon_names.reserve(pokemon_data.size());
-    
-    for (const auto& [name, pokemon] : pokemon_data) {
-        pokemon_names.push_back(pokemon.name);
-    }
-    
-    std::sort(pokemon_names.begin(), pokemon_names.end());
-    return pokemon_names;
+    return snapshot()->index.pokemon_names;
+}
+
+std::shared_ptr<const std::vector<std::string>> PokemonData::pokemonNames() const {
+    auto data = snapshot();
+    return std::shared_ptr<const std::vector<std::string>>(data, &data->index.pokemon_names);
 }
 
 std::optional<PokemonData::PokemonInfo> PokemonData::getPokemonInfo(const std::string& name) const {
-    std::string normalized = normalizeName(name);
-    auto it = pokemon_data.find(normalized);
-    if (it != pokemon_data.end()) {
-        return it->second;
+    auto info = pokemonInfo(name);
+    if (info) {
+        return *info;
     }
     return std::nullopt;
 }
 
+std::shared_ptr<const PokemonData::PokemonInfo> PokemonData::pokemonInfo(const std::string& name) const {
+    // Share ownership of the snapshot, so the entry outlives a reload
+    auto data = snapshot();
+    const PokemonInfo* info = data->findPokemonInfo(name);
+    return info != nullptr ? std::shared_ptr<const PokemonInfo>(data, info) : nullptr;
+}
+
 bool PokemonData::hasPokemon(const std::string& name) const {
-    std::string normalized = normalizeName(name);
-    return pokemon_data.find(normalized) != pokemon_data.end();
+    return snapshot()->findPokemonInfo(name) != nullptr;
 }
 
 std::vector<std::string> PokemonData::getPokemonByType(const std::string& type) const {
-    auto it = pokemon_by_type.find(type);
-    if (it != pokemon_by_type.end()) {
+    auto data = snapshot();
+    auto it = data->pokemon_by_type.find(type);
+    if (it != data->pokemon_by_type.end()) {
         return it->second;
     }
     return {};
 }
 
 std::vector<std::string> PokemonData::getAvailableMoves() const {
-    std::vector<std::string> move_names;
-    move_names.reserve(move_data.size());
-    
-    for (const auto& [name, move] : move_data) {
-        move_names.push_back(move.name);
-    }
-    
-    std::sort(move_names.begin(), move_names.end());
-    return move_names;
+    return snapshot()->index.move_names;
+}
+
+std::shared_ptr<const std::vector<std::string>> PokemonData::moveNames() const {
+    auto data = snapshot();
+    return std::shared_ptr<const std::vector<std::string>>(data, &data->index.move_names);
 }
 
 std::optional<PokemonData::MoveInfo> PokemonData::getMoveInfo(const std::string& name) const {
-    std::string normalized = normalizeName(name);
-    auto it = move_data.find(normalized);
-    if (it != move_data.end()) {
-        return it->second;
+    auto info = moveInfo(name);
+    if (info) {
+        return *info;
     }
     return std::nullopt;
 }
 
+std::shared_ptr<const PokemonData::MoveInfo> PokemonData::moveInfo(const std::string& name) const {
+    auto data = snapshot();
+    const MoveInfo* info = data->findMoveInfo(name);
+    return info != nullptr ? std::shared_ptr<const MoveInfo>(data, info) : nullptr;
+}
+
 bool PokemonData::hasMove(const std::string& name) const {
-    std::string normalized = normalizeName(name);
-    return move_data.find(normalized) != move_data.end();
+    return snapshot()->findMoveInfo(name) != nullptr;
 }
 
 std::vector<std::string> PokemonData::getMovesByType(const std::string& type) const {
-    auto it = moves_by_type.find(type);
-    if (it != moves_by_type.end()) {
+    auto data = snapshot();
+    auto it = data->moves_by_type.find(type);
+    if (it != data->moves_by_type.end()) {
         return it->second;
     }
     return {};
 }
 
 std::vector<std::string> PokemonData::getMovesByDamageClass(const std::string& damage_class) const {
-    auto it = moves_by_damage_class.find(damage_class);
-    if (it != moves_by_damage_class.end()) {
+    auto data = snapshot();
+    auto it = data->moves_by_damage_class.find(damage_class);
+    if (it != data->moves_by_damage_class.end()) {
         return it->second;
     }
     return {};
@@ -507,14 +1146,17 @@ std::vector<std::string> PokemonData::getMovesByDamageClass(const std::string& d
 
 bool PokemonData::validateTeamEntry(const std::string& pokemon_name, 
                                    const std::vector<std::string>& move_names) const {
+    // Check everything against one snapshot
+    auto data = snapshot();
+    
     // Validate Pokemon name
-    if (!hasPokemon(pokemon_name)) {
+    if (data->findPokemonInfo(pokemon_name) == nullptr) {
         return false;
     }
     
     // Validate all move names
     for (const auto& move_name : move_names) {
-        if (!hasMove(move_name)) {
+        if (data->findMoveInfo(move_name) == nullptr) {
             return false;
         }
     }
@@ -525,125 +1167,89 @@ bool PokemonData::validateTeamEntry(const std::string& pokemon_name,
 std::vector<std::string> PokemonData::suggestMovesForPokemon(const std::string& pokemon_name, int count) const {
     std::vector<std::string> suggested_moves;
     
-    auto pokemon_info = getPokemonInfo(pokemon_name);
-    if (!pokemon_info.has_value()) {
+    // Suggest from one snapshot even if a reload lands meanwhile
+    auto data = snapshot();
+    const PokemonInfo* pokemon = data->findPokemonInfo(pokemon_name);
+    if (pokemon == nullptr) {
         return suggested_moves;
     }
     
     count = std::min(count, 4); // Maximum 4 moves
-    
-    // Get moves of the same type as the Pokemon (STAB moves)
-    for (const auto& type : pokemon_info->types) {
-        auto type_moves = getMovesByType(type);
-        for (const auto& move : type_moves) {
-            auto move_info = getMoveInfo(move);
-            if (move_info.has_value() && move_info->power > 0) { // Damaging moves
-                suggested_moves.push_back(move);
-                if (suggested_moves.size() >= static_cast<size_t>(count)) {
-                    return suggested_moves;
-                }
+    auto suggest = [&](const MoveQuery& query) {
+        for (EntryId id : data->findMoves(query)) {
+            if (suggested_moves.size() >= static_cast<size_t>(count)) {
+                return;
             }
-        }
-    }
-    
-    // Fill remaining slots with high-power moves of other types
-    auto all_moves = getAvailableMoves();
-    for (const auto& move : all_moves) {
-        auto move_info = getMoveInfo(move);
-        if (move_info.has_value() && move_info->power >= 80) {
-            // Check if we already have this move
+            const auto& move = data->move(id).name;
             if (std::find(suggested_moves.begin(), suggested_moves.end(), move) == suggested_moves.end()) {
                 suggested_moves.push_back(move);
-                if (suggested_moves.size() >= static_cast<size_t>(count)) {
-                    break;
-                }
             }
         }
+    };
+    
+    // Damaging moves of the same type as the Pokemon (STAB moves)
+    for (const auto& type : pokemon->types) {
+        MoveQuery stab;
+        stab.type = type;
+        stab.power.min = 1;
+        suggest(stab);
     }
     
+    // Fill remaining slots with high-power moves of other types
+    MoveQuery strong;
+    strong.power.min = 80;
+    suggest(strong);
+    
     return suggested_moves;
 }
 
+std::vector<std::string> PokemonData::findPokemonNames(const PokemonQuery& query) const {
+    auto data = snapshot();
+    std::vector<std::string> names;
+    for (EntryId id : data->findPokemon(query)) {
+        names.push_back(data->pokemon(id).name);
+    }
+    return names;
+}
+
+std::vector<std::string> PokemonData::findMoveNames(const MoveQuery& query) const {
+    auto data = snapshot();
+    std::vector<std::string> names;
+    for (EntryId id : data->findMoves(query)) {
+        names.push_back(data->move(id).name);
+    }
+    return names;
+}
+
 double PokemonData::getTypeEffectiveness(const std::string& attacking_type,
                                         const std::vector<std::string>& defending_types) const {
-    auto type_chart = getTypeChart();
-    double effectiveness = 1.0;
-    
-    for (const auto& defending_type : defending_types) {
-        auto attacking_it = type_chart.find(attacking_type);
-        if (attacking_it != type_chart.end()) {
-            auto defending_it = attacking_it->second.find(defending_type);
-            if (defending_it != attacking_it->second.end()) {
-                effectiveness *= defending_it->second;
-            }
-        }
-    }
-    
-    return effectiveness;
+    return TypeEffectiveness::getEffectivenessMultiplier(attacking_type, defending_types);
 }
 
 std::string PokemonData::getDataStatistics() const {
+    auto data = snapshot();
     std::ostringstream stats;
     stats << "Pokemon Data Statistics:\n";
-    stats << "  Pokemon loaded: " << pokemon_data.size() << "\n";
-    stats << "  Moves loaded: " << move_data.size() << "\n";
-    stats << "  Types represented: " << pokemon_by_type.size() << "\n";
-    stats << "  Move damage classes: " << moves_by_damage_class.size() << "\n";
+    stats << "  Pokemon loaded: " << data->pokemon_data.size() << "\n";
+    stats << "  Moves loaded: " << data->move_data.size() << "\n";
+    stats << "  Types represented: " << data->pokemon_by_type.size() << "\n";
+    stats << "  Move damage classes: " << data->moves_by_damage_class.size() << "\n";
     return stats.str();
 }
 
+uint64_t PokemonData::contentHash(const std::string& contents) {
+    // FNV-1a, 64-bit
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (unsigned char byte : contents) {
+        hash ^= byte;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
 void PokemonData::clearCache() {
-    pokemon_data.clear();
-    move_data.clear();
-    pokemon_by_type.clear();
-    moves_by_type.clear();
-    moves_by_damage_class.clear();
+    std::lock_guard<std::mutex> lock(reload_mutex);
+    source_files.clear();
+    publish(std::make_shared<Snapshot>());
     is_initialized = false;
 }
-
-std::unordered_map<std::string, std::unordered_map<std::string, double>> PokemonData::getTypeChart() const {
-    // Simplified type effectiveness chart - in a real implementation this would be more complete
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> type_chart;
-    
-    // Fire type effectiveness
-    type_chart["fire"]["grass"] = 2.0;
-    type_chart["fire"]["ice"] = 2.0;
-    type_chart["fire"]["bug"] = 2.0;
-    type_chart["fire"]["steel"] = 2.0;
-    type_chart["fire"]["fire"] = 0.5;
-    type_chart["fire"]["water"] = 0.5;
-    type_chart["fire"]["rock"] = 0.5;
-    type_chart["fire"]["dragon"] = 0.5;
-    
-    // Water type effectiveness
-    type_chart["water"]["fire"] = 2.0;
-    type_chart["water"]["ground"] = 2.0;
-    type_chart["water"]["rock"] = 2.0;
-    type_chart["water"]["water"] = 0.5;
-    type_chart["water"]["grass"] = 0.5;
-    type_chart["water"]["dragon"] = 0.5;
-    
-    // Grass type effectiveness
-    type_chart["grass"]["water"] = 2.0;
-    type_chart["grass"]["ground"] = 2.0;
-    type_chart["grass"]["rock"] = 2.0;
-    type_chart["grass"]["fire"] = 0.5;
-    type_chart["grass"]["grass"] = 0.5;
-    type_chart["grass"]["poison"] = 0.5;
-    type_chart["grass"]["flying"] = 0.5;
-    type_chart["grass"]["bug"] = 0.5;
-    type_chart["grass"]["dragon"] = 0.5;
-    type_chart["grass"]["steel"] = 0.5;
-    
-    // Electric type effectiveness
-    type_chart["electric"]["water"] = 2.0;
-    type_chart["electric"]["flying"] = 2.0;
-    type_chart["electric"]["electric"] = 0.5;
-    type_chart["electric"]["grass"] = 0.5;
-    type_chart["electric"]["dragon"] = 0.5;
-    type_chart["electric"]["ground"] = 0.0;
-    
-    // Add more type relationships as needed...
-    
-    return type_chart;
-}
\ No newline at end of file
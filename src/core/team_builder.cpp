@@ -9,11 +9,19 @@
 #include <chrono>
 #include <iomanip>
 #include <map>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <thread>
+#include <iterator>
+#include "battle.h"
+#include "ai_factory.h"
+#include "type_effectiveness.h"
 
 using json = nlohmann::json;
 
 TeamBuilder::TeamBuilder(std::shared_ptr<PokemonData> data) 
-    : pokemon_data(data), validation_settings(), templates_loaded(false) {
+    : pokemon_data(data), validation_settings(), templates_loaded(false), cache_generation(0) {
     if (!pokemon_data) {
         throw std::invalid_argument("PokemonData cannot be null");
     }
@@ -336,8 +344,8 @@ TeamBuilder::TeamAnalysis TeamBuilder::analyzeTeam(const Team& team) const {
     // Analyze moves
     for (const auto& pokemon : team.pokemon) {
         for (const auto& move_name : pokemon.moves) {
-            auto move_info = pokemon_data->getMoveInfo(move_name);
-            if (move_info.has_value()) {
+            auto move_info = pokemon_data->moveInfo(move_name);
+            if (move_info) {
                 if (move_info->damage_class == "physical") {
                     analysis.physical_moves++;
                 } else if (move_info->damage_class == "special") {
@@ -354,8 +362,8 @@ TeamBuilder::TeamAnalysis TeamBuilder::analyzeTeam(const Team& team) const {
     double total_sp_attack = 0, total_sp_defense = 0, total_speed = 0;
     
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
+        auto pokemon_info = pokemon_data->pokemonInfo(pokemon.name);
+        if (pokemon_info) {
             total_hp += pokemon_info->hp;
             total_attack += pokemon_info->attack;
             total_defense += pokemon_info->defense;
@@ -387,8 +395,8 @@ std::vector<std::string> TeamBuilder::getTeamTypes(const Team& team) const {
     std::set<std::string> unique_types;
     
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
+        auto pokemon_info = pokemon_data->pokemonInfo(pokemon.name);
+        if (pokemon_info) {
             for (const auto& type : pokemon_info->types) {
                 unique_types.insert(type);
             }
@@ -402,8 +410,8 @@ std::unordered_map<std::string, int> TeamBuilder::getTypeCounts(const Team& team
     std::unordered_map<std::string, int> type_counts;
     
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
+        auto pokemon_info = pokemon_data->pokemonInfo(pokemon.name);
+        if (pokemon_info) {
             for (const auto& type : pokemon_info->types) {
                 type_counts[type]++;
             }
@@ -439,8 +447,8 @@ int TeamBuilder::calculateBalanceScore(const Team& team) const {
     double total_sp_attack = 0, total_sp_defense = 0, total_speed = 0;
     
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
+        auto pokemon_info = pokemon_data->pokemonInfo(pokemon.name);
+        if (pokemon_info) {
             total_hp += pokemon_info->hp;
             total_attack += pokemon_info->attack;
             total_defense += pokemon_info->defense;
@@ -475,7 +483,8 @@ TeamBuilder::Team TeamBuilder::generateRandomTeam(const std::string& team_name,
     auto team = createTeam(team_name);
     team_size = std::min(6, std::max(1, team_size));
     
-    auto available_pokemon = pokemon_data->getAvailablePokemon();
+    auto available_pokemon_names = pokemon_data->pokemonNames();
+    const auto& available_pokemon = *available_pokemon_names;
     if (available_pokemon.empty()) {
         std::cout << "Error: No Pokemon data available for random team generation!" << std::endl;
         return team;
@@ -493,7 +502,8 @@ TeamBuilder::Team TeamBuilder::generateRandomTeam(const std::string& team_name,
         if (moves.empty()) {
             std::cout << "Warning: No moves generated for " << pokemon_name << std::endl;
             // Force add some basic moves as fallback
-            auto all_moves = pokemon_data->getAvailableMoves();
+            auto all_moves_names = pokemon_data->moveNames();
+            const auto& all_moves = *all_moves_names;
             if (!all_moves.empty()) {
                 moves.push_back(all_moves[0]); // Add at least one move
                 if (all_moves.size() > 1) moves.push_back(all_moves[1]);
@@ -547,7 +557,8 @@ TeamBuilder::Team TeamBuilder::generateBalancedTeam(const std::string& team_name
     
     // Fill remaining slots with random Pokemon
     while (team.size() < static_cast<size_t>(team_size)) {
-        auto available_pokemon = pokemon_data->getAvailablePokemon();
+        auto available_pokemon_names = pokemon_data->pokemonNames();
+        const auto& available_pokemon = *available_pokemon_names;
         std::random_device rd;
         std::mt19937 gen(rd());
         std::uniform_int_distribution<> dis(0, available_pokemon.size() - 1);
@@ -600,7 +611,8 @@ std::vector<std::string> TeamBuilder::generateMovesForPokemon(const std::string&
     
     // If we don't have enough moves, fill with random moves
     if (suggested_moves.size() < 4) {
-        auto all_moves = pokemon_data->getAvailableMoves();
+        auto all_moves_names = pokemon_data->moveNames();
+        const auto& all_moves = *all_moves_names;
         std::random_device rd;
         std::mt19937 gen(rd());
         
@@ -793,7 +805,8 @@ std::vector<std::string> TeamBuilder::suggestPokemonForTeam(const Team& team, in
     std::set<std::string> type_set(current_types.begin(), current_types.end());
     
     // Get all available Pokemon
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    auto all_pokemon_names = pokemon_data->pokemonNames();
+    const auto& all_pokemon = *all_pokemon_names;
     
     // Score Pokemon based on type diversity and team composition
     std::vector<std::pair<std::string, int>> pokemon_scores;
@@ -814,8 +827,8 @@ std::vector<std::string> TeamBuilder::suggestPokemonForTeam(const Team& team, in
             continue;
         }
         
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon_name);
-        if (!pokemon_info.has_value()) {
+        auto pokemon_info = pokemon_data->pokemonInfo(pokemon_name);
+        if (!pokemon_info) {
             continue;
         }
         
@@ -877,17 +890,15 @@ std::vector<std::string> TeamBuilder::suggestMovesForTeamPokemon(const Team& tea
     
     // If we need more suggestions, add some popular moves
     if (suggestions.size() < static_cast<size_t>(count)) {
-        auto all_moves = pokemon_data->getAvailableMoves();
+        PokemonData::MoveQuery damaging;
+        damaging.power.min = 1;
         
-        for (const auto& move : all_moves) {
+        for (const auto& move : pokemon_data->findMoveNames(damaging)) {
             if (suggestions.size() >= static_cast<size_t>(count)) break;
             
             if (current_moves.find(move) == current_moves.end() &&
                 std::find(suggestions.begin(), suggestions.end(), move) == suggestions.end()) {
-                auto move_info = pokemon_data->getMoveInfo(move);
-                if (move_info.has_value() && move_info->power > 0) {
-                    suggestions.push_back(move);
-                }
+                suggestions.push_back(move);
             }
         }
     }
@@ -912,8 +923,8 @@ std::vector<std::string> TeamBuilder::getTeamSuggestions(const Team& team) const
     // Check for common weaknesses
     std::unordered_map<std::string, int> weakness_count;
     for (const auto& pokemon : team.pokemon) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon.name);
-        if (pokemon_info.has_value()) {
+        auto pokemon_info = pokemon_data->pokemonInfo(pokemon.name);
+        if (pokemon_info) {
             auto weak_types = getWeakTypes(pokemon_info->types);
             for (const auto& weakness : weak_types) {
                 weakness_count[weakness]++;
@@ -931,8 +942,8 @@ std::vector<std::string> TeamBuilder::getTeamSuggestions(const Team& team) const
     std::unordered_map<std::string, int> move_type_count;
     for (const auto& pokemon : team.pokemon) {
         for (const auto& move_name : pokemon.moves) {
-            auto move_info = pokemon_data->getMoveInfo(move_name);
-            if (move_info.has_value()) {
+            auto move_info = pokemon_data->moveInfo(move_name);
+            if (move_info) {
                 move_type_count[move_info->type]++;
             }
         }
@@ -946,34 +957,28 @@ std::vector<std::string> TeamBuilder::getTeamSuggestions(const Team& team) const
 }
 
 std::unordered_map<std::string, double> TeamBuilder::calculateTypeCoverage(const Team& team) const {
-    std::unordered_map<std::string, double> coverage;
-    
-    // Get all possible target types
-    std::vector<std::string> all_types = {"normal", "fire", "water", "electric", "grass", "ice",
-                                         "fighting", "poison", "ground", "flying", "psychic",
-                                         "bug", "rock", "ghost", "dragon", "dark", "steel", "fairy"};
-    
-    // Initialize coverage map
-    for (const auto& type : all_types) {
-        coverage[type] = 1.0; // Neutral effectiveness by default
-    }
+    // Best effectiveness against each type from the team's moves, neutral by default
+    double best[kPokemonTypeCount];
+    std::fill(std::begin(best), std::end(best), 1.0);
     
-    // Calculate best effectiveness against each type from team's moves
     for (const auto& pokemon : team.pokemon) {
         for (const auto& move_name : pokemon.moves) {
-            auto move_info = pokemon_data->getMoveInfo(move_name);
-            if (move_info.has_value()) {
-                for (const auto& target_type : all_types) {
-                    double effectiveness = pokemon_data->getTypeEffectiveness(
-                        move_info->type, {target_type}
-                    );
-                    // Keep the best effectiveness for each target type
-                    coverage[target_type] = std::max(coverage[target_type], effectiveness);
+            auto move_info = pokemon_data->moveInfo(move_name);
+            if (move_info) {
+                PokemonType attacking_type = parsePokemonType(move_info->type);
+                for (int target = 0; target < kPokemonTypeCount; ++target) {
+                    double effectiveness = TypeEffectiveness::getEffectivenessMultiplier(
+                        attacking_type, static_cast<PokemonType>(target));
+                    best[target] = std::max(best[target], effectiveness);
                 }
             }
         }
     }
     
+    std::unordered_map<std::string, double> coverage;
+    for (int target = 0; target < kPokemonTypeCount; ++target) {
+        coverage[pokemonTypeName(static_cast<PokemonType>(target))] = best[target];
+    }
     return coverage;
 }
 
@@ -1157,37 +1162,19 @@ TeamBuilder::Team TeamBuilder::generateAdvancedRandomTeam(const RandomGeneration
     std::string team_name = custom_name.empty() ? "Random Team" : custom_name;
     Team team = createTeam(team_name);
     
-    // Get available Pokemon
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
-    if (all_pokemon.empty()) {
-        return team;
-    }
+    // Get available Pokemon, without banned types
+    PokemonData::PokemonQuery query;
+    query.excluded_types = settings.banned_types;
+    auto allowed_pokemon = pokemon_data->findPokemonNames(query);
     
     // Filter Pokemon based on settings
     std::vector<std::string> available_pokemon;
-    for (const auto& pokemon : all_pokemon) {
+    for (const auto& pokemon : allowed_pokemon) {
         // Skip legendaries if not allowed
         if (!settings.allow_legendaries && isPokemonLegendary(pokemon)) {
             continue;
         }
-        
-        // Check banned types
-        bool is_banned = false;
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon);
-        std::vector<std::string> pokemon_types;
-        if (pokemon_info.has_value()) {
-            pokemon_types = pokemon_info->types;
-        }
-        for (const auto& banned_type : settings.banned_types) {
-            if (std::find(pokemon_types.begin(), pokemon_types.end(), banned_type) != pokemon_types.end()) {
-                is_banned = true;
-                break;
-            }
-        }
-        
-        if (!is_banned) {
-            available_pokemon.push_back(pokemon);
-        }
+        available_pokemon.push_back(pokemon);
     }
     
     if (available_pokemon.empty()) {
@@ -1431,7 +1418,8 @@ TeamBuilder::Team TeamBuilder::convertTemplateToTeam(const TeamTemplate& templat
 
 std::vector<std::string> TeamBuilder::getPokemonByRole(const std::string& role, int count) const {
     // This is a simplified implementation - in a full version, Pokemon would have role metadata
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    auto all_pokemon_names = pokemon_data->pokemonNames();
+    const auto& all_pokemon = *all_pokemon_names;
     std::vector<std::string> role_pokemon;
     
     // Basic role categorization based on known Pokemon characteristics
@@ -2045,6 +2033,152 @@ TeamBuilder::TeamComparison TeamBuilder::compareTeams(const Team& team1, const T
     return comparison;
 }
 
+TeamBuilder::TeamComparison TeamBuilder::compareTeams(const Team& team1, const Team& team2,
+                                                      const SimulationSettings& simulation) const {
+    TeamComparison comparison = compareTeams(team1, team2);
+    
+    SimulationResult outcome = simulateBattleOutcome(team1, team2, simulation);
+    if (outcome.battles_played == 0) {
+        return comparison;  // Keep the heuristic prediction
+    }
+    
+    comparison.team1_win_probability = outcome.team1_win_probability;
+    comparison.simulation = outcome;
+    
+    std::stringstream reasoning;
+    reasoning << std::fixed << std::setprecision(1)
+              << team1.name << " won " << (outcome.team1_win_probability * 100.0) << "% of "
+              << outcome.battles_played << " simulated battles (95% CI "
+              << (outcome.confidence_low * 100.0) << "-" << (outcome.confidence_high * 100.0) << "%)";
+    comparison.battle_prediction_reasoning = reasoning.str();
+    
+    return comparison;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Monte Carlo Matchup Simulation Implementation
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+// Two-sided 95% normal quantile
+constexpr double kConfidenceZ = 1.96;
+
+// Wilson score interval; successes may be fractional since draws count as half
+std::pair<double, double> wilsonInterval(double successes, int trials) {
+    if (trials <= 0) {
+        return {0.0, 1.0};
+    }
+    const double n = static_cast<double>(trials);
+    const double p = successes / n;
+    const double z2 = kConfidenceZ * kConfidenceZ;
+    const double denominator = 1.0 + z2 / n;
+    const double centre = (p + z2 / (2.0 * n)) / denominator;
+    const double margin = kConfidenceZ * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denominator;
+    return {std::max(0.0, centre - margin), std::min(1.0, centre + margin)};
+}
+
+} // namespace
+
+TeamBuilder::SimulationResult TeamBuilder::simulateBattleOutcome(const Team& team1, const Team& team2,
+                                                                const SimulationSettings& settings) const {
+    SimulationResult result;
+    if (team1.pokemon.empty() || team2.pokemon.empty() || settings.max_battles <= 0) {
+        return result;
+    }
+    
+    // Load the battle teams once; every battle copies them
+    auto exported1 = exportTeamForBattle(team1);
+    auto exported2 = exportTeamForBattle(team2);
+    ::Team battle_team1;
+    ::Team battle_team2;
+    battle_team1.loadTeams(exported1.first, exported1.second, team1.name);
+    battle_team2.loadTeams(exported2.first, exported2.second, team2.name);
+    if (battle_team1.isEmpty() || battle_team2.isEmpty()) {
+        return result;
+    }
+    
+    unsigned int workers = settings.worker_threads;
+    if (workers == 0) {
+        workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers = std::min(workers, static_cast<unsigned int>(settings.max_battles));
+    
+    const bool has_deadline = settings.time_budget.count() > 0;
+    const auto deadline = std::chrono::steady_clock::now() + settings.time_budget;
+    
+    std::atomic<int> battles_claimed{0};
+    std::atomic<bool> stop{false};
+    std::mutex tally_mutex;
+    long long total_turns = 0;
+    
+    auto worker = [&](unsigned int worker_id) {
+        // Independent stream per worker, derived from the base seed
+        BattleRng stream = BattleRng(settings.seed).fork(worker_id);
+        
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (battles_claimed.fetch_add(1, std::memory_order_relaxed) >= settings.max_battles) {
+                break;
+            }
+            if (has_deadline && std::chrono::steady_clock::now() >= deadline) {
+                stop.store(true, std::memory_order_relaxed);
+                break;
+            }
+            
+            auto team1_ai = AIFactory::createAI(settings.ai_difficulty);
+            auto team2_ai = AIFactory::createAI(settings.ai_difficulty);
+            Battle battle(battle_team1, battle_team2);
+            battle.seedRandom(stream());
+            auto outcome = battle.runHeadless(*team1_ai, *team2_ai, settings.max_turns_per_battle);
+            
+            std::lock_guard<std::mutex> lock(tally_mutex);
+            switch (outcome.result) {
+                case Battle::BattleResult::PLAYER_WINS:
+                    result.team1_wins++;
+                    break;
+                case Battle::BattleResult::OPPONENT_WINS:
+                    result.team2_wins++;
+                    break;
+                default:
+                    result.draws++;
+                    break;
+            }
+            result.battles_played++;
+            total_turns += outcome.turns;
+            
+            if (settings.target_half_width > 0.0 && result.battles_played >= settings.min_battles &&
+                result.battles_played < settings.max_battles) {
+                auto interval = wilsonInterval(result.team1_wins + 0.5 * result.draws, result.battles_played);
+                if ((interval.second - interval.first) / 2.0 <= settings.target_half_width) {
+                    result.stopped_early = true;
+                    stop.store(true, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (unsigned int i = 1; i < workers; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    if (result.battles_played > 0) {
+        const double team1_score = result.team1_wins + 0.5 * result.draws;
+        result.team1_win_probability = team1_score / result.battles_played;
+        auto interval = wilsonInterval(team1_score, result.battles_played);
+        result.confidence_low = interval.first;
+        result.confidence_high = interval.second;
+        result.average_turns = static_cast<double>(total_turns) / result.battles_played;
+    }
+    
+    return result;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Battle History and Statistics Implementation
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -2202,7 +2336,77 @@ TeamBuilder::Team TeamBuilder::generateMetaOptimizedTeam(const RandomGenerationS
 TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, const std::string& team_name,
                                                    double strictness) const {
     Team counter_team = const_cast<TeamBuilder*>(this)->createTeam(team_name);
+    auto counter_pokemon = selectCounterPokemon(target_team, strictness, 6);
+    
+    // Add to team
+    for (const auto& pokemon : counter_pokemon) {
+        auto moves = generateMovesForPokemon(pokemon);
+        const_cast<TeamBuilder*>(this)->addPokemonToTeam(counter_team, pokemon, moves);
+    }
+    
+    return counter_team;
+}
+
+TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, const std::string& team_name,
+                                                   double strictness,
+                                                   const SimulationSettings& simulation) const {
+    Team best_team = generateCounterTeam(target_team, team_name, strictness);
+    if (best_team.pokemon.empty() || target_team.pokemon.empty()) {
+        return best_team;
+    }
+    
+    // Candidates beyond the heuristic picks are tried one slot at a time
+    auto candidates = selectCounterPokemon(target_team, strictness, 12);
+    std::vector<std::string> alternates;
+    for (const auto& pokemon : candidates) {
+        bool in_team = std::any_of(best_team.pokemon.begin(), best_team.pokemon.end(),
+            [&pokemon](const TeamPokemon& member) { return member.name == pokemon; });
+        if (!in_team) {
+            alternates.push_back(pokemon);
+        }
+    }
+    size_t swaps = std::min(alternates.size(), best_team.pokemon.size());
+    
+    // Split the budget evenly between the baseline and every swap
+    SimulationSettings per_candidate = simulation;
+    int evaluations = static_cast<int>(swaps) + 1;
+    per_candidate.max_battles = std::max(1, simulation.max_battles / evaluations);
+    per_candidate.min_battles = std::min(simulation.min_battles, per_candidate.max_battles);
+    per_candidate.time_budget = simulation.time_budget / evaluations;
+    // Baseline and variants all use the caller's seed, so each battle of a
+    // variant replays the same random stream as the baseline's: comparisons
+    // are paired and the chosen team is reproducible
+    per_candidate.seed = simulation.seed;
+    
+    double best_score = simulateBattleOutcome(best_team, target_team, per_candidate).team1_win_probability;
+    
+    for (size_t slot = 0; slot < swaps; ++slot) {
+        Team variant = const_cast<TeamBuilder*>(this)->createTeam(team_name);
+        for (size_t i = 0; i < best_team.pokemon.size(); ++i) {
+            if (i == slot) {
+                const_cast<TeamBuilder*>(this)->addPokemonToTeam(
+                    variant, alternates[slot], generateMovesForPokemon(alternates[slot]));
+            } else {
+                const_cast<TeamBuilder*>(this)->addPokemonToTeam(
+                    variant, best_team.pokemon[i].name, best_team.pokemon[i].moves);
+            }
+        }
+        if (variant.pokemon.size() != best_team.pokemon.size()) {
+            continue;  // Swap rejected by team validation
+        }
+        
+        double score = simulateBattleOutcome(variant, target_team, per_candidate).team1_win_probability;
+        if (score > best_score) {
+            best_team = variant;
+            best_score = score;
+        }
+    }
     
+    return best_team;
+}
+
+std::vector<std::string> TeamBuilder::selectCounterPokemon(const Team& target_team, double strictness,
+                                                           size_t count) const {
     // Analyze target team weaknesses
     std::vector<std::string> target_weaknesses;
     for (const auto& pokemon : target_team.pokemon) {
@@ -2222,18 +2426,18 @@ TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, cons
     target_weaknesses.erase(std::unique(target_weaknesses.begin(), target_weaknesses.end()), target_weaknesses.end());
     
     // Select counter Pokemon
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    auto all_pokemon_names = pokemon_data->pokemonNames();
+    const auto& all_pokemon = *all_pokemon_names;
     std::vector<std::string> counter_pokemon;
     
     for (const auto& weakness_type : target_weaknesses) {
-        for (const auto& pokemon : all_pokemon) {
-            if (counter_pokemon.size() >= 6) break;
+        PokemonData::PokemonQuery query;
+        query.types = {weakness_type};
+        for (const auto& pokemon : pokemon_data->findPokemonNames(query)) {
+            if (counter_pokemon.size() >= count) break;
             
-            auto types = getCachedPokemonTypes(pokemon);
-            if (std::find(types.begin(), types.end(), weakness_type) != types.end()) {
-                if (std::find(counter_pokemon.begin(), counter_pokemon.end(), pokemon) == counter_pokemon.end()) {
-                    counter_pokemon.push_back(pokemon);
-                }
+            if (std::find(counter_pokemon.begin(), counter_pokemon.end(), pokemon) == counter_pokemon.end()) {
+                counter_pokemon.push_back(pokemon);
             }
         }
     }
@@ -2242,7 +2446,7 @@ TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, cons
     if (strictness < 0.8) {
         std::vector<std::string> balanced_picks = {"snorlax", "alakazam", "gengar", "dragonite"};
         for (const auto& pokemon : balanced_picks) {
-            if (counter_pokemon.size() >= 6) break;
+            if (counter_pokemon.size() >= count) break;
             if (std::find(counter_pokemon.begin(), counter_pokemon.end(), pokemon) == counter_pokemon.end()) {
                 counter_pokemon.push_back(pokemon);
             }
@@ -2250,22 +2454,16 @@ TeamBuilder::Team TeamBuilder::generateCounterTeam(const Team& target_team, cons
     }
     
     // Ensure we have enough Pokemon
-    while (counter_pokemon.size() < 6 && counter_pokemon.size() < all_pokemon.size()) {
+    while (counter_pokemon.size() < count && counter_pokemon.size() < all_pokemon.size()) {
         for (const auto& pokemon : all_pokemon) {
-            if (counter_pokemon.size() >= 6) break;
+            if (counter_pokemon.size() >= count) break;
             if (std::find(counter_pokemon.begin(), counter_pokemon.end(), pokemon) == counter_pokemon.end()) {
                 counter_pokemon.push_back(pokemon);
             }
         }
     }
     
-    // Add to team
-    for (size_t i = 0; i < std::min(counter_pokemon.size(), size_t(6)); ++i) {
-        auto moves = generateMovesForPokemon(counter_pokemon[i]);
-        const_cast<TeamBuilder*>(this)->addPokemonToTeam(counter_team, counter_pokemon[i], moves);
-    }
-    
-    return counter_team;
+    return counter_pokemon;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -2782,7 +2980,8 @@ std::string TeamBuilder::getTeamStatisticsFilePath() const {
 
 // Performance optimization helper methods
 void TeamBuilder::preloadPokemonData() const {
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    auto all_pokemon_names = pokemon_data->pokemonNames();
+    const auto& all_pokemon = *all_pokemon_names;
     for (const auto& pokemon : all_pokemon) {
         getCachedPokemonTypes(pokemon);
         getCachedPokemonMoves(pokemon);
@@ -2794,7 +2993,16 @@ void TeamBuilder::clearPerformanceCaches() const {
     pokemon_moves_cache.clear();
 }
 
+void TeamBuilder::dropStaleCaches() const {
+    uint64_t generation = pokemon_data->generation();
+    if (generation != cache_generation) {
+        clearPerformanceCaches();
+        cache_generation = generation;
+    }
+}
+
 std::vector<std::string> TeamBuilder::getCachedPokemonTypes(const std::string& pokemon_name) const {
+    dropStaleCaches();
     auto it = pokemon_type_cache.find(pokemon_name);
     if (it != pokemon_type_cache.end()) {
         return it->second;
@@ -2802,11 +3010,9 @@ std::vector<std::string> TeamBuilder::getCachedPokemonTypes(const std::string& p
     
     // Load from Pokemon data and cache
     std::vector<std::string> types;
-    if (pokemon_data->hasPokemon(pokemon_name)) {
-        auto pokemon_info = pokemon_data->getPokemonInfo(pokemon_name);
-        if (pokemon_info) {
-            types = pokemon_info->types;
-        }
+    auto pokemon_info = pokemon_data->pokemonInfo(pokemon_name);
+    if (pokemon_info) {
+        types = pokemon_info->types;
     }
     
     pokemon_type_cache[pokemon_name] = types;
@@ -2814,6 +3020,7 @@ std::vector<std::string> TeamBuilder::getCachedPokemonTypes(const std::string& p
 }
 
 std::vector<std::string> TeamBuilder::getCachedPokemonMoves(const std::string& pokemon_name) const {
+    dropStaleCaches();
     auto it = pokemon_moves_cache.find(pokemon_name);
     if (it != pokemon_moves_cache.end()) {
         return it->second;
@@ -2855,7 +3062,8 @@ std::vector<std::string> TeamBuilder::getCounterPokemon(const std::string& targe
     std::vector<std::string> counters;
     auto target_types = getCachedPokemonTypes(target_pokemon);
     
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    auto all_pokemon_names = pokemon_data->pokemonNames();
+    const auto& all_pokemon = *all_pokemon_names;
     for (const auto& pokemon : all_pokemon) {
         auto pokemon_types = getCachedPokemonTypes(pokemon);
         
@@ -2924,7 +3132,8 @@ std::vector<std::string> TeamBuilder::optimizeTeamComposition(const std::vector<
     
     // If we're missing important types, try to replace some Pokemon
     std::vector<std::string> important_types = {"fire", "water", "electric", "psychic"};
-    auto all_pokemon = pokemon_data->getAvailablePokemon();
+    auto all_pokemon_names = pokemon_data->pokemonNames();
+    const auto& all_pokemon = *all_pokemon_names;
     
     for (const auto& needed_type : important_types) {
         if (team_types.count(needed_type) == 0 && optimized.size() < 6) {
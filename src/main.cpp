@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "battle.h"
+#include "data_pack.h"
 #include "input_validator.h"
 #include "team_builder.h"
 #include "pokemon_data.h"
@@ -755,6 +756,10 @@ int main() {
   
   std::cout << "\nWelcome, " << userName << "!" << std::endl;
 
+  // Compile data/ into the binary pack on first run, or when the JSON changed;
+  // without it everything below falls back to reading the JSON files
+  DataPack::ensureCurrent();
+
   // Initialize Pokemon data and team builder
   std::shared_ptr<PokemonData> pokemonData = std::make_shared<PokemonData>();
   auto initResult = pokemonData->initialize();
@@ -0,0 +1,264 @@
+#include "async_event_listener.h"
+#include "pokemon.h"
+#include <chrono>
+
+namespace {
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// Bounds a parked consumer's sleep, in case a wake-up races past it
+constexpr auto kParkTimeout = std::chrono::milliseconds(1);
+
+// Always queued, whatever the target wants: stand-ins are kept per battle
+constexpr BattleEvents::EventMask kBattleBounds =
+    BattleEvents::eventBit(BattleEvents::EventType::BATTLE_START) |
+    BattleEvents::eventBit(BattleEvents::EventType::BATTLE_END);
+
+} // namespace
+
+AsyncEventListener::AsyncEventListener(std::shared_ptr<BattleEvents::BattleEventListener> target)
+    : AsyncEventListener(std::move(target), Config()) {}
+
+AsyncEventListener::AsyncEventListener(std::shared_ptr<BattleEvents::BattleEventListener> target,
+                                       const Config& config)
+    : target_(std::move(target)),
+      targetEvents_(target_ ? target_->subscribedEvents() : 0),
+      events_(targetEvents_ | kBattleBounds),
+      overflow_(config.overflow),
+      sampleEvery_(config.sampleEvery > 0 ? config.sampleEvery : 1),
+      slots_(roundUpToPowerOfTwo(config.capacity > 1 ? config.capacity : 2)),
+      mask_(slots_.size() - 1) {
+    consumer_ = std::thread([this] { consume(); });
+}
+
+AsyncEventListener::~AsyncEventListener() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_.store(true);
+    }
+    wake_.notify_one();
+    consumer_.join();
+}
+
+void AsyncEventListener::onHealthChanged(const BattleEvents::HealthChangeEvent& event) {
+    push(event, event.pokemon, event.attacker, event.move);
+}
+void AsyncEventListener::onStatusChanged(const BattleEvents::StatusChangeEvent& event) {
+    push(event, event.pokemon);
+}
+void AsyncEventListener::onMoveUsed(const BattleEvents::MoveUsedEvent& event) {
+    push(event, event.user, event.target, event.move);
+}
+void AsyncEventListener::onWeatherChanged(const BattleEvents::WeatherChangeEvent& event) { push(event); }
+void AsyncEventListener::onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) {
+    push(event, event.oldPokemon, event.newPokemon);
+}
+void AsyncEventListener::onBattleStart(const BattleEvents::BattleStartEvent& event) {
+    push(event, event.playerStartPokemon, event.aiStartPokemon);
+}
+void AsyncEventListener::onBattleEnd(const BattleEvents::BattleEndEvent& event) { push(event); }
+void AsyncEventListener::onTurnStart(int turnNumber) { push(TurnEvent{turnNumber, false}); }
+void AsyncEventListener::onTurnEnd(int turnNumber) { push(TurnEvent{turnNumber, true}); }
+void AsyncEventListener::onMultiTurnMove(const BattleEvents::MultiTurnMoveEvent& event) {
+    push(event, event.pokemon, nullptr, event.move);
+}
+
+void AsyncEventListener::push(const QueuedEvent& event, const Pokemon* first,
+                              const Pokemon* second, const Move* move) {
+    queued_.fetch_add(1, std::memory_order_relaxed);
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+    auto used = [&] {
+        if (tail - cachedHead_ >= slots_.size()) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+        }
+        return tail - cachedHead_;
+    };
+
+    if (overflow_ == OverflowPolicy::SAMPLE && used() > slots_.size() / 2) {
+        // The cached head only ever lags, so confirm against the consumer's
+        // position before sampling a ring that may have drained
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        if (used() > slots_.size() / 2 && sampleCounter_++ % sampleEvery_ != 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            sampledOut_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    if (used() >= slots_.size()) {
+        if (overflow_ != OverflowPolicy::BLOCK) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        while (used() >= slots_.size()) {
+            std::this_thread::yield();
+        }
+    }
+
+    Slot& slot = slots_[tail & mask_];
+    slot.event = event;
+    capture(slot.pokemon[0], first);
+    capture(slot.pokemon[1], second);
+    slot.move = move ? *move : Move();
+    // Sequentially consistent with consumerParked_, so either the consumer
+    // sees this event before parking or we see it parked and wake it
+    tail_.store(tail + 1);
+    if (consumerParked_.load()) {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wake_.notify_one();
+    }
+}
+
+void AsyncEventListener::consume() {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    while (true) {
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+        if (head != cachedTail_) {
+            deliver(slots_[head & mask_]);
+            head_.store(++head, std::memory_order_release);
+            continue;
+        }
+        if (stopping_.load()) {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        consumerParked_.store(true);
+        if (tail_.load() == head && !stopping_.load()) {
+            wake_.wait_for(lock, kParkTimeout);
+        }
+        consumerParked_.store(false);
+    }
+}
+
+void AsyncEventListener::capture(PokemonState& state, const Pokemon* pokemon) {
+    state.identity = pokemon;
+    if (!pokemon) {
+        return;
+    }
+    // Reuses the slot's buffer, so names don't allocate once the ring is warm
+    state.name.assign(pokemon->name);
+    state.hp = pokemon->hp;
+    state.currentHp = pokemon->current_hp;
+    state.status = pokemon->status;
+}
+
+Pokemon* AsyncEventListener::standIn(const PokemonState& state) {
+    if (!state.identity) {
+        return nullptr;
+    }
+    std::unique_ptr<Pokemon>& pokemon = standIns_[state.identity];
+    if (!pokemon) {
+        pokemon = std::make_unique<Pokemon>();
+    }
+    pokemon->name = state.name;
+    pokemon->hp = state.hp;
+    pokemon->current_hp = state.currentHp;
+    pokemon->status = state.status;
+    return pokemon.get();
+}
+
+void AsyncEventListener::deliver(Slot& slot) {
+    QueuedEvent& event = slot.event;
+    // Stand-ins last one battle, so they don't pile up across battles
+    if (event.index() == 5) {
+        standIns_.clear();
+    }
+    if (!target_) {
+        return;
+    }
+    // Point the event at the stand-ins and the slot's move copy, never at
+    // the battle's own objects
+    Pokemon* first = standIn(slot.pokemon[0]);
+    Pokemon* second = standIn(slot.pokemon[1]);
+    const Move* move = &slot.move;
+    try {
+        switch (event.index()) {
+            case 0: {
+                auto health = std::get<0>(event);
+                health.pokemon = first;
+                health.attacker = second;
+                health.move = health.move ? move : nullptr;
+                target_->onHealthChanged(health);
+                break;
+            }
+            case 1: {
+                auto status = std::get<1>(event);
+                status.pokemon = first;
+                target_->onStatusChanged(status);
+                break;
+            }
+            case 2: {
+                auto used = std::get<2>(event);
+                used.user = first;
+                used.target = second;
+                used.move = used.move ? move : nullptr;
+                target_->onMoveUsed(used);
+                break;
+            }
+            case 3: target_->onWeatherChanged(std::get<3>(event)); break;
+            case 4: {
+                auto switched = std::get<4>(event);
+                switched.oldPokemon = first;
+                switched.newPokemon = second;
+                target_->onPokemonSwitch(switched);
+                break;
+            }
+            case 5: {
+                if (!(targetEvents_ & BattleEvents::eventBit(BattleEvents::EventType::BATTLE_START))) {
+                    break;
+                }
+                auto start = std::get<5>(event);
+                start.playerStartPokemon = first;
+                start.aiStartPokemon = second;
+                target_->onBattleStart(start);
+                break;
+            }
+            case 6:
+                if (targetEvents_ & BattleEvents::eventBit(BattleEvents::EventType::BATTLE_END)) {
+                    target_->onBattleEnd(std::get<6>(event));
+                }
+                break;
+            case 7: {
+                auto multiTurn = std::get<7>(event);
+                multiTurn.pokemon = first;
+                multiTurn.move = multiTurn.move ? move : nullptr;
+                target_->onMultiTurnMove(multiTurn);
+                break;
+            }
+            case 8: {
+                const TurnEvent& turn = std::get<8>(event);
+                if (turn.isEnd) {
+                    target_->onTurnEnd(turn.turnNumber);
+                } else {
+                    target_->onTurnStart(turn.turnNumber);
+                }
+                break;
+            }
+        }
+    } catch (...) {
+        // As in BattleEventManager, a throwing listener doesn't stop delivery
+    }
+    if (event.index() == 6) {
+        standIns_.clear();
+    }
+}
+
+void AsyncEventListener::flush() {
+    uint64_t target = tail_.load(std::memory_order_relaxed);
+    while (head_.load(std::memory_order_acquire) < target) {
+        if (consumerParked_.load()) {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            wake_.notify_one();
+        }
+        std::this_thread::yield();
+    }
+}
@@ -9,6 +9,12 @@ HealthBarEventListener::HealthBarEventListener(std::shared_ptr<HealthBarAnimator
     }
 }
 
+BattleEvents::EventMask HealthBarEventListener::subscribedEvents() const {
+    return BattleEvents::eventBit(BattleEvents::EventType::HEALTH_CHANGED) |
+           BattleEvents::eventBit(BattleEvents::EventType::BATTLE_START) |
+           BattleEvents::eventBit(BattleEvents::EventType::POKEMON_SWITCH);
+}
+
 void HealthBarEventListener::onHealthChanged(const BattleEvents::HealthChangeEvent& event) {
     if (!event.pokemon || !isPokemonRegistered(event.pokemon)) {
         return;
@@ -24,9 +30,7 @@ void HealthBarEventListener::onHealthChanged(const BattleEvents::HealthChangeEve
         std::cout << pokemonName << " healed " << (-event.damage) << " HP";
     }
     
-    if (!event.source.empty()) {
-        std::cout << " from " << event.source;
-    }
+    std::cout << " from " << BattleEvents::describeHealthSource(event);
     std::cout << std::endl;
 }
 
@@ -46,7 +50,7 @@ void HealthBarEventListener::onPokemonSwitch(const BattleEvents::PokemonSwitchEv
         registerPokemon(event.newPokemon, prefix);
         
         // Initialize health bar for the new Pokemon (no previous health for switches)
-        updateHealthBar(event.newPokemon, event.newPokemon->current_hp, -1, "switch");
+        updateHealthBar(event.newPokemon, event.newPokemon->current_hp, -1, BattleEvents::EventSource::SWITCH);
     }
 }
 
@@ -94,7 +98,7 @@ std::string HealthBarEventListener::getPokemonDisplayName(Pokemon* pokemon) cons
     return (it != pokemonDisplayNames_.end()) ? it->second : "Unknown Pokemon";
 }
 
-void HealthBarEventListener::updateHealthBar(Pokemon* pokemon, int newHealth, int previousHealth, const std::string& /*source*/) {
+void HealthBarEventListener::updateHealthBar(Pokemon* pokemon, int newHealth, int previousHealth, BattleEvents::EventSource /*source*/) {
     if (!animator_ || !pokemon) return;
     
     std::string pokemonName = getPokemonDisplayName(pokemon);
@@ -1,6 +1,7 @@
 #include "input_validator.h"
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <filesystem>
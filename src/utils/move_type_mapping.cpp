@@ -1,434 +1,383 @@
 #include "move_type_mapping.h"
 
-// Static member initialisation
-std::map<std::string, std::string> MoveTypeMapping::moveTypeMap;
-bool MoveTypeMapping::initialised = false;
+#include <algorithm>
+#include <iterator>
 
-void MoveTypeMapping::ensureInitialised() {
-  if (!initialised) {
-    initialiseMoveTypes();
-    initialised = true;
-  }
-}
-
-std::string MoveTypeMapping::getMoveType(const std::string &moveName) {
-  ensureInitialised();
-
-  auto it = moveTypeMap.find(moveName);
-  if (it != moveTypeMap.end()) {
-    return it->second;
-  }
-
-  // Default to normal type if move not found
-  return "normal";
-}
-
-void MoveTypeMapping::initialiseMoveTypes() {
-  // Normal type moves
-  moveTypeMap["tackle"] = "normal";
-  moveTypeMap["scratch"] = "normal";
-  moveTypeMap["pound"] = "normal";
-  moveTypeMap["pay-day"] = "normal";
-  moveTypeMap["mega-punch"] = "normal";
-  moveTypeMap["mega-kick"] = "normal";
-  moveTypeMap["headbutt"] = "normal";
-  moveTypeMap["body-slam"] = "normal";
-  moveTypeMap["wrap"] = "normal";
-  moveTypeMap["take-down"] = "normal";
-  moveTypeMap["double-edge"] = "normal";
-  moveTypeMap["tail-whip"] = "normal";
-  moveTypeMap["leer"] = "normal";
-  moveTypeMap["growl"] = "normal";
-  moveTypeMap["roar"] = "normal";
-  moveTypeMap["sing"] = "normal";
-  moveTypeMap["supersonic"] = "normal";
-  moveTypeMap["sonic-boom"] = "normal";
-  moveTypeMap["disable"] = "normal";
-  moveTypeMap["hyper-beam"] = "normal";
-  moveTypeMap["strength"] = "normal";
-  moveTypeMap["growth"] = "normal";
-  moveTypeMap["quick-attack"] = "normal";
-  moveTypeMap["rage"] = "normal";
-  moveTypeMap["mimic"] = "normal";
-  moveTypeMap["screech"] = "normal";
-  moveTypeMap["double-team"] = "normal";
-  moveTypeMap["recover"] = "normal";
-  moveTypeMap["harden"] = "normal";
-  moveTypeMap["minimize"] = "normal";
-  moveTypeMap["smokescreen"] = "normal";
-  moveTypeMap["confuse-ray"] = "normal";
-  moveTypeMap["withdraw"] = "normal";
-  moveTypeMap["defense-curl"] = "normal";
-  moveTypeMap["barrier"] = "normal";
-  moveTypeMap["light-screen"] = "normal";
-  moveTypeMap["haze"] = "normal";
-  moveTypeMap["reflect"] = "normal";
-  moveTypeMap["focus-energy"] = "normal";
-  moveTypeMap["bide"] = "normal";
-  moveTypeMap["metronome"] = "normal";
-  moveTypeMap["mirror-move"] = "normal";
-  moveTypeMap["self-destruct"] = "normal";
-  moveTypeMap["egg-bomb"] = "normal";
-  moveTypeMap["swift"] = "normal";
-  moveTypeMap["skull-bash"] = "normal";
-  moveTypeMap["spike-cannon"] = "normal";
-  moveTypeMap["constrict"] = "normal";
-  moveTypeMap["amnesia"] = "normal";
-  moveTypeMap["soft-boiled"] = "normal";
-  moveTypeMap["dizzy-punch"] = "normal";
-  moveTypeMap["flash"] = "normal";
-  moveTypeMap["splash"] = "normal";
-  moveTypeMap["explosion"] = "normal";
-  moveTypeMap["fury-swipes"] = "normal";
-  moveTypeMap["bonemerang"] = "normal";
-  moveTypeMap["rest"] = "normal";
-  moveTypeMap["rock-slide"] = "normal";
-  moveTypeMap["hyper-fang"] = "normal";
-  moveTypeMap["sharpen"] = "normal";
-  moveTypeMap["conversion"] = "normal";
-  moveTypeMap["tri-attack"] = "normal";
-  moveTypeMap["super-fang"] = "normal";
-  moveTypeMap["slash"] = "normal";
-  moveTypeMap["substitute"] = "normal";
-  moveTypeMap["struggle"] = "normal";
-
-  // Fire type moves
-  moveTypeMap["ember"] = "fire";
-  moveTypeMap["flamethrower"] = "fire";
-  moveTypeMap["fire-punch"] = "fire";
-  moveTypeMap["fire-blast"] = "fire";
-  moveTypeMap["fire-spin"] = "fire";
-  moveTypeMap["flame-wheel"] = "fire";
-  moveTypeMap["fire-fang"] = "fire";
-  moveTypeMap["blaze-kick"] = "fire";
-  moveTypeMap["heat-wave"] = "fire";
-  moveTypeMap["flare-blitz"] = "fire";
-  moveTypeMap["lava-plume"] = "fire";
-
-  // Water type moves
-  moveTypeMap["water-gun"] = "water";
-  moveTypeMap["hydro-pump"] = "water";
-  moveTypeMap["surf"] = "water";
-  moveTypeMap["ice-beam"] = "water";
-  moveTypeMap["blizzard"] = "water";
-  moveTypeMap["bubble-beam"] = "water";
-  moveTypeMap["water-pulse"] = "water";
-  moveTypeMap["aqua-tail"] = "water";
-  moveTypeMap["scald"] = "water";
-  moveTypeMap["bubble"] = "water";
-  moveTypeMap["crabhammer"] = "water";
-  moveTypeMap["clamp"] = "water";
-  moveTypeMap["withdraw"] = "water";
-  moveTypeMap["aqua-jet"] = "water";
-  moveTypeMap["brine"] = "water";
-  moveTypeMap["aqua-ring"] = "water";
-
-  // Electric type moves
-  moveTypeMap["thunder-shock"] = "electric";
-  moveTypeMap["thunderbolt"] = "electric";
-  moveTypeMap["thunder-wave"] = "electric";
-  moveTypeMap["thunder"] = "electric";
-  moveTypeMap["thunder-punch"] = "electric";
-  moveTypeMap["spark"] = "electric";
-  moveTypeMap["shock-wave"] = "electric";
-  moveTypeMap["discharge"] = "electric";
-  moveTypeMap["charge-beam"] = "electric";
-  moveTypeMap["thunder-fang"] = "electric";
+namespace {
 
-  // Grass type moves
-  moveTypeMap["vine-whip"] = "grass";
-  moveTypeMap["razor-leaf"] = "grass";
-  moveTypeMap["solar-beam"] = "grass";
-  moveTypeMap["petal-dance"] = "grass";
-  moveTypeMap["absorb"] = "grass";
-  moveTypeMap["mega-drain"] = "grass";
-  moveTypeMap["leech-seed"] = "grass";
-  moveTypeMap["growth"] = "grass";
-  moveTypeMap["sleep-powder"] = "grass";
-  moveTypeMap["poison-powder"] = "grass";
-  moveTypeMap["stun-spore"] = "grass";
-  moveTypeMap["string-shot"] = "grass";
-  moveTypeMap["spore"] = "grass";
-  moveTypeMap["cotton-spore"] = "grass";
-  moveTypeMap["giga-drain"] = "grass";
-  moveTypeMap["synthesis"] = "grass";
-  moveTypeMap["magical-leaf"] = "grass";
-  moveTypeMap["leaf-blade"] = "grass";
-  moveTypeMap["energy-ball"] = "grass";
-  moveTypeMap["leaf-storm"] = "grass";
-  moveTypeMap["power-whip"] = "grass";
-  moveTypeMap["seed-bomb"] = "grass";
+struct MoveTypeEntry {
+  std::string_view name;
+  PokemonType type;
+};
 
-  // Ice type moves
-  moveTypeMap["ice-beam"] = "ice";
-  moveTypeMap["blizzard"] = "ice";
-  moveTypeMap["aurora-beam"] = "ice";
-  moveTypeMap["ice-punch"] = "ice";
-  moveTypeMap["powder-snow"] = "ice";
-  moveTypeMap["icy-wind"] = "ice";
-  moveTypeMap["mist"] = "ice";
-  moveTypeMap["haze"] = "ice";
-  moveTypeMap["ice-shard"] = "ice";
-  moveTypeMap["avalanche"] = "ice";
-  moveTypeMap["ice-fang"] = "ice";
-  moveTypeMap["sheer-cold"] = "ice";
-  moveTypeMap["icicle-spear"] = "ice";
+using T = PokemonType;
 
-  // Fighting type moves
-  moveTypeMap["karate-chop"] = "fighting";
-  moveTypeMap["double-kick"] = "fighting";
-  moveTypeMap["jump-kick"] = "fighting";
-  moveTypeMap["rolling-kick"] = "fighting";
-  moveTypeMap["sand-attack"] = "fighting";
-  moveTypeMap["headbutt"] = "fighting";
-  moveTypeMap["horn-attack"] = "fighting";
-  moveTypeMap["fury-attack"] = "fighting";
-  moveTypeMap["horn-drill"] = "fighting";
-  moveTypeMap["tackle"] = "fighting";
-  moveTypeMap["body-slam"] = "fighting";
-  moveTypeMap["wrap"] = "fighting";
-  moveTypeMap["take-down"] = "fighting";
-  moveTypeMap["thrash"] = "fighting";
-  moveTypeMap["double-edge"] = "fighting";
-  moveTypeMap["low-kick"] = "fighting";
-  moveTypeMap["counter"] = "fighting";
-  moveTypeMap["seismic-toss"] = "fighting";
-  moveTypeMap["submission"] = "fighting";
-  moveTypeMap["high-jump-kick"] = "fighting";
-  moveTypeMap["mach-punch"] = "fighting";
-  moveTypeMap["dynamic-punch"] = "fighting";
-  moveTypeMap["focus-punch"] = "fighting";
-  moveTypeMap["superpower"] = "fighting";
-  moveTypeMap["revenge"] = "fighting";
-  moveTypeMap["brick-break"] = "fighting";
-  moveTypeMap["arm-thrust"] = "fighting";
-  moveTypeMap["sky-uppercut"] = "fighting";
-  moveTypeMap["bulk-up"] = "fighting";
-  moveTypeMap["cross-chop"] = "fighting";
-  moveTypeMap["reversal"] = "fighting";
-  moveTypeMap["vital-throw"] = "fighting";
-  moveTypeMap["close-combat"] = "fighting";
-  moveTypeMap["hammer-arm"] = "fighting";
+// Sorted by name for binary search; checked below at compile time
+constexpr MoveTypeEntry kMoveTypes[] = {
+    {"absorb", T::GRASS},
+    {"acid", T::POISON},
+    {"aerial-ace", T::FLYING},
+    {"aeroblast", T::FLYING},
+    {"agility", T::PSYCHIC},
+    {"air-cutter", T::FLYING},
+    {"air-slash", T::FLYING},
+    {"amnesia", T::PSYCHIC},
+    {"ancient-power", T::ROCK},
+    {"aqua-jet", T::WATER},
+    {"aqua-ring", T::WATER},
+    {"aqua-tail", T::WATER},
+    {"arm-thrust", T::FIGHTING},
+    {"aromatic-mist", T::FAIRY},
+    {"assurance", T::DARK},
+    {"astonish", T::GHOST},
+    {"attack-order", T::BUG},
+    {"aurora-beam", T::ICE},
+    {"autotomize", T::STEEL},
+    {"avalanche", T::ICE},
+    {"baby-doll-eyes", T::FAIRY},
+    {"barrier", T::PSYCHIC},
+    {"bide", T::PSYCHIC},
+    {"bite", T::DARK},
+    {"blaze-kick", T::FIRE},
+    {"blizzard", T::ICE},
+    {"body-slam", T::FIGHTING},
+    {"bone-club", T::GROUND},
+    {"bone-rush", T::GROUND},
+    {"bonemerang", T::GROUND},
+    {"bounce", T::FLYING},
+    {"brave-bird", T::FLYING},
+    {"brick-break", T::FIGHTING},
+    {"brine", T::WATER},
+    {"bubble", T::WATER},
+    {"bubble-beam", T::WATER},
+    {"bug-bite", T::BUG},
+    {"bug-buzz", T::BUG},
+    {"bulk-up", T::FIGHTING},
+    {"bullet-punch", T::STEEL},
+    {"calm-mind", T::PSYCHIC},
+    {"charge-beam", T::ELECTRIC},
+    {"charm", T::FAIRY},
+    {"clamp", T::WATER},
+    {"close-combat", T::FIGHTING},
+    {"confuse-ray", T::GHOST},
+    {"confusion", T::PSYCHIC},
+    {"constrict", T::NORMAL},
+    {"conversion", T::NORMAL},
+    {"cosmic-power", T::PSYCHIC},
+    {"cotton-spore", T::GRASS},
+    {"counter", T::FIGHTING},
+    {"crabhammer", T::WATER},
+    {"crafty-shield", T::FAIRY},
+    {"cross-chop", T::FIGHTING},
+    {"cross-poison", T::POISON},
+    {"crunch", T::DARK},
+    {"curse", T::GHOST},
+    {"dark-pulse", T::DARK},
+    {"dark-void", T::DARK},
+    {"dazzling-gleam", T::FAIRY},
+    {"defend-order", T::BUG},
+    {"defense-curl", T::NORMAL},
+    {"defog", T::FLYING},
+    {"destiny-bond", T::GHOST},
+    {"dig", T::GROUND},
+    {"disable", T::NORMAL},
+    {"disarming-voice", T::FAIRY},
+    {"discharge", T::ELECTRIC},
+    {"dizzy-punch", T::NORMAL},
+    {"doom-desire", T::STEEL},
+    {"double-edge", T::FIGHTING},
+    {"double-kick", T::FIGHTING},
+    {"double-team", T::PSYCHIC},
+    {"draco-meteor", T::DRAGON},
+    {"dragon-breath", T::DRAGON},
+    {"dragon-claw", T::DRAGON},
+    {"dragon-dance", T::DRAGON},
+    {"dragon-pulse", T::DRAGON},
+    {"dragon-rage", T::DRAGON},
+    {"dragon-rush", T::DRAGON},
+    {"draining-kiss", T::FAIRY},
+    {"dream-eater", T::PSYCHIC},
+    {"drill-peck", T::FLYING},
+    {"dynamic-punch", T::FIGHTING},
+    {"earth-power", T::GROUND},
+    {"earthquake", T::GROUND},
+    {"eerie-impulse", T::FAIRY},
+    {"egg-bomb", T::NORMAL},
+    {"embargo", T::DARK},
+    {"ember", T::FIRE},
+    {"energy-ball", T::GRASS},
+    {"explosion", T::NORMAL},
+    {"extrasensory", T::PSYCHIC},
+    {"facade", T::DARK},
+    {"fairy-lock", T::FAIRY},
+    {"fairy-wind", T::FAIRY},
+    {"fake-tears", T::DARK},
+    {"feather-dance", T::FLYING},
+    {"feint-attack", T::DARK},
+    {"fire-blast", T::FIRE},
+    {"fire-fang", T::FIRE},
+    {"fire-punch", T::FIRE},
+    {"fire-spin", T::FIRE},
+    {"fissure", T::GROUND},
+    {"flame-wheel", T::FIRE},
+    {"flamethrower", T::FIRE},
+    {"flare-blitz", T::FIRE},
+    {"flash", T::NORMAL},
+    {"flash-cannon", T::STEEL},
+    {"flatter", T::DARK},
+    {"fling", T::DARK},
+    {"flower-shield", T::FAIRY},
+    {"fly", T::FLYING},
+    {"focus-energy", T::PSYCHIC},
+    {"focus-punch", T::FIGHTING},
+    {"fury-attack", T::FIGHTING},
+    {"fury-cutter", T::BUG},
+    {"fury-swipes", T::NORMAL},
+    {"future-sight", T::PSYCHIC},
+    {"gear-grind", T::STEEL},
+    {"geomancy", T::FAIRY},
+    {"giga-drain", T::GRASS},
+    {"growl", T::NORMAL},
+    {"growth", T::GRASS},
+    {"grudge", T::GHOST},
+    {"gunk-shot", T::POISON},
+    {"gust", T::FLYING},
+    {"gyro-ball", T::STEEL},
+    {"hammer-arm", T::FIGHTING},
+    {"harden", T::NORMAL},
+    {"haze", T::ICE},
+    {"head-smash", T::ROCK},
+    {"headbutt", T::FIGHTING},
+    {"heal-order", T::BUG},
+    {"heat-wave", T::FIRE},
+    {"heavy-slam", T::STEEL},
+    {"high-jump-kick", T::FIGHTING},
+    {"horn-attack", T::FIGHTING},
+    {"horn-drill", T::FIGHTING},
+    {"hurricane", T::FLYING},
+    {"hydro-pump", T::WATER},
+    {"hyper-beam", T::NORMAL},
+    {"hyper-fang", T::NORMAL},
+    {"hypnosis", T::PSYCHIC},
+    {"ice-beam", T::ICE},
+    {"ice-fang", T::ICE},
+    {"ice-punch", T::ICE},
+    {"ice-shard", T::ICE},
+    {"icicle-spear", T::ICE},
+    {"icy-wind", T::ICE},
+    {"iron-defense", T::STEEL},
+    {"iron-head", T::STEEL},
+    {"iron-tail", T::STEEL},
+    {"jump-kick", T::FIGHTING},
+    {"karate-chop", T::FIGHTING},
+    {"kinesis", T::PSYCHIC},
+    {"knock-off", T::DARK},
+    {"lava-plume", T::FIRE},
+    {"leaf-blade", T::GRASS},
+    {"leaf-storm", T::GRASS},
+    {"leech-life", T::BUG},
+    {"leech-seed", T::GRASS},
+    {"leer", T::NORMAL},
+    {"lick", T::GHOST},
+    {"light-of-ruin", T::FAIRY},
+    {"light-screen", T::PSYCHIC},
+    {"low-kick", T::FIGHTING},
+    {"mach-punch", T::FIGHTING},
+    {"magical-leaf", T::GRASS},
+    {"magnet-bomb", T::STEEL},
+    {"magnet-rise", T::STEEL},
+    {"magnitude", T::GROUND},
+    {"meditate", T::PSYCHIC},
+    {"mega-drain", T::GRASS},
+    {"mega-kick", T::NORMAL},
+    {"mega-punch", T::NORMAL},
+    {"megahorn", T::BUG},
+    {"memento", T::DARK},
+    {"metal-claw", T::STEEL},
+    {"metal-sound", T::STEEL},
+    {"meteor-mash", T::STEEL},
+    {"metronome", T::PSYCHIC},
+    {"mimic", T::PSYCHIC},
+    {"minimize", T::NORMAL},
+    {"miracle-eye", T::PSYCHIC},
+    {"mirror-move", T::PSYCHIC},
+    {"mirror-shot", T::STEEL},
+    {"mist", T::ICE},
+    {"misty-terrain", T::FAIRY},
+    {"moonblast", T::FAIRY},
+    {"moonlight", T::FAIRY},
+    {"mud-bomb", T::GROUND},
+    {"mud-shot", T::GROUND},
+    {"mud-slap", T::GROUND},
+    {"mud-sport", T::GROUND},
+    {"muddy-water", T::GROUND},
+    {"nasty-plot", T::DARK},
+    {"night-daze", T::DARK},
+    {"night-shade", T::GHOST},
+    {"night-slash", T::DARK},
+    {"nightmare", T::GHOST},
+    {"ominous-wind", T::GHOST},
+    {"outrage", T::DRAGON},
+    {"pay-day", T::NORMAL},
+    {"payback", T::DARK},
+    {"peck", T::FLYING},
+    {"petal-dance", T::GRASS},
+    {"pin-missile", T::BUG},
+    {"play-rough", T::FAIRY},
+    {"poison-fang", T::POISON},
+    {"poison-gas", T::POISON},
+    {"poison-jab", T::POISON},
+    {"poison-powder", T::POISON},
+    {"poison-sting", T::POISON},
+    {"pound", T::NORMAL},
+    {"powder-snow", T::ICE},
+    {"power-gem", T::ROCK},
+    {"power-whip", T::GRASS},
+    {"psybeam", T::PSYCHIC},
+    {"psychic", T::PSYCHIC},
+    {"psycho-boost", T::PSYCHIC},
+    {"psycho-cut", T::PSYCHIC},
+    {"psyshock", T::PSYCHIC},
+    {"punishment", T::DARK},
+    {"pursuit", T::DARK},
+    {"quick-attack", T::PSYCHIC},
+    {"rage", T::PSYCHIC},
+    {"razor-leaf", T::GRASS},
+    {"recover", T::PSYCHIC},
+    {"reflect", T::PSYCHIC},
+    {"rest", T::NORMAL},
+    {"revenge", T::FIGHTING},
+    {"reversal", T::FIGHTING},
+    {"roar", T::NORMAL},
+    {"roar-of-time", T::DRAGON},
+    {"rock-blast", T::ROCK},
+    {"rock-polish", T::ROCK},
+    {"rock-slide", T::ROCK},
+    {"rock-throw", T::ROCK},
+    {"rock-tomb", T::ROCK},
+    {"rock-wrecker", T::ROCK},
+    {"rolling-kick", T::FIGHTING},
+    {"rollout", T::ROCK},
+    {"roost", T::FLYING},
+    {"sand-attack", T::GROUND},
+    {"sand-tomb", T::GROUND},
+    {"sandstorm", T::ROCK},
+    {"scald", T::WATER},
+    {"scratch", T::NORMAL},
+    {"screech", T::PSYCHIC},
+    {"seed-bomb", T::GRASS},
+    {"seismic-toss", T::FIGHTING},
+    {"self-destruct", T::NORMAL},
+    {"shadow-ball", T::GHOST},
+    {"shadow-claw", T::GHOST},
+    {"shadow-force", T::GHOST},
+    {"shadow-punch", T::GHOST},
+    {"shadow-sneak", T::GHOST},
+    {"sharpen", T::NORMAL},
+    {"sheer-cold", T::ICE},
+    {"shock-wave", T::ELECTRIC},
+    {"signal-beam", T::BUG},
+    {"silver-wind", T::BUG},
+    {"sing", T::NORMAL},
+    {"skull-bash", T::NORMAL},
+    {"sky-attack", T::FLYING},
+    {"sky-uppercut", T::FLYING},
+    {"slash", T::NORMAL},
+    {"sleep-powder", T::GRASS},
+    {"sludge", T::POISON},
+    {"sludge-bomb", T::POISON},
+    {"smog", T::POISON},
+    {"smokescreen", T::NORMAL},
+    {"snatch", T::DARK},
+    {"soft-boiled", T::PSYCHIC},
+    {"solar-beam", T::GRASS},
+    {"sonic-boom", T::NORMAL},
+    {"spacial-rend", T::DRAGON},
+    {"spark", T::ELECTRIC},
+    {"spider-web", T::BUG},
+    {"spike-cannon", T::NORMAL},
+    {"spikes", T::GROUND},
+    {"spite", T::GHOST},
+    {"splash", T::NORMAL},
+    {"spore", T::GRASS},
+    {"stealth-rock", T::ROCK},
+    {"steel-wing", T::STEEL},
+    {"stone-edge", T::ROCK},
+    {"stored-power", T::PSYCHIC},
+    {"strength", T::NORMAL},
+    {"string-shot", T::BUG},
+    {"struggle", T::NORMAL},
+    {"stun-spore", T::GRASS},
+    {"submission", T::FIGHTING},
+    {"substitute", T::NORMAL},
+    {"sucker-punch", T::DARK},
+    {"super-fang", T::NORMAL},
+    {"superpower", T::FIGHTING},
+    {"supersonic", T::NORMAL},
+    {"surf", T::WATER},
+    {"sweet-kiss", T::FAIRY},
+    {"sweet-scent", T::FAIRY},
+    {"swift", T::NORMAL},
+    {"switcheroo", T::DARK},
+    {"synchronoise", T::PSYCHIC},
+    {"synthesis", T::GRASS},
+    {"tackle", T::FIGHTING},
+    {"tail-whip", T::NORMAL},
+    {"tailwind", T::FLYING},
+    {"take-down", T::FIGHTING},
+    {"taunt", T::DARK},
+    {"teleport", T::PSYCHIC},
+    {"thief", T::DARK},
+    {"thrash", T::FIGHTING},
+    {"thunder", T::ELECTRIC},
+    {"thunder-fang", T::ELECTRIC},
+    {"thunder-punch", T::ELECTRIC},
+    {"thunder-shock", T::ELECTRIC},
+    {"thunder-wave", T::ELECTRIC},
+    {"thunderbolt", T::ELECTRIC},
+    {"torment", T::DARK},
+    {"toxic", T::POISON},
+    {"toxic-spikes", T::POISON},
+    {"tri-attack", T::NORMAL},
+    {"twin-needle", T::BUG},
+    {"twister", T::DRAGON},
+    {"u-turn", T::BUG},
+    {"vine-whip", T::GRASS},
+    {"vital-throw", T::FIGHTING},
+    {"water-gun", T::WATER},
+    {"water-pulse", T::WATER},
+    {"whirlwind", T::FLYING},
+    {"wing-attack", T::FLYING},
+    {"withdraw", T::WATER},
+    {"wrap", T::FIGHTING},
+    {"x-scissor", T::BUG},
+    {"zen-headbutt", T::PSYCHIC},
+};
 
-  // Poison type moves
-  moveTypeMap["poison-sting"] = "poison";
-  moveTypeMap["smog"] = "poison";
-  moveTypeMap["sludge"] = "poison";
-  moveTypeMap["poison-powder"] = "poison";
-  moveTypeMap["poison-gas"] = "poison";
-  moveTypeMap["acid"] = "poison";
-  moveTypeMap["sludge-bomb"] = "poison";
-  moveTypeMap["toxic"] = "poison";
-  moveTypeMap["poison-fang"] = "poison";
-  moveTypeMap["poison-jab"] = "poison";
-  moveTypeMap["toxic-spikes"] = "poison";
-  moveTypeMap["gunk-shot"] = "poison";
-  moveTypeMap["cross-poison"] = "poison";
-
-  // Ground type moves
-  moveTypeMap["sand-attack"] = "ground";
-  moveTypeMap["dig"] = "ground";
-  moveTypeMap["bone-club"] = "ground";
-  moveTypeMap["bonemerang"] = "ground";
-  moveTypeMap["earthquake"] = "ground";
-  moveTypeMap["fissure"] = "ground";
-  moveTypeMap["sand-tomb"] = "ground";
-  moveTypeMap["mud-shot"] = "ground";
-  moveTypeMap["mud-bomb"] = "ground";
-  moveTypeMap["earth-power"] = "ground";
-  moveTypeMap["mud-slap"] = "ground";
-  moveTypeMap["spikes"] = "ground";
-  moveTypeMap["magnitude"] = "ground";
-  moveTypeMap["bone-rush"] = "ground";
-  moveTypeMap["mud-sport"] = "ground";
-  moveTypeMap["muddy-water"] = "ground";
-
-  // Flying type moves
-  moveTypeMap["gust"] = "flying";
-  moveTypeMap["wing-attack"] = "flying";
-  moveTypeMap["whirlwind"] = "flying";
-  moveTypeMap["fly"] = "flying";
-  moveTypeMap["peck"] = "flying";
-  moveTypeMap["drill-peck"] = "flying";
-  moveTypeMap["sky-attack"] = "flying";
-  moveTypeMap["aeroblast"] = "flying";
-  moveTypeMap["air-slash"] = "flying";
-  moveTypeMap["hurricane"] = "flying";
-  moveTypeMap["brave-bird"] = "flying";
-  moveTypeMap["roost"] = "flying";
-  moveTypeMap["tailwind"] = "flying";
-  moveTypeMap["air-cutter"] = "flying";
-  moveTypeMap["defog"] = "flying";
-  moveTypeMap["bounce"] = "flying";
-  moveTypeMap["aerial-ace"] = "flying";
-  moveTypeMap["feather-dance"] = "flying";
-  moveTypeMap["sky-uppercut"] = "flying";
-
-  // Psychic type moves
-  moveTypeMap["confusion"] = "psychic";
-  moveTypeMap["psychic"] = "psychic";
-  moveTypeMap["hypnosis"] = "psychic";
-  moveTypeMap["meditate"] = "psychic";
-  moveTypeMap["agility"] = "psychic";
-  moveTypeMap["quick-attack"] = "psychic";
-  moveTypeMap["rage"] = "psychic";
-  moveTypeMap["teleport"] = "psychic";
-  moveTypeMap["night-shade"] = "psychic";
-  moveTypeMap["mimic"] = "psychic";
-  moveTypeMap["screech"] = "psychic";
-  moveTypeMap["double-team"] = "psychic";
-  moveTypeMap["recover"] = "psychic";
-  moveTypeMap["light-screen"] = "psychic";
-  moveTypeMap["reflect"] = "psychic";
-  moveTypeMap["focus-energy"] = "psychic";
-  moveTypeMap["bide"] = "psychic";
-  moveTypeMap["metronome"] = "psychic";
-  moveTypeMap["mirror-move"] = "psychic";
-  moveTypeMap["amnesia"] = "psychic";
-  moveTypeMap["barrier"] = "psychic";
-  moveTypeMap["kinesis"] = "psychic";
-  moveTypeMap["soft-boiled"] = "psychic";
-  moveTypeMap["dream-eater"] = "psychic";
-  moveTypeMap["psybeam"] = "psychic";
-  moveTypeMap["psycho-cut"] = "psychic";
-  moveTypeMap["zen-headbutt"] = "psychic";
-  moveTypeMap["psycho-boost"] = "psychic";
-  moveTypeMap["future-sight"] = "psychic";
-  moveTypeMap["calm-mind"] = "psychic";
-  moveTypeMap["cosmic-power"] = "psychic";
-  moveTypeMap["stored-power"] = "psychic";
-  moveTypeMap["psyshock"] = "psychic";
-  moveTypeMap["miracle-eye"] = "psychic";
-  moveTypeMap["extrasensory"] = "psychic";
-  moveTypeMap["synchronoise"] = "psychic";
-
-  // Bug type moves
-  moveTypeMap["string-shot"] = "bug";
-  moveTypeMap["leech-life"] = "bug";
-  moveTypeMap["twin-needle"] = "bug";
-  moveTypeMap["pin-missile"] = "bug";
-  moveTypeMap["spider-web"] = "bug";
-  moveTypeMap["fury-cutter"] = "bug";
-  moveTypeMap["megahorn"] = "bug";
-  moveTypeMap["bug-bite"] = "bug";
-  moveTypeMap["x-scissor"] = "bug";
-  moveTypeMap["bug-buzz"] = "bug";
-  moveTypeMap["signal-beam"] = "bug";
-  moveTypeMap["silver-wind"] = "bug";
-  moveTypeMap["u-turn"] = "bug";
-  moveTypeMap["attack-order"] = "bug";
-  moveTypeMap["defend-order"] = "bug";
-  moveTypeMap["heal-order"] = "bug";
-
-  // Rock type moves
-  moveTypeMap["rock-throw"] = "rock";
-  moveTypeMap["rock-slide"] = "rock";
-  moveTypeMap["rock-blast"] = "rock";
-  moveTypeMap["rollout"] = "rock";
-  moveTypeMap["sandstorm"] = "rock";
-  moveTypeMap["ancient-power"] = "rock";
-  moveTypeMap["rock-tomb"] = "rock";
-  moveTypeMap["rock-polish"] = "rock";
-  moveTypeMap["power-gem"] = "rock";
-  moveTypeMap["stone-edge"] = "rock";
-  moveTypeMap["stealth-rock"] = "rock";
-  moveTypeMap["rock-wrecker"] = "rock";
-  moveTypeMap["head-smash"] = "rock";
+constexpr bool isSortedByName(const MoveTypeEntry *entries, size_t count) {
+  for (size_t i = 1; i < count; ++i) {
+    if (!(entries[i - 1].name < entries[i].name)) return false;
+  }
+  return true;
+}
 
-  // Ghost type moves
-  moveTypeMap["lick"] = "ghost";
-  moveTypeMap["night-shade"] = "ghost";
-  moveTypeMap["confuse-ray"] = "ghost";
-  moveTypeMap["shadow-punch"] = "ghost";
-  moveTypeMap["shadow-ball"] = "ghost";
-  moveTypeMap["destiny-bond"] = "ghost";
-  moveTypeMap["spite"] = "ghost";
-  moveTypeMap["curse"] = "ghost";
-  moveTypeMap["nightmare"] = "ghost";
-  moveTypeMap["grudge"] = "ghost";
-  moveTypeMap["astonish"] = "ghost";
-  moveTypeMap["shadow-claw"] = "ghost";
-  moveTypeMap["ominous-wind"] = "ghost";
-  moveTypeMap["shadow-sneak"] = "ghost";
-  moveTypeMap["shadow-force"] = "ghost";
+static_assert(isSortedByName(kMoveTypes, std::size(kMoveTypes)),
+              "kMoveTypes must be sorted by name with no duplicates");
 
-  // Dragon type moves
-  moveTypeMap["dragon-rage"] = "dragon";
-  moveTypeMap["twister"] = "dragon";
-  moveTypeMap["dragon-breath"] = "dragon";
-  moveTypeMap["dragon-claw"] = "dragon";
-  moveTypeMap["dragon-dance"] = "dragon";
-  moveTypeMap["dragon-pulse"] = "dragon";
-  moveTypeMap["dragon-rush"] = "dragon";
-  moveTypeMap["draco-meteor"] = "dragon";
-  moveTypeMap["outrage"] = "dragon";
-  moveTypeMap["spacial-rend"] = "dragon";
-  moveTypeMap["roar-of-time"] = "dragon";
+}  // namespace
 
-  // Dark type moves
-  moveTypeMap["bite"] = "dark";
-  moveTypeMap["crunch"] = "dark";
-  moveTypeMap["thief"] = "dark";
-  moveTypeMap["feint-attack"] = "dark";
-  moveTypeMap["pursuit"] = "dark";
-  moveTypeMap["torment"] = "dark";
-  moveTypeMap["flatter"] = "dark";
-  moveTypeMap["memento"] = "dark";
-  moveTypeMap["facade"] = "dark";
-  moveTypeMap["taunt"] = "dark";
-  moveTypeMap["knock-off"] = "dark";
-  moveTypeMap["snatch"] = "dark";
-  moveTypeMap["fake-tears"] = "dark";
-  moveTypeMap["payback"] = "dark";
-  moveTypeMap["assurance"] = "dark";
-  moveTypeMap["embargo"] = "dark";
-  moveTypeMap["fling"] = "dark";
-  moveTypeMap["punishment"] = "dark";
-  moveTypeMap["sucker-punch"] = "dark";
-  moveTypeMap["dark-void"] = "dark";
-  moveTypeMap["night-daze"] = "dark";
-  moveTypeMap["dark-pulse"] = "dark";
-  moveTypeMap["nasty-plot"] = "dark";
-  moveTypeMap["night-slash"] = "dark";
-  moveTypeMap["switcheroo"] = "dark";
+PokemonType MoveTypeMapping::getMoveTypeId(std::string_view moveName) {
+  auto it = std::lower_bound(
+      std::begin(kMoveTypes), std::end(kMoveTypes), moveName,
+      [](const MoveTypeEntry &entry, std::string_view name) { return entry.name < name; });
+  if (it != std::end(kMoveTypes) && it->name == moveName) {
+    return it->type;
+  }
 
-  // Steel type moves
-  moveTypeMap["metal-claw"] = "steel";
-  moveTypeMap["steel-wing"] = "steel";
-  moveTypeMap["meteor-mash"] = "steel";
-  moveTypeMap["iron-tail"] = "steel";
-  moveTypeMap["metal-sound"] = "steel";
-  moveTypeMap["iron-defense"] = "steel";
-  moveTypeMap["doom-desire"] = "steel";
-  moveTypeMap["gyro-ball"] = "steel";
-  moveTypeMap["magnet-rise"] = "steel";
-  moveTypeMap["mirror-shot"] = "steel";
-  moveTypeMap["flash-cannon"] = "steel";
-  moveTypeMap["bullet-punch"] = "steel";
-  moveTypeMap["iron-head"] = "steel";
-  moveTypeMap["magnet-bomb"] = "steel";
-  moveTypeMap["autotomize"] = "steel";
-  moveTypeMap["heavy-slam"] = "steel";
-  moveTypeMap["gear-grind"] = "steel";
+  // Default to normal type if move not found
+  return PokemonType::NORMAL;
+}
 
-  // Fairy type moves
-  moveTypeMap["sweet-kiss"] = "fairy";
-  moveTypeMap["charm"] = "fairy";
-  moveTypeMap["moonlight"] = "fairy";
-  moveTypeMap["sweet-scent"] = "fairy";
-  moveTypeMap["fairy-wind"] = "fairy";
-  moveTypeMap["draining-kiss"] = "fairy";
-  moveTypeMap["crafty-shield"] = "fairy";
-  moveTypeMap["flower-shield"] = "fairy";
-  moveTypeMap["misty-terrain"] = "fairy";
-  moveTypeMap["play-rough"] = "fairy";
-  moveTypeMap["fairy-lock"] = "fairy";
-  moveTypeMap["aromatic-mist"] = "fairy";
-  moveTypeMap["eerie-impulse"] = "fairy";
-  moveTypeMap["dazzling-gleam"] = "fairy";
-  moveTypeMap["baby-doll-eyes"] = "fairy";
-  moveTypeMap["disarming-voice"] = "fairy";
-  moveTypeMap["moonblast"] = "fairy";
-  moveTypeMap["geomancy"] = "fairy";
-  moveTypeMap["light-of-ruin"] = "fairy";
-}
\ No newline at end of file
+std::string MoveTypeMapping::getMoveType(const std::string &moveName) {
+  return pokemonTypeName(getMoveTypeId(moveName));
+}
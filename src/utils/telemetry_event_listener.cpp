@@ -0,0 +1,571 @@
+#include "telemetry_event_listener.h"
+#include "move.h"
+#include "pokemon.h"
+#include "weather.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+
+namespace Telemetry {
+
+namespace {
+
+constexpr char kMagic[4] = {'P', 'K', 'C', 'B'};
+constexpr uint8_t kVersion = 1;
+
+// Tables in the order makeTables() returns them
+enum Table { MOVES, HEALTH, SWITCHES, WEATHER, BATTLES, TABLE_COUNT };
+
+// Dictionary kinds
+enum Kind { SPECIES, MOVE };
+
+size_t typeWidth(ColumnType type) {
+    switch (type) {
+        case ColumnType::U8: return 1;
+        case ColumnType::U16: return 2;
+        case ColumnType::U32:
+        case ColumnType::I32:
+        case ColumnType::F32: return 4;
+        case ColumnType::UTF8: break;
+    }
+    return 0;
+}
+
+// Little-endian on every platform we build for; values are copied as-is.
+// Both return false if the write failed.
+bool writeBytes(std::FILE* file, const void* data, size_t size) {
+    return std::fwrite(data, 1, size, file) == size;
+}
+
+template<typename T>
+bool writeValue(std::FILE* file, T value) {
+    return writeBytes(file, &value, sizeof(value));
+}
+
+template<typename T>
+bool readValue(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+// Bytes between the read position and the end of the stream
+uint64_t remainingBytes(std::istream& in) {
+    auto position = in.tellg();
+    if (position < 0 || !in.seekg(0, std::ios::end)) {
+        return 0;
+    }
+    auto end = in.tellg();
+    in.seekg(position);
+    return end > position ? static_cast<uint64_t>(end - position) : 0;
+}
+
+} // namespace
+
+// ColumnTable
+
+ColumnTable::ColumnTable(std::string name,
+                         std::vector<std::pair<std::string, ColumnType>> columns)
+    : name_(std::move(name)) {
+    for (auto& column : columns) {
+        columns_.push_back(Column{std::move(column.first), column.second, {}, {0}});
+    }
+}
+
+const ColumnTable::Column* ColumnTable::find(const std::string& name) const {
+    for (const auto& column : columns_) {
+        if (column.name == name) {
+            return &column;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T>
+void ColumnTable::put(size_t column, T value) {
+    auto& data = columns_[column].data;
+    size_t size = data.size();
+    data.resize(size + sizeof(T));
+    std::memcpy(data.data() + size, &value, sizeof(T));
+}
+
+void ColumnTable::putString(size_t column, const std::string& value) {
+    auto& target = columns_[column];
+    target.data.insert(target.data.end(), value.begin(), value.end());
+    target.offsets.push_back(static_cast<uint32_t>(target.data.size()));
+}
+
+template<typename T>
+T ColumnTable::get(size_t column, size_t row) const {
+    T value;
+    std::memcpy(&value, columns_[column].data.data() + row * sizeof(T), sizeof(T));
+    return value;
+}
+
+std::string ColumnTable::getString(size_t column, size_t row) const {
+    const auto& source = columns_[column];
+    const auto* begin = reinterpret_cast<const char*>(source.data.data());
+    return std::string(begin + source.offsets[row], begin + source.offsets[row + 1]);
+}
+
+template void ColumnTable::put<uint8_t>(size_t, uint8_t);
+template void ColumnTable::put<uint16_t>(size_t, uint16_t);
+template void ColumnTable::put<uint32_t>(size_t, uint32_t);
+template void ColumnTable::put<int32_t>(size_t, int32_t);
+template void ColumnTable::put<float>(size_t, float);
+template uint8_t ColumnTable::get<uint8_t>(size_t, size_t) const;
+template uint16_t ColumnTable::get<uint16_t>(size_t, size_t) const;
+template uint32_t ColumnTable::get<uint32_t>(size_t, size_t) const;
+template int32_t ColumnTable::get<int32_t>(size_t, size_t) const;
+template float ColumnTable::get<float>(size_t, size_t) const;
+
+void ColumnTable::append(const ColumnTable& other) {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        auto& target = columns_[i];
+        const auto& source = other.columns_[i];
+        if (target.type == ColumnType::UTF8) {
+            uint32_t base = static_cast<uint32_t>(target.data.size());
+            for (size_t row = 1; row < source.offsets.size(); ++row) {
+                target.offsets.push_back(base + source.offsets[row]);
+            }
+        }
+        target.data.insert(target.data.end(), source.data.begin(), source.data.end());
+    }
+    rows_ += other.rows_;
+}
+
+void ColumnTable::clear() {
+    for (auto& column : columns_) {
+        column.data.clear();
+        column.offsets.assign(1, 0);
+    }
+    rows_ = 0;
+}
+
+bool ColumnTable::writeBlock(std::FILE* file) const {
+    bool written = writeBytes(file, kMagic, sizeof(kMagic)) &&
+                   writeValue<uint8_t>(file, kVersion) &&
+                   writeValue<uint32_t>(file, static_cast<uint32_t>(rows_)) &&
+                   writeValue<uint8_t>(file, static_cast<uint8_t>(columns_.size()));
+    for (const auto& column : columns_) {
+        if (!written) {
+            break;
+        }
+        uint64_t bytes = column.data.size();
+        if (column.type == ColumnType::UTF8) {
+            bytes += column.offsets.size() * sizeof(uint32_t);
+        }
+        written = writeValue<uint8_t>(file, static_cast<uint8_t>(column.name.size())) &&
+                  writeBytes(file, column.name.data(), column.name.size()) &&
+                  writeValue<uint8_t>(file, static_cast<uint8_t>(column.type)) &&
+                  writeValue<uint64_t>(file, bytes) &&
+                  (column.type != ColumnType::UTF8 ||
+                   writeBytes(file, column.offsets.data(), column.offsets.size() * sizeof(uint32_t))) &&
+                  writeBytes(file, column.data.data(), column.data.size());
+    }
+    return written;
+}
+
+bool ColumnTable::readBlock(std::istream& in, const char* onlyColumn) {
+    char magic[sizeof(kMagic)];
+    uint8_t version = 0;
+    uint32_t rows = 0;
+    uint8_t count = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+        !readValue(in, version) || version != kVersion || !readValue(in, rows) ||
+        !readValue(in, count)) {
+        return false;
+    }
+
+    std::vector<Column> columns;
+    for (uint8_t i = 0; i < count; ++i) {
+        Column column;
+        uint8_t nameLength = 0;
+        uint8_t type = 0;
+        uint64_t bytes = 0;
+        if (!readValue(in, nameLength)) {
+            return false;
+        }
+        column.name.resize(nameLength);
+        if (!in.read(&column.name[0], nameLength) || !readValue(in, type) ||
+            type > static_cast<uint8_t>(ColumnType::UTF8) || !readValue(in, bytes)) {
+            return false;
+        }
+        column.type = static_cast<ColumnType>(type);
+        // Nothing is sized from the header until the stream is known to
+        // hold that much, so a corrupt row count can't force a huge allocation
+        if (bytes > remainingBytes(in)) {
+            return false;
+        }
+        if (onlyColumn && column.name != onlyColumn) {
+            if (!in.seekg(static_cast<std::streamoff>(bytes), std::ios::cur)) {
+                return false;
+            }
+            continue;
+        }
+
+        uint64_t offsetBytes = 0;
+        if (column.type == ColumnType::UTF8) {
+            offsetBytes = (uint64_t{rows} + 1) * sizeof(uint32_t);
+            if (bytes < offsetBytes) {
+                return false;
+            }
+            column.offsets.resize(rows + 1);
+            if (!in.read(reinterpret_cast<char*>(column.offsets.data()), offsetBytes)) {
+                return false;
+            }
+        } else if (bytes != uint64_t{rows} * typeWidth(column.type)) {
+            return false;
+        }
+        column.data.resize(bytes - offsetBytes);
+        if (!in.read(reinterpret_cast<char*>(column.data.data()), column.data.size())) {
+            return false;
+        }
+        if (column.type == ColumnType::UTF8 && column.offsets.back() != column.data.size()) {
+            return false;
+        }
+        columns.push_back(std::move(column));
+    }
+
+    columns_ = std::move(columns);
+    rows_ = rows;
+    return true;
+}
+
+// TelemetryWriter
+
+std::vector<ColumnTable> TelemetryWriter::makeTables() {
+    std::vector<ColumnTable> tables;
+    tables.emplace_back("moves", std::vector<std::pair<std::string, ColumnType>>{
+        {"battle", ColumnType::U32}, {"turn", ColumnType::U16}, {"user", ColumnType::U32},
+        {"move", ColumnType::U32}, {"target", ColumnType::U32}, {"hit", ColumnType::U8},
+        {"critical", ColumnType::U8}, {"effectiveness", ColumnType::F32}});
+    tables.emplace_back("health", std::vector<std::pair<std::string, ColumnType>>{
+        {"battle", ColumnType::U32}, {"turn", ColumnType::U16}, {"pokemon", ColumnType::U32},
+        {"old_hp", ColumnType::I32}, {"new_hp", ColumnType::I32}, {"damage", ColumnType::I32},
+        {"source", ColumnType::U8}, {"move", ColumnType::U32}});
+    tables.emplace_back("switches", std::vector<std::pair<std::string, ColumnType>>{
+        {"battle", ColumnType::U32}, {"turn", ColumnType::U16}, {"player", ColumnType::U8},
+        {"from", ColumnType::U32}, {"to", ColumnType::U32}});
+    tables.emplace_back("weather", std::vector<std::pair<std::string, ColumnType>>{
+        {"battle", ColumnType::U32}, {"turn", ColumnType::U16},
+        {"old_weather", ColumnType::U8}, {"new_weather", ColumnType::U8},
+        {"turns_remaining", ColumnType::I32}});
+    tables.emplace_back("battles", std::vector<std::pair<std::string, ColumnType>>{
+        {"battle", ColumnType::U32}, {"winner", ColumnType::U8}, {"turns", ColumnType::U32}});
+    return tables;
+}
+
+TelemetryWriter::TelemetryWriter(const std::string& directory)
+    : TelemetryWriter(directory, Config()) {}
+
+TelemetryWriter::TelemetryWriter(const std::string& directory, const Config& config)
+    : config_(config),
+      dictionary_("dictionary", {{"kind", ColumnType::U8},
+                                 {"id", ColumnType::U32},
+                                 {"name", ColumnType::UTF8}}),
+      pending_(makeTables()),
+      lastFlush_(std::chrono::steady_clock::now()) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    resume(directory);
+
+    std::vector<std::string> names;
+    for (const auto& table : pending_) {
+        names.push_back(table.name());
+    }
+    names.push_back(dictionary_.name());
+    for (const auto& name : names) {
+        std::string path = (std::filesystem::path(directory) / (name + ".col")).string();
+        std::FILE* file = std::fopen(path.c_str(), "ab");
+        if (!file) {
+            std::cerr << "Error: Could not open telemetry file " << path << std::endl;
+            open_ = false;
+        }
+        files_.push_back(file);
+    }
+}
+
+TelemetryWriter::~TelemetryWriter() {
+    flush();
+    for (std::FILE* file : files_) {
+        if (file) {
+            std::fclose(file);
+        }
+    }
+}
+
+void TelemetryWriter::resume(const std::filesystem::path& directory) {
+    // Reads each file's blocks, then cuts off anything after the last whole
+    // one (a writer that died mid-flush), so appended blocks stay readable
+    auto readAll = [](const std::filesystem::path& path, const char* onlyColumn,
+                      const std::function<void(const ColumnTable&)>& visit) {
+        std::error_code error;
+        uintmax_t size = std::filesystem::file_size(path, error);
+        std::ifstream in(path, std::ios::binary);
+        if (error || !in) {
+            return;
+        }
+        ColumnTable block;
+        uintmax_t end = 0;
+        // Skipped columns are seeked past, so a torn block shows up as a
+        // position beyond the end of the file
+        while (block.readBlock(in, onlyColumn) && static_cast<uintmax_t>(in.tellg()) <= size) {
+            end = static_cast<uintmax_t>(in.tellg());
+            visit(block);
+        }
+        in.close();
+        if (end < size) {
+            std::filesystem::resize_file(path, end, error);
+        }
+    };
+
+    readAll(directory / (dictionary_.name() + ".col"), nullptr, [this](const ColumnTable& block) {
+        if (block.columnCount() != 3 || block.column(2).type != ColumnType::UTF8) {
+            return;
+        }
+        for (size_t row = 0; row < block.rows(); ++row) {
+            uint8_t kind = block.get<uint8_t>(0, row);
+            uint32_t id = block.get<uint32_t>(1, row);
+            if (kind > MOVE) {
+                continue;
+            }
+            ids_[kind].emplace(block.getString(2, row), id);
+            nextId_[kind] = std::max(nextId_[kind], id + 1);
+        }
+    });
+
+    // Every table, not just battles: a battle cut short has rows but no result
+    for (const auto& table : pending_) {
+        readAll(directory / (table.name() + ".col"), "battle", [this](const ColumnTable& block) {
+            if (block.columnCount() != 1 || block.column(0).type != ColumnType::U32) {
+                return;
+            }
+            for (size_t row = 0; row < block.rows(); ++row) {
+                nextBattle_ = std::max(nextBattle_, block.get<uint32_t>(0, row) + 1);
+            }
+        });
+    }
+}
+
+uint32_t TelemetryWriter::nextBattleId() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nextBattle_++;
+}
+
+uint32_t TelemetryWriter::speciesId(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return internLocked(SPECIES, name);
+}
+
+uint32_t TelemetryWriter::moveId(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return internLocked(MOVE, name);
+}
+
+uint32_t TelemetryWriter::internLocked(int kind, const std::string& name) {
+    auto inserted = ids_[kind].emplace(name, nextId_[kind]);
+    if (inserted.second) {
+        ++nextId_[kind];
+        dictionary_.put<uint8_t>(0, static_cast<uint8_t>(kind));
+        dictionary_.put<uint32_t>(1, inserted.first->second);
+        dictionary_.putString(2, name);
+        dictionary_.endRow();
+    }
+    return inserted.first->second;
+}
+
+void TelemetryWriter::append(const std::vector<ColumnTable>& batch) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        pending_[i].append(batch[i]);
+        pendingRows_ += batch[i].rows();
+    }
+    if (pendingRows_ >= config_.flushRows ||
+        std::chrono::steady_clock::now() - lastFlush_ >= config_.flushInterval) {
+        flushLocked();
+    }
+}
+
+void TelemetryWriter::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushLocked();
+}
+
+void TelemetryWriter::flushLocked() {
+    lastFlush_ = std::chrono::steady_clock::now();
+    // The dictionary goes first, so every ID written is already defined
+    if (dictionary_.rows() > 0 && files_.back()) {
+        writeLocked(dictionary_, files_.back());
+    }
+    dictionary_.clear();
+
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        if (pending_[i].rows() > 0 && files_[i] && writeLocked(pending_[i], files_[i])) {
+            rowsWritten_ += pending_[i].rows();
+        }
+        pending_[i].clear();
+    }
+    pendingRows_ = 0;
+}
+
+bool TelemetryWriter::writeLocked(const ColumnTable& table, std::FILE*& file) {
+    if (table.writeBlock(file) && std::fflush(file) == 0) {
+        return true;
+    }
+    // Nothing more goes to this file: the next writer's resume() cuts off a
+    // torn block, and with it anything appended after
+    std::cerr << "Error: Could not write telemetry table " << table.name()
+              << "; its further rows are dropped" << std::endl;
+    std::fclose(file);
+    file = nullptr;
+    writeFailed_ = true;
+    return false;
+}
+
+uint64_t TelemetryWriter::rowsWritten() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return rowsWritten_;
+}
+
+bool TelemetryWriter::writeFailed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return writeFailed_;
+}
+
+// TelemetryEventListener
+
+TelemetryEventListener::TelemetryEventListener(std::shared_ptr<TelemetryWriter> writer,
+                                               size_t batchRows)
+    : writer_(std::move(writer)),
+      batchRows_(batchRows > 0 ? batchRows : 1),
+      batch_(TelemetryWriter::makeTables()) {}
+
+TelemetryEventListener::~TelemetryEventListener() {
+    submit();
+}
+
+BattleEvents::EventMask TelemetryEventListener::subscribedEvents() const {
+    using BattleEvents::EventType;
+    using BattleEvents::eventBit;
+    return eventBit(EventType::HEALTH_CHANGED) | eventBit(EventType::MOVE_USED) |
+           eventBit(EventType::WEATHER_CHANGED) | eventBit(EventType::POKEMON_SWITCH) |
+           eventBit(EventType::BATTLE_START) | eventBit(EventType::BATTLE_END) |
+           eventBit(EventType::TURN_START);
+}
+
+uint32_t TelemetryEventListener::speciesId(const Pokemon* pokemon) {
+    if (!pokemon) {
+        return kNoId;
+    }
+    auto found = species_.find(pokemon->name);
+    if (found != species_.end()) {
+        return found->second;
+    }
+    uint32_t id = writer_->speciesId(pokemon->name);
+    species_.emplace(pokemon->name, id);
+    return id;
+}
+
+uint32_t TelemetryEventListener::moveId(const Move* move) {
+    if (!move) {
+        return kNoId;
+    }
+    const MoveDef* def = &move->def();
+    auto found = moves_.find(def);
+    if (found != moves_.end()) {
+        return found->second;
+    }
+    uint32_t id = writer_->moveId(def->name);
+    moves_.emplace(def, id);
+    return id;
+}
+
+void TelemetryEventListener::onBattleStart(const BattleEvents::BattleStartEvent& /*event*/) {
+    battle_ = writer_->nextBattleId();
+    turn_ = 0;
+}
+
+void TelemetryEventListener::onTurnStart(int turnNumber) {
+    turn_ = static_cast<uint16_t>(turnNumber);
+}
+
+void TelemetryEventListener::onMoveUsed(const BattleEvents::MoveUsedEvent& event) {
+    ColumnTable& table = batch_[MOVES];
+    table.put<uint32_t>(0, battle_);
+    table.put<uint16_t>(1, turn_);
+    table.put<uint32_t>(2, speciesId(event.user));
+    table.put<uint32_t>(3, moveId(event.move));
+    table.put<uint32_t>(4, speciesId(event.target));
+    table.put<uint8_t>(5, event.wasSuccessful);
+    table.put<uint8_t>(6, event.wasCritical);
+    table.put<float>(7, static_cast<float>(event.effectiveness));
+    table.endRow();
+    rowAdded();
+}
+
+void TelemetryEventListener::onHealthChanged(const BattleEvents::HealthChangeEvent& event) {
+    ColumnTable& table = batch_[HEALTH];
+    table.put<uint32_t>(0, battle_);
+    table.put<uint16_t>(1, turn_);
+    table.put<uint32_t>(2, speciesId(event.pokemon));
+    table.put<int32_t>(3, event.oldHealth);
+    table.put<int32_t>(4, event.newHealth);
+    table.put<int32_t>(5, event.damage);
+    table.put<uint8_t>(6, static_cast<uint8_t>(event.source));
+    table.put<uint32_t>(7, moveId(event.move));
+    table.endRow();
+    rowAdded();
+}
+
+void TelemetryEventListener::onPokemonSwitch(const BattleEvents::PokemonSwitchEvent& event) {
+    ColumnTable& table = batch_[SWITCHES];
+    table.put<uint32_t>(0, battle_);
+    table.put<uint16_t>(1, turn_);
+    table.put<uint8_t>(2, event.isPlayerSwitch);
+    table.put<uint32_t>(3, speciesId(event.oldPokemon));
+    table.put<uint32_t>(4, speciesId(event.newPokemon));
+    table.endRow();
+    rowAdded();
+}
+
+void TelemetryEventListener::onWeatherChanged(const BattleEvents::WeatherChangeEvent& event) {
+    ColumnTable& table = batch_[WEATHER];
+    table.put<uint32_t>(0, battle_);
+    table.put<uint16_t>(1, turn_);
+    table.put<uint8_t>(2, static_cast<uint8_t>(event.oldWeather));
+    table.put<uint8_t>(3, static_cast<uint8_t>(event.newWeather));
+    table.put<int32_t>(4, event.turnsRemaining);
+    table.endRow();
+    rowAdded();
+}
+
+void TelemetryEventListener::onBattleEnd(const BattleEvents::BattleEndEvent& event) {
+    ColumnTable& table = batch_[BATTLES];
+    table.put<uint32_t>(0, battle_);
+    table.put<uint8_t>(1, static_cast<uint8_t>(event.winner));
+    table.put<uint32_t>(2, static_cast<uint32_t>(event.totalTurns));
+    table.endRow();
+    ++batchedRows_;
+    submit();
+}
+
+void TelemetryEventListener::rowAdded() {
+    if (++batchedRows_ >= batchRows_) {
+        submit();
+    }
+}
+
+void TelemetryEventListener::submit() {
+    if (batchedRows_ == 0) {
+        return;
+    }
+    writer_->append(batch_);
+    for (auto& table : batch_) {
+        table.clear();
+    }
+    batchedRows_ = 0;
+}
+
+} // namespace Telemetry
@@ -1,51 +1,339 @@
 #include "type_effectiveness.h"
 
-// Static member initialisation
-std::map<std::string, std::map<std::string, TypeEffectiveness::Effectiveness>>
-    TypeEffectiveness::typeChart;
-bool TypeEffectiveness::initialised = false;
-
-void TypeEffectiveness::ensureInitialised() {
-  if (!initialised) {
-    initialiseTypeChart();
-    initialised = true;
+#include <array>
+#include <iterator>
+#include <utility>
+
+namespace {
+
+using Effectiveness = TypeEffectiveness::Effectiveness;
+
+constexpr int kTypes = kPokemonTypeCount;
+
+constexpr const char *kTypeNames[kTypes] = {
+    "normal",   "fire",   "water",  "electric", "grass",   "ice",
+    "fighting", "poison", "ground", "flying",   "psychic", "bug",
+    "rock",     "ghost",  "dragon", "dark",     "steel",   "fairy"};
+
+struct Matchup {
+  PokemonType attacking;
+  PokemonType defending;
+  Effectiveness effectiveness;
+};
+
+using T = PokemonType;
+constexpr Effectiveness kNone = Effectiveness::NO_EFFECT;
+constexpr Effectiveness kHalf = Effectiveness::NOT_VERY_EFFECTIVE;
+constexpr Effectiveness kDouble = Effectiveness::SUPER_EFFECTIVE;
+
+// Every matchup that isn't neutral
+constexpr Matchup kMatchups[] = {
+    // Normal type effectiveness
+    {T::NORMAL, T::ROCK, kHalf}, {T::NORMAL, T::GHOST, kNone}, {T::NORMAL, T::STEEL, kHalf},
+
+    // Fire type effectiveness
+    {T::FIRE, T::FIRE, kHalf}, {T::FIRE, T::WATER, kHalf}, {T::FIRE, T::GRASS, kDouble},
+    {T::FIRE, T::ICE, kDouble}, {T::FIRE, T::BUG, kDouble}, {T::FIRE, T::ROCK, kHalf},
+    {T::FIRE, T::DRAGON, kHalf}, {T::FIRE, T::STEEL, kDouble},
+
+    // Water type effectiveness
+    {T::WATER, T::FIRE, kDouble}, {T::WATER, T::WATER, kHalf}, {T::WATER, T::GRASS, kHalf},
+    {T::WATER, T::GROUND, kDouble}, {T::WATER, T::ROCK, kDouble}, {T::WATER, T::DRAGON, kHalf},
+
+    // Electric type effectiveness
+    {T::ELECTRIC, T::WATER, kDouble}, {T::ELECTRIC, T::ELECTRIC, kHalf},
+    {T::ELECTRIC, T::GRASS, kHalf}, {T::ELECTRIC, T::GROUND, kNone},
+    {T::ELECTRIC, T::FLYING, kDouble}, {T::ELECTRIC, T::DRAGON, kHalf},
+    {T::ELECTRIC, T::STEEL, kHalf},
+
+    // Grass type effectiveness
+    {T::GRASS, T::FIRE, kHalf}, {T::GRASS, T::WATER, kDouble}, {T::GRASS, T::GRASS, kHalf},
+    {T::GRASS, T::POISON, kHalf}, {T::GRASS, T::GROUND, kDouble}, {T::GRASS, T::FLYING, kHalf},
+    {T::GRASS, T::BUG, kHalf}, {T::GRASS, T::ROCK, kDouble}, {T::GRASS, T::DRAGON, kHalf},
+    {T::GRASS, T::STEEL, kHalf},
+
+    // Ice type effectiveness
+    {T::ICE, T::FIRE, kHalf}, {T::ICE, T::WATER, kHalf}, {T::ICE, T::GRASS, kDouble},
+    {T::ICE, T::ICE, kHalf}, {T::ICE, T::GROUND, kDouble}, {T::ICE, T::FLYING, kDouble},
+    {T::ICE, T::DRAGON, kDouble}, {T::ICE, T::STEEL, kHalf},
+
+    // Fighting type effectiveness
+    {T::FIGHTING, T::NORMAL, kDouble}, {T::FIGHTING, T::ICE, kDouble},
+    {T::FIGHTING, T::POISON, kHalf}, {T::FIGHTING, T::FLYING, kHalf},
+    {T::FIGHTING, T::PSYCHIC, kHalf}, {T::FIGHTING, T::BUG, kHalf},
+    {T::FIGHTING, T::ROCK, kDouble}, {T::FIGHTING, T::GHOST, kNone},
+    {T::FIGHTING, T::DARK, kDouble}, {T::FIGHTING, T::STEEL, kDouble},
+    {T::FIGHTING, T::FAIRY, kHalf},
+
+    // Poison type effectiveness
+    {T::POISON, T::GRASS, kDouble}, {T::POISON, T::POISON, kHalf},
+    {T::POISON, T::GROUND, kHalf}, {T::POISON, T::ROCK, kHalf}, {T::POISON, T::GHOST, kHalf},
+    {T::POISON, T::STEEL, kNone}, {T::POISON, T::FAIRY, kDouble},
+
+    // Ground type effectiveness
+    // Ground vs Steel is neutral (1.0x) in Pokemon games
+    {T::GROUND, T::FIRE, kDouble}, {T::GROUND, T::ELECTRIC, kDouble},
+    {T::GROUND, T::GRASS, kHalf}, {T::GROUND, T::POISON, kDouble},
+    {T::GROUND, T::FLYING, kNone}, {T::GROUND, T::BUG, kHalf}, {T::GROUND, T::ROCK, kDouble},
+
+    // Flying type effectiveness
+    {T::FLYING, T::ELECTRIC, kHalf}, {T::FLYING, T::GRASS, kDouble},
+    {T::FLYING, T::FIGHTING, kDouble}, {T::FLYING, T::BUG, kDouble},
+    {T::FLYING, T::ROCK, kHalf}, {T::FLYING, T::STEEL, kHalf},
+
+    // Psychic type effectiveness
+    {T::PSYCHIC, T::FIGHTING, kDouble}, {T::PSYCHIC, T::POISON, kDouble},
+    {T::PSYCHIC, T::PSYCHIC, kHalf}, {T::PSYCHIC, T::DARK, kNone},
+    {T::PSYCHIC, T::STEEL, kHalf},
+
+    // Bug type effectiveness
+    {T::BUG, T::FIRE, kHalf}, {T::BUG, T::GRASS, kDouble}, {T::BUG, T::FIGHTING, kHalf},
+    {T::BUG, T::POISON, kHalf}, {T::BUG, T::FLYING, kHalf}, {T::BUG, T::PSYCHIC, kDouble},
+    {T::BUG, T::GHOST, kHalf}, {T::BUG, T::DARK, kDouble}, {T::BUG, T::STEEL, kHalf},
+    {T::BUG, T::FAIRY, kHalf},
+
+    // Rock type effectiveness
+    {T::ROCK, T::FIRE, kDouble}, {T::ROCK, T::ICE, kDouble}, {T::ROCK, T::FIGHTING, kHalf},
+    {T::ROCK, T::GROUND, kHalf}, {T::ROCK, T::FLYING, kDouble}, {T::ROCK, T::BUG, kDouble},
+    {T::ROCK, T::STEEL, kHalf},
+
+    // Ghost type effectiveness
+    {T::GHOST, T::NORMAL, kNone}, {T::GHOST, T::PSYCHIC, kDouble},
+    {T::GHOST, T::GHOST, kDouble}, {T::GHOST, T::DARK, kHalf}, {T::GHOST, T::STEEL, kHalf},
+
+    // Dragon type effectiveness
+    {T::DRAGON, T::DRAGON, kDouble}, {T::DRAGON, T::STEEL, kHalf},
+    {T::DRAGON, T::FAIRY, kNone},
+
+    // Dark type effectiveness
+    {T::DARK, T::FIGHTING, kHalf}, {T::DARK, T::PSYCHIC, kDouble}, {T::DARK, T::GHOST, kDouble},
+    {T::DARK, T::DARK, kHalf}, {T::DARK, T::STEEL, kHalf}, {T::DARK, T::FAIRY, kHalf},
+
+    // Steel type effectiveness
+    {T::STEEL, T::FIRE, kHalf}, {T::STEEL, T::WATER, kHalf}, {T::STEEL, T::ELECTRIC, kHalf},
+    {T::STEEL, T::ICE, kDouble}, {T::STEEL, T::ROCK, kDouble}, {T::STEEL, T::STEEL, kHalf},
+    {T::STEEL, T::FAIRY, kDouble},
+
+    // Fairy type effectiveness
+    {T::FAIRY, T::FIRE, kHalf}, {T::FAIRY, T::FIGHTING, kDouble}, {T::FAIRY, T::POISON, kHalf},
+    {T::FAIRY, T::DRAGON, kDouble}, {T::FAIRY, T::DARK, kDouble}, {T::FAIRY, T::STEEL, kHalf},
+};
+
+using TypeChart = std::array<std::array<Effectiveness, kTypes>, kTypes>;
+
+constexpr TypeChart makeTypeChart() {
+  TypeChart chart{};
+  for (auto &row : chart) {
+    for (auto &cell : row) cell = Effectiveness::NORMAL;
   }
+  for (const Matchup &matchup : kMatchups) {
+    chart[static_cast<int>(matchup.attacking)][static_cast<int>(matchup.defending)] =
+        matchup.effectiveness;
+  }
+  return chart;
+}
+
+constexpr TypeChart kTypeChart = makeTypeChart();
+
+// Multipliers in quarters, so every single and dual matchup (0x to 4x) is
+// exact in a byte
+constexpr uint8_t quarters(Effectiveness effectiveness) {
+  switch (effectiveness) {
+    case Effectiveness::NO_EFFECT:
+      return 0;
+    case Effectiveness::NOT_VERY_EFFECTIVE:
+      return 2;
+    case Effectiveness::SUPER_EFFECTIVE:
+      return 8;
+    default:
+      return 4;
+  }
+}
+
+// Singles occupy columns 0-17; the pair (a, b) with a < b follows all pairs
+// whose first type is lower
+constexpr int pairIndex(int a, int b) {
+  return kTypes + a * (2 * kTypes - 1 - a) / 2 + (b - a - 1);
+}
+
+using DefenderTable =
+    std::array<std::array<uint8_t, TypeEffectiveness::kDefenderCount>, kTypes>;
+
+constexpr DefenderTable makeDefenderTable() {
+  DefenderTable table{};
+  for (int attacking = 0; attacking < kTypes; ++attacking) {
+    for (int a = 0; a < kTypes; ++a) {
+      table[attacking][a] = quarters(kTypeChart[attacking][a]);
+      for (int b = a + 1; b < kTypes; ++b) {
+        table[attacking][pairIndex(a, b)] = static_cast<uint8_t>(
+            quarters(kTypeChart[attacking][a]) * quarters(kTypeChart[attacking][b]) / 4);
+      }
+    }
+  }
+  return table;
+}
+
+constexpr DefenderTable kDefenderTable = makeDefenderTable();
+
+static_assert(pairIndex(kTypes - 2, kTypes - 1) == TypeEffectiveness::kDefenderCount - 1,
+              "Pair columns must fill the defender table");
+static_assert(kDefenderTable[static_cast<int>(T::ELECTRIC)][pairIndex(
+                  static_cast<int>(T::WATER), static_cast<int>(T::FLYING))] == 16,
+              "Electric is 4x against Water/Flying");
+
+bool isType(PokemonType type) { return type != PokemonType::NONE; }
+
+}  // namespace
+
+const char *pokemonTypeName(PokemonType type) {
+  return isType(type) ? kTypeNames[static_cast<int>(type)] : "";
+}
+
+PokemonType parsePokemonType(std::string_view name) {
+  // Branch on the first letter so a lookup costs at most four comparisons
+  auto match = [&name](PokemonType type) {
+    return name == kTypeNames[static_cast<int>(type)];
+  };
+  if (name.empty()) return PokemonType::NONE;
+  switch (name[0]) {
+    case 'b':
+      if (match(T::BUG)) return T::BUG;
+      break;
+    case 'd':
+      if (match(T::DRAGON)) return T::DRAGON;
+      if (match(T::DARK)) return T::DARK;
+      break;
+    case 'e':
+      if (match(T::ELECTRIC)) return T::ELECTRIC;
+      break;
+    case 'f':
+      if (match(T::FIRE)) return T::FIRE;
+      if (match(T::FIGHTING)) return T::FIGHTING;
+      if (match(T::FLYING)) return T::FLYING;
+      if (match(T::FAIRY)) return T::FAIRY;
+      break;
+    case 'g':
+      if (match(T::GRASS)) return T::GRASS;
+      if (match(T::GROUND)) return T::GROUND;
+      if (match(T::GHOST)) return T::GHOST;
+      break;
+    case 'i':
+      if (match(T::ICE)) return T::ICE;
+      break;
+    case 'n':
+      if (match(T::NORMAL)) return T::NORMAL;
+      break;
+    case 'p':
+      if (match(T::POISON)) return T::POISON;
+      if (match(T::PSYCHIC)) return T::PSYCHIC;
+      break;
+    case 'r':
+      if (match(T::ROCK)) return T::ROCK;
+      break;
+    case 's':
+      if (match(T::STEEL)) return T::STEEL;
+      break;
+    case 'w':
+      if (match(T::WATER)) return T::WATER;
+      break;
+    default:
+      break;
+  }
+  return PokemonType::NONE;
+}
+
+PokemonTypes::PokemonTypes(std::vector<std::string> names) : names_(std::move(names)) {
+  ids_.reserve(names_.size());
+  for (const std::string &name : names_) {
+    ids_.push_back(parsePokemonType(name));
+  }
+}
+
+PokemonTypes::PokemonTypes(std::initializer_list<std::string> names)
+    : PokemonTypes(std::vector<std::string>(names)) {}
+
+void PokemonTypes::clear() {
+  names_.clear();
+  ids_.clear();
+}
+
+void PokemonTypes::push_back(std::string name) {
+  ids_.push_back(parsePokemonType(name));
+  names_.push_back(std::move(name));
+}
+
+bool PokemonTypes::contains(PokemonType type) const {
+  if (!isType(type)) return false;
+  for (PokemonType id : ids_) {
+    if (id == type) return true;
+  }
+  return false;
+}
+
+int TypeEffectiveness::defenderIndex(PokemonType firstType, PokemonType secondType) {
+  if (!isType(firstType)) std::swap(firstType, secondType);
+  if (!isType(firstType)) return -1;
+  int a = static_cast<int>(firstType);
+  if (!isType(secondType) || secondType == firstType) return a;
+  int b = static_cast<int>(secondType);
+  if (a > b) std::swap(a, b);
+  return pairIndex(a, b);
+}
+
+double TypeEffectiveness::getEffectivenessMultiplier(PokemonType attackingType,
+                                                     PokemonType firstType,
+                                                     PokemonType secondType) {
+  int defender = defenderIndex(firstType, secondType);
+  if (!isType(attackingType) || defender < 0) return 1.0;
+  double multiplier = kDefenderTable[static_cast<int>(attackingType)][defender] * 0.25;
+  // defenderIndex folds a repeated type into one; it still applies twice
+  return firstType == secondType ? multiplier * multiplier : multiplier;
+}
+
+double TypeEffectiveness::getEffectivenessMultiplier(
+    PokemonType attackingType, const std::vector<PokemonType> &defendingTypes) {
+  if (defendingTypes.size() <= 2) {
+    return getEffectivenessMultiplier(
+        attackingType, defendingTypes.empty() ? PokemonType::NONE : defendingTypes[0],
+        defendingTypes.size() < 2 ? PokemonType::NONE : defendingTypes[1]);
+  }
+
+  double multiplier = 1.0;
+  for (PokemonType defendingType : defendingTypes) {
+    multiplier *= getMultiplier(getEffectiveness(attackingType, defendingType));
+  }
+  return multiplier;
 }
 
 double TypeEffectiveness::getEffectivenessMultiplier(
     const std::string &attackingType,
     const std::vector<std::string> &defendingTypes) {
-  ensureInitialised();
+  PokemonType attacking = parsePokemonType(attackingType);
+  if (defendingTypes.size() <= 2) {
+    return getEffectivenessMultiplier(
+        attacking,
+        defendingTypes.empty() ? PokemonType::NONE : parsePokemonType(defendingTypes[0]),
+        defendingTypes.size() < 2 ? PokemonType::NONE : parsePokemonType(defendingTypes[1]));
+  }
 
   double multiplier = 1.0;
-
-  // Calculate combined effectiveness against all defending types
   for (const std::string &defendingType : defendingTypes) {
-    Effectiveness effectiveness =
-        getEffectiveness(attackingType, defendingType);
-    multiplier *= getMultiplier(effectiveness);
+    multiplier *= getMultiplier(getEffectiveness(attacking, parsePokemonType(defendingType)));
   }
-
   return multiplier;
 }
 
 TypeEffectiveness::Effectiveness TypeEffectiveness::getEffectiveness(
-    const std::string &attackingType, const std::string &defendingType) {
-  ensureInitialised();
-
-  // Check if attacking type exists in chart
-  auto attackingTypeIt = typeChart.find(attackingType);
-  if (attackingTypeIt == typeChart.end()) {
-    return Effectiveness::NORMAL;  // Default to normal effectiveness
-  }
-
-  // Check if defending type exists for this attacking type
-  auto defendingTypeIt = attackingTypeIt->second.find(defendingType);
-  if (defendingTypeIt == attackingTypeIt->second.end()) {
+    PokemonType attackingType, PokemonType defendingType) {
+  if (!isType(attackingType) || !isType(defendingType)) {
     return Effectiveness::NORMAL;  // Default to normal effectiveness
   }
+  return kTypeChart[static_cast<int>(attackingType)][static_cast<int>(defendingType)];
+}
 
-  return defendingTypeIt->second;
+TypeEffectiveness::Effectiveness TypeEffectiveness::getEffectiveness(
+    const std::string &attackingType, const std::string &defendingType) {
+  return getEffectiveness(parsePokemonType(attackingType), parsePokemonType(defendingType));
 }
 
 double TypeEffectiveness::getMultiplier(Effectiveness effectiveness) {
@@ -64,176 +352,5 @@ double TypeEffectiveness::getMultiplier(Effectiveness effectiveness) {
 }
 
 std::vector<std::string> TypeEffectiveness::getAllTypes() {
-  return {"normal",   "fire",   "water",  "electric", "grass",   "ice",
-          "fighting", "poison", "ground", "flying",   "psychic", "bug",
-          "rock",     "ghost",  "dragon", "dark",     "steel",   "fairy"};
+  return std::vector<std::string>(std::begin(kTypeNames), std::end(kTypeNames));
 }
-
-void TypeEffectiveness::initialiseTypeChart() {
-  // Initialise all combinations to normal effectiveness first
-  auto types = getAllTypes();
-  for (const auto &attackingType : types) {
-    for (const auto &defendingType : types) {
-      typeChart[attackingType][defendingType] = Effectiveness::NORMAL;
-    }
-  }
-
-  // Normal type effectiveness
-  typeChart["normal"]["rock"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["normal"]["ghost"] = Effectiveness::NO_EFFECT;
-  typeChart["normal"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Fire type effectiveness
-  typeChart["fire"]["fire"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fire"]["water"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fire"]["grass"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fire"]["ice"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fire"]["bug"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fire"]["rock"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fire"]["dragon"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fire"]["steel"] = Effectiveness::SUPER_EFFECTIVE;
-
-  // Water type effectiveness
-  typeChart["water"]["fire"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["water"]["water"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["water"]["grass"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["water"]["ground"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["water"]["rock"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["water"]["dragon"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Electric type effectiveness
-  typeChart["electric"]["water"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["electric"]["electric"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["electric"]["grass"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["electric"]["ground"] = Effectiveness::NO_EFFECT;
-  typeChart["electric"]["flying"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["electric"]["dragon"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["electric"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Grass type effectiveness
-  typeChart["grass"]["fire"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["grass"]["water"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["grass"]["grass"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["grass"]["poison"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["grass"]["ground"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["grass"]["flying"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["grass"]["bug"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["grass"]["rock"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["grass"]["dragon"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["grass"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Ice type effectiveness
-  typeChart["ice"]["fire"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["ice"]["water"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["ice"]["grass"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ice"]["ice"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["ice"]["ground"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ice"]["flying"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ice"]["dragon"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ice"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Fighting type effectiveness
-  typeChart["fighting"]["normal"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fighting"]["ice"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fighting"]["poison"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fighting"]["flying"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fighting"]["psychic"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fighting"]["bug"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fighting"]["rock"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fighting"]["ghost"] = Effectiveness::NO_EFFECT;
-  typeChart["fighting"]["dark"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fighting"]["steel"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fighting"]["fairy"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Poison type effectiveness
-  typeChart["poison"]["grass"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["poison"]["poison"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["poison"]["ground"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["poison"]["rock"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["poison"]["ghost"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["poison"]["steel"] = Effectiveness::NO_EFFECT;
-  typeChart["poison"]["fairy"] = Effectiveness::SUPER_EFFECTIVE;
-
-  // Ground type effectiveness
-  typeChart["ground"]["fire"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ground"]["electric"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ground"]["grass"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["ground"]["poison"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ground"]["flying"] = Effectiveness::NO_EFFECT;
-  typeChart["ground"]["bug"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["ground"]["rock"] = Effectiveness::SUPER_EFFECTIVE;
-  // Ground vs Steel is neutral (1.0x) in Pokemon games
-
-  // Flying type effectiveness
-  typeChart["flying"]["electric"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["flying"]["grass"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["flying"]["fighting"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["flying"]["bug"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["flying"]["rock"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["flying"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Psychic type effectiveness
-  typeChart["psychic"]["fighting"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["psychic"]["poison"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["psychic"]["psychic"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["psychic"]["dark"] = Effectiveness::NO_EFFECT;
-  typeChart["psychic"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Bug type effectiveness
-  typeChart["bug"]["fire"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["bug"]["grass"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["bug"]["fighting"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["bug"]["poison"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["bug"]["flying"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["bug"]["psychic"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["bug"]["ghost"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["bug"]["dark"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["bug"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["bug"]["fairy"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Rock type effectiveness
-  typeChart["rock"]["fire"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["rock"]["ice"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["rock"]["fighting"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["rock"]["ground"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["rock"]["flying"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["rock"]["bug"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["rock"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Ghost type effectiveness
-  typeChart["ghost"]["normal"] = Effectiveness::NO_EFFECT;
-  typeChart["ghost"]["psychic"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ghost"]["ghost"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["ghost"]["dark"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["ghost"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Dragon type effectiveness
-  typeChart["dragon"]["dragon"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["dragon"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["dragon"]["fairy"] = Effectiveness::NO_EFFECT;
-
-  // Dark type effectiveness
-  typeChart["dark"]["fighting"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["dark"]["psychic"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["dark"]["ghost"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["dark"]["dark"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["dark"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["dark"]["fairy"] = Effectiveness::NOT_VERY_EFFECTIVE;
-
-  // Steel type effectiveness
-  typeChart["steel"]["fire"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["steel"]["water"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["steel"]["electric"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["steel"]["ice"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["steel"]["rock"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["steel"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["steel"]["fairy"] = Effectiveness::SUPER_EFFECTIVE;
-
-  // Fairy type effectiveness
-  typeChart["fairy"]["fire"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fairy"]["fighting"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fairy"]["poison"] = Effectiveness::NOT_VERY_EFFECTIVE;
-  typeChart["fairy"]["dragon"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fairy"]["dark"] = Effectiveness::SUPER_EFFECTIVE;
-  typeChart["fairy"]["steel"] = Effectiveness::NOT_VERY_EFFECTIVE;
-}
\ No newline at end of file
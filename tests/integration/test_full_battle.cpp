@@ -200,13 +200,17 @@ TEST_F(FullBattleTest, BattleWithMultiHitMoves) {
     // Multi-hit moves
     multiHitter.moves.clear();
     Move bulletSeed = TestUtils::createTestMove("bullet-seed", 25, 100, 30, "grass", "physical");
-    bulletSeed.min_hits = 2;
-    bulletSeed.max_hits = 5;
+    MoveDef bulletSeedDef = bulletSeed.def();
+    bulletSeedDef.min_hits = 2;
+    bulletSeedDef.max_hits = 5;
+    bulletSeed.setDef(bulletSeedDef);
     multiHitter.moves.push_back(bulletSeed);
     
     Move doubleSlap = TestUtils::createTestMove("double-slap", 15, 85, 10, "normal", "physical");
-    doubleSlap.min_hits = 2;
-    doubleSlap.max_hits = 5;
+    MoveDef doubleSlapDef = doubleSlap.def();
+    doubleSlapDef.min_hits = 2;
+    doubleSlapDef.max_hits = 5;
+    doubleSlap.setDef(doubleSlapDef);
     multiHitter.moves.push_back(doubleSlap);
     
     multiHitter.moves.push_back(TestUtils::createTestMove("tackle", 40, 100, 35, "normal", "physical"));
@@ -233,11 +237,15 @@ TEST_F(FullBattleTest, BattleWithRecoilMoves) {
     // Recoil moves
     recoilUser.moves.clear();
     Move doubleEdge = TestUtils::createTestMove("double-edge", 120, 100, 15, "normal", "physical");
-    doubleEdge.drain = -25; // 25% recoil damage
+    MoveDef doubleEdgeDef = doubleEdge.def();
+    doubleEdgeDef.drain = -25; // 25% recoil damage
+    doubleEdge.setDef(doubleEdgeDef);
     recoilUser.moves.push_back(doubleEdge);
     
     Move takeDown = TestUtils::createTestMove("take-down", 90, 85, 20, "normal", "physical");
-    takeDown.drain = -25; // 25% recoil damage
+    MoveDef takeDownDef = takeDown.def();
+    takeDownDef.drain = -25; // 25% recoil damage
+    takeDown.setDef(takeDownDef);
     recoilUser.moves.push_back(takeDown);
     
     recoilUser.moves.push_back(TestUtils::createTestMove("tackle", 40, 100, 35, "normal", "physical"));
@@ -264,11 +272,15 @@ TEST_F(FullBattleTest, BattleWithPriorityMoves) {
     // Fast Pokemon has priority moves
     fastPokemon.moves.clear();
     Move quickAttack = TestUtils::createTestMove("quick-attack", 40, 100, 30, "normal", "physical");
-    quickAttack.priority = 1;
+    MoveDef quickAttackDef = quickAttack.def();
+    quickAttackDef.priority = 1;
+    quickAttack.setDef(quickAttackDef);
     fastPokemon.moves.push_back(quickAttack);
     
     Move extremeSpeed = TestUtils::createTestMove("extreme-speed", 80, 100, 5, "normal", "physical");
-    extremeSpeed.priority = 2;
+    MoveDef extremeSpeedDef = extremeSpeed.def();
+    extremeSpeedDef.priority = 2;
+    extremeSpeed.setDef(extremeSpeedDef);
     fastPokemon.moves.push_back(extremeSpeed);
     
     fastPokemon.moves.push_back(TestUtils::createTestMove("tackle", 40, 100, 35, "normal", "physical"));
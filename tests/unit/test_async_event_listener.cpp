@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "async_event_listener.h"
+#include "pokemon.h"
+
+using namespace BattleEvents;
+
+namespace {
+
+// Records health changes and turn numbers, optionally stalling until released
+class RecordingListener : public BattleEventListener {
+ public:
+  EventMask subscribedEvents() const override {
+    return eventBit(EventType::HEALTH_CHANGED) | eventBit(EventType::TURN_START);
+  }
+
+  void onHealthChanged(const HealthChangeEvent &event) override {
+    while (stalled) {
+      std::this_thread::yield();
+    }
+    damage.push_back(event.damage);
+    deliveredOn = std::this_thread::get_id();
+  }
+
+  void onTurnStart(int turnNumber) override { turns.push_back(turnNumber); }
+
+  std::atomic<bool> stalled{false};
+  std::vector<int> damage;
+  std::vector<int> turns;
+  std::thread::id deliveredOn;
+};
+
+// Records what it can read of the Pokemon in health changes
+class SnapshotListener : public BattleEventListener {
+ public:
+  EventMask subscribedEvents() const override { return eventBit(EventType::HEALTH_CHANGED); }
+
+  void onBattleEnd(const BattleEndEvent & /*event*/) override { ++battleEnds; }
+
+  void onHealthChanged(const HealthChangeEvent &event) override {
+    while (stalled) {
+      std::this_thread::yield();
+    }
+    pokemon.push_back(event.pokemon);
+    names.push_back(event.pokemon->name);
+    hp.push_back(event.pokemon->current_hp);
+    moves.push_back(event.move ? event.move->def().name : "");
+  }
+
+  std::atomic<bool> stalled{false};
+  std::vector<const Pokemon *> pokemon;
+  std::vector<std::string> names;
+  std::vector<int> hp;
+  std::vector<std::string> moves;
+  int battleEnds = 0;
+};
+
+HealthChangeEvent damageEvent(int damage) {
+  return BattleEventManager::createHealthChangeEvent(nullptr, 100, 100 - damage,
+                                                     EventSource::MOVE);
+}
+
+}  // namespace
+
+// Test that events reach the target in order on the consumer thread
+TEST(AsyncEventListenerTest, DeliversInOrderOnConsumerThread) {
+  auto target = std::make_shared<RecordingListener>();
+  auto async = std::make_shared<AsyncEventListener>(target);
+  EXPECT_EQ(async->subscribedEvents(), target->subscribedEvents() | eventBit(EventType::BATTLE_START) |
+                                          eventBit(EventType::BATTLE_END));
+
+  BattleEventManager manager;
+  manager.subscribe(async);
+  for (int i = 1; i <= 1000; ++i) {
+    manager.notifyTurnStart(i);
+    manager.notifyHealthChanged(damageEvent(i % 100));
+  }
+  async->flush();
+
+  ASSERT_EQ(target->damage.size(), 1000u);
+  ASSERT_EQ(target->turns.size(), 1000u);
+  for (int i = 1; i <= 1000; ++i) {
+    EXPECT_EQ(target->turns[i - 1], i);
+    EXPECT_EQ(target->damage[i - 1], i % 100);
+  }
+  EXPECT_NE(target->deliveredOn, std::this_thread::get_id());
+  EXPECT_EQ(async->deliveredEvents(), 2000u);
+  EXPECT_EQ(async->droppedEvents(), 0u);
+}
+
+// Test that a full ring drops, samples or blocks as configured
+TEST(AsyncEventListenerTest, OverflowPolicies) {
+  for (auto policy : {AsyncEventListener::OverflowPolicy::DROP,
+                      AsyncEventListener::OverflowPolicy::SAMPLE,
+                      AsyncEventListener::OverflowPolicy::BLOCK}) {
+    auto target = std::make_shared<RecordingListener>();
+    target->stalled = true;
+    AsyncEventListener::Config config;
+    config.capacity = 16;
+    config.overflow = policy;
+    config.sampleEvery = 4;
+    AsyncEventListener async(target, config);
+    EXPECT_EQ(async.capacity(), 16u);
+
+    if (policy == AsyncEventListener::OverflowPolicy::BLOCK) {
+      std::thread release([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        target->stalled = false;
+      });
+      for (int i = 0; i < 100; ++i) {
+        async.onHealthChanged(damageEvent(1));
+      }
+      release.join();
+      async.flush();
+      EXPECT_EQ(async.droppedEvents(), 0u);
+      EXPECT_EQ(target->damage.size(), 100u);
+      continue;
+    }
+
+    for (int i = 0; i < 100; ++i) {
+      async.onHealthChanged(damageEvent(1));
+    }
+    target->stalled = false;
+    async.flush();
+
+    EXPECT_EQ(async.queuedEvents(), 100u);
+    EXPECT_GT(async.droppedEvents(), 0u);
+    EXPECT_EQ(target->damage.size() + async.droppedEvents(), 100u);
+    if (policy == AsyncEventListener::OverflowPolicy::SAMPLE) {
+      EXPECT_GT(async.sampledOutEvents(), 0u);
+    } else {
+      EXPECT_EQ(async.sampledOutEvents(), 0u);
+    }
+  }
+}
+
+// Test that destruction delivers events still in the ring
+TEST(AsyncEventListenerTest, DrainsOnDestruction) {
+  auto target = std::make_shared<RecordingListener>();
+  {
+    AsyncEventListener async(target);
+    for (int i = 0; i < 50; ++i) {
+      async.onTurnStart(i);
+    }
+  }
+  EXPECT_EQ(target->turns.size(), 50u);
+}
+
+// Test that sampling leaves events alone while the consumer keeps up
+TEST(AsyncEventListenerTest, SampleKeepsEverythingWhenNotBehind) {
+  auto target = std::make_shared<RecordingListener>();
+  AsyncEventListener::Config config;
+  config.capacity = 16;
+  config.overflow = AsyncEventListener::OverflowPolicy::SAMPLE;
+  config.sampleEvery = 4;
+  AsyncEventListener async(target, config);
+
+  for (int i = 0; i < 100; ++i) {
+    async.onHealthChanged(damageEvent(1));
+    async.flush();
+  }
+
+  EXPECT_EQ(async.droppedEvents(), 0u);
+  EXPECT_EQ(target->damage.size(), 100u);
+}
+
+// Test that targets see Pokemon as they were when queued, never the originals
+TEST(AsyncEventListenerTest, DeliversCopiesOfPokemonAndMoves) {
+  auto target = std::make_shared<SnapshotListener>();
+  target->stalled = true;
+  AsyncEventListener async(target);
+
+  auto pokemon = std::make_unique<Pokemon>();
+  pokemon->name = "pikachu";
+  pokemon->hp = 100;
+  pokemon->current_hp = 60;
+  MoveDef def;
+  def.name = "thunderbolt";
+  Move move(def);
+  async.onHealthChanged(BattleEventManager::createHealthChangeEvent(
+      pokemon.get(), 100, 60, EventSource::MOVE, &move));
+  pokemon->current_hp = 20;
+  async.onHealthChanged(BattleEventManager::createHealthChangeEvent(
+      pokemon.get(), 60, 20, EventSource::STATUS));
+
+  // The battle's Pokemon is gone before anything is delivered
+  const Pokemon *original = pokemon.get();
+  pokemon.reset();
+  target->stalled = false;
+  async.flush();
+
+  ASSERT_EQ(target->pokemon.size(), 2u);
+  EXPECT_NE(target->pokemon[0], original);
+  EXPECT_EQ(target->pokemon[0], target->pokemon[1]);
+  EXPECT_EQ(target->names[0], "pikachu");
+  EXPECT_EQ(target->hp[0], 60);
+  EXPECT_EQ(target->hp[1], 20);
+  EXPECT_EQ(target->moves[0], "thunderbolt");
+  EXPECT_EQ(target->moves[1], "");
+}
+
+// Test that battle boundaries reach the adapter but only subscribed targets
+TEST(AsyncEventListenerTest, BattleBoundsResetStandIns) {
+  auto target = std::make_shared<SnapshotListener>();
+  AsyncEventListener async(target);
+
+  Pokemon pokemon;
+  pokemon.name = "pikachu";
+  pokemon.hp = 100;
+  for (int battle = 0; battle < 2; ++battle) {
+    async.onBattleStart(BattleStartEvent{&pokemon, nullptr});
+    for (int hp = 90; hp >= 70; hp -= 10) {
+      pokemon.current_hp = hp;
+      async.onHealthChanged(BattleEventManager::createHealthChangeEvent(
+          &pokemon, hp + 10, hp, EventSource::STATUS));
+    }
+    async.onBattleEnd(BattleEndEvent{BattleEndEvent::Winner::PLAYER, 3});
+  }
+  async.flush();
+
+  // Stand-ins are stable within a battle and start from fresh state after
+  EXPECT_EQ(target->battleEnds, 0);
+  ASSERT_EQ(target->pokemon.size(), 6u);
+  EXPECT_EQ(target->pokemon[0], target->pokemon[2]);
+  EXPECT_EQ(target->pokemon[3], target->pokemon[5]);
+  EXPECT_EQ(target->hp, (std::vector<int>{90, 80, 70, 90, 80, 70}));
+  EXPECT_EQ(async.deliveredEvents(), 10u);
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include "test_utils.h"
 #include "battle.h"
+#include "battle_replay.h"
+#include "battle_rng.h"
+#include "easy_ai.h"
 
 class BattleTest : public TestUtils::BattleTestFixture {
 protected:
@@ -282,4 +285,184 @@ TEST_F(BattleTest, BattleWithMixedTeamStates) {
     EXPECT_TRUE(mixedPlayerTeam.hasAlivePokemon());
     EXPECT_TRUE(playerPokemon2->isAlive());
     EXPECT_FALSE(playerPokemon1->isAlive());
-}
\ No newline at end of file
+}
+
+// Test headless battle runs to completion with AI strategies on both sides
+TEST_F(BattleTest, HeadlessBattleWithStrategies) {
+    Pokemon testPokemon3 = TestUtils::createTestPokemon("testmon3", 80, 70, 60, 85, 75, 90, {"water"});
+    Team headlessPlayerTeam = TestUtils::createTestTeam({testPokemon1, testPokemon3});
+    Team headlessOpponentTeam = TestUtils::createTestTeam({testPokemon2});
+
+    Battle headlessBattle(headlessPlayerTeam, headlessOpponentTeam);
+    EasyAI playerAI;
+    EasyAI opponentAI;
+
+    auto outcome = headlessBattle.runHeadless(playerAI, opponentAI);
+
+    EXPECT_TRUE(headlessBattle.isBattleOver());
+    EXPECT_NE(outcome.result, Battle::BattleResult::ONGOING);
+    EXPECT_EQ(outcome.result, headlessBattle.getBattleResult());
+    EXPECT_GT(outcome.turns, 0);
+    EXPECT_LE(outcome.turns, Battle::kDefaultHeadlessTurnLimit);
+}
+
+// Test headless battle with callback providers and the turn limit
+TEST_F(BattleTest, HeadlessBattleWithCallbacks) {
+    int playerCalls = 0;
+    Battle::ActionProvider player = [&playerCalls](const BattleState& state) {
+        ++playerCalls;
+        EXPECT_NE(state.aiPokemon, nullptr);
+        EXPECT_NE(state.opponentPokemon, nullptr);
+        return Battle::BattleAction{Battle::BattleAction::Type::MOVE, 0};
+    };
+    Battle::ActionProvider opponent = [](const BattleState&) {
+        return Battle::BattleAction{Battle::BattleAction::Type::MOVE, 0};
+    };
+
+    Battle headlessBattle(playerTeam, opponentTeam);
+    auto outcome = headlessBattle.runHeadless(player, opponent);
+    EXPECT_TRUE(headlessBattle.isBattleOver());
+    EXPECT_GT(playerCalls, 0);
+    EXPECT_EQ(outcome.turns, playerCalls);
+
+    // Harmless moves never end the battle, so the turn limit reports a draw
+    Pokemon passive1 = testPokemon1;
+    Pokemon passive2 = testPokemon2;
+    passive1.moves = {TestUtils::createTestMove("splash", 0)};
+    passive2.moves = {TestUtils::createTestMove("splash", 0)};
+    Battle limitedBattle(TestUtils::createTestTeam({passive1}),
+                         TestUtils::createTestTeam({passive2}));
+    auto limited = limitedBattle.runHeadless(player, opponent, 5);
+    EXPECT_EQ(limited.turns, 5);
+    EXPECT_EQ(limited.result, Battle::BattleResult::DRAW);
+}
+
+// Test that one seed replays a battle exactly
+TEST_F(BattleTest, SeededBattlesReplayIdentically) {
+    auto replay = [this](uint64_t seed) {
+        std::vector<int> hp;
+        Battle::ActionProvider recordingProvider = [&hp](const BattleState& state) {
+            hp.push_back(state.aiPokemon->current_hp);
+            hp.push_back(state.opponentPokemon->current_hp);
+            return Battle::BattleAction{Battle::BattleAction::Type::MOVE, 0};
+        };
+        Battle seeded(playerTeam, opponentTeam);
+        seeded.seedRandom(seed);
+        EXPECT_EQ(seeded.getRandomSeed(), seed);
+        auto outcome = seeded.runHeadless(recordingProvider, recordingProvider);
+        hp.push_back(static_cast<int>(outcome.result));
+        hp.push_back(outcome.turns);
+        return hp;
+    };
+
+    EXPECT_EQ(replay(42), replay(42));
+    EXPECT_EQ(replay(7), replay(7));
+}
+
+TEST(BattleRngTest, StreamsAreReproducibleAndIndependent) {
+    BattleRng first(12345);
+    BattleRng second(12345);
+    BattleRng other(12346);
+    int matches_other = 0;
+    for (int i = 0; i < 100; ++i) {
+        auto value = first();
+        EXPECT_EQ(value, second());
+        matches_other += value == other() ? 1 : 0;
+    }
+    EXPECT_EQ(matches_other, 0);
+
+    // Forks differ from each other and from their parent, and reseeding restarts
+    BattleRng parent(99);
+    BattleRng fork0 = parent.fork(0);
+    BattleRng fork1 = parent.fork(1);
+    EXPECT_NE(fork0(), fork1());
+    EXPECT_EQ(parent.fork(0)(), BattleRng(99).fork(0)());
+    auto start = parent();
+    parent();
+    parent.seed(99);
+    EXPECT_EQ(parent(), start);
+}
+
+TEST(BattleRngTest, HelpersStayInRange) {
+    BattleRng rng(2024);
+    std::vector<int> counts(3, 0);
+    for (int i = 0; i < 3000; ++i) {
+        int value = rng.uniformInt(1, 3);
+        ASSERT_GE(value, 1);
+        ASSERT_LE(value, 3);
+        ++counts[value - 1];
+
+        double real = rng.uniformReal();
+        ASSERT_GE(real, 0.0);
+        ASSERT_LT(real, 1.0);
+        ASSERT_LT(rng.index(7), 7u);
+    }
+    for (int count : counts) {
+        EXPECT_GT(count, 800);
+    }
+    EXPECT_EQ(rng.uniformInt(-5, -5), -5);
+    EXPECT_FALSE(rng.percentChance(0));
+    EXPECT_TRUE(rng.percentChance(100));
+}
+
+// Test that a recorded battle encodes, decodes and replays to the same outcome
+TEST_F(BattleTest, ReplayRecordsAndVerifies) {
+    Battle recorded(playerTeam, opponentTeam);
+    recorded.seedRandom(1234);
+    BattleReplay replay;
+    replay.records_draws = true;
+    recorded.recordReplay(&replay);
+    EasyAI playerAI;
+    EasyAI opponentAI;
+    auto outcome = recorded.runHeadless(playerAI, opponentAI);
+
+    ASSERT_EQ(replay.turns.size(), static_cast<size_t>(outcome.turns));
+    EXPECT_EQ(replay.seed, 1234u);
+    EXPECT_EQ(replay.result, outcome.result);
+    EXPECT_EQ(replay.end_draws, recorded.getRandomDraws());
+    EXPECT_EQ(replay.player_team_hash, BattleReplay::hashTeam(playerTeam));
+
+    // Two replays share one buffer and decode back in order
+    std::vector<uint8_t> archive;
+    replay.encode(archive);
+    size_t first_size = archive.size();
+    replay.encode(archive);
+    EXPECT_LT(first_size, 64 + 5 * replay.turns.size());
+
+    BattleReplay decoded;
+    ASSERT_EQ(BattleReplay::decode(archive.data(), archive.size(), decoded), first_size);
+    EXPECT_EQ(decoded.seed, replay.seed);
+    EXPECT_EQ(decoded.turns, replay.turns);
+    EXPECT_EQ(decoded.end_draws, replay.end_draws);
+    EXPECT_EQ(decoded.end_state_hash, replay.end_state_hash);
+    BattleReplay second;
+    EXPECT_EQ(BattleReplay::decode(archive.data() + first_size, archive.size() - first_size, second),
+              first_size);
+    EXPECT_EQ(BattleReplay::decode(archive.data(), first_size - 1, second), 0u);
+
+    auto verification = decoded.verify(playerTeam, opponentTeam);
+    EXPECT_TRUE(verification.matches) << verification.mismatch;
+    EXPECT_EQ(verification.outcome.result, outcome.result);
+    EXPECT_EQ(verification.outcome.turns, outcome.turns);
+}
+
+// Test that verification catches a tampered replay or the wrong teams
+TEST_F(BattleTest, ReplayDetectsMismatch) {
+    Battle recorded(playerTeam, opponentTeam);
+    recorded.seedRandom(99);
+    BattleReplay replay;
+    recorded.recordReplay(&replay);
+    Battle::ActionProvider firstMove = [](const BattleState&) {
+        return Battle::BattleAction{Battle::BattleAction::Type::MOVE, 0};
+    };
+    recorded.runHeadless(firstMove, firstMove);
+    ASSERT_TRUE(replay.verify(playerTeam, opponentTeam).matches);
+
+    auto verification = replay.verify(opponentTeam, playerTeam);
+    EXPECT_FALSE(verification.matches);
+    EXPECT_EQ(verification.mismatch, "player team differs from the recorded one");
+
+    BattleReplay tampered = replay;
+    tampered.seed = 100;
+    EXPECT_FALSE(tampered.verify(playerTeam, opponentTeam).matches);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "battle_events.h"
+#include "test_utils.h"
+#include "weather.h"
+
+using namespace BattleEvents;
+
+namespace {
+
+// Counts the events it handles; subscribes to health changes only unless told otherwise
+class CountingListener : public BattleEventListener {
+ public:
+  explicit CountingListener(EventMask events = eventBit(EventType::HEALTH_CHANGED))
+      : events_(events) {}
+
+  EventMask subscribedEvents() const override { return events_; }
+  void onHealthChanged(const HealthChangeEvent &) override { ++healthChanges; }
+  void onTurnStart(int) override { ++turnStarts; }
+
+  int healthChanges = 0;
+  int turnStarts = 0;
+
+ private:
+  EventMask events_;
+};
+
+// Unsubscribes a listener, possibly itself, while being notified
+class UnsubscribingListener : public BattleEventListener {
+ public:
+  explicit UnsubscribingListener(BattleEventManager &manager) : manager_(manager) {}
+
+  void onHealthChanged(const HealthChangeEvent &) override {
+    ++healthChanges;
+    auto unsubscribed = std::move(target);
+    manager_.unsubscribe(unsubscribed);
+  }
+
+  std::shared_ptr<BattleEventListener> target;
+  int healthChanges = 0;
+
+ private:
+  BattleEventManager &manager_;
+};
+
+}  // namespace
+
+// Test that listeners only receive the events they subscribe to
+TEST(BattleEventManagerTest, DispatchesBySubscribedEvents) {
+  BattleEventManager manager;
+  EXPECT_FALSE(manager.isSubscribed(EventType::HEALTH_CHANGED));
+
+  auto health = std::make_shared<CountingListener>();
+  auto all = std::make_shared<CountingListener>(kAllEvents);
+  manager.subscribe(health);
+  manager.subscribe(all);
+  manager.subscribe(health);  // Duplicate subscriptions are ignored
+  EXPECT_EQ(manager.getListenerCount(), 2u);
+  EXPECT_TRUE(manager.isSubscribed(EventType::HEALTH_CHANGED));
+  EXPECT_TRUE(manager.isSubscribed(EventType::TURN_START));
+
+  manager.notifyHealthChanged(
+      BattleEventManager::createHealthChangeEvent(nullptr, 50, 40, EventSource::MOVE));
+  manager.notifyTurnStart(1);
+  EXPECT_EQ(health->healthChanges, 1);
+  EXPECT_EQ(health->turnStarts, 0);
+  EXPECT_EQ(all->healthChanges, 1);
+  EXPECT_EQ(all->turnStarts, 1);
+
+  manager.unsubscribe(all);
+  EXPECT_FALSE(manager.isSubscribed(EventType::TURN_START));
+  manager.clear();
+  EXPECT_FALSE(manager.isSubscribed(EventType::HEALTH_CHANGED));
+  EXPECT_FALSE(manager.hasListeners());
+}
+
+// Test that a listener can unsubscribe itself and others mid-dispatch
+TEST(BattleEventManagerTest, UnsubscribeDuringDispatch) {
+  BattleEventManager manager;
+  auto unsubscriber = std::make_shared<UnsubscribingListener>(manager);
+  auto later = std::make_shared<CountingListener>();
+  unsubscriber->target = later;
+  manager.subscribe(unsubscriber);
+  manager.subscribe(later);
+
+  auto event = BattleEventManager::createHealthChangeEvent(nullptr, 50, 40, EventSource::MOVE);
+  manager.notifyHealthChanged(event);
+  EXPECT_EQ(later->healthChanges, 0);
+  EXPECT_EQ(manager.getListenerCount(), 1u);
+
+  // Dropping the last outside reference while it unsubscribes itself is safe
+  std::weak_ptr<UnsubscribingListener> watch = unsubscriber;
+  unsubscriber->target = unsubscriber;
+  unsubscriber.reset();
+  manager.notifyHealthChanged(event);
+  EXPECT_TRUE(watch.expired());
+  EXPECT_FALSE(manager.hasListeners());
+}
+
+// Test that interned sources and multi-turn messages still read as before
+TEST(BattleEventManagerTest, DescribesEventsOnRequest) {
+  EXPECT_STREQ(getSourceName(EventSource::RECOIL), "recoil");
+  EXPECT_STREQ(getSourceName(EventSource::WEATHER), "weather");
+
+  Pokemon pokemon = TestUtils::createTestPokemon("charger", 100, 80, 70, 90, 85, 75, {"grass"});
+  Move move = TestUtils::createTestMove("solar-beam", 120, 100, 10, "grass", "special");
+  auto charging = BattleEventManager::createMultiTurnMoveEvent(
+      &pokemon, &move, MultiTurnMoveEvent::Phase::CHARGING);
+  EXPECT_EQ(describeMultiTurnMove(charging), "charger began charging solar-beam!");
+  auto skipped = BattleEventManager::createMultiTurnMoveEvent(
+      &pokemon, &move, MultiTurnMoveEvent::Phase::EXECUTING, true);
+  EXPECT_EQ(describeMultiTurnMove(skipped),
+            "The sunlight is strong! charger doesn't need to charge!");
+}
+
+// Test that health changes name the move, weather or condition behind them
+TEST(BattleEventManagerTest, DescribesHealthSources) {
+  Pokemon attacker = TestUtils::createTestPokemon("pikachu", 100, 55, 40, 50, 50, 90, {"electric"});
+  Pokemon defender = TestUtils::createTestPokemon("onix", 100, 45, 160, 30, 45, 70, {"rock"});
+  Move thunderbolt = TestUtils::createTestMove("thunderbolt", 90, 100, 15, "electric", "special");
+
+  auto hit = BattleEventManager::createHealthChangeEvent(&defender, 100, 60, EventSource::MOVE,
+                                                         &thunderbolt);
+  hit.attacker = &attacker;
+  EXPECT_EQ(describeHealthSource(hit), "pikachu's thunderbolt");
+  hit.source = EventSource::OHKO;
+  EXPECT_EQ(describeHealthSource(hit), "pikachu's thunderbolt (OHKO)");
+  hit.source = EventSource::RECOIL;
+  EXPECT_EQ(describeHealthSource(hit), "thunderbolt (recoil)");
+
+  auto weather = BattleEventManager::createHealthChangeEvent(&defender, 60, 54, EventSource::WEATHER);
+  weather.weather = WeatherCondition::SANDSTORM;
+  EXPECT_EQ(describeHealthSource(weather), "Sandstorm damage");
+
+  auto status = BattleEventManager::createHealthChangeEvent(&defender, 54, 48, EventSource::STATUS);
+  status.status = StatusCondition::BURN;
+  EXPECT_EQ(describeHealthSource(status), "Burned damage");
+
+  auto other = BattleEventManager::createHealthChangeEvent(&defender, 48, 40, EventSource::ITEM);
+  EXPECT_EQ(describeHealthSource(other), "item");
+}
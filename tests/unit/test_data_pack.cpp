@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "data_pack.h"
+#include "move.h"
+#include "pokemon.h"
+#include "pokemon_data.h"
+
+// Packs are compiled from private copies of the test data, so the shared
+// data directories used by other tests are never modified
+class DataPackTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::filesystem::create_directories(pokemon_dir);
+    std::filesystem::create_directories(moves_dir);
+    std::filesystem::copy_file("data/pokemon/testmona.json", pokemon_dir + "/testmona.json",
+                               std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::copy_file("data/moves/testmove.json", moves_dir + "/testmove.json",
+                               std::filesystem::copy_options::overwrite_existing);
+    // Rejected by the loaders: kept out of the pack
+    std::ofstream(moves_dir + "/broken.json") << "{\"name\": \"broken\"";
+    pack_path = DataPack::packPathFor(pokemon_dir);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(pokemon_dir);
+    std::filesystem::remove_all(moves_dir);
+    std::filesystem::remove(pack_path);
+  }
+
+  // Rewrites a byte of the pack file in place
+  void corruptByte(size_t offset) {
+    std::fstream file(pack_path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(static_cast<std::streamoff>(offset));
+    char byte = static_cast<char>(file.get());
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.put(static_cast<char>(byte ^ 0x5A));
+  }
+
+  const std::string pokemon_dir = "data/pokemon/data_pack_test";
+  const std::string moves_dir = "data/moves/data_pack_test";
+  std::string pack_path;
+};
+
+// Records read back from the mapped pack match the JSON loaders field for field
+TEST_F(DataPackTest, BuildAndReadBack) {
+  auto result = DataPack::build(pokemon_dir, moves_dir, pack_path);
+  ASSERT_TRUE(result.success) << result.error_message;
+  EXPECT_EQ(result.pokemon_count, 1);
+  EXPECT_EQ(result.move_count, 1);
+
+  DataPack pack;
+  ASSERT_TRUE(pack.open(pack_path));
+  EXPECT_TRUE(pack.isCurrent(pokemon_dir, moves_dir));
+  EXPECT_EQ(pack.findMove("broken"), nullptr);
+  EXPECT_EQ(pack.findPokemon("missing"), nullptr);
+
+  Pokemon packed;
+  ASSERT_TRUE(pack.loadPokemon("testmona", packed));
+  Pokemon parsed("testmona");
+  EXPECT_EQ(packed.name, parsed.name);
+  EXPECT_EQ(packed.id, 901);
+  EXPECT_EQ(packed.types, parsed.types);
+  EXPECT_EQ(packed.hp, parsed.hp);
+  EXPECT_EQ(packed.current_hp, parsed.current_hp);
+  EXPECT_EQ(packed.attack, parsed.attack);
+  EXPECT_EQ(packed.defense, parsed.defense);
+  EXPECT_EQ(packed.special_attack, parsed.special_attack);
+  EXPECT_EQ(packed.special_defense, parsed.special_defense);
+  EXPECT_EQ(packed.speed, parsed.speed);
+
+  MoveDef packed_move;
+  ASSERT_TRUE(pack.loadMove("testmove", packed_move));
+  const MoveDef& parsed_move = Move("testmove").def();
+  EXPECT_EQ(packed_move.name, parsed_move.name);
+  EXPECT_EQ(packed_move.effect_chance, -1);
+  EXPECT_EQ(packed_move.pp, 15);
+  EXPECT_EQ(packed_move.damage_class, DamageClass::PHYSICAL);
+  EXPECT_EQ(packed_move.max_hits, 1);
+  EXPECT_EQ(packed_move.multi_turn_behavior, MultiTurnBehavior::NONE);
+  EXPECT_TRUE(packed_move == parsed_move);
+}
+
+// Changed sources make the pack stale; damaged files are rejected on open
+TEST_F(DataPackTest, DetectsStaleAndCorruptPacks) {
+  ASSERT_TRUE(DataPack::build(pokemon_dir, moves_dir, pack_path).success);
+  size_t pack_size = std::filesystem::file_size(pack_path);
+
+  DataPack pack;
+  ASSERT_TRUE(pack.open(pack_path));
+  auto touched = std::filesystem::last_write_time(moves_dir + "/testmove.json");
+  std::filesystem::last_write_time(moves_dir + "/testmove.json", touched + std::chrono::seconds(5));
+  EXPECT_FALSE(pack.isCurrent(pokemon_dir, moves_dir));
+  std::ofstream(pokemon_dir + "/extra.json") << "{}";
+  EXPECT_FALSE(pack.isCurrent(pokemon_dir, moves_dir));
+  pack.close();
+
+  // ensureCurrent recompiles a stale pack
+  EXPECT_TRUE(DataPack::ensureCurrent(pokemon_dir, moves_dir, pack_path));
+  ASSERT_TRUE(pack.open(pack_path));
+  EXPECT_TRUE(pack.isCurrent(pokemon_dir, moves_dir));
+  pack.close();
+
+  corruptByte(pack_size - 8);  // Inside the string table
+  EXPECT_FALSE(pack.open(pack_path));
+  EXPECT_FALSE(pack.isOpen());
+  EXPECT_EQ(pack.findPokemon("testmona"), nullptr);
+
+  std::filesystem::resize_file(pack_path, 16);
+  EXPECT_FALSE(pack.open(pack_path));
+  EXPECT_FALSE(pack.open(pack_path + ".missing"));
+}
+
+// PokemonData reads a current pack and falls back to JSON once it is stale
+TEST_F(DataPackTest, PokemonDataFallsBackToJson) {
+  PokemonData from_json;
+  auto json_result = from_json.initialize(pokemon_dir, moves_dir);
+  ASSERT_TRUE(json_result.success) << json_result.error_message;
+  EXPECT_FALSE(from_json.isUsingDataPack());
+
+  ASSERT_TRUE(DataPack::ensureCurrent(pokemon_dir, moves_dir, pack_path));
+
+  PokemonData from_pack;
+  auto pack_result = from_pack.initialize(pokemon_dir, moves_dir);
+  ASSERT_TRUE(pack_result.success);
+  EXPECT_TRUE(from_pack.isUsingDataPack());
+  EXPECT_EQ(pack_result.loaded_count, json_result.loaded_count);
+  EXPECT_EQ(pack_result.failed_count, json_result.failed_count);
+  EXPECT_EQ(from_pack.getAvailablePokemon(), from_json.getAvailablePokemon());
+  EXPECT_EQ(from_pack.getAvailableMoves(), from_json.getAvailableMoves());
+
+  auto pokemon = from_pack.getPokemonInfo("TestMona");
+  ASSERT_TRUE(pokemon.has_value());
+  EXPECT_EQ(pokemon->types, from_json.getPokemonInfo("testmona")->types);
+  EXPECT_EQ(pokemon->speed, 75);
+  auto move = from_pack.getMoveInfo("testmove");
+  auto json_move = from_json.getMoveInfo("testmove");
+  ASSERT_TRUE(move.has_value());
+  EXPECT_EQ(move->type, json_move->type);
+  EXPECT_EQ(move->power, json_move->power);
+  EXPECT_EQ(move->category, json_move->category);
+  EXPECT_EQ(from_pack.getMovesByType("normal"), from_json.getMovesByType("normal"));
+
+  // A new data file makes the pack stale: the next load reads JSON again
+  std::filesystem::copy_file(pokemon_dir + "/testmona.json", pokemon_dir + "/testmonb.json");
+  auto reloaded = from_pack.reloadData();
+  EXPECT_TRUE(reloaded.success);
+  EXPECT_FALSE(from_pack.isUsingDataPack());
+}
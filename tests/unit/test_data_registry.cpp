@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "data_registry.h"
+#include "pokemon_data.h"
+#include "team.h"
+
+// A name is loaded once; later constructions copy the same prototype
+TEST(DataRegistryTest, InternsEachNameOnce) {
+  auto& registry = DataRegistry::instance();
+  auto handle = registry.speciesHandle("testmona");
+  ASSERT_NE(handle, DataRegistry::kNoHandle);
+  EXPECT_EQ(registry.speciesHandle("testmona"), handle);
+  EXPECT_EQ(registry.speciesHandleById(901), handle);
+
+  const Pokemon& prototype = registry.species(handle);
+  EXPECT_EQ(prototype.name, "testmona");
+  EXPECT_TRUE(prototype.moves.empty());
+  EXPECT_EQ(&registry.species(handle), &prototype);
+
+  Pokemon pokemon("testmona");
+  EXPECT_EQ(pokemon.name, prototype.name);
+  EXPECT_EQ(pokemon.types, prototype.types);
+  EXPECT_EQ(pokemon.current_hp, prototype.hp);
+  EXPECT_EQ(pokemon.speed, 75);
+  EXPECT_EQ(pokemon.status, StatusCondition::NONE);
+
+  auto move_handle = registry.moveHandle("testmove");
+  ASSERT_NE(move_handle, DataRegistry::kNoHandle);
+  Move move("testmove");
+  EXPECT_EQ(move.def().name, registry.moveDef(move_handle).name);
+  EXPECT_EQ(move.current_pp, 15);
+  EXPECT_EQ(move.def().power, 80);
+}
+
+// Unknown or unsafe names are never interned
+TEST(DataRegistryTest, RejectsUnknownNames) {
+  auto& registry = DataRegistry::instance();
+  size_t species = registry.speciesCount();
+  EXPECT_EQ(registry.speciesHandle("no-such-pokemon"), DataRegistry::kNoHandle);
+  EXPECT_EQ(registry.speciesHandle("../moves/testmove"), DataRegistry::kNoHandle);
+  EXPECT_EQ(registry.moveHandle(""), DataRegistry::kNoHandle);
+  EXPECT_EQ(registry.speciesHandleById(12345), DataRegistry::kNoHandle);
+  EXPECT_EQ(registry.speciesCount(), species);
+}
+
+// Threads racing to intern the same names all get the same handles
+TEST(DataRegistryTest, ConcurrentInterningAgrees) {
+  auto& registry = DataRegistry::instance();
+  constexpr int kThreads = 8;
+  std::vector<DataRegistry::Handle> species(kThreads), moves(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      species[t] = registry.speciesHandle("testmonc");
+      moves[t] = registry.moveHandle("testmove");
+      Pokemon pokemon("testmonb");
+      pokemon.moves.push_back(Move("testmove"));
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (int t = 0; t < kThreads; ++t) {
+    EXPECT_NE(species[t], DataRegistry::kNoHandle);
+    EXPECT_EQ(species[t], species[0]);
+    EXPECT_EQ(moves[t], moves[0]);
+  }
+
+  // preload interns the remaining files without duplicating any
+  EXPECT_EQ(registry.preload(), 4u);  // testmona/b/c and testmove
+  EXPECT_EQ(registry.preload(), 4u);
+}
+
+// A reload reaches teams built afterwards; moves already built keep theirs
+TEST(DataRegistryTest, ReloadReachesNewTeams) {
+  const std::string path = "data/moves/reloadmove.json";
+  auto writeMove = [&path](int power, int pp) {
+    std::ofstream out(path);
+    out << R"({"name": "reloadmove", "power": )" << power << R"(, "accuracy": 100, )"
+        << R"("effect_chance": null, "pp": )" << pp << R"(, "priority": 0, )"
+        << R"("damage_class": {"name": "physical", "url": ""}, "effect_entries": [], )"
+        << R"("Info": {"ailment": {"name": "none", "url": ""}, "ailment_chance": 0, )"
+        << R"("category": {"name": "damage", "url": ""}, "crit_rate": 0, "drain": 0, )"
+        << R"("flinch_chance": 0, "healing": 0, "max_hits": null, "max_turns": null, )"
+        << R"("min_hits": null, "min_turns": null, "stat_chance": 0}})";
+  };
+  auto buildTeam = [] {
+    Team team;
+    team.loadTeams({{"reload", {"testmona"}}}, {{"reload", {{"testmona", {"reloadmove"}}}}},
+                   "reload");
+    return team;
+  };
+
+  writeMove(40, 10);
+  auto& registry = DataRegistry::instance();
+  PokemonData data;
+  ASSERT_TRUE(data.initialize("data/pokemon", "data/moves").success);
+  Team before = buildTeam();
+  ASSERT_EQ(before.getPokemon(0)->moves.size(), 1u);
+  const Move& old_move = before.getPokemon(0)->moves[0];
+  EXPECT_EQ(old_move.def().power, 40);
+  uint64_t generation = registry.generation();
+
+  // Rewrite the file; move its timestamp on in case the clock is coarse
+  auto written = std::filesystem::last_write_time(path);
+  writeMove(120, 5);
+  std::filesystem::last_write_time(path, written + std::chrono::seconds(1));
+  EXPECT_TRUE(data.reloadData().success);
+  EXPECT_GT(registry.generation(), generation);
+
+  Team after = buildTeam();
+  ASSERT_EQ(after.getPokemon(0)->moves.size(), 1u);
+  EXPECT_EQ(after.getPokemon(0)->moves[0].def().power, 120);
+  EXPECT_EQ(after.getPokemon(0)->moves[0].current_pp, 5);
+  EXPECT_EQ(old_move.def().power, 40);
+  EXPECT_EQ(old_move.current_pp, 10);
+
+  // Touching the file without changing its contents is not a change
+  generation = registry.generation();
+  std::filesystem::last_write_time(path, written + std::chrono::seconds(2));
+  EXPECT_TRUE(data.reloadData().success);
+  EXPECT_EQ(registry.generation(), generation);
+
+  // A removed file is forgotten rather than served from the old generation
+  std::filesystem::remove(path);
+  data.reloadData();
+  EXPECT_EQ(registry.moveHandle("reloadmove"), DataRegistry::kNoHandle);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "data_schema.h"
+#include "move.h"
+
+namespace {
+
+const std::string kThunderbolt = R"({
+  "name": "thunderbolt", "accuracy": 100, "effect_chance": 10, "pp": 15, "priority": 0,
+  "power": 90, "damage_class": {"name": "special", "url": "ignored"},
+  "effect_entries": [{"effect": "ignored", "language": {"name": "en"}}],
+  "Info": {"ailment": {"name": "paralysis"}, "ailment_chance": 10,
+           "category": {"name": "damage+ailment"}, "crit_rate": 0, "drain": 0,
+           "flinch_chance": 0, "healing": 0, "max_hits": null, "max_turns": null,
+           "min_hits": null, "min_turns": null, "stat_chance": 0}})";
+
+const std::string kPikachu = R"({"name": "pikachu", "id": 25, "types": ["electric"],
+  "base_stats": {"hp": 35, "attack": 55, "defense": 40, "special-attack": 50,
+                 "special-defense": 50, "speed": 90}})";
+
+std::string replace(std::string text, const std::string& from, const std::string& to) {
+  text.replace(text.find(from), from.size(), to);
+  return text;
+}
+
+bool moveIsValid(const std::string& text) {
+  MoveDef move;
+  std::vector<SchemaError> errors;
+  return DataSchema::parseMove(text, move, errors);
+}
+
+bool speciesIsValid(const std::string& text) {
+  SpeciesRecord species;
+  std::vector<SchemaError> errors;
+  return DataSchema::parseSpecies(text, species, errors);
+}
+
+}  // namespace
+
+TEST(DataSchemaTest, ParsesMoveRecord) {
+  MoveDef move;
+  std::vector<SchemaError> errors;
+  ASSERT_TRUE(DataSchema::parseMove(kThunderbolt, move, errors));
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(move.name, "thunderbolt");
+  EXPECT_EQ(move.accuracy, 100);
+  EXPECT_EQ(move.effect_chance, 10);
+  EXPECT_EQ(move.pp, 15);
+  EXPECT_EQ(move.power, 90);
+  EXPECT_EQ(move.damage_class, DamageClass::SPECIAL);
+  EXPECT_EQ(move.ailment_name, "paralysis");
+  EXPECT_EQ(move.ailment_id, MoveAilment::PARALYSIS);
+  EXPECT_EQ(move.ailment_chance, 10);
+  EXPECT_EQ(move.category, "damage+ailment");
+  EXPECT_EQ(move.category_id, MoveCategory::OTHER);
+  EXPECT_EQ(move.max_hits, 1);
+  EXPECT_EQ(move.min_turns, 1);
+}
+
+// Nullable fields fall back when null or missing; defaulted ones only when missing
+TEST(DataSchemaTest, MoveFallbacks) {
+  MoveDef move;
+  std::vector<SchemaError> errors;
+  auto text = replace(replace(kThunderbolt, "\"power\": 90,", "\"power\": null,"),
+                      "\"accuracy\": 100,", "");
+  text = replace(text, "\"priority\": 0,", "");
+  ASSERT_TRUE(DataSchema::parseMove(text, move, errors));
+  EXPECT_EQ(move.power, -1);
+  EXPECT_EQ(move.accuracy, 100);
+  EXPECT_EQ(move.priority, 0);
+
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"priority\": 0", "\"priority\": null")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"pp\": 15,", "")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"stat_chance\": 0", "\"stat_chance\": null")));
+}
+
+TEST(DataSchemaTest, RejectsBadMoves) {
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"thunderbolt\"", "\"\"")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"pp\": 15", "\"pp\": 41")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"pp\": 15", "\"pp\": 15.5")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"pp\": 15", "\"pp\": \"15\"")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"special\"", "\"magic\"")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"paralysis\"", "\"no-type-immunity\"")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"max_turns\": null", "\"max_turns\": 15")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "{\"name\": \"special\", \"url\": \"ignored\"}",
+                                   "\"special\"")));
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"Info\"", "\"info\"")));
+  EXPECT_FALSE(moveIsValid("[1, 2, 3]"));
+  EXPECT_FALSE(moveIsValid("{\"name\": \"thunderbolt\""));
+}
+
+// Every broken rule is reported with its path
+TEST(DataSchemaTest, ReportsEveryError) {
+  MoveDef move;
+  std::vector<SchemaError> errors;
+  auto text = replace(replace(kThunderbolt, "\"pp\": 15", "\"pp\": 0"), "\"drain\": 0",
+                      "\"drain\": 101");
+  EXPECT_FALSE(DataSchema::parseMove(text, move, errors));
+  ASSERT_EQ(errors.size(), 2u);
+  EXPECT_EQ(errors[0].field, "pp");
+  EXPECT_EQ(errors[1].field, "Info.drain");
+  EXPECT_EQ(errors[1].describe(), "Info.drain: value 101 is out of range [-100, 100]");
+
+  errors.clear();
+  EXPECT_FALSE(DataSchema::parseMove("{oops}", move, errors));
+  ASSERT_EQ(errors.size(), 1u);
+  EXPECT_TRUE(errors[0].field.empty());
+}
+
+// As in a DOM, the last occurrence of a repeated key wins
+TEST(DataSchemaTest, RepeatedKeyLastWins) {
+  MoveDef move;
+  std::vector<SchemaError> errors;
+  EXPECT_TRUE(DataSchema::parseMove(replace(kThunderbolt, "\"pp\": 15", "\"pp\": 99, \"pp\": 15"),
+                                    move, errors));
+  EXPECT_EQ(move.pp, 15);
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"pp\": 15", "\"pp\": 15, \"pp\": 99")));
+  // A repeated object replaces everything under it
+  EXPECT_FALSE(moveIsValid(replace(kThunderbolt, "\"damage_class\":",
+                                   "\"damage_class\": {\"name\": \"status\"}, \"damage_class\": {},"
+                                   " \"ignored\":")));
+}
+
+TEST(DataSchemaTest, ParsesSpeciesRecord) {
+  SpeciesRecord species;
+  std::vector<SchemaError> errors;
+  ASSERT_TRUE(DataSchema::parseSpecies(kPikachu, species, errors));
+  EXPECT_EQ(species.name, "pikachu");
+  EXPECT_EQ(species.id, 25);
+  EXPECT_EQ(species.types, std::vector<std::string>{"electric"});
+  EXPECT_EQ(species.hp, 35);
+  EXPECT_EQ(species.special_defense, 50);
+  EXPECT_EQ(species.speed, 90);
+}
+
+TEST(DataSchemaTest, RejectsBadSpecies) {
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "\"id\": 25", "\"id\": 1000")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "[]")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "[\"electric\", \"fire\", \"ice\"]")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "[\"electric\", 3]")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "[\"electric\", [\"fire\"]]")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "[\"steel\"]")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "\"electric\"")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "\"speed\": 90", "\"speed\": 0")));
+  EXPECT_FALSE(speciesIsValid(replace(kPikachu, "\"base_stats\"", "\"stats\"")));
+  EXPECT_TRUE(speciesIsValid(replace(kPikachu, "[\"electric\"]", "[\"electric\", \"fairy\"]")));
+}
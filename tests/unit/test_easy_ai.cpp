@@ -339,7 +339,9 @@ TEST_F(EasyAITest, PriorityMoves) {
       "tackle", 40, 100, 35, "normal", "physical"));
   Move quickAttack = TestUtils::createTestMove(
       "quick-attack", 40, 100, 30, "normal", "physical");
-  quickAttack.priority = 1;  // Priority move
+  MoveDef quickAttackDef = quickAttack.def();
+  quickAttackDef.priority = 1;  // Priority move
+  quickAttack.setDef(quickAttackDef);
   battleState.aiPokemon->moves.push_back(quickAttack);
 
   MoveEvaluation result = easyAI->chooseBestMove(battleState);
@@ -180,6 +180,101 @@ TEST_F(ExpertAITest, MiniMaxPositionEvaluation) {
   EXPECT_LT(disadvantage_score, normal_score + 10.0);  // Should be worse than normal
 }
 
+// Tests that iterative deepening stops at its wall-clock budget with a usable line
+TEST_F(ExpertAITest, IterativeDeepeningRespectsTimeBudget) {
+  std::vector<int> best_line;
+  auto budget = std::chrono::milliseconds(5);
+  double evaluation = expertAI->iterativeDeepeningSearch(battleState, budget, best_line);
+  auto stats = expertAI->getSearchStatistics();
+
+  EXPECT_TRUE(std::isfinite(evaluation));
+  EXPECT_GE(stats.completed_depth, 1);
+  ASSERT_FALSE(best_line.empty());
+  EXPECT_EQ(stats.principal_variation, best_line);
+  EXPECT_DOUBLE_EQ(stats.principal_variation_score, evaluation);
+  // Generous slack for loaded machines; an unbounded search takes far longer
+  EXPECT_LT(stats.search_time.count(), budget.count() + 100);
+}
+
+// Tests that a completed iterative deepening run agrees with fixed-depth search
+TEST_F(ExpertAITest, IterativeDeepeningMatchesFixedDepth) {
+  std::vector<int> deepening_line;
+  double deepening = expertAI->iterativeDeepeningSearch(
+      battleState, std::chrono::milliseconds(10000), deepening_line, 3);
+  EXPECT_EQ(expertAI->getSearchStatistics().completed_depth, 3);
+
+  ExpertAI fresh;
+  std::vector<int> fixed_line;
+  double fixed = fresh.miniMaxSearch(battleState, 3, -1000.0, 1000.0, true, fixed_line);
+  EXPECT_NEAR(deepening, fixed, 1e-3);
+  EXPECT_FALSE(deepening_line.empty());
+}
+
+// Tests that chooseBestMove honours a configured search budget
+TEST_F(ExpertAITest, ChooseBestMoveWithSearchBudget) {
+  expertAI->setSearchTimeBudget(std::chrono::milliseconds(20));
+  EXPECT_EQ(expertAI->getSearchTimeBudget().count(), 20);
+
+  MoveEvaluation result = expertAI->chooseBestMove(battleState);
+  ASSERT_GE(result.moveIndex, 0);
+  ASSERT_LT(result.moveIndex, static_cast<int>(battleState.aiPokemon->moves.size()));
+  EXPECT_TRUE(battleState.aiPokemon->moves[result.moveIndex].canUse());
+  EXPECT_GE(expertAI->getSearchStatistics().completed_depth, 1);
+}
+
+// Tests that reproducible parallel search gives identical results at any thread count
+TEST_F(ExpertAITest, ReproducibleParallelSearchIsDeterministic) {
+  std::vector<int> serial_line;
+  double serial = expertAI->miniMaxSearch(battleState, 3, -1000.0, 1000.0, true, serial_line);
+
+  std::vector<int> reference_line;
+  double reference = 0.0;
+  for (int threads : {1, 2, 4, 3}) {
+    ExpertAI parallel;
+    parallel.setParallelSearch({threads, true});
+    std::vector<int> line;
+    double value = parallel.miniMaxSearch(battleState, 3, -1000.0, 1000.0, true, line);
+    EXPECT_EQ(parallel.getSearchStatistics().worker_threads, threads);
+    ASSERT_FALSE(line.empty());
+
+    if (threads == 1) {
+      reference = value;
+      reference_line = line;
+    } else {
+      // Bit-identical value, same chosen move and line
+      EXPECT_EQ(value, reference) << threads << " threads";
+      EXPECT_EQ(line.front(), reference_line.front()) << threads << " threads";
+      EXPECT_EQ(line, reference_line) << threads << " threads";
+    }
+  }
+
+  // Root splitting finds the same minimax value as the serial search
+  EXPECT_NEAR(reference, serial, 1e-3);
+}
+
+// Tests that Lazy SMP helpers share the table and still return a usable line
+TEST_F(ExpertAITest, LazySmpParallelSearch) {
+  expertAI->setParallelSearch({4, false});
+  EXPECT_EQ(expertAI->getParallelSearch().worker_threads, 4);
+  EXPECT_FALSE(expertAI->getParallelSearch().reproducible);
+
+  std::vector<int> best_line;
+  double evaluation = expertAI->miniMaxSearch(battleState, 3, -1000.0, 1000.0, true, best_line);
+  auto stats = expertAI->getSearchStatistics();
+
+  EXPECT_TRUE(std::isfinite(evaluation));
+  EXPECT_EQ(stats.worker_threads, 4);
+  EXPECT_GT(stats.nodes_evaluated, 0);
+  EXPECT_GT(stats.tt_hits + stats.tt_misses + stats.tt_collisions, 0u);
+  ASSERT_FALSE(best_line.empty());
+
+  // Budgeted search works the same way with helpers running
+  std::vector<int> timed_line;
+  expertAI->iterativeDeepeningSearch(battleState, std::chrono::milliseconds(20), timed_line);
+  EXPECT_GE(expertAI->getSearchStatistics().completed_depth, 1);
+  EXPECT_FALSE(timed_line.empty());
+}
+
 // Tests team archetype recognition for meta-game analysis
 TEST_F(ExpertAITest, MetaGameTeamArchetypeRecognition) {
   // Test that the AI can correctly identify different team compositions and strategies
@@ -683,8 +778,10 @@ TEST_F(ExpertAITest, GenerateLegalMovesSwitchOnlyScenario) {
 // Test generateLegalMoves correct target legality and no duplicate states
 TEST_F(ExpertAITest, GenerateLegalMovesTargetLegalityAndUniqueness) {
   // Minimal test - just verify the method doesn't crash and returns valid data
+  MoveDef def = battleState.aiPokemon->moves[0].def();
+  def.power = 80;
+  battleState.aiPokemon->moves[0].setDef(def);
   battleState.aiPokemon->moves[0].current_pp = 5;
-  battleState.aiPokemon->moves[0].power = 80;
   
   // Ensure status is clear to avoid canAct issues
   battleState.aiPokemon->status = StatusCondition::NONE;
@@ -855,8 +952,10 @@ TEST_F(ExpertAITest, AssessPositionalAdvantage) {
 TEST_F(ExpertAITest, EvaluateResourceManagement) {
   // Test PP management
   BattleState ppState = battleState;
+  MoveDef def = ppState.aiPokemon->moves[0].def();
+  def.power = 120;
+  ppState.aiPokemon->moves[0].setDef(def);
   ppState.aiPokemon->moves[0].current_pp = 1; // Low on powerful move
-  ppState.aiPokemon->moves[0].power = 120;
   
   double ppScore = expertAI->evaluateResourceManagement(ppState);
   
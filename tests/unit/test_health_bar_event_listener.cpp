@@ -116,7 +116,7 @@ TEST_F(HealthBarEventListenerTest, HealthChangeEventHandling) {
     event.oldHealth = 100;
     event.newHealth = 75;
     event.damage = 25;
-    event.source = "move";
+    event.source = BattleEvents::EventSource::MOVE;
     
     // Reset call counters
     mockAnimator->displayAnimatedHealthCalls = 0;
@@ -137,7 +137,7 @@ TEST_F(HealthBarEventListenerTest, HealthChangeEventUnregisteredPokemon) {
     event.oldHealth = 80;
     event.newHealth = 60;
     event.damage = 20;
-    event.source = "move";
+    event.source = BattleEvents::EventSource::MOVE;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -221,7 +221,7 @@ TEST_F(HealthBarEventListenerTest, HealingEvents) {
     healEvent.oldHealth = 50;
     healEvent.newHealth = 75;
     healEvent.damage = -25; // Negative damage indicates healing
-    healEvent.source = "item";
+    healEvent.source = BattleEvents::EventSource::ITEM;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -240,7 +240,7 @@ TEST_F(HealthBarEventListenerTest, MultipleConsecutiveHealthChanges) {
     event1.oldHealth = 100;
     event1.newHealth = 80;
     event1.damage = 20;
-    event1.source = "move";
+    event1.source = BattleEvents::EventSource::MOVE;
     
     // Second damage event
     BattleEvents::HealthChangeEvent event2;
@@ -248,7 +248,7 @@ TEST_F(HealthBarEventListenerTest, MultipleConsecutiveHealthChanges) {
     event2.oldHealth = 80;
     event2.newHealth = 50;
     event2.damage = 30;
-    event2.source = "move";
+    event2.source = BattleEvents::EventSource::MOVE;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -268,7 +268,7 @@ TEST_F(HealthBarEventListenerTest, StatusConditionIntegration) {
     event.oldHealth = 100;
     event.newHealth = 90;
     event.damage = 10;
-    event.source = "status";
+    event.source = BattleEvents::EventSource::STATUS;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -285,7 +285,7 @@ TEST_F(HealthBarEventListenerTest, ZeroDamageEvents) {
     event.oldHealth = 100;
     event.newHealth = 100;
     event.damage = 0;
-    event.source = "missed";
+    event.source = BattleEvents::EventSource::MOVE;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -304,7 +304,7 @@ TEST_F(HealthBarEventListenerTest, KnockoutEvents) {
     knockoutEvent.oldHealth = 15;
     knockoutEvent.newHealth = 0;
     knockoutEvent.damage = 15;
-    knockoutEvent.source = "move";
+    knockoutEvent.source = BattleEvents::EventSource::MOVE;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -325,7 +325,7 @@ TEST_F(HealthBarEventListenerTest, RevivalEvents) {
     revivalEvent.oldHealth = 0;
     revivalEvent.newHealth = 50;
     revivalEvent.damage = -50; // Negative damage for healing
-    revivalEvent.source = "revive";
+    revivalEvent.source = BattleEvents::EventSource::ITEM;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -346,7 +346,7 @@ TEST_F(HealthBarEventListenerTest, CustomDisplayNames) {
     event.oldHealth = 80;
     event.newHealth = 60;
     event.damage = 20;
-    event.source = "move";
+    event.source = BattleEvents::EventSource::MOVE;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -378,7 +378,7 @@ TEST_F(HealthBarEventListenerTest, PokemonReregistration) {
     event.oldHealth = 100;
     event.newHealth = 75;
     event.damage = 25;
-    event.source = "move";
+    event.source = BattleEvents::EventSource::MOVE;
     
     EXPECT_NO_THROW({
         eventListener->onHealthChanged(event);
@@ -392,7 +392,7 @@ TEST_F(HealthBarEventListenerTest, MaximumHealthChanges) {
     maxDamageEvent.oldHealth = testPokemon1.stats.hp;
     maxDamageEvent.newHealth = 0;
     maxDamageEvent.damage = testPokemon1.stats.hp;
-    maxDamageEvent.source = "move";
+    maxDamageEvent.source = BattleEvents::EventSource::MOVE;
     
     mockAnimator->displayAnimatedHealthCalls = 0;
     
@@ -405,7 +405,10 @@ TEST_F(HealthBarEventListenerTest, MaximumHealthChanges) {
 
 // Test different damage sources
 TEST_F(HealthBarEventListenerTest, DifferentDamageSources) {
-    std::vector<std::string> sources = {"move", "weather", "status", "item", "ability", "recoil"};
+    std::vector<BattleEvents::EventSource> sources = {
+        BattleEvents::EventSource::MOVE, BattleEvents::EventSource::WEATHER,
+        BattleEvents::EventSource::STATUS, BattleEvents::EventSource::ITEM,
+        BattleEvents::EventSource::OTHER, BattleEvents::EventSource::RECOIL};
     
     for (const auto& source : sources) {
         BattleEvents::HealthChangeEvent event;
@@ -419,7 +422,7 @@ TEST_F(HealthBarEventListenerTest, DifferentDamageSources) {
         
         eventListener->onHealthChanged(event);
         
-        EXPECT_EQ(mockAnimator->displayAnimatedHealthCalls, 1) << "Failed for source: " << source;
+        EXPECT_EQ(mockAnimator->displayAnimatedHealthCalls, 1) << "Failed for source: " << BattleEvents::getSourceName(source);
     }
 }
 
@@ -433,7 +436,7 @@ TEST_F(HealthBarEventListenerTest, PerformanceWithManyEvents) {
         event.oldHealth = 100;
         event.newHealth = 90;
         event.damage = 10;
-        event.source = "move";
+        event.source = BattleEvents::EventSource::MOVE;
         
         eventListener->onHealthChanged(event);
     }
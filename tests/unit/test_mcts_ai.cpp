@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include "ai_factory.h"
+#include "mcts_ai.h"
+#include "test_utils.h"
+
+class MCTSAITest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Fire lead with a weak normal move and a strong super-effective one
+    Pokemon lead = TestUtils::createTestPokemon("lead", 100, 80, 70, 90, 85, 75, {"fire"});
+    lead.moves.clear();
+    lead.moves.push_back(TestUtils::createTestMove("tackle", 20, 100, 35, "normal", "physical"));
+    lead.moves.push_back(TestUtils::createTestMove("flamethrower", 90, 100, 15, "fire", "special"));
+
+    aiTeam = TestUtils::createTestTeam(
+        {lead, TestUtils::createTestPokemon("backup", 90, 70, 80, 70, 80, 60, {"water"})});
+    opponentTeam = TestUtils::createTestTeam(
+        {TestUtils::createTestPokemon("foe", 100, 80, 70, 90, 85, 70, {"grass"}),
+         TestUtils::createTestPokemon("foe_backup", 90, 75, 70, 65, 70, 55, {"bug"})});
+
+    battleState = {aiTeam.getPokemon(0), opponentTeam.getPokemon(0), &aiTeam,
+                   &opponentTeam,        WeatherCondition::NONE,      0,
+                   1};
+  }
+
+  static MCTSAI::Settings fixedSettings(int playouts) {
+    MCTSAI::Settings settings;
+    settings.max_playouts = playouts;
+    settings.seed = 1234;
+    return settings;
+  }
+
+  Team aiTeam;
+  Team opponentTeam;
+  BattleState battleState;
+};
+
+TEST_F(MCTSAITest, FactoryCreatesMCTSDifficulty) {
+  auto ai = AIFactory::createAI(AIDifficulty::MCTS);
+  ASSERT_NE(ai, nullptr);
+  EXPECT_EQ(ai->getDifficulty(), AIDifficulty::MCTS);
+  EXPECT_NE(dynamic_cast<MCTSAI*>(ai.get()), nullptr);
+}
+
+// A playout budget runs exactly that many playouts and reports throughput
+TEST_F(MCTSAITest, PlayoutBudgetIsHonoured) {
+  MCTSAI ai(fixedSettings(200));
+  MoveEvaluation move = ai.chooseBestMove(battleState);
+
+  EXPECT_GE(move.moveIndex, 0);
+  EXPECT_LT(move.moveIndex, 2);
+  auto stats = ai.getSearchStatistics();
+  EXPECT_EQ(stats.playouts, 200);
+  EXPECT_EQ(stats.worker_threads, 1);
+  EXPECT_GT(stats.tree_nodes, 1);
+  EXPECT_GE(stats.max_tree_depth, 1);
+  EXPECT_GT(stats.playouts_per_second, 0.0);
+
+  int root_visits = 0;
+  for (const auto& action : stats.root_actions) root_visits += action.visits;
+  EXPECT_EQ(root_visits, 200);
+}
+
+TEST_F(MCTSAITest, PrefersSuperEffectiveMove) {
+  MCTSAI ai(fixedSettings(400));
+  MoveEvaluation move = ai.chooseBestMove(battleState);
+  EXPECT_EQ(move.moveIndex, 1);
+  EXPECT_FALSE(ai.shouldSwitch(battleState));
+  EXPECT_EQ(ai.getSearchStatistics().playouts, 400);  // Cached, not searched again
+}
+
+// Shared tree with virtual loss across workers
+TEST_F(MCTSAITest, ParallelSearchWithVirtualLoss) {
+  MCTSAI::Settings settings = fixedSettings(400);
+  settings.worker_threads = 4;
+  settings.virtual_loss = 3;
+  MCTSAI ai(settings);
+
+  Battle::BattleAction action = ai.search(battleState);
+  auto stats = ai.getSearchStatistics();
+  EXPECT_EQ(stats.playouts, 400);
+  EXPECT_EQ(stats.worker_threads, 4);
+  EXPECT_EQ(action.type, Battle::BattleAction::Type::MOVE);
+  EXPECT_EQ(action.index, 1);
+}
+
+TEST_F(MCTSAITest, TimeBudgetIsHonoured) {
+  MCTSAI::Settings settings;
+  settings.max_playouts = 0;
+  settings.time_budget = std::chrono::milliseconds(20);
+  MCTSAI ai(settings);
+
+  ai.search(battleState);
+  auto stats = ai.getSearchStatistics();
+  EXPECT_GT(stats.playouts, 0);
+  EXPECT_LT(stats.search_time.count(), 500);
+}
+
+TEST_F(MCTSAITest, ChooseBestSwitchReturnsAliveTeamMember) {
+  MCTSAI ai(fixedSettings(200));
+  SwitchEvaluation result = ai.chooseBestSwitch(battleState);
+  if (result.pokemonIndex >= 0) {
+    EXPECT_NE(result.pokemonIndex, 0);
+    EXPECT_TRUE(aiTeam.getPokemon(result.pokemonIndex)->isAlive());
+  }
+
+  // With the lead fainted the root decision is the replacement
+  aiTeam.getPokemon(0)->current_hp = 0;
+  result = ai.chooseBestSwitch(battleState);
+  EXPECT_EQ(result.pokemonIndex, 1);
+}
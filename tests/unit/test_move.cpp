@@ -2,6 +2,8 @@
 #include "test_utils.h"
 #include "move.h"
 
+#include <type_traits>
+
 class MoveTest : public TestUtils::PokemonTestFixture {
 protected:
     void SetUp() override {
@@ -20,14 +22,14 @@ protected:
 
 // Test Move creation and basic properties
 TEST_F(MoveTest, BasicProperties) {
-    EXPECT_EQ(damageMove.name, "testmove");
-    EXPECT_EQ(damageMove.power, 80);
-    EXPECT_EQ(damageMove.accuracy, 100);
+    EXPECT_EQ(damageMove.def().name, "testmove");
+    EXPECT_EQ(damageMove.def().power, 80);
+    EXPECT_EQ(damageMove.def().accuracy, 100);
     EXPECT_EQ(damageMove.current_pp, 15);
     EXPECT_EQ(damageMove.getMaxPP(), 15);
-    EXPECT_EQ(damageMove.type, "normal");
-    EXPECT_EQ(damageMove.damage_class, "physical");
-    EXPECT_EQ(damageMove.priority, 0);
+    EXPECT_EQ(damageMove.def().type, "normal");
+    EXPECT_EQ(damageMove.def().damage_class, DamageClass::PHYSICAL);
+    EXPECT_EQ(damageMove.def().priority, 0);
 }
 
 // Test PP management
@@ -65,144 +67,160 @@ TEST_F(MoveTest, PPManagement) {
 // Test move types and categories
 TEST_F(MoveTest, MoveTypes) {
     // Test physical move
-    EXPECT_EQ(damageMove.damage_class, "physical");
-    EXPECT_GT(damageMove.power, 0);
+    EXPECT_EQ(damageMove.def().damage_class, DamageClass::PHYSICAL);
+    EXPECT_GT(damageMove.def().power, 0);
     
     // Test special move
-    EXPECT_EQ(specialMove.damage_class, "special");
-    EXPECT_GT(specialMove.power, 0);
-    EXPECT_EQ(specialMove.type, "fire");
+    EXPECT_EQ(specialMove.def().damage_class, DamageClass::SPECIAL);
+    EXPECT_GT(specialMove.def().power, 0);
+    EXPECT_EQ(specialMove.def().type, "fire");
     
     // Test status move
-    EXPECT_EQ(statusMove.damage_class, "status");
-    EXPECT_EQ(statusMove.power, 0);
-    EXPECT_GT(statusMove.ailment_chance, 0);
+    EXPECT_EQ(statusMove.def().damage_class, DamageClass::STATUS);
+    EXPECT_EQ(statusMove.def().power, 0);
+    EXPECT_GT(statusMove.def().ailment_chance, 0);
 }
 
 // Test status condition application
 TEST_F(MoveTest, StatusConditions) {
-    EXPECT_EQ(statusMove.ailment_chance, 100);
+    EXPECT_EQ(statusMove.def().ailment_chance, 100);
     EXPECT_EQ(statusMove.getStatusCondition(), StatusCondition::POISON);
     
     // Test move without status condition
     EXPECT_EQ(damageMove.getStatusCondition(), StatusCondition::NONE);
-    EXPECT_EQ(damageMove.ailment_chance, 0);
+    EXPECT_EQ(damageMove.def().ailment_chance, 0);
 }
 
 // Test move effects and properties
 TEST_F(MoveTest, MoveEffects) {
     // Test critical hit rate
-    EXPECT_EQ(damageMove.crit_rate, 0);
+    EXPECT_EQ(damageMove.def().crit_rate, 0);
     
     // Test drain/healing
-    EXPECT_EQ(damageMove.drain, 0);
-    EXPECT_EQ(damageMove.healing, 0);
+    EXPECT_EQ(damageMove.def().drain, 0);
+    EXPECT_EQ(damageMove.def().healing, 0);
     
     // Test flinch chance
-    EXPECT_EQ(damageMove.flinch_chance, 0);
+    EXPECT_EQ(damageMove.def().flinch_chance, 0);
     
     // Test stat modification chance
-    EXPECT_EQ(damageMove.stat_chance, 0);
+    EXPECT_EQ(damageMove.def().stat_chance, 0);
 }
 
 // Test move priority
 TEST_F(MoveTest, MovePriority) {
     // Test normal priority
-    EXPECT_EQ(damageMove.priority, 0);
+    EXPECT_EQ(damageMove.def().priority, 0);
     
     // Test high priority move
     Move quickMove = TestUtils::createTestMove("quickmove", 40, 100, 30, "normal", "physical");
-    quickMove.priority = 1;
-    EXPECT_EQ(quickMove.priority, 1);
+    MoveDef quickMoveDef = quickMove.def();
+    quickMoveDef.priority = 1;
+    quickMove.setDef(quickMoveDef);
+    EXPECT_EQ(quickMove.def().priority, 1);
     
     // Test low priority move
     Move slowMove = TestUtils::createTestMove("slowmove", 100, 80, 5, "normal", "physical");
-    slowMove.priority = -1;
-    EXPECT_EQ(slowMove.priority, -1);
+    MoveDef slowMoveDef = slowMove.def();
+    slowMoveDef.priority = -1;
+    slowMove.setDef(slowMoveDef);
+    EXPECT_EQ(slowMove.def().priority, -1);
 }
 
 // Test multi-hit moves
 TEST_F(MoveTest, MultiHitMoves) {
     Move multiHitMove = TestUtils::createTestMove("multihit", 25, 85, 10, "normal", "physical");
-    multiHitMove.min_hits = 2;
-    multiHitMove.max_hits = 5;
+    MoveDef multiHitMoveDef = multiHitMove.def();
+    multiHitMoveDef.min_hits = 2;
+    multiHitMoveDef.max_hits = 5;
+    multiHitMove.setDef(multiHitMoveDef);
     
-    EXPECT_EQ(multiHitMove.min_hits, 2);
-    EXPECT_EQ(multiHitMove.max_hits, 5);
-    EXPECT_GT(multiHitMove.max_hits, multiHitMove.min_hits);
+    EXPECT_EQ(multiHitMove.def().min_hits, 2);
+    EXPECT_EQ(multiHitMove.def().max_hits, 5);
+    EXPECT_GT(multiHitMove.def().max_hits, multiHitMove.def().min_hits);
 }
 
 // Test healing moves
 TEST_F(MoveTest, HealingMoves) {
     Move healingMove = TestUtils::createTestMove("heal", 0, 100, 10, "normal", "status");
-    healingMove.healing = 50; // 50% healing
+    MoveDef healingMoveDef = healingMove.def();
+    healingMoveDef.healing = 50; // 50% healing
+    healingMove.setDef(healingMoveDef);
     
-    EXPECT_EQ(healingMove.healing, 50);
-    EXPECT_EQ(healingMove.power, 0);
-    EXPECT_EQ(healingMove.damage_class, "status");
+    EXPECT_EQ(healingMove.def().healing, 50);
+    EXPECT_EQ(healingMove.def().power, 0);
+    EXPECT_EQ(healingMove.def().damage_class, DamageClass::STATUS);
 }
 
 // Test draining moves
 TEST_F(MoveTest, DrainingMoves) {
     Move drainingMove = TestUtils::createTestMove("drain", 75, 100, 10, "grass", "special");
-    drainingMove.drain = 50; // 50% of damage dealt is recovered
+    MoveDef drainingMoveDef = drainingMove.def();
+    drainingMoveDef.drain = 50; // 50% of damage dealt is recovered
+    drainingMove.setDef(drainingMoveDef);
     
-    EXPECT_EQ(drainingMove.drain, 50);
-    EXPECT_GT(drainingMove.power, 0);
+    EXPECT_EQ(drainingMove.def().drain, 50);
+    EXPECT_GT(drainingMove.def().power, 0);
 }
 
 // Test recoil moves
 TEST_F(MoveTest, RecoilMoves) {
     Move recoilMove = TestUtils::createTestMove("recoil", 120, 100, 15, "normal", "physical");
-    recoilMove.drain = -25; // 25% recoil damage
+    MoveDef recoilMoveDef = recoilMove.def();
+    recoilMoveDef.drain = -25; // 25% recoil damage
+    recoilMove.setDef(recoilMoveDef);
     
-    EXPECT_EQ(recoilMove.drain, -25);
-    EXPECT_GT(recoilMove.power, 0);
+    EXPECT_EQ(recoilMove.def().drain, -25);
+    EXPECT_GT(recoilMove.def().power, 0);
 }
 
 // Test move accuracy
 TEST_F(MoveTest, MoveAccuracy) {
-    EXPECT_EQ(damageMove.accuracy, 100);
+    EXPECT_EQ(damageMove.def().accuracy, 100);
     
     // Test low accuracy move
     Move lowAccuracyMove = TestUtils::createTestMove("lowaccuracy", 120, 70, 5, "normal", "physical");
-    EXPECT_EQ(lowAccuracyMove.accuracy, 70);
+    EXPECT_EQ(lowAccuracyMove.def().accuracy, 70);
     
     // Test never-miss move
     Move neverMissMove = TestUtils::createTestMove("nevermiss", 60, 0, 20, "normal", "physical");
-    EXPECT_EQ(neverMissMove.accuracy, 0); // 0 accuracy means never miss
+    EXPECT_EQ(neverMissMove.def().accuracy, 0); // 0 accuracy means never miss
 }
 
 // Test move categories
 TEST_F(MoveTest, MoveCategories) {
     // Test damage category
-    EXPECT_EQ(damageMove.category, "damage");
+    EXPECT_EQ(damageMove.def().category, "damage");
     
     // Test ailment category
-    EXPECT_EQ(statusMove.category, "ailment");
+    EXPECT_EQ(statusMove.def().category, "ailment");
     
     // Test other categories
     Move statMove = TestUtils::createTestMove("statmove", 0, 100, 20, "normal", "status");
-    statMove.category = "net-good-stats";
-    EXPECT_EQ(statMove.category, "net-good-stats");
+    MoveDef statMoveDef = statMove.def();
+    statMoveDef.category = "net-good-stats";
+    statMove.setDef(statMoveDef);
+    EXPECT_EQ(statMove.def().category, "net-good-stats");
 }
 
 // Test OHKO moves
 TEST_F(MoveTest, OHKOMoves) {
     Move ohkoMove = TestUtils::createTestMove("ohko", 0, 30, 5, "normal", "physical");
-    ohkoMove.category = "ohko";
+    MoveDef ohkoMoveDef = ohkoMove.def();
+    ohkoMoveDef.category = "ohko";
+    ohkoMove.setDef(ohkoMoveDef);
     
-    EXPECT_EQ(ohkoMove.category, "ohko");
-    EXPECT_EQ(ohkoMove.power, 0); // OHKO moves typically have 0 power
-    EXPECT_LT(ohkoMove.accuracy, 100); // OHKO moves typically have low accuracy
+    EXPECT_EQ(ohkoMove.def().category, "ohko");
+    EXPECT_EQ(ohkoMove.def().power, 0); // OHKO moves typically have 0 power
+    EXPECT_LT(ohkoMove.def().accuracy, 100); // OHKO moves typically have low accuracy
 }
 
 // Test move validation
 TEST_F(MoveTest, MoveValidation) {
     // Test that moves are created with valid data
-    EXPECT_FALSE(damageMove.name.empty());
-    EXPECT_FALSE(damageMove.type.empty());
-    EXPECT_FALSE(damageMove.damage_class.empty());
+    EXPECT_FALSE(damageMove.def().name.empty());
+    EXPECT_FALSE(damageMove.def().type.empty());
+    EXPECT_STRNE(damageClassName(damageMove.def().damage_class), "");
     
     // Test that PP values are reasonable
     EXPECT_GT(damageMove.getMaxPP(), 0);
@@ -210,8 +228,8 @@ TEST_F(MoveTest, MoveValidation) {
     EXPECT_LE(damageMove.current_pp, damageMove.getMaxPP());
     
     // Test that accuracy is within reasonable bounds
-    EXPECT_GE(damageMove.accuracy, 0);
-    EXPECT_LE(damageMove.accuracy, 100);
+    EXPECT_GE(damageMove.def().accuracy, 0);
+    EXPECT_LE(damageMove.def().accuracy, 100);
 }
 
 // Test move comparison and equality
@@ -220,12 +238,12 @@ TEST_F(MoveTest, MoveComparison) {
     Move move2 = TestUtils::createTestMove("testmove", 80, 100, 15, "normal", "physical");
     
     // Test that moves with same properties are considered equal
-    EXPECT_EQ(move1.name, move2.name);
-    EXPECT_EQ(move1.power, move2.power);
-    EXPECT_EQ(move1.accuracy, move2.accuracy);
-    EXPECT_EQ(move1.pp, move2.pp);
-    EXPECT_EQ(move1.type, move2.type);
-    EXPECT_EQ(move1.damage_class, move2.damage_class);
+    EXPECT_EQ(move1.def().name, move2.def().name);
+    EXPECT_EQ(move1.def().power, move2.def().power);
+    EXPECT_EQ(move1.def().accuracy, move2.def().accuracy);
+    EXPECT_EQ(move1.def().pp, move2.def().pp);
+    EXPECT_EQ(move1.def().type, move2.def().type);
+    EXPECT_EQ(move1.def().damage_class, move2.def().damage_class);
 }
 
 // Test move effects with different ailments
@@ -258,4 +276,70 @@ TEST_F(MoveTest, FullPPRestoration) {
     // Restore to full
     damageMove.restorePP();
     EXPECT_EQ(damageMove.getRemainingPP(), damageMove.getMaxPP());
-}
\ No newline at end of file
+}
+
+// Copies share one definition and carry only their own PP
+TEST_F(MoveTest, CopiesShareDefinition) {
+    EXPECT_TRUE(std::is_trivially_copyable<Move>::value);
+
+    Move copy = damageMove;
+    copy.usePP();
+    EXPECT_EQ(&copy.def(), &damageMove.def());
+    EXPECT_EQ(copy.getRemainingPP(), 14);
+    EXPECT_EQ(damageMove.getRemainingPP(), 15);
+
+    // Identical custom definitions are interned once
+    Move same = TestUtils::createTestMove("testmove", 80, 100, 15, "normal", "physical");
+    EXPECT_EQ(&same.def(), &damageMove.def());
+    Move loaded("testmove");
+    EXPECT_EQ(&Move("testmove").def(), &loaded.def());
+}
+
+// Changing the definition keeps the slot's PP within the new maximum
+TEST_F(MoveTest, SetDefKeepsPP) {
+    damageMove.usePP();
+    MoveDef def = damageMove.def();
+    def.power = 120;
+    damageMove.setDef(def);
+    EXPECT_EQ(damageMove.def().power, 120);
+    EXPECT_EQ(damageMove.getRemainingPP(), 14);
+
+    def.pp = 5;
+    damageMove.setDef(def);
+    EXPECT_EQ(damageMove.getRemainingPP(), 5);
+    EXPECT_EQ(damageMove.getMaxPP(), 5);
+}
+
+// Ailment and category are parsed into enums when the definition is loaded
+TEST_F(MoveTest, EffectsParsedOnLoad) {
+    Move loaded("testmove");
+    EXPECT_EQ(loaded.def().ailment_id, MoveAilment::NONE);
+    EXPECT_EQ(loaded.def().category_id, MoveCategory::DAMAGE);
+
+    Move burnMove = TestUtils::createTestMove("burnmove", 0, 85, 15, "fire", "status", StatusCondition::BURN, 100);
+    EXPECT_EQ(burnMove.def().ailment_id, MoveAilment::BURN);
+    EXPECT_EQ(burnMove.def().category_id, MoveCategory::AILMENT);
+    EXPECT_EQ(burnMove.getStatusCondition(), StatusCondition::BURN);
+
+    MoveDef def = damageMove.def();
+    def.ailment_name = "confusion";
+    def.category = "ohko";
+    damageMove.setDef(def);
+    EXPECT_EQ(damageMove.def().ailment_id, MoveAilment::OTHER);
+    EXPECT_EQ(damageMove.def().category_id, MoveCategory::OHKO);
+    EXPECT_EQ(damageMove.getStatusCondition(), StatusCondition::NONE);
+}
+
+// A disabled slot cannot be used whatever its PP; copies keep their own flag
+TEST_F(MoveTest, DisabledSlot) {
+    EXPECT_FALSE(damageMove.disabled);
+    Move copy = damageMove;
+    copy.disabled = true;
+    EXPECT_FALSE(copy.canUse());
+    EXPECT_TRUE(damageMove.canUse());
+
+    copy.restorePP();
+    EXPECT_FALSE(copy.canUse());
+    copy.disabled = false;
+    EXPECT_TRUE(copy.canUse());
+}
@@ -3,14 +3,12 @@
 #include "move_type_mapping.h"
 #include <set>
 #include <algorithm>
+#include <thread>
 
 class MoveTypeMappingTest : public TestUtils::PokemonTestFixture {
 protected:
     void SetUp() override {
         TestUtils::PokemonTestFixture::SetUp();
-        // MoveTypeMapping is a static class with lazy initialization
-        // First call will initialize the mapping
-        MoveTypeMapping::getMoveType("tackle");
     }
 };
 
@@ -454,4 +452,28 @@ TEST_F(MoveTypeMappingTest, MoveNamePatterns) {
     EXPECT_EQ(MoveTypeMapping::getMoveType("body-slam"), "normal");
     EXPECT_EQ(MoveTypeMapping::getMoveType("double-team"), "normal");
     EXPECT_EQ(MoveTypeMapping::getMoveType("high-jump-kick"), "fighting");
-}
\ No newline at end of file
+}
+
+// The table needs no initialisation, so first use can come from any thread
+TEST_F(MoveTypeMappingTest, ConcurrentLookups) {
+    const std::vector<std::pair<std::string, std::string>> expected = {
+        {"scratch", "normal"}, {"flamethrower", "fire"}, {"ice-beam", "ice"},
+        {"withdraw", "water"}, {"sweet-kiss", "fairy"}, {"nonexistent-move", "normal"}
+    };
+    std::vector<int> mismatches(8, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < mismatches.size(); ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 1000; ++i) {
+                for (const auto& [move, type] : expected) {
+                    if (MoveTypeMapping::getMoveType(move) != type) ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (int count : mismatches) EXPECT_EQ(count, 0);
+
+    EXPECT_EQ(MoveTypeMapping::getMoveTypeId("thunderbolt"), PokemonType::ELECTRIC);
+    EXPECT_EQ(MoveTypeMapping::getMoveTypeId("fake-move"), PokemonType::NORMAL);
+}
@@ -221,7 +221,7 @@ TEST_F(PokemonTest, MovesManagement) {
     // Test move access
     if (!testPokemon.moves.empty()) {
         Move& firstMove = testPokemon.moves[0];
-        EXPECT_FALSE(firstMove.name.empty());
+        EXPECT_FALSE(firstMove.def().name.empty());
         EXPECT_TRUE(firstMove.canUse());
         
         // Test PP usage
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "../utils/test_utils.h"
 #include "pokemon_data.h"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 
@@ -9,9 +10,11 @@ protected:
     void SetUp() override {
         TestUtils::PokemonTestFixture::SetUp();
         
-        // Create temporary test data directories
-        test_pokemon_dir = "test_data/pokemon";
-        test_moves_dir = "test_data/moves";
+        // Create temporary test data directories; initialize() only accepts
+        // directories inside data/
+        std::string test_name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        test_pokemon_dir = "data/pokemon/" + test_name;
+        test_moves_dir = "data/moves/" + test_name;
         
         std::filesystem::create_directories(test_pokemon_dir);
         std::filesystem::create_directories(test_moves_dir);
@@ -32,7 +35,8 @@ protected:
     
     void TearDown() override {
         // Clean up test directories
-        std::filesystem::remove_all("test_data");
+        std::filesystem::remove_all(test_pokemon_dir);
+        std::filesystem::remove_all(test_moves_dir);
         TestUtils::PokemonTestFixture::TearDown();
     }
     
@@ -43,7 +47,7 @@ protected:
             {"name", name},
             {"id", 1},
             {"types", types},
-            {"stats", {
+            {"base_stats", {
                 {"hp", hp},
                 {"attack", attack},
                 {"defense", defense},
@@ -66,11 +70,11 @@ protected:
             {"power", power},
             {"accuracy", accuracy},
             {"pp", pp},
+            {"priority", priority},
             {"type", {{"name", type}}},
             {"damage_class", {{"name", damage_class}}},
-            {"meta", {
+            {"Info", {
                 {"category", {{"name", category}}},
-                {"priority", priority},
                 {"ailment", {{"name", ailment}}},
                 {"ailment_chance", ailment_chance}
             }}
@@ -85,6 +89,18 @@ protected:
     std::unique_ptr<PokemonData> pokemon_data;
 };
 
+// Starts from empty data directories, for tests that write all their own files
+class EmptyPokemonDataTest : public PokemonDataTest {
+protected:
+    void SetUp() override {
+        PokemonDataTest::SetUp();
+        std::filesystem::remove_all(test_pokemon_dir);
+        std::filesystem::remove_all(test_moves_dir);
+        std::filesystem::create_directories(test_pokemon_dir);
+        std::filesystem::create_directories(test_moves_dir);
+    }
+};
+
 // Test PokemonData initialization
 TEST_F(PokemonDataTest, Initialization) {
     auto result = pokemon_data->initialize(test_pokemon_dir, test_moves_dir);
@@ -336,7 +352,8 @@ TEST_F(PokemonDataTest, DataReloading) {
     
     auto reload_result = pokemon_data->reloadData();
     EXPECT_TRUE(reload_result.success);
-    EXPECT_EQ(reload_result.loaded_count, 8); // 4 Pokemon + 4 moves
+    EXPECT_EQ(reload_result.loaded_count, 1); // Only the new file is parsed
+    EXPECT_EQ(reload_result.added_count, 1);
     
     auto reloaded_pokemon = pokemon_data->getAvailablePokemon();
     EXPECT_EQ(reloaded_pokemon.size(), 4);
@@ -384,4 +401,215 @@ TEST_F(PokemonDataTest, PerformanceWithLargeDataset) {
     
     duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
     EXPECT_LT(duration.count(), 100); // Lookups should be very fast
-}
\ No newline at end of file
+}
+
+// Loading across threads gives the same data as loading on one thread
+TEST_F(EmptyPokemonDataTest, ParallelLoadMatchesSingleThread) {
+    createTestPokemonFile("pikachu.json", "pikachu", 35, 55, 40, 50, 50, 90, {"electric"});
+    for (int i = 0; i < 100; ++i) {
+        std::string name = "move" + std::to_string(i);
+        createTestMoveFile(name + ".json", name, i, 100, 10, "normal", "physical", "damage", 0, "none", 0);
+    }
+    
+    pokemon_data->setLoaderThreads(1);
+    auto serial = pokemon_data->initialize(test_pokemon_dir, test_moves_dir);
+    auto serial_moves = pokemon_data->getAvailableMoves();
+    auto serial_pokemon = pokemon_data->getAvailablePokemon();
+    
+    PokemonData parallel_data;
+    parallel_data.setLoaderThreads(4);
+    auto parallel = parallel_data.initialize(test_pokemon_dir, test_moves_dir);
+    
+    ASSERT_TRUE(serial.success);
+    ASSERT_TRUE(parallel.success);
+    EXPECT_EQ(serial.threads_used, 1u);
+    EXPECT_EQ(parallel.threads_used, 4u);
+    EXPECT_EQ(parallel.loaded_count, serial.loaded_count);
+    EXPECT_EQ(parallel.failed_count, serial.failed_count);
+    EXPECT_GE(parallel.loaded_count, 100);
+    
+    ASSERT_FALSE(serial_pokemon.empty());
+    
+    auto parallel_moves = parallel_data.getAvailableMoves();
+    auto parallel_pokemon = parallel_data.getAvailablePokemon();
+    std::sort(serial_moves.begin(), serial_moves.end());
+    std::sort(parallel_moves.begin(), parallel_moves.end());
+    std::sort(serial_pokemon.begin(), serial_pokemon.end());
+    std::sort(parallel_pokemon.begin(), parallel_pokemon.end());
+    EXPECT_EQ(parallel_moves, serial_moves);
+    EXPECT_EQ(parallel_pokemon, serial_pokemon);
+    
+    auto move = parallel_data.getMoveInfo("move42");
+    ASSERT_TRUE(move.has_value());
+    EXPECT_EQ(move->power, 42);
+    
+    // Every phase ran and was timed
+    auto total = parallel.timings.scan + parallel.timings.validation +
+                 parallel.timings.parse + parallel.timings.index_build;
+    EXPECT_GT(total.count(), 0);
+}
+
+// A reload parses only changed files and leaves earlier snapshots untouched
+TEST_F(EmptyPokemonDataTest, IncrementalReload) {
+    createTestPokemonFile("pikachu.json", "pikachu", 50, 50, 50, 50, 50, 90, {"electric"});
+    createTestPokemonFile("charmander.json", "charmander", 50, 50, 50, 50, 50, 65, {"fire"});
+    createTestMoveFile("spark.json", "spark", 65, 100, 20, "electric", "physical", "damage", 0, "none", 0);
+    createTestMoveFile("ember.json", "ember", 40, 100, 25, "fire", "special", "damage", 0, "none", 0);
+    
+    ASSERT_TRUE(pokemon_data->initialize(test_pokemon_dir, test_moves_dir).success);
+    auto before = pokemon_data->snapshot();
+    
+    // Modify one file, add one, remove one and touch one without changing it
+    auto later = std::filesystem::file_time_type::clock::now() + std::chrono::hours(1);
+    createTestPokemonFile("pikachu.json", "pikachu", 50, 50, 50, 50, 50, 120, {"electric"});
+    std::filesystem::last_write_time(test_pokemon_dir + "/pikachu.json", later);
+    createTestPokemonFile("bulbasaur.json", "bulbasaur", 50, 50, 50, 50, 50, 45, {"grass"});
+    std::filesystem::remove(test_pokemon_dir + "/charmander.json");
+    std::filesystem::last_write_time(test_moves_dir + "/spark.json", later);
+    
+    auto result = pokemon_data->reloadData();
+    ASSERT_TRUE(result.success);
+    EXPECT_EQ(result.changed_count, 1);
+    EXPECT_EQ(result.added_count, 1);
+    EXPECT_EQ(result.removed_count, 1);
+    EXPECT_EQ(result.loaded_count, 2);
+    EXPECT_GT(pokemon_data->generation(), before->generation);
+    
+    EXPECT_EQ(pokemon_data->getPokemonInfo("pikachu")->speed, 120);
+    EXPECT_TRUE(pokemon_data->hasPokemon("bulbasaur"));
+    EXPECT_FALSE(pokemon_data->hasPokemon("charmander"));
+    EXPECT_TRUE(pokemon_data->getPokemonByType("fire").empty());
+    EXPECT_EQ(pokemon_data->getPokemonByType("grass"), std::vector<std::string>{"bulbasaur"});
+    EXPECT_TRUE(pokemon_data->hasMove("spark"));
+    
+    // The snapshot taken before the reload still sees the old data
+    EXPECT_EQ(before->pokemon_data.at("pikachu").speed, 90);
+    EXPECT_EQ(before->pokemon_data.count("charmander"), 1u);
+    EXPECT_EQ(before->pokemon_data.count("bulbasaur"), 0u);
+    
+    // Nothing changed since: no new snapshot
+    auto generation = pokemon_data->generation();
+    auto unchanged = pokemon_data->reloadData();
+    EXPECT_TRUE(unchanged.success);
+    EXPECT_EQ(unchanged.loaded_count, 0);
+    EXPECT_EQ(pokemon_data->generation(), generation);
+}
+
+TEST_F(EmptyPokemonDataTest, IndexedQueries) {
+    createTestPokemonFile("squirtle.json", "squirtle", 50, 48, 50, 50, 50, 43, {"water"});
+    createTestPokemonFile("gyarados.json", "gyarados", 50, 125, 50, 50, 50, 81, {"water", "flying"});
+    createTestPokemonFile("pidgey.json", "pidgey", 50, 45, 50, 50, 50, 56, {"normal", "flying"});
+    createTestPokemonFile("jolteon.json", "jolteon", 50, 65, 50, 50, 50, 130, {"electric"});
+    createTestMoveFile("surf.json", "surf", 90, 100, 15, "water", "special", "damage", 0, "none", 0);
+    createTestMoveFile("water-gun.json", "water-gun", 40, 100, 15, "water", "special", "damage", 0, "none", 0);
+    createTestMoveFile("waterfall.json", "waterfall", 80, 100, 15, "water", "physical", "damage", 0, "none", 0);
+    createTestMoveFile("hydro-pump.json", "hydro-pump", 110, 100, 15, "water", "special", "damage", 0, "none", 0);
+    createTestMoveFile("thunder-wave.json", "thunder-wave", 0, 100, 15, "electric", "status", "damage", 0, "paralysis", 0);
+    createTestMoveFile("quick-attack.json", "quick-attack", 40, 100, 15, "normal", "physical", "damage", 1, "none", 0);
+    
+    ASSERT_TRUE(pokemon_data->initialize(test_pokemon_dir, test_moves_dir).success);
+    
+    // Special water moves with power >= 80
+    PokemonData::MoveQuery strong_special_water;
+    strong_special_water.type = "water";
+    strong_special_water.damage_class = "special";
+    strong_special_water.power.min = 80;
+    EXPECT_EQ(pokemon_data->findMoveNames(strong_special_water),
+              (std::vector<std::string>{"hydro-pump", "surf"}));
+    
+    PokemonData::MoveQuery priority;
+    priority.priority.min = 1;
+    EXPECT_EQ(pokemon_data->findMoveNames(priority), std::vector<std::string>{"quick-attack"});
+    
+    PokemonData::MoveQuery paralysis;
+    paralysis.ailment = "paralysis";
+    EXPECT_EQ(pokemon_data->findMoveNames(paralysis), std::vector<std::string>{"thunder-wave"});
+    
+    PokemonData::MoveQuery unknown_type;
+    unknown_type.type = "shadow";
+    EXPECT_TRUE(pokemon_data->findMoveNames(unknown_type).empty());
+    
+    PokemonData::PokemonQuery flying;
+    flying.types = {"flying"};
+    flying.excluded_types = {"normal"};
+    EXPECT_EQ(pokemon_data->findPokemonNames(flying), std::vector<std::string>{"gyarados"});
+    
+    PokemonData::PokemonQuery fast;
+    fast.speed.min = 60;
+    fast.attack.max = 100;
+    EXPECT_EQ(pokemon_data->findPokemonNames(fast), std::vector<std::string>{"jolteon"});
+    
+    // Ids resolve to entries in the snapshot that produced them
+    auto data = pokemon_data->snapshot();
+    auto ids = data->findPokemon(PokemonData::PokemonQuery());
+    ASSERT_EQ(ids.size(), 4u);
+    EXPECT_EQ(data->pokemon(ids.front()).name, "gyarados");
+    EXPECT_EQ(data->pokemon(ids.back()).attack, 48);
+    
+    // A reload rebuilds the indexes
+    auto later = std::filesystem::file_time_type::clock::now() + std::chrono::hours(1);
+    createTestPokemonFile("pidgey.json", "pidgey", 50, 45, 50, 50, 50, 101, {"normal", "flying"});
+    std::filesystem::last_write_time(test_pokemon_dir + "/pidgey.json", later);
+    std::filesystem::remove(test_moves_dir + "/surf.json");
+    ASSERT_TRUE(pokemon_data->reloadData().success);
+    EXPECT_EQ(pokemon_data->findMoveNames(strong_special_water), std::vector<std::string>{"hydro-pump"});
+    EXPECT_EQ(pokemon_data->findPokemonNames(fast), (std::vector<std::string>{"jolteon", "pidgey"}));
+    EXPECT_EQ(data->findPokemon(fast).size(), 1u);
+    
+    // Editing entries in place updates the indexes to match a full load
+    later += std::chrono::hours(1);
+    createTestPokemonFile("squirtle.json", "squirtle", 50, 48, 50, 50, 50, 75, {"water", "flying"});
+    createTestMoveFile("waterfall.json", "waterfall", 95, 100, 15, "water", "special", "damage", 0, "none", 0);
+    createTestMoveFile("quick-attack.json", "quick-attack", 40, 100, 15, "normal", "physical", "damage", 0, "flinch", 0);
+    std::filesystem::last_write_time(test_pokemon_dir + "/squirtle.json", later);
+    std::filesystem::last_write_time(test_moves_dir + "/waterfall.json", later);
+    std::filesystem::last_write_time(test_moves_dir + "/quick-attack.json", later);
+    auto reload = pokemon_data->reloadData();
+    ASSERT_TRUE(reload.success);
+    EXPECT_EQ(reload.changed_count, 3);
+    
+    PokemonData fresh;
+    ASSERT_TRUE(fresh.initialize(test_pokemon_dir, test_moves_dir).success);
+    PokemonData::MoveQuery flinch;
+    flinch.ailment = "flinch";
+    for (const auto& query : {strong_special_water, priority, paralysis, flinch}) {
+        EXPECT_EQ(pokemon_data->findMoveNames(query), fresh.findMoveNames(query));
+    }
+    EXPECT_EQ(pokemon_data->findMoveNames(strong_special_water),
+              (std::vector<std::string>{"hydro-pump", "waterfall"}));
+    EXPECT_TRUE(pokemon_data->findMoveNames(priority).empty());
+    for (const auto& query : {flying, fast}) {
+        EXPECT_EQ(pokemon_data->findPokemonNames(query), fresh.findPokemonNames(query));
+    }
+    EXPECT_EQ(pokemon_data->findPokemonNames(flying), (std::vector<std::string>{"gyarados", "squirtle"}));
+    EXPECT_EQ(pokemon_data->findPokemonNames(fast), (std::vector<std::string>{"jolteon", "pidgey", "squirtle"}));
+}
+
+TEST_F(EmptyPokemonDataTest, SharedAccessorsOutliveReload) {
+    createTestPokemonFile("pikachu.json", "pikachu", 50, 50, 50, 50, 50, 90, {"electric"});
+    createTestPokemonFile("jolteon.json", "jolteon", 50, 50, 50, 50, 50, 130, {"electric"});
+    createTestMoveFile("spark.json", "spark", 65, 100, 20, "electric", "physical", "damage", 0, "none", 0);
+    ASSERT_TRUE(pokemon_data->initialize(test_pokemon_dir, test_moves_dir).success);
+    
+    auto pikachu = pokemon_data->pokemonInfo("PikaChu");
+    ASSERT_NE(pikachu, nullptr);
+    EXPECT_EQ(pikachu->speed, 90);
+    EXPECT_EQ(pokemon_data->pokemonInfo("raichu"), nullptr);
+    ASSERT_NE(pokemon_data->moveInfo("spark"), nullptr);
+    EXPECT_EQ(pokemon_data->moveInfo("SPARK")->power, 65);
+    
+    auto names = pokemon_data->pokemonNames();
+    EXPECT_EQ(*names, (std::vector<std::string>{"jolteon", "pikachu"}));
+    EXPECT_EQ(*pokemon_data->moveNames(), std::vector<std::string>{"spark"});
+    
+    // The pointers pin the data they were taken from
+    auto later = std::filesystem::file_time_type::clock::now() + std::chrono::hours(1);
+    createTestPokemonFile("pikachu.json", "pikachu", 50, 50, 50, 50, 50, 120, {"electric"});
+    std::filesystem::last_write_time(test_pokemon_dir + "/pikachu.json", later);
+    std::filesystem::remove(test_pokemon_dir + "/jolteon.json");
+    ASSERT_TRUE(pokemon_data->reloadData().success);
+    EXPECT_EQ(pikachu->speed, 90);
+    EXPECT_EQ(names->size(), 2u);
+    EXPECT_EQ(pokemon_data->pokemonInfo("pikachu")->speed, 120);
+    EXPECT_EQ(pokemon_data->getAvailablePokemon(), std::vector<std::string>{"pikachu"});
+}
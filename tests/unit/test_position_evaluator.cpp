@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "expert_ai.h"
+#include "position_evaluator.h"
+#include "test_utils.h"
+
+class PositionEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Pokemon lead = TestUtils::createTestPokemon("lead", 100, 80, 70, 90, 85, 75, {"fire"});
+    lead.moves.clear();
+    lead.moves.push_back(TestUtils::createTestMove("flamethrower", 90, 100, 15, "fire", "special"));
+    lead.moves.push_back(TestUtils::createTestMove("water-gun", 40, 100, 25, "water", "special"));
+    lead.moves.push_back(TestUtils::createTestMove("growl", 0, 100, 40, "normal", "status"));
+
+    aiTeam = TestUtils::createTestTeam(
+        {lead, TestUtils::createTestPokemon("second", 90, 70, 80, 70, 80, 60, {"water"}),
+         TestUtils::createTestPokemon("third", 80, 90, 60, 60, 70, 95, {"electric"})});
+    opponentTeam = TestUtils::createTestTeam(
+        {TestUtils::createTestPokemon("foe", 100, 80, 70, 90, 85, 75, {"grass"}),
+         TestUtils::createTestPokemon("foe_backup", 110, 75, 85, 65, 80, 55, {"rock"})});
+
+    battleState = {aiTeam.getPokemon(0), opponentTeam.getPokemon(0), &aiTeam,
+                   &opponentTeam,        WeatherCondition::NONE,      0,
+                   1};
+  }
+
+  // Positions reached by random play from the root, including faints,
+  // switches, status and spent PP
+  std::vector<SearchState> randomStates(const SearchContext& context, int count) {
+    std::mt19937 rng(7);
+    std::vector<SearchState> states;
+    SearchState state = context.root();
+    while (static_cast<int>(states.size()) < count) {
+      if (context.isTerminal(state) || rng() % 12 == 0) state = context.root();
+      int side = static_cast<int>(rng() % 2);
+      SearchAction actions[8];
+      int action_count = context.generateActions(state, side, actions, 8);
+      if (action_count == 0) {
+        state = context.root();
+        continue;
+      }
+      SearchUndo undo;
+      context.make(state, side, actions[rng() % action_count], undo);
+      if (rng() % 5 == 0) {
+        state.combatants[rng() % SearchState::kMaxCombatants].status =
+            static_cast<uint8_t>(StatusCondition::BURN);
+      }
+      states.push_back(state);
+    }
+    return states;
+  }
+
+  // The evaluation as ExpertAI computed it before the tables were introduced
+  static double referenceScore(const SearchContext& context, const SearchState& state) {
+    double score = 0.0;
+    score += (context.aliveCount(state, 0) - context.aliveCount(state, 1)) * 30.0;
+    double health[2] = {0.0, 0.0};
+    for (int side = 0; side < 2; ++side) {
+      for (int slot = 0; slot < context.teamSize(side); ++slot) {
+        int index = SearchState::combatantIndex(side, slot);
+        const auto& info = context.info(index);
+        if (info.present && info.max_hp > 0 && state.combatants[index].hp > 0) {
+          health[side] += static_cast<double>(state.combatants[index].hp) / info.max_hp;
+        }
+      }
+    }
+    score += (health[0] - health[1]) * 20.0;
+    int ai = state.activeIndex(0);
+    int opp = state.activeIndex(1);
+    if (ai >= 0 && opp >= 0) {
+      const auto& ai_info = context.info(ai);
+      for (int m = 0; m < ai_info.move_count; ++m) {
+        if (ai_info.moves[m].power > 0 && state.combatants[ai].pp[m] > 0) {
+          double effectiveness = ai_info.moves[m].type_multiplier[state.active[1]];
+          if (effectiveness >= 2.0) score += 15.0;
+          else if (effectiveness >= 1.5) score += 8.0;
+          else if (effectiveness <= 0.5) score -= 10.0;
+        }
+      }
+      if (ai_info.speed > context.info(opp).speed) score += 10.0;
+      else if (ai_info.speed < context.info(opp).speed) score -= 5.0;
+      if (state.combatants[opp].status != 0) score += 25.0;
+      if (state.combatants[ai].status != 0) score -= 20.0;
+    }
+    return std::clamp(score, -400.0, 400.0);
+  }
+
+  Team aiTeam;
+  Team opponentTeam;
+  BattleState battleState;
+};
+
+TEST_F(PositionEvaluatorTest, MatchesReferenceEvaluation) {
+  SearchContext context(battleState);
+  PositionEvaluator evaluator(context);
+  ExpertAI expertAI;
+  for (const SearchState& state : randomStates(context, 200)) {
+    EXPECT_DOUBLE_EQ(evaluator.evaluate(state), referenceScore(context, state));
+    EXPECT_DOUBLE_EQ(expertAI.evaluateSearchState(context, state), evaluator.evaluate(state));
+  }
+}
+
+// Batches spanning several chunks score exactly as one-at-a-time evaluation
+TEST_F(PositionEvaluatorTest, BatchMatchesSingleEvaluation) {
+  SearchContext context(battleState);
+  PositionEvaluator evaluator(context);
+  const int count = 2 * PositionEvaluator::kBatchSize + 5;
+  std::vector<SearchState> states = randomStates(context, count);
+
+  std::vector<double> scores(count);
+  evaluator.evaluateBatch(states.data(), count, scores.data());
+  for (int i = 0; i < count; ++i) {
+    EXPECT_EQ(scores[i], evaluator.evaluate(states[i])) << "state " << i;
+  }
+}
+
+// Legacy ordering sorts by each state's evaluation, best first for the AI
+TEST_F(PositionEvaluatorTest, OrderMovesSortsByPrecomputedScores) {
+  ExpertAI expertAI;
+  std::vector<BattleState> states = expertAI.generateLegalMoves(battleState, true);
+  ASSERT_GT(states.size(), 1u);
+
+  expertAI.orderMoves(states, true);
+  for (size_t i = 1; i < states.size(); ++i) {
+    EXPECT_GE(expertAI.evaluatePosition(states[i - 1]), expertAI.evaluatePosition(states[i]));
+  }
+  expertAI.orderMoves(states, false);
+  for (size_t i = 1; i < states.size(); ++i) {
+    EXPECT_LE(expertAI.evaluatePosition(states[i - 1]), expertAI.evaluatePosition(states[i]));
+  }
+}
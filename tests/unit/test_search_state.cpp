@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "expert_ai.h"
+#include "search_state.h"
+#include "test_utils.h"
+
+// Exposes the strategy-level damage estimate for comparison
+class DamageProbe : public ExpertAI {
+ public:
+  using AIStrategy::estimateDamage;
+};
+
+class SearchStateTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Pokemon attacker = TestUtils::createTestPokemon("attacker", 100, 80, 70, 90, 85, 75, {"fire"});
+    attacker.moves.clear();
+    attacker.moves.push_back(TestUtils::createTestMove("flamethrower", 90, 100, 15, "fire", "special"));
+    attacker.moves.push_back(TestUtils::createTestMove("thunder-wave", 0, 90, 20, "electric", "status",
+                                                       StatusCondition::PARALYSIS, 100));
+
+    Pokemon backup = TestUtils::createTestPokemon("backup", 80, 70, 60, 80, 75, 65, {"water"});
+    Pokemon defender = TestUtils::createTestPokemon("defender", 100, 80, 70, 90, 85, 60, {"grass"});
+    Pokemon reserve = TestUtils::createTestPokemon("reserve", 90, 70, 80, 70, 80, 50, {"rock"});
+
+    aiTeam = TestUtils::createTestTeam({attacker, backup});
+    opponentTeam = TestUtils::createTestTeam({defender, reserve});
+
+    battleState = {aiTeam.getPokemon(0), opponentTeam.getPokemon(0), &aiTeam,
+                   &opponentTeam,        WeatherCondition::NONE,      0,
+                   1};
+  }
+
+  Team aiTeam;
+  Team opponentTeam;
+  BattleState battleState;
+};
+
+// The compact root mirrors the live battle
+TEST_F(SearchStateTest, ContextCapturesLiveBattle) {
+  SearchContext context(battleState);
+  const SearchState& root = context.root();
+
+  EXPECT_EQ(context.teamSize(SearchState::kAISide), 2);
+  EXPECT_EQ(context.teamSize(SearchState::kOpponentSide), 2);
+  EXPECT_EQ(root.active[SearchState::kAISide], 0);
+  EXPECT_EQ(root.active[SearchState::kOpponentSide], 0);
+  EXPECT_EQ(root.turn, 1);
+
+  int ai_active = root.activeIndex(SearchState::kAISide);
+  EXPECT_EQ(root.combatants[ai_active].hp, aiTeam.getPokemon(0)->current_hp);
+  EXPECT_EQ(root.combatants[ai_active].pp[0], aiTeam.getPokemon(0)->moves[0].current_pp);
+  EXPECT_EQ(context.info(ai_active).move_count, 2);
+
+  // Fire is super effective against the grass-type defender
+  EXPECT_DOUBLE_EQ(context.info(ai_active).moves[0].type_multiplier[0], 2.0);
+  EXPECT_FALSE(context.isTerminal(root));
+}
+
+// Damage on the compact state matches the AI's damage estimate
+TEST_F(SearchStateTest, DamageMatchesStrategyEstimate) {
+  SearchContext context(battleState);
+  int attacker = context.root().activeIndex(SearchState::kAISide);
+  int defender = context.root().activeIndex(SearchState::kOpponentSide);
+
+  DamageProbe probe;
+  double compact = context.estimateDamage(context.root(), attacker, 0, defender);
+  double live = probe.estimateDamage(*aiTeam.getPokemon(0), *opponentTeam.getPokemon(0),
+                                     aiTeam.getPokemon(0)->moves[0], WeatherCondition::NONE);
+  EXPECT_DOUBLE_EQ(compact, live);
+  EXPECT_DOUBLE_EQ(context.estimateDamage(context.root(), attacker, 1, defender), 0.0);
+}
+
+// make/unmake round-trips bit for bit
+TEST_F(SearchStateTest, MakeUnmakeRestoresState) {
+  SearchContext context(battleState);
+  SearchState state = context.root();
+  SearchState before = state;
+
+  SearchAction actions[8];
+  int count = context.generateActions(state, SearchState::kAISide, actions, 8);
+  ASSERT_EQ(count, 3);  // Two moves and one switch
+  EXPECT_EQ(actions[0].type, SearchAction::Type::MOVE);
+  EXPECT_EQ(actions[2].type, SearchAction::Type::SWITCH);
+
+  for (int i = 0; i < count; ++i) {
+    SearchUndo undo;
+    context.make(state, SearchState::kAISide, actions[i], undo);
+    EXPECT_EQ(state.turn, before.turn + 1);
+    SearchContext::unmake(state, undo);
+    EXPECT_EQ(std::memcmp(&state, &before, sizeof(SearchState)), 0);
+  }
+
+  // Attacking lowers the defender's HP and spends PP
+  SearchUndo undo;
+  context.make(state, SearchState::kAISide, actions[0], undo);
+  int defender = state.activeIndex(SearchState::kOpponentSide);
+  int attacker = state.activeIndex(SearchState::kAISide);
+  EXPECT_LT(state.combatants[defender].hp, before.combatants[defender].hp);
+  EXPECT_EQ(state.combatants[attacker].pp[0], before.combatants[attacker].pp[0] - 1);
+  SearchContext::unmake(state, undo);
+
+  // Status moves inflict their ailment
+  context.make(state, SearchState::kAISide, actions[1], undo);
+  EXPECT_EQ(state.combatants[defender].status, static_cast<uint8_t>(StatusCondition::PARALYSIS));
+  SearchContext::unmake(state, undo);
+
+  // Switching changes the active slot
+  context.make(state, SearchState::kAISide, actions[2], undo);
+  EXPECT_EQ(state.active[SearchState::kAISide], 1);
+  SearchContext::unmake(state, undo);
+  EXPECT_EQ(std::memcmp(&state, &before, sizeof(SearchState)), 0);
+}
+
+// Asleep or fainted Pokemon can only switch
+TEST_F(SearchStateTest, ActionGenerationRespectsStatusAndFainting) {
+  aiTeam.getPokemon(0)->status = StatusCondition::SLEEP;
+  SearchContext sleeping(battleState);
+  SearchAction actions[8];
+  int count = sleeping.generateActions(sleeping.root(), SearchState::kAISide, actions, 8);
+  ASSERT_EQ(count, 1);
+  EXPECT_EQ(actions[0].type, SearchAction::Type::SWITCH);
+
+  aiTeam.getPokemon(0)->status = StatusCondition::NONE;
+  aiTeam.getPokemon(1)->current_hp = 0;
+  opponentTeam.getPokemon(1)->current_hp = 0;
+  SearchContext last_stand(battleState);
+  count = last_stand.generateActions(last_stand.root(), SearchState::kAISide, actions, 8);
+  EXPECT_EQ(count, 2);  // Moves only, nobody left to switch to
+
+  opponentTeam.getPokemon(0)->current_hp = 0;
+  SearchContext finished(battleState);
+  EXPECT_TRUE(finished.isTerminal(finished.root()));
+}
+
+// Searching never mutates the live battle
+TEST_F(SearchStateTest, MiniMaxSearchLeavesLiveTeamsUntouched) {
+  ExpertAI expertAI;
+  int ai_hp = aiTeam.getPokemon(0)->current_hp;
+  int opp_hp = opponentTeam.getPokemon(0)->current_hp;
+  int ai_pp = aiTeam.getPokemon(0)->moves[0].current_pp;
+
+  std::vector<int> best_line;
+  double value = expertAI.miniMaxSearch(battleState, 4, -1000.0, 1000.0, true, best_line);
+
+  EXPECT_TRUE(std::isfinite(value));
+  EXPECT_FALSE(best_line.empty());
+  EXPECT_EQ(aiTeam.getPokemon(0)->current_hp, ai_hp);
+  EXPECT_EQ(opponentTeam.getPokemon(0)->current_hp, opp_hp);
+  EXPECT_EQ(aiTeam.getPokemon(0)->moves[0].current_pp, ai_pp);
+  EXPECT_EQ(opponentTeam.getPokemon(0)->status, StatusCondition::NONE);
+
+  // The principal variation starts with a legal root action
+  SearchAction first = SearchAction::decode(best_line.front());
+  if (first.type == SearchAction::Type::MOVE) {
+    EXPECT_LT(first.index, 2);
+  } else {
+    EXPECT_EQ(first.index, 1);
+  }
+}
+
+// Chance outcomes follow the battle engine's rolls and sum to one
+TEST_F(SearchStateTest, ChanceOutcomesCoverAccuracyCritsRollsAndParalysis) {
+  SearchContext context(battleState);
+  SearchState state = context.root();
+  SearchOutcome outcomes[SearchContext::kMaxOutcomes];
+  // Face the rock-type reserve so Flamethrower doesn't knock it out outright
+  state.active[SearchState::kOpponentSide] = 1;
+  int attacker = state.activeIndex(SearchState::kAISide);
+  int defender = state.activeIndex(SearchState::kOpponentSide);
+
+  auto total = [&](int count) {
+    double sum = 0.0;
+    for (int i = 0; i < count; ++i) sum += outcomes[i].probability;
+    return sum;
+  };
+
+  // Flamethrower always hits: crit and roll buckets only, damage bracketing the estimate
+  int count = context.chanceOutcomes(state, SearchState::kAISide, 0, outcomes);
+  ASSERT_GE(count, 2);  // Critical hits land in a different HP band
+  EXPECT_NEAR(total(count), 1.0, 1e-12);
+  double expected_damage = 0.0;
+  for (int i = 0; i < count; ++i) {
+    EXPECT_TRUE(outcomes[i].acted);
+    EXPECT_GT(outcomes[i].damage, 0);
+    expected_damage += outcomes[i].probability * outcomes[i].damage;
+  }
+  double estimate = context.estimateDamage(state, attacker, 0, defender);
+  EXPECT_LT(expected_damage, estimate);  // Average roll is 92.5%
+  EXPECT_GT(expected_damage, estimate * 0.85);
+
+  // Thunder Wave: 90% accurate, and a pure status move lands whenever it hits
+  count = context.chanceOutcomes(state, SearchState::kAISide, 1, outcomes);
+  ASSERT_EQ(count, 2);
+  EXPECT_NEAR(total(count), 1.0, 1e-12);
+  for (int i = 0; i < count; ++i) {
+    EXPECT_NEAR(outcomes[i].probability, outcomes[i].ailment ? 0.9 : 0.1, 1e-12);
+  }
+
+  // A paralyzed attacker is fully stopped a quarter of the time, spending no PP
+  state.combatants[attacker].status = static_cast<uint8_t>(StatusCondition::PARALYSIS);
+  count = context.chanceOutcomes(state, SearchState::kAISide, 0, outcomes);
+  EXPECT_NEAR(total(count), 1.0, 1e-12);
+  const SearchOutcome* stopped = nullptr;
+  for (int i = 0; i < count; ++i) {
+    if (!outcomes[i].acted) stopped = &outcomes[i];
+  }
+  ASSERT_NE(stopped, nullptr);
+  EXPECT_DOUBLE_EQ(stopped->probability, SearchContext::kFullParalysisChance);
+
+  SearchState before = state;
+  SearchUndo undo;
+  context.makeOutcome(state, SearchState::kAISide, 0, *stopped, undo);
+  EXPECT_EQ(state.combatants[attacker].pp[0], before.combatants[attacker].pp[0]);
+  EXPECT_EQ(state.combatants[defender].hp, before.combatants[defender].hp);
+  SearchContext::unmake(state, undo);
+  EXPECT_EQ(std::memcmp(&state, &before, sizeof(SearchState)), 0);
+}
+
+namespace {
+
+// Plain expectiminimax without pruning or tables, for reference
+double bruteForceExpectimax(const ExpertAI& ai, const SearchContext& context,
+                            SearchState& state, int depth, bool maximizing) {
+  if (depth <= 0 || context.isTerminal(state)) {
+    return ai.evaluateSearchState(context, state);
+  }
+  int side = maximizing ? SearchState::kAISide : SearchState::kOpponentSide;
+  SearchAction actions[8];
+  int count = context.generateActions(state, side, actions, 8);
+  if (count == 0) return ai.evaluateSearchState(context, state);
+
+  double best = maximizing ? -1000.0 : 1000.0;
+  for (int i = 0; i < count; ++i) {
+    double value = 0.0;
+    if (actions[i].type == SearchAction::Type::SWITCH) {
+      SearchUndo undo;
+      context.make(state, side, actions[i], undo);
+      value = bruteForceExpectimax(ai, context, state, depth - 1, !maximizing);
+      SearchContext::unmake(state, undo);
+    } else {
+      SearchOutcome outcomes[SearchContext::kMaxOutcomes];
+      int outcome_count = context.chanceOutcomes(state, side, actions[i].index, outcomes);
+      for (int o = 0; o < outcome_count; ++o) {
+        SearchUndo undo;
+        context.makeOutcome(state, side, actions[i].index, outcomes[o], undo);
+        value += outcomes[o].probability *
+                 bruteForceExpectimax(ai, context, state, depth - 1, !maximizing);
+        SearchContext::unmake(state, undo);
+      }
+    }
+    best = maximizing ? std::max(best, value) : std::min(best, value);
+  }
+  return best;
+}
+
+}  // namespace
+
+// Star1/Star2 pruning never changes the expectiminimax value
+TEST_F(SearchStateTest, ChanceSearchMatchesUnprunedExpectimax) {
+  ExpertAI expertAI;
+  expertAI.setChanceSearch({true, true});
+  SearchContext context(battleState);
+  SearchState state = context.root();
+  double reference = bruteForceExpectimax(expertAI, context, state, 2, true);
+
+  std::vector<int> line;
+  double pruned = expertAI.miniMaxSearch(battleState, 2, -1000.0, 1000.0, true, line);
+  EXPECT_NEAR(pruned, reference, 1e-9);
+
+  ExpertAI star1_only;
+  star1_only.setChanceSearch({true, false});
+  double without_probes = star1_only.miniMaxSearch(battleState, 2, -1000.0, 1000.0, true, line);
+  EXPECT_NEAR(without_probes, reference, 1e-9);
+
+  // Deeper searches prune chance nodes
+  expertAI.miniMaxSearch(battleState, 4, -1000.0, 1000.0, true, line);
+  EXPECT_GT(expertAI.getSearchStatistics().chance_cutoffs, 0);
+
+  // Chance nodes are off by default: the deterministic average-damage model
+  ExpertAI deterministic;
+  EXPECT_FALSE(deterministic.getChanceSearch().chance_nodes);
+  double average = deterministic.miniMaxSearch(battleState, 2, -1000.0, 1000.0, true, line);
+  EXPECT_TRUE(std::isfinite(average));
+  EXPECT_EQ(deterministic.getSearchStatistics().chance_cutoffs, 0);
+}
@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+
+#include "expert_ai.h"
+#include "matrix_game.h"
+#include "search_state.h"
+#include "test_utils.h"
+
+namespace {
+
+MatrixGame makeGame(std::initializer_list<std::initializer_list<double>> rows) {
+  MatrixGame game;
+  game.rows = static_cast<int>(rows.size());
+  int i = 0;
+  for (const auto& row : rows) {
+    game.cols = static_cast<int>(row.size());
+    int j = 0;
+    for (double payoff : row) game.payoff[i][j++] = payoff;
+    ++i;
+  }
+  return game;
+}
+
+}  // namespace
+
+class SimultaneousSearchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Pokemon attacker = TestUtils::createTestPokemon("attacker", 100, 80, 70, 90, 85, 75, {"fire"});
+    attacker.moves.clear();
+    attacker.moves.push_back(TestUtils::createTestMove("flamethrower", 90, 100, 15, "fire", "special"));
+    MoveDef quick_attack = TestUtils::createTestMove("quick-attack", 40, 100, 30, "normal", "physical").def();
+    quick_attack.priority = 1;
+    attacker.moves.push_back(Move(quick_attack));
+
+    Pokemon backup = TestUtils::createTestPokemon("backup", 80, 70, 60, 80, 75, 65, {"water"});
+    Pokemon defender = TestUtils::createTestPokemon("defender", 100, 80, 70, 90, 85, 90, {"grass"});
+    Pokemon reserve = TestUtils::createTestPokemon("reserve", 90, 70, 80, 70, 80, 50, {"rock"});
+
+    aiTeam = TestUtils::createTestTeam({attacker, backup});
+    opponentTeam = TestUtils::createTestTeam({defender, reserve});
+
+    battleState = {aiTeam.getPokemon(0), opponentTeam.getPokemon(0), &aiTeam,
+                   &opponentTeam,        WeatherCondition::NONE,      0,
+                   1};
+  }
+
+  Team aiTeam;
+  Team opponentTeam;
+  BattleState battleState;
+};
+
+TEST(MatrixGameSolverTest, FindsPureSaddlePoint) {
+  MatrixGameSolution solution = MatrixGameSolver::solve(makeGame({{3, 5}, {1, 4}}));
+  EXPECT_EQ(solution.iterations, 0);
+  EXPECT_DOUBLE_EQ(solution.value, 3.0);
+  EXPECT_DOUBLE_EQ(solution.row_strategy[0], 1.0);
+  EXPECT_DOUBLE_EQ(solution.col_strategy[0], 1.0);
+}
+
+TEST(MatrixGameSolverTest, SolvesMixedGames) {
+  // Matching pennies: value 0, both sides mix evenly
+  MatrixGameSolution pennies = MatrixGameSolver::solve(makeGame({{1, -1}, {-1, 1}}), 5000, 1e-3);
+  EXPECT_GT(pennies.iterations, 0);
+  EXPECT_NEAR(pennies.value, 0.0, 1e-3);
+  EXPECT_NEAR(pennies.row_strategy[0], 0.5, 1e-2);
+  EXPECT_NEAR(pennies.col_strategy[0], 0.5, 1e-2);
+
+  // Known 2x2 solution: value 1/7, AI plays row 0 with probability 3/7
+  MatrixGameSolution skewed = MatrixGameSolver::solve(makeGame({{3, -1}, {-2, 1}}), 5000, 1e-3);
+  EXPECT_NEAR(skewed.value, 1.0 / 7.0, 1e-3);
+  EXPECT_NEAR(skewed.row_strategy[0], 3.0 / 7.0, 1e-2);
+  EXPECT_NEAR(skewed.col_strategy[0], 2.0 / 7.0, 1e-2);
+
+  // Rock-paper-scissors
+  MatrixGameSolution rps =
+      MatrixGameSolver::solve(makeGame({{0, -1, 1}, {1, 0, -1}, {-1, 1, 0}}), 5000, 1e-3);
+  EXPECT_LE(rps.exploitability, 1e-3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(rps.row_strategy[i], 1.0 / 3.0, 1e-2);
+    EXPECT_NEAR(rps.col_strategy[i], 1.0 / 3.0, 1e-2);
+  }
+}
+
+// Priority beats speed; paralysis halves speed
+TEST_F(SimultaneousSearchTest, TurnOrderFollowsPriorityThenSpeed) {
+  SearchContext context(battleState);
+  SearchState state = context.root();
+
+  EXPECT_EQ(context.turnOrder(state, 0, 0), -1);  // Defender is faster
+  EXPECT_EQ(context.turnOrder(state, 1, 0), 1);   // Quick Attack has priority
+
+  int defender = state.activeIndex(SearchState::kOpponentSide);
+  state.combatants[defender].status = static_cast<uint8_t>(StatusCondition::PARALYSIS);
+  EXPECT_EQ(context.effectiveSpeed(state, defender), 45);
+  EXPECT_EQ(context.turnOrder(state, 0, 0), 1);
+}
+
+// Switches go first, a knocked out Pokemon doesn't act, and unmakeTurn
+// restores the state exactly
+TEST_F(SimultaneousSearchTest, MakeTurnResolvesLikeTheEngine) {
+  SearchContext context(battleState);
+  SearchState state = context.root();
+  int ai = state.activeIndex(SearchState::kAISide);
+  int defender = state.activeIndex(SearchState::kOpponentSide);
+  state.combatants[defender].hp = 1;
+  const SearchState before = state;
+
+  SearchAction moves[2] = {{SearchAction::Type::MOVE, 1}, {SearchAction::Type::MOVE, 0}};
+  SearchTurnUndo undo;
+  context.makeTurn(state, moves, true, undo);
+  EXPECT_EQ(state.combatants[defender].hp, 0);
+  EXPECT_EQ(state.combatants[ai].hp, before.combatants[ai].hp);  // Never got to act
+  EXPECT_EQ(undo.count, 1);
+  SearchContext::unmakeTurn(state, undo);
+  EXPECT_EQ(std::memcmp(&state, &before, sizeof(state)), 0);
+
+  // The opponent's switch-in takes the AI's attack
+  SearchAction exchange[2] = {{SearchAction::Type::MOVE, 0}, {SearchAction::Type::SWITCH, 1}};
+  context.makeTurn(state, exchange, false, undo);
+  EXPECT_EQ(state.active[SearchState::kOpponentSide], 1);
+  EXPECT_EQ(state.combatants[defender].hp, 1);
+  EXPECT_LT(state.combatants[SearchState::combatantIndex(SearchState::kOpponentSide, 1)].hp,
+            before.combatants[SearchState::combatantIndex(SearchState::kOpponentSide, 1)].hp);
+  SearchContext::unmakeTurn(state, undo);
+  EXPECT_EQ(std::memcmp(&state, &before, sizeof(state)), 0);
+}
+
+// At depth 1 the root value is the equilibrium of the matrix of evaluated
+// turn outcomes
+TEST_F(SimultaneousSearchTest, DepthOneMatchesSolvedPayoffMatrix) {
+  ExpertAI expertAI;
+  ExpertAI::SimultaneousSearchResult result = expertAI.simultaneousSearch(battleState, 1);
+
+  ASSERT_EQ(result.ai_actions.size(), result.ai_strategy.size());
+  ASSERT_EQ(result.opponent_actions.size(), result.opponent_strategy.size());
+  EXPECT_NEAR(std::accumulate(result.ai_strategy.begin(), result.ai_strategy.end(), 0.0), 1.0, 1e-9);
+  EXPECT_NEAR(std::accumulate(result.opponent_strategy.begin(), result.opponent_strategy.end(), 0.0),
+              1.0, 1e-9);
+
+  SearchContext context(battleState);
+  SearchState state = context.root();
+  MatrixGame game;
+  game.rows = static_cast<int>(result.ai_actions.size());
+  game.cols = static_cast<int>(result.opponent_actions.size());
+  for (int i = 0; i < game.rows; ++i) {
+    for (int j = 0; j < game.cols; ++j) {
+      SearchAction turn[2] = {SearchAction::decode(result.ai_actions[i]),
+                              SearchAction::decode(result.opponent_actions[j])};
+      int order = turn[0].type == SearchAction::Type::MOVE && turn[1].type == SearchAction::Type::MOVE
+                      ? context.turnOrder(state, turn[0].index, turn[1].index)
+                      : 1;
+      ASSERT_NE(order, 0);
+      SearchTurnUndo undo;
+      context.makeTurn(state, turn, order > 0, undo);
+      game.payoff[i][j] = expertAI.evaluateSearchState(context, state);
+      SearchContext::unmakeTurn(state, undo);
+    }
+  }
+  EXPECT_NEAR(result.value, MatrixGameSolver::solve(game).value, 1e-6);
+
+  auto stats = expertAI.getSearchStatistics();
+  EXPECT_EQ(stats.matrix_games_solved, 1);
+  EXPECT_EQ(stats.completed_depth, 1);
+  EXPECT_EQ(stats.worker_threads, 1);
+}
+
+TEST_F(SimultaneousSearchTest, DeeperSearchDrivesChooseBestMove) {
+  ExpertAI expertAI;
+  expertAI.simultaneousSearch(battleState, 1);
+  int shallow_games = expertAI.getSearchStatistics().matrix_games_solved;
+
+  expertAI.setSimultaneousSearchDepth(2);
+  MoveEvaluation move = expertAI.chooseBestMove(battleState);
+  auto stats = expertAI.getSearchStatistics();
+  EXPECT_GT(stats.matrix_games_solved, shallow_games);
+  EXPECT_EQ(stats.completed_depth, 2);
+  ASSERT_GE(move.moveIndex, 0);
+  EXPECT_LT(move.moveIndex, 2);
+  EXPECT_NE(move.reasoning.find("Simultaneous"), std::string::npos);
+}
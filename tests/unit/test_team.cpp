@@ -304,7 +304,7 @@ TEST_F(TeamTest, TeamWithPokemonMoves) {
         
         // Check that moves are properly loaded
         for (const auto& move : pokemon->moves) {
-            EXPECT_FALSE(move.name.empty());
+            EXPECT_FALSE(move.def().name.empty());
             EXPECT_TRUE(move.canUse());
         }
     }
@@ -190,6 +190,71 @@ TEST_F(TeamBuilderPhase4Test, TeamComparison) {
     EXPECT_FALSE(comparison.battle_prediction_reasoning.empty());
 }
 
+// Test simulation-backed battle prediction
+TEST_F(TeamBuilderPhase4Test, SimulatedBattleOutcome) {
+    auto team1 = team_builder->createTeam("Sim Alpha");
+    auto team2 = team_builder->createTeam("Sim Beta");
+    ASSERT_TRUE(team_builder->addPokemonToTeam(team1, "testmona", {"testmove"}));
+    ASSERT_TRUE(team_builder->addPokemonToTeam(team2, "testmonb", {"testmove"}));
+    
+    TeamBuilder::SimulationSettings settings;
+    settings.max_battles = 40;
+    settings.target_half_width = 0.0;  // Play the full sample budget
+    settings.worker_threads = 2;
+    settings.seed = 7;
+    settings.ai_difficulty = AIDifficulty::EASY;
+    
+    auto result = team_builder->simulateBattleOutcome(team1, team2, settings);
+    
+    EXPECT_EQ(result.battles_played, 40);
+    EXPECT_EQ(result.team1_wins + result.team2_wins + result.draws, result.battles_played);
+    EXPECT_FALSE(result.stopped_early);
+    EXPECT_GT(result.average_turns, 0.0);
+    EXPECT_LE(result.confidence_low, result.team1_win_probability);
+    EXPECT_GE(result.confidence_high, result.team1_win_probability);
+    EXPECT_GE(result.confidence_low, 0.0);
+    EXPECT_LE(result.confidence_high, 1.0);
+    
+    // A loose target is met as soon as early stopping is allowed
+    settings.max_battles = 200;
+    settings.min_battles = 10;
+    settings.target_half_width = 0.5;
+    auto early = team_builder->simulateBattleOutcome(team1, team2, settings);
+    EXPECT_TRUE(early.stopped_early);
+    EXPECT_GE(early.battles_played, 10);
+    EXPECT_LT(early.battles_played, 200);
+    
+    // Empty teams cannot be simulated
+    auto empty = team_builder->simulateBattleOutcome(team1, team_builder->createTeam("Empty"), settings);
+    EXPECT_EQ(empty.battles_played, 0);
+}
+
+// Test comparison and counter generation opting into simulation
+TEST_F(TeamBuilderPhase4Test, SimulationBudgetedAnalysis) {
+    auto team1 = team_builder->createTeam("Sim Alpha");
+    auto team2 = team_builder->createTeam("Sim Beta");
+    ASSERT_TRUE(team_builder->addPokemonToTeam(team1, "testmona", {"testmove"}));
+    ASSERT_TRUE(team_builder->addPokemonToTeam(team2, "testmonb", {"testmove"}));
+    
+    TeamBuilder::SimulationSettings settings;
+    settings.max_battles = 20;
+    settings.worker_threads = 1;
+    settings.ai_difficulty = AIDifficulty::EASY;
+    
+    auto comparison = team_builder->compareTeams(team1, team2, settings);
+    ASSERT_TRUE(comparison.simulation.has_value());
+    EXPECT_GT(comparison.simulation->battles_played, 0);
+    EXPECT_DOUBLE_EQ(comparison.team1_win_probability, comparison.simulation->team1_win_probability);
+    EXPECT_FALSE(comparison.battle_prediction_reasoning.empty());
+    
+    // The heuristic comparison leaves the simulation unset
+    EXPECT_FALSE(team_builder->compareTeams(team1, team2).simulation.has_value());
+    
+    auto counter = team_builder->generateCounterTeam(team2, "Sim Counter", 0.7, settings);
+    EXPECT_FALSE(counter.pokemon.empty());
+    EXPECT_LE(counter.pokemon.size(), 6u);
+}
+
 // Test tournament draft functionality
 TEST_F(TeamBuilderPhase4Test, TournamentDraftMode) {
     TeamBuilder::DraftSettings settings;
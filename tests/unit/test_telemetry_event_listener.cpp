@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#include "battle.h"
+#include "easy_ai.h"
+#include "telemetry_event_listener.h"
+#include "test_utils.h"
+
+using namespace Telemetry;
+
+class TelemetryEventListenerTest : public TestUtils::BattleTestFixture {
+ protected:
+  void SetUp() override {
+    TestUtils::BattleTestFixture::SetUp();
+    directory = std::filesystem::temp_directory_path() /
+                ("pokemon_telemetry_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                 "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    std::filesystem::remove_all(directory);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory); }
+
+  // Every block of a table file, concatenated
+  ColumnTable readTable(const std::string &name) const {
+    std::ifstream in(directory / (name + ".col"), std::ios::binary);
+    ColumnTable all;
+    ColumnTable block;
+    bool first = true;
+    while (block.readBlock(in)) {
+      if (first) {
+        all = block;
+        first = false;
+      } else {
+        all.append(block);
+      }
+    }
+    return all;
+  }
+
+  std::filesystem::path directory;
+};
+
+// Test that a column table survives a write and read
+TEST_F(TelemetryEventListenerTest, ColumnBlockRoundTrip) {
+  ColumnTable table("sample", {{"id", ColumnType::U32}, {"ratio", ColumnType::F32},
+                               {"name", ColumnType::UTF8}});
+  table.put<uint32_t>(0, 7);
+  table.put<float>(1, 0.5f);
+  table.putString(2, "thunderbolt");
+  table.endRow();
+  table.put<uint32_t>(0, 9);
+  table.put<float>(1, 2.0f);
+  table.putString(2, "");
+  table.endRow();
+
+  std::filesystem::create_directories(directory);
+  auto path = directory / "sample.col";
+  std::FILE *file = std::fopen(path.string().c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  table.writeBlock(file);
+  table.writeBlock(file);
+  std::fclose(file);
+
+  std::ifstream in(path, std::ios::binary);
+  ColumnTable read;
+  for (int block = 0; block < 2; ++block) {
+    ASSERT_TRUE(read.readBlock(in));
+    ASSERT_EQ(read.rows(), 2u);
+    EXPECT_EQ(read.get<uint32_t>(0, 1), 9u);
+    EXPECT_FLOAT_EQ(read.get<float>(1, 0), 0.5f);
+    EXPECT_EQ(read.getString(2, 0), "thunderbolt");
+    EXPECT_EQ(read.getString(2, 1), "");
+  }
+  EXPECT_FALSE(read.readBlock(in));
+}
+
+// Test that headless battles produce consistent move, health and battle tables
+TEST_F(TelemetryEventListenerTest, RecordsHeadlessBattles) {
+  constexpr int kBattles = 5;
+  {
+    auto writer = std::make_shared<TelemetryWriter>(directory.string());
+    ASSERT_TRUE(writer->isOpen());
+    auto listener = std::make_shared<TelemetryEventListener>(writer, 16);
+    EasyAI playerAI;
+    EasyAI opponentAI;
+    for (int i = 0; i < kBattles; ++i) {
+      Battle battle(playerTeam, opponentTeam);
+      battle.seedRandom(100 + i);
+      battle.getEventManager().subscribe(listener);
+      battle.runHeadless(playerAI, opponentAI);
+    }
+  }
+
+  ColumnTable battles = readTable("battles");
+  ASSERT_EQ(battles.rows(), static_cast<size_t>(kBattles));
+  for (size_t row = 0; row < battles.rows(); ++row) {
+    EXPECT_EQ(battles.get<uint32_t>(0, row), row);
+    EXPECT_GT(battles.get<uint32_t>(2, row), 0u);
+  }
+
+  ColumnTable moves = readTable("moves");
+  ASSERT_GT(moves.rows(), 0u);
+  ASSERT_NE(moves.find("effectiveness"), nullptr);
+
+  ColumnTable dictionary = readTable("dictionary");
+  std::set<std::pair<uint8_t, uint32_t>> defined;
+  for (size_t row = 0; row < dictionary.rows(); ++row) {
+    defined.insert({dictionary.get<uint8_t>(0, row), dictionary.get<uint32_t>(1, row)});
+  }
+  for (size_t row = 0; row < moves.rows(); ++row) {
+    EXPECT_LT(moves.get<uint32_t>(0, row), static_cast<uint32_t>(kBattles));
+    EXPECT_TRUE(defined.count({0, moves.get<uint32_t>(2, row)}));
+    EXPECT_TRUE(defined.count({1, moves.get<uint32_t>(3, row)}));
+  }
+
+  // Every hit that landed shows up as damage
+  ColumnTable health = readTable("health");
+  int damage = 0;
+  for (size_t row = 0; row < health.rows(); ++row) {
+    damage += health.get<int32_t>(5, row);
+  }
+  EXPECT_GT(damage, 0);
+}
+
+// Test that a second writer into the same directory carries on numbering
+TEST_F(TelemetryEventListenerTest, SuccessiveWritersShareDirectory) {
+  constexpr int kBattlesPerWriter = 3;
+  for (int run = 0; run < 2; ++run) {
+    auto writer = std::make_shared<TelemetryWriter>(directory.string());
+    ASSERT_TRUE(writer->isOpen());
+    auto listener = std::make_shared<TelemetryEventListener>(writer);
+    EasyAI playerAI;
+    EasyAI opponentAI;
+    for (int i = 0; i < kBattlesPerWriter; ++i) {
+      Battle battle(playerTeam, opponentTeam);
+      battle.seedRandom(200 + run * kBattlesPerWriter + i);
+      battle.getEventManager().subscribe(listener);
+      battle.runHeadless(playerAI, opponentAI);
+    }
+  }
+
+  ColumnTable battles = readTable("battles");
+  ASSERT_EQ(battles.rows(), static_cast<size_t>(2 * kBattlesPerWriter));
+  for (size_t row = 0; row < battles.rows(); ++row) {
+    EXPECT_EQ(battles.get<uint32_t>(0, row), row);
+  }
+
+  // Each ID names one thing, and each name has one ID
+  ColumnTable dictionary = readTable("dictionary");
+  std::set<std::pair<uint8_t, uint32_t>> ids;
+  std::set<std::pair<uint8_t, std::string>> names;
+  for (size_t row = 0; row < dictionary.rows(); ++row) {
+    uint8_t kind = dictionary.get<uint8_t>(0, row);
+    EXPECT_TRUE(ids.insert({kind, dictionary.get<uint32_t>(1, row)}).second);
+    EXPECT_TRUE(names.insert({kind, dictionary.getString(2, row)}).second);
+  }
+
+  ColumnTable moves = readTable("moves");
+  ASSERT_GT(moves.rows(), 0u);
+  for (size_t row = 0; row < moves.rows(); ++row) {
+    EXPECT_TRUE(ids.count({0, moves.get<uint32_t>(2, row)}));
+    EXPECT_TRUE(ids.count({1, moves.get<uint32_t>(3, row)}));
+  }
+}
+
+// Test that a torn block left by a crashed writer doesn't hide later blocks
+TEST_F(TelemetryEventListenerTest, NewWriterDropsTornBlock) {
+  {
+    TelemetryWriter writer(directory.string());
+    writer.speciesId("pikachu");
+  }
+  {
+    std::ofstream torn(directory / "dictionary.col", std::ios::binary | std::ios::app);
+    torn << "PKCB";
+  }
+  {
+    TelemetryWriter writer(directory.string());
+    EXPECT_EQ(writer.speciesId("pikachu"), 0u);
+    EXPECT_EQ(writer.speciesId("onix"), 1u);
+  }
+
+  ColumnTable dictionary = readTable("dictionary");
+  ASSERT_EQ(dictionary.rows(), 2u);
+  EXPECT_EQ(dictionary.getString(2, 1), "onix");
+}
+
+// Test that a header claiming more rows than the file holds is rejected up front
+TEST_F(TelemetryEventListenerTest, RejectsOversizedBlockHeader) {
+  const uint32_t rows = 1u << 30;
+  const uint64_t bytes = uint64_t{rows} * sizeof(uint32_t);
+  std::string block = "PKCB";
+  block += '\x01';
+  block.append(reinterpret_cast<const char *>(&rows), sizeof(rows));
+  block += '\x01';
+  block += '\x02';
+  block += "id";
+  block += static_cast<char>(ColumnType::U32);
+  block.append(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+
+  std::istringstream in(block);
+  ColumnTable read;
+  EXPECT_FALSE(read.readBlock(in));
+  EXPECT_EQ(read.rows(), 0u);
+}
+
+// Test that failed writes are reported instead of counted as written
+TEST_F(TelemetryEventListenerTest, ReportsFailedWrites) {
+  if (!std::filesystem::exists("/dev/full")) {
+    GTEST_SKIP() << "needs /dev/full";
+  }
+  std::filesystem::create_directories(directory);
+  std::filesystem::create_symlink("/dev/full", directory / "battles.col");
+
+  TelemetryWriter writer(directory.string());
+  ASSERT_TRUE(writer.isOpen());
+  auto batch = TelemetryWriter::makeTables();
+  ColumnTable &battles = batch.back();
+  battles.put<uint32_t>(0, writer.nextBattleId());
+  battles.put<uint8_t>(1, 1);
+  battles.put<uint32_t>(2, 12);
+  battles.endRow();
+  writer.append(batch);
+  writer.flush();
+
+  EXPECT_TRUE(writer.writeFailed());
+  EXPECT_EQ(writer.rowsWritten(), 0u);
+
+  // The failed table's later rows are dropped, not written after a torn block
+  writer.append(batch);
+  writer.flush();
+  EXPECT_EQ(writer.rowsWritten(), 0u);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "expert_ai.h"
+#include "test_utils.h"
+#include "transposition_table.h"
+
+class TranspositionTableTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    aiTeam = TestUtils::createTestTeam({
+        TestUtils::createTestPokemon("lead", 100, 80, 70, 90, 85, 75, {"fire"}),
+        TestUtils::createTestPokemon("second", 90, 70, 80, 70, 80, 60, {"water"}),
+        TestUtils::createTestPokemon("third", 80, 90, 60, 60, 70, 95, {"electric"})});
+    opponentTeam = TestUtils::createTestTeam({
+        TestUtils::createTestPokemon("foe", 100, 80, 70, 90, 85, 70, {"grass"}),
+        TestUtils::createTestPokemon("foe_backup", 110, 75, 85, 65, 80, 55, {"rock"})});
+
+    battleState = {aiTeam.getPokemon(0), opponentTeam.getPokemon(0), &aiTeam,
+                   &opponentTeam,        WeatherCondition::NONE,      0,
+                   1};
+  }
+
+  Team aiTeam;
+  Team opponentTeam;
+  BattleState battleState;
+};
+
+// Hashes are stable and sensitive to every tracked feature
+TEST_F(TranspositionTableTest, ZobristHashTracksPositionFeatures) {
+  SearchContext context(battleState);
+  SearchState state = context.root();
+  uint64_t base = ZobristHasher::hash(context, state, true);
+
+  EXPECT_EQ(base, ZobristHasher::hash(context, state, true));
+  EXPECT_NE(base, ZobristHasher::hash(context, state, false));
+
+  SearchState switched = state;
+  switched.active[SearchState::kAISide] = 1;
+  EXPECT_NE(base, ZobristHasher::hash(context, switched, true));
+
+  SearchState statused = state;
+  statused.combatants[0].status = static_cast<uint8_t>(StatusCondition::BURN);
+  EXPECT_NE(base, ZobristHasher::hash(context, statused, true));
+
+  SearchState boosted = state;
+  boosted.combatants[0].stages[0] = 2;
+  EXPECT_NE(base, ZobristHasher::hash(context, boosted, true));
+
+  SearchState spent = state;
+  spent.combatants[0].pp[0]--;
+  EXPECT_NE(base, ZobristHasher::hash(context, spent, true));
+
+  SearchState rainy = state;
+  rainy.weather = static_cast<uint8_t>(WeatherCondition::RAIN);
+  EXPECT_NE(base, ZobristHasher::hash(context, rainy, true));
+
+  // HP is bucketed: a 1 HP scratch keeps the key, a big hit changes it
+  SearchState wounded = state;
+  wounded.combatants[0].hp = 55;
+  uint64_t wounded_key = ZobristHasher::hash(context, wounded, true);
+  EXPECT_NE(base, wounded_key);
+  SearchState scratched = wounded;
+  scratched.combatants[0].hp = 54;
+  EXPECT_EQ(wounded_key, ZobristHasher::hash(context, scratched, true));
+  SearchState fainted = state;
+  fainted.combatants[0].hp = 0;
+  EXPECT_NE(base, ZobristHasher::hash(context, fainted, true));
+}
+
+// Transpositions: the same switches in either order reach the same key
+TEST_F(TranspositionTableTest, MoveOrderTranspositionsShareKey) {
+  SearchContext context(battleState);
+  SearchState a = context.root();
+  SearchState b = context.root();
+  SearchUndo undo;
+
+  context.make(a, SearchState::kAISide, {SearchAction::Type::SWITCH, 1}, undo);
+  context.make(a, SearchState::kAISide, {SearchAction::Type::SWITCH, 2}, undo);
+  context.make(b, SearchState::kAISide, {SearchAction::Type::SWITCH, 2}, undo);
+
+  EXPECT_EQ(ZobristHasher::hash(context, a, true), ZobristHasher::hash(context, b, true));
+}
+
+// Store/probe round trip and hit/miss/collision accounting
+TEST_F(TranspositionTableTest, ProbeCountsHitsMissesAndCollisions) {
+  TranspositionTable table(16);
+  EXPECT_EQ(table.capacity(), 16u);
+
+  TranspositionTable::Entry entry;
+  EXPECT_FALSE(table.probe(0x1234, entry));
+  EXPECT_EQ(table.misses(), 1u);
+
+  table.store(0x1234, {42.5, 3, TranspositionTable::Bound::EXACT, -2});
+  ASSERT_TRUE(table.probe(0x1234, entry));
+  EXPECT_DOUBLE_EQ(entry.score, 42.5);
+  EXPECT_EQ(entry.depth, 3);
+  EXPECT_EQ(entry.bound, TranspositionTable::Bound::EXACT);
+  EXPECT_EQ(entry.best_move, -2);
+  EXPECT_EQ(table.hits(), 1u);
+
+  // Same slot (low bits), different key
+  EXPECT_FALSE(table.probe(0x1234 + 16 * 7, entry));
+  EXPECT_EQ(table.collisions(), 1u);
+
+  // A shallower result doesn't evict a deeper one from the same search
+  table.store(0x1234 + 16 * 7, {1.0, 1, TranspositionTable::Bound::LOWER, 0});
+  ASSERT_TRUE(table.probe(0x1234, entry));
+  EXPECT_EQ(entry.depth, 3);
+
+  // ...but entries from an earlier search are replaceable
+  table.newSearch();
+  table.store(0x1234 + 16 * 7, {1.0, 1, TranspositionTable::Bound::LOWER, 0});
+  ASSERT_TRUE(table.probe(0x1234 + 16 * 7, entry));
+  EXPECT_EQ(entry.bound, TranspositionTable::Bound::LOWER);
+
+  table.resetCounters();
+  EXPECT_EQ(table.hits() + table.misses() + table.collisions(), 0u);
+}
+
+// The search reports table activity and benefits from it on repeat searches
+TEST_F(TranspositionTableTest, ExpertAISearchUsesTable) {
+  ExpertAI expertAI;
+  std::vector<int> first_line;
+  double first = expertAI.miniMaxSearch(battleState, 4, -1000.0, 1000.0, true, first_line);
+  auto first_stats = expertAI.getSearchStatistics();
+
+  EXPECT_GT(first_stats.nodes_evaluated, 0);
+  EXPECT_GT(first_stats.tt_hits + first_stats.tt_misses + first_stats.tt_collisions, 0u);
+  EXPECT_EQ(first_stats.principal_variation, first_line);
+
+  // A second search of the same position is served largely from the table
+  std::vector<int> second_line;
+  double second = expertAI.miniMaxSearch(battleState, 4, -1000.0, 1000.0, true, second_line);
+  auto second_stats = expertAI.getSearchStatistics();
+
+  EXPECT_GT(second_stats.tt_hits, 0u);
+  EXPECT_LE(second_stats.nodes_evaluated, first_stats.nodes_evaluated);
+  EXPECT_NEAR(second, first, 1e-3);
+  ASSERT_FALSE(second_line.empty());
+  EXPECT_EQ(second_line.front(), first_line.front());
+}
@@ -133,6 +133,30 @@ TEST_F(TypeEffectivenessTest, DualTypeEffectiveness) {
     
     // No effect vs one type (2.0 * 0.0 = 0.0)
     EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier("electric", {"water", "ground"}), 0.0);
+    
+    // A type listed twice applies twice (0.5 * 0.5 = 0.25)
+    EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier("fire", {"fire", "fire"}), 0.25);
+    EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier(
+        PokemonType::FIRE, PokemonTypes{"fire", "fire"}), 0.25);
+}
+
+// Test that Pokemon types keep their names and parsed enums in step
+TEST_F(TypeEffectivenessTest, PokemonTypesParseOnAssignment) {
+    PokemonTypes types = std::vector<std::string>{"water", "flying"};
+    EXPECT_EQ(types.primary(), PokemonType::WATER);
+    EXPECT_EQ(types.secondary(), PokemonType::FLYING);
+    EXPECT_TRUE(types.contains(PokemonType::FLYING));
+    EXPECT_FALSE(types.contains(PokemonType::NONE));
+
+    types = {"shadow"};
+    EXPECT_EQ(types.size(), 1u);
+    EXPECT_EQ(types[0], "shadow");
+    EXPECT_EQ(types.primary(), PokemonType::NONE);
+
+    types.clear();
+    types.emplace_back("grass");
+    EXPECT_EQ(types.ids(), std::vector<PokemonType>{PokemonType::GRASS});
+    EXPECT_EQ(types, PokemonTypes{"grass"});
 }
 
 // Test ice type effectiveness
@@ -279,4 +303,56 @@ TEST_F(TypeEffectivenessTest, PokemonTypeScenarios) {
     
     // Magnezone (Electric/Steel) vs Ground
     EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier("ground", {"electric", "steel"}), 2.0);
-}
\ No newline at end of file
+}
+
+// Type names round-trip through the enum; anything else is NONE
+TEST_F(TypeEffectivenessTest, TypeNameParsing) {
+    auto names = TypeEffectiveness::getAllTypes();
+    ASSERT_EQ(names.size(), static_cast<size_t>(kPokemonTypeCount));
+    for (int i = 0; i < kPokemonTypeCount; ++i) {
+        auto type = static_cast<PokemonType>(i);
+        EXPECT_EQ(names[i], pokemonTypeName(type));
+        EXPECT_EQ(parsePokemonType(names[i]), type);
+    }
+    EXPECT_EQ(parsePokemonType("Fire"), PokemonType::NONE);
+    EXPECT_EQ(parsePokemonType("fir"), PokemonType::NONE);
+    EXPECT_EQ(parsePokemonType(""), PokemonType::NONE);
+    EXPECT_STREQ(pokemonTypeName(PokemonType::NONE), "");
+}
+
+// The precomputed dual-type table agrees with the per-type chart everywhere
+TEST_F(TypeEffectivenessTest, DualTypeTableMatchesChart) {
+    for (int attacking = 0; attacking < kPokemonTypeCount; ++attacking) {
+        auto attack = static_cast<PokemonType>(attacking);
+        for (int first = 0; first < kPokemonTypeCount; ++first) {
+            auto a = static_cast<PokemonType>(first);
+            double single = TypeEffectiveness::getMultiplier(TypeEffectiveness::getEffectiveness(attack, a));
+            EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier(attack, a), single);
+            for (int second = first + 1; second < kPokemonTypeCount; ++second) {
+                auto b = static_cast<PokemonType>(second);
+                double expected = single *
+                    TypeEffectiveness::getMultiplier(TypeEffectiveness::getEffectiveness(attack, b));
+                EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier(attack, a, b), expected);
+                EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier(attack, b, a), expected);
+                EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier(
+                    pokemonTypeName(attack), {pokemonTypeName(a), pokemonTypeName(b)}), expected);
+            }
+        }
+    }
+
+    // Every defender combination has its own column
+    std::vector<bool> seen(TypeEffectiveness::kDefenderCount, false);
+    for (int first = 0; first < kPokemonTypeCount; ++first) {
+        for (int second = first; second < kPokemonTypeCount; ++second) {
+            int index = TypeEffectiveness::defenderIndex(static_cast<PokemonType>(first),
+                                                         static_cast<PokemonType>(second));
+            ASSERT_GE(index, 0);
+            ASSERT_LT(index, TypeEffectiveness::kDefenderCount);
+            EXPECT_FALSE(seen[index]);
+            seen[index] = true;
+        }
+    }
+    EXPECT_EQ(TypeEffectiveness::defenderIndex(PokemonType::NONE, PokemonType::NONE), -1);
+    EXPECT_DOUBLE_EQ(TypeEffectiveness::getEffectivenessMultiplier(
+        PokemonType::NONE, PokemonType::GHOST), 1.0);
+}
@@ -43,49 +43,48 @@ Pokemon createTestPokemon(const std::string& name, int hp, int attack, int defen
 Move createTestMove(const std::string& name, int power, int accuracy, int pp,
                    const std::string& type, const std::string& damageClass,
                    StatusCondition ailment, int ailmentChance) {
-    Move move;
-    move.name = name;
-    move.power = power;
-    move.accuracy = accuracy;
-    move.effect_chance = 0; // Add required effect_chance field
-    move.pp = pp;
-    move.current_pp = pp;
-    move.type = type;
-    move.damage_class = damageClass;
-    move.priority = 0;
-    move.crit_rate = 0;
-    move.drain = 0;
-    move.healing = 0;
-    move.flinch_chance = 0;
-    move.stat_chance = 0;
-    move.ailment_chance = ailmentChance;
-    move.min_hits = 0;
-    move.max_hits = 0;
-    move.category = (power > 0) ? "damage" : "ailment";
+    MoveDef def;
+    def.name = name;
+    def.power = power;
+    def.accuracy = accuracy;
+    def.effect_chance = 0; // Add required effect_chance field
+    def.pp = pp;
+    def.type = type;
+    parseDamageClass(damageClass, def.damage_class);
+    def.priority = 0;
+    def.crit_rate = 0;
+    def.drain = 0;
+    def.healing = 0;
+    def.flinch_chance = 0;
+    def.stat_chance = 0;
+    def.ailment_chance = ailmentChance;
+    def.min_hits = 0;
+    def.max_hits = 0;
+    def.category = (power > 0) ? "damage" : "ailment";
     
     // Set ailment based on status condition
     switch (ailment) {
         case StatusCondition::POISON:
-            move.ailment_name = "poison";
+            def.ailment_name = "poison";
             break;
         case StatusCondition::BURN:
-            move.ailment_name = "burn";
+            def.ailment_name = "burn";
             break;
         case StatusCondition::PARALYSIS:
-            move.ailment_name = "paralysis";
+            def.ailment_name = "paralysis";
             break;
         case StatusCondition::SLEEP:
-            move.ailment_name = "sleep";
+            def.ailment_name = "sleep";
             break;
         case StatusCondition::FREEZE:
-            move.ailment_name = "freeze";
+            def.ailment_name = "freeze";
             break;
         default:
-            move.ailment_name = "none";
+            def.ailment_name = "none";
             break;
     }
     
-    return move;
+    return Move(def);
 }
 
 Team createTestTeam(const std::vector<Pokemon>& pokemon) {